@@ -68,3 +68,13 @@ if( MSVC )
     set(CMAKE_CXX_FLAGS_DEBUG   "${CMAKE_CXX_FLAGS_DEBUG} /W4 /wd4267 /wd4244 /wd4100 /WX")
     set(CMAKE_CXX_FLAGS         "${CMAKE_CXX_FLAGS} /W4 /wd4267 /wd4244 /wd4100 /WX" )
 endif( MSVC )
+
+option(USE_NATIVE_ARCH OFF)
+if( USE_NATIVE_ARCH )
+    message( STATUS "Enable instructions of the host processor" )
+    if( MSVC )
+        add_compile_options(/arch:AVX2)
+    else()
+        add_compile_options(-march=native)
+    endif( MSVC )
+endif( USE_NATIVE_ARCH )
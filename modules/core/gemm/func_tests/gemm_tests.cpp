@@ -0,0 +1,89 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include "core/gemm/include/gemm.hpp"
+
+namespace {
+
+using ppc::core::gemm::Kernel;
+
+std::vector<double> RandomMatrix(size_t size, std::mt19937 &gen) {
+  std::uniform_real_distribution<double> value(-1.0, 1.0);
+  std::vector<double> m(size);
+  for (auto &x : m) {
+    x = value(gen);
+  }
+  return m;
+}
+
+// C += A * B on submatrices with leading dimensions larger than their widths
+void CheckGemm(Kernel kernel, size_t m, size_t n, size_t k) {
+  std::mt19937 gen(static_cast<unsigned>((m * 131) + (n * 17) + k));
+  const size_t lda = k + 3;
+  const size_t ldb = n + 1;
+  const size_t ldc = n + 5;
+  const auto a = RandomMatrix(m * lda, gen);
+  const auto b = RandomMatrix(k * ldb, gen);
+  auto c = RandomMatrix(m * ldc, gen);
+  auto expected = c;
+  for (size_t i = 0; i < m; i++) {
+    for (size_t j = 0; j < n; j++) {
+      double sum = 0.0;
+      for (size_t p = 0; p < k; p++) {
+        sum += a[(i * lda) + p] * b[(p * ldb) + j];
+      }
+      expected[(i * ldc) + j] += sum;
+    }
+  }
+  ppc::core::gemm::Gemm(kernel, m, n, k, a.data(), lda, b.data(), ldb, c.data(), ldc);
+  for (size_t i = 0; i < c.size(); i++) {
+    // padding columns of C stay untouched
+    ASSERT_NEAR(c[i], expected[i], 1e-12 * static_cast<double>(k + 1)) << "m=" << m << " n=" << n << " k=" << k;
+  }
+}
+
+void CheckKernel(Kernel kernel) {
+  if (!ppc::core::gemm::IsSupported(kernel)) {
+    GTEST_SKIP() << "the processor does not support the kernel";
+  }
+  // shapes below one register tile, with edge tiles, and over the cache blocks of every dimension
+  for (const size_t m : {1, 5, 8, 17, 100}) {
+    for (const size_t n : {1, 7, 16, 33}) {
+      for (const size_t k : {1, 6, 300}) {
+        CheckGemm(kernel, m, n, k);
+      }
+    }
+  }
+  CheckGemm(kernel, 3, 2100, 5);
+  CheckGemm(kernel, 0, 4, 4);
+}
+
+}  // namespace
+
+TEST(gemm_tests, check_generic_kernel) { CheckKernel(Kernel::kGeneric); }
+
+TEST(gemm_tests, check_avx2_kernel) { CheckKernel(Kernel::kAvx2); }
+
+TEST(gemm_tests, check_avx512_kernel) { CheckKernel(Kernel::kAvx512); }
+
+TEST(gemm_tests, check_default_kernel_is_supported) {
+  EXPECT_TRUE(ppc::core::gemm::IsSupported(Kernel::kGeneric));
+  EXPECT_TRUE(ppc::core::gemm::IsSupported(ppc::core::gemm::DefaultKernel()));
+}
+
+TEST(gemm_tests, check_multiply_overwrites_and_validates_sizes) {
+  const std::vector<double> a = {1.0, 2.0, 3.0, 4.0, 5.0, 6.0};
+  const std::vector<double> b = {1.0, 0.0, 0.0, 1.0, 1.0, 1.0};
+  std::vector<double> c(4, 7.0);
+  ppc::core::gemm::Multiply(a, b, c, 2, 3, 2);
+  EXPECT_EQ(c, (std::vector<double>{4.0, 5.0, 10.0, 11.0}));
+
+  std::vector<double> wrong(3);
+  EXPECT_THROW(ppc::core::gemm::Multiply(a, b, wrong, 2, 3, 2), std::invalid_argument);
+  EXPECT_THROW(ppc::core::gemm::Multiply(a, b, c, 3, 3, 2), std::invalid_argument);
+}
@@ -0,0 +1,119 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <random>
+#include <span>
+#include <vector>
+
+#include "core/gemm/include/gemm.hpp"
+#include "core/gemm/include/strassen.hpp"
+#include "core/thread_pool/include/thread_pool.hpp"
+#include "core/util/include/util.hpp"
+
+namespace {
+
+using ppc::core::gemm::ParallelInvoke;
+using ppc::core::gemm::StrassenPlan;
+
+std::vector<double> RandomMatrix(size_t size, std::mt19937 &gen) {
+  std::uniform_real_distribution<double> value(-1.0, 1.0);
+  std::vector<double> m(size);
+  for (auto &x : m) {
+    x = value(gen);
+  }
+  return m;
+}
+
+// c = a * b by the plan on matrices with leading dimensions larger than n, compared with Gemm
+void CheckPlan(size_t n, size_t cutoff, size_t parallel_levels, const ParallelInvoke &invoke = {}) {
+  std::mt19937 gen(static_cast<unsigned>((n * 31) + cutoff));
+  const size_t lda = n + 2;
+  const size_t ldb = n + 3;
+  const size_t ldc = n + 1;
+  const auto a = RandomMatrix(n * lda, gen);
+  const auto b = RandomMatrix(n * ldb, gen);
+  auto c = RandomMatrix(n * ldc, gen);
+  auto expected = c;
+  for (size_t i = 0; i < n; i++) {
+    std::fill_n(expected.begin() + static_cast<std::ptrdiff_t>(i * ldc), n, 0.0);
+  }
+  ppc::core::gemm::Gemm(n, n, n, a.data(), lda, b.data(), ldb, expected.data(), ldc);
+
+  StrassenPlan plan(n, cutoff, parallel_levels);
+  ASSERT_EQ(plan.Size(), n);
+  // the plan is reusable: the second product overwrites the first one
+  for (int run = 0; run < 2; run++) {
+    plan.Multiply(a.data(), lda, b.data(), ldb, c.data(), ldc, invoke);
+    for (size_t i = 0; i < c.size(); i++) {
+      // every level adds a few roundings of sums of the operands
+      ASSERT_NEAR(c[i], expected[i], 1e-11 * static_cast<double>(n + 1)) << "n=" << n << " cutoff=" << cutoff;
+    }
+  }
+}
+
+}  // namespace
+
+TEST(strassen_tests, check_levels_and_padding) {
+  EXPECT_EQ(StrassenPlan(64, 64).Levels(), 0U);
+  EXPECT_EQ(StrassenPlan(65, 64).Levels(), 1U);
+  EXPECT_EQ(StrassenPlan(1000, 128).Levels(), 3U);
+  EXPECT_EQ(StrassenPlan(0, 16).Levels(), 0U);
+}
+
+TEST(strassen_tests, check_sequential_levels) {
+  for (const size_t n : {1, 7, 16, 17, 64, 100, 129}) {
+    CheckPlan(n, 8, 0);
+  }
+}
+
+TEST(strassen_tests, check_parallel_levels_without_invoke) {
+  for (const size_t n : {9, 33, 100}) {
+    CheckPlan(n, 8, 1);
+    CheckPlan(n, 8, 2);
+  }
+}
+
+TEST(strassen_tests, check_parallel_levels_on_thread_pool) {
+  ppc::core::ThreadPool pool(3);
+  const ParallelInvoke invoke = [&pool](std::span<const std::function<void()>> tasks) {
+    ppc::core::TaskGroup group(pool);
+    for (const auto &task : tasks) {
+      group.Run(task);
+    }
+    group.Wait();
+  };
+  for (const size_t n : {16, 50, 127}) {
+    CheckPlan(n, 16, 2, invoke);
+  }
+}
+
+TEST(strassen_tests, check_gemm_rows_on_thread_pool) {
+  ppc::core::ThreadPool pool(3);
+  size_t invoked_tasks = 0;
+  const ParallelInvoke invoke = [&](std::span<const std::function<void()>> tasks) {
+    invoked_tasks += tasks.size();
+    ppc::core::TaskGroup group(pool);
+    for (const auto &task : tasks) {
+      group.Run(task);
+    }
+    group.Wait();
+  };
+  // a plan without levels still runs its Gemm through invoke, by blocks of at least 32 rows
+  for (const size_t n : {1, 31, 100, 256}) {
+    invoked_tasks = 0;
+    CheckPlan(n, 256, 1, invoke);
+    EXPECT_EQ(invoked_tasks, 2 * std::min(ppc::util::GetPPCNumChunks(), (n + 31) / 32)) << "n=" << n;
+  }
+}
+
+TEST(strassen_tests, check_calibrated_cutoff) {
+  if (!ppc::util::GetEnvVariable("PPC_STRASSEN_CUTOFF").empty()) {
+    GTEST_SKIP() << "PPC_STRASSEN_CUTOFF is set";
+  }
+  const size_t cutoff = ppc::core::gemm::StrassenCutoff();
+  EXPECT_TRUE(cutoff == 32 || cutoff == 64 || cutoff == 128 || cutoff == 256 || cutoff == 512) << cutoff;
+  // calibrated once per process
+  EXPECT_EQ(ppc::core::gemm::StrassenCutoff(), cutoff);
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace ppc::core::gemm {
+
+// Micro-kernels of Gemm: a portable one and x86-64 ones for AVX2 with FMA and for AVX-512
+enum class Kernel : uint8_t { kGeneric, kAvx2, kAvx512 };
+
+// true if the kernel is compiled in and supported by the processor and the operating system
+bool IsSupported(Kernel kernel);
+// kernel used by Gemm: the widest supported one, or the one named by PPC_GEMM_KERNEL (generic, avx2 or avx512)
+// if it is supported
+Kernel DefaultKernel();
+
+// C += A * B for row-major A (m x k), B (k x n) and C (m x n) with leading dimensions lda, ldb and ldc.
+// B and A are packed by panels which fit the caches and C is updated by register tiles of the micro-kernel.
+// The product runs in the calling thread: callers parallelize over blocks of C, each thread packs into its own
+// buffers, which are kept between calls.
+void Gemm(size_t m, size_t n, size_t k, const double *a, size_t lda, const double *b, size_t ldb, double *c,
+          size_t ldc);
+// Gemm with the given kernel, throws std::invalid_argument if it is not supported
+void Gemm(Kernel kernel, size_t m, size_t n, size_t k, const double *a, size_t lda, const double *b, size_t ldb,
+          double *c, size_t ldc);
+
+// c = a * b for contiguous row-major a (m x k) and b (k x n), throws std::invalid_argument on size mismatch
+void Multiply(std::span<const double> a, std::span<const double> b, std::span<double> c, size_t m, size_t k,
+              size_t n);
+
+}  // namespace ppc::core::gemm
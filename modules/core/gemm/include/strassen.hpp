@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <span>
+
+#include "core/util/include/aligned_allocator.hpp"
+
+namespace ppc::core::gemm {
+
+// Runs the tasks, possibly concurrently, and returns when all of them are finished
+using ParallelInvoke = std::function<void(std::span<const std::function<void()>> tasks)>;
+
+// Size of the products which Strassen-Winograd leaves to Gemm: PPC_STRASSEN_CUTOFF if it is set, otherwise
+// calibrated on the first call of the process. The calibration takes the smallest of 32, 64, 128 and 256 for
+// which one level over products of that size is 5% faster than Gemm on twice the size, or 512 if none is.
+// Both sides run a fixed number of times on fixed operands and their medians are compared, so a few slow
+// runs do not move the cutoff.
+size_t StrassenCutoff();
+
+// Strassen-Winograd product of n x n matrices. All temporaries live in one arena allocated by the constructor:
+// a level works on strided views of its operands and of the quarters of the result and keeps its sums and
+// products in its part of the arena. Matrices whose size does not halve down to the cutoff are padded
+// with zeros inside the arena.
+class StrassenPlan {
+ public:
+  // parallel_levels top levels compute their seven products as parallel tasks, with separate workspaces
+  explicit StrassenPlan(size_t n, size_t cutoff = StrassenCutoff(), size_t parallel_levels = 0);
+
+  [[nodiscard]] size_t Size() const { return n_; }
+  [[nodiscard]] size_t Levels() const { return levels_; }
+
+  // c = a * b for row-major n x n matrices with leading dimensions lda, ldb and ldc, c does not overlap a and b.
+  // Tasks of the parallel levels are run by invoke, or one after another if it is empty. A plan without levels
+  // gives invoke blocks of rows of its Gemm instead.
+  void Multiply(const double *a, size_t lda, const double *b, size_t ldb, double *c, size_t ldc,
+                const ParallelInvoke &invoke = {});
+
+ private:
+  [[nodiscard]] size_t WorkspaceSize(size_t m, size_t level) const;
+  void Recurse(size_t m, const double *a, size_t lda, const double *b, size_t ldb, double *c, size_t ldc,
+               double *ws, size_t level, const ParallelInvoke &invoke);
+  void SequentialLevel(size_t m, const double *a, size_t lda, const double *b, size_t ldb, double *c, size_t ldc,
+                       double *ws, size_t level, const ParallelInvoke &invoke);
+  void ParallelLevel(size_t m, const double *a, size_t lda, const double *b, size_t ldb, double *c, size_t ldc,
+                     double *ws, size_t level, const ParallelInvoke &invoke);
+
+  size_t n_;
+  size_t levels_ = 0;
+  size_t parallel_levels_;
+  size_t padded_;
+  ppc::util::AlignedVector<double> arena_;
+};
+
+}  // namespace ppc::core::gemm
@@ -0,0 +1,338 @@
+#include "core/gemm/include/gemm.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <string>
+
+#include "core/util/include/aligned_allocator.hpp"
+#include "core/util/include/cpu_features.hpp"
+#include "core/util/include/util.hpp"
+
+#ifdef PPC_X86_64
+#include <immintrin.h>
+#endif
+
+namespace {
+
+// c (mr x nr, leading dimension ldc) += a sliver (kc x mr, column by column) * b sliver (kc x nr, row by row)
+using MicroKernel = void (*)(size_t kc, const double *a, const double *b, double *c, size_t ldc);
+
+// Register tile mr x nr of the micro-kernel and cache blocks: the kc x nr sliver of B stays in L1 while the
+// micro-kernel runs over the mc x kc block of A in L2, and the kc x nc panel of B stays in L3
+struct Blocking {
+  size_t mr;
+  size_t nr;
+  size_t kc;
+  size_t mc;
+  size_t nc;
+  MicroKernel micro;
+};
+
+constexpr size_t kMaxTile = 8 * 16;
+
+template <size_t MR, size_t NR>
+void MicroGeneric(size_t kc, const double *a, const double *b, double *c, size_t ldc) {
+  double acc[MR][NR] = {};
+  for (size_t p = 0; p < kc; p++) {
+    for (size_t i = 0; i < MR; i++) {
+      for (size_t j = 0; j < NR; j++) {
+        acc[i][j] += a[i] * b[j];
+      }
+    }
+    a += MR;
+    b += NR;
+  }
+  for (size_t i = 0; i < MR; i++) {
+    for (size_t j = 0; j < NR; j++) {
+      c[(i * ldc) + j] += acc[i][j];
+    }
+  }
+}
+
+#ifdef PPC_X86_64
+
+PPC_TARGET("avx2,fma")
+inline void AddRowAvx2(double *c, __m256d lo, __m256d hi) {
+  _mm256_storeu_pd(c, _mm256_add_pd(_mm256_loadu_pd(c), lo));
+  _mm256_storeu_pd(c + 4, _mm256_add_pd(_mm256_loadu_pd(c + 4), hi));
+}
+
+// 6 x 8 tile: 12 accumulators, 2 rows of B and a broadcast of A fit 16 ymm registers. The accumulators are
+// separate variables, compilers keep arrays of vectors on the stack.
+PPC_TARGET("avx2,fma")
+void MicroAvx2(size_t kc, const double *a, const double *b, double *c, size_t ldc) {
+  __m256d c00 = _mm256_setzero_pd();
+  __m256d c01 = _mm256_setzero_pd();
+  __m256d c10 = _mm256_setzero_pd();
+  __m256d c11 = _mm256_setzero_pd();
+  __m256d c20 = _mm256_setzero_pd();
+  __m256d c21 = _mm256_setzero_pd();
+  __m256d c30 = _mm256_setzero_pd();
+  __m256d c31 = _mm256_setzero_pd();
+  __m256d c40 = _mm256_setzero_pd();
+  __m256d c41 = _mm256_setzero_pd();
+  __m256d c50 = _mm256_setzero_pd();
+  __m256d c51 = _mm256_setzero_pd();
+  for (size_t p = 0; p < kc; p++) {
+    const __m256d b0 = _mm256_load_pd(b);
+    const __m256d b1 = _mm256_load_pd(b + 4);
+    __m256d ai;
+    ai = _mm256_set1_pd(a[0]);
+    c00 = _mm256_fmadd_pd(ai, b0, c00);
+    c01 = _mm256_fmadd_pd(ai, b1, c01);
+    ai = _mm256_set1_pd(a[1]);
+    c10 = _mm256_fmadd_pd(ai, b0, c10);
+    c11 = _mm256_fmadd_pd(ai, b1, c11);
+    ai = _mm256_set1_pd(a[2]);
+    c20 = _mm256_fmadd_pd(ai, b0, c20);
+    c21 = _mm256_fmadd_pd(ai, b1, c21);
+    ai = _mm256_set1_pd(a[3]);
+    c30 = _mm256_fmadd_pd(ai, b0, c30);
+    c31 = _mm256_fmadd_pd(ai, b1, c31);
+    ai = _mm256_set1_pd(a[4]);
+    c40 = _mm256_fmadd_pd(ai, b0, c40);
+    c41 = _mm256_fmadd_pd(ai, b1, c41);
+    ai = _mm256_set1_pd(a[5]);
+    c50 = _mm256_fmadd_pd(ai, b0, c50);
+    c51 = _mm256_fmadd_pd(ai, b1, c51);
+    a += 6;
+    b += 8;
+  }
+  AddRowAvx2(c, c00, c01);
+  AddRowAvx2(c + ldc, c10, c11);
+  AddRowAvx2(c + (2 * ldc), c20, c21);
+  AddRowAvx2(c + (3 * ldc), c30, c31);
+  AddRowAvx2(c + (4 * ldc), c40, c41);
+  AddRowAvx2(c + (5 * ldc), c50, c51);
+}
+
+PPC_TARGET("avx512f")
+inline void AddRowAvx512(double *c, __m512d lo, __m512d hi) {
+  _mm512_storeu_pd(c, _mm512_add_pd(_mm512_loadu_pd(c), lo));
+  _mm512_storeu_pd(c + 8, _mm512_add_pd(_mm512_loadu_pd(c + 8), hi));
+}
+
+// 8 x 16 tile: 16 accumulators of 32 zmm registers
+PPC_TARGET("avx512f")
+void MicroAvx512(size_t kc, const double *a, const double *b, double *c, size_t ldc) {
+  __m512d c00 = _mm512_setzero_pd();
+  __m512d c01 = _mm512_setzero_pd();
+  __m512d c10 = _mm512_setzero_pd();
+  __m512d c11 = _mm512_setzero_pd();
+  __m512d c20 = _mm512_setzero_pd();
+  __m512d c21 = _mm512_setzero_pd();
+  __m512d c30 = _mm512_setzero_pd();
+  __m512d c31 = _mm512_setzero_pd();
+  __m512d c40 = _mm512_setzero_pd();
+  __m512d c41 = _mm512_setzero_pd();
+  __m512d c50 = _mm512_setzero_pd();
+  __m512d c51 = _mm512_setzero_pd();
+  __m512d c60 = _mm512_setzero_pd();
+  __m512d c61 = _mm512_setzero_pd();
+  __m512d c70 = _mm512_setzero_pd();
+  __m512d c71 = _mm512_setzero_pd();
+  for (size_t p = 0; p < kc; p++) {
+    const __m512d b0 = _mm512_load_pd(b);
+    const __m512d b1 = _mm512_load_pd(b + 8);
+    __m512d ai;
+    ai = _mm512_set1_pd(a[0]);
+    c00 = _mm512_fmadd_pd(ai, b0, c00);
+    c01 = _mm512_fmadd_pd(ai, b1, c01);
+    ai = _mm512_set1_pd(a[1]);
+    c10 = _mm512_fmadd_pd(ai, b0, c10);
+    c11 = _mm512_fmadd_pd(ai, b1, c11);
+    ai = _mm512_set1_pd(a[2]);
+    c20 = _mm512_fmadd_pd(ai, b0, c20);
+    c21 = _mm512_fmadd_pd(ai, b1, c21);
+    ai = _mm512_set1_pd(a[3]);
+    c30 = _mm512_fmadd_pd(ai, b0, c30);
+    c31 = _mm512_fmadd_pd(ai, b1, c31);
+    ai = _mm512_set1_pd(a[4]);
+    c40 = _mm512_fmadd_pd(ai, b0, c40);
+    c41 = _mm512_fmadd_pd(ai, b1, c41);
+    ai = _mm512_set1_pd(a[5]);
+    c50 = _mm512_fmadd_pd(ai, b0, c50);
+    c51 = _mm512_fmadd_pd(ai, b1, c51);
+    ai = _mm512_set1_pd(a[6]);
+    c60 = _mm512_fmadd_pd(ai, b0, c60);
+    c61 = _mm512_fmadd_pd(ai, b1, c61);
+    ai = _mm512_set1_pd(a[7]);
+    c70 = _mm512_fmadd_pd(ai, b0, c70);
+    c71 = _mm512_fmadd_pd(ai, b1, c71);
+    a += 8;
+    b += 16;
+  }
+  AddRowAvx512(c, c00, c01);
+  AddRowAvx512(c + ldc, c10, c11);
+  AddRowAvx512(c + (2 * ldc), c20, c21);
+  AddRowAvx512(c + (3 * ldc), c30, c31);
+  AddRowAvx512(c + (4 * ldc), c40, c41);
+  AddRowAvx512(c + (5 * ldc), c50, c51);
+  AddRowAvx512(c + (6 * ldc), c60, c61);
+  AddRowAvx512(c + (7 * ldc), c70, c71);
+}
+
+#endif
+
+Blocking BlockingOf(ppc::core::gemm::Kernel kernel) {
+  switch (kernel) {
+#ifdef PPC_X86_64
+    case ppc::core::gemm::Kernel::kAvx2:
+      return {.mr = 6, .nr = 8, .kc = 256, .mc = 72, .nc = 2048, .micro = MicroAvx2};
+    case ppc::core::gemm::Kernel::kAvx512:
+      return {.mr = 8, .nr = 16, .kc = 256, .mc = 96, .nc = 2048, .micro = MicroAvx512};
+#else
+    case ppc::core::gemm::Kernel::kAvx2:
+    case ppc::core::gemm::Kernel::kAvx512:
+#endif
+    case ppc::core::gemm::Kernel::kGeneric:
+      break;
+  }
+  return {.mr = 4, .nr = 4, .kc = 256, .mc = 64, .nc = 2048, .micro = MicroGeneric<4, 4>};
+}
+
+size_t RoundUp(size_t x, size_t step) { return (x + step - 1) / step * step; }
+
+// slivers of mr rows of the mc x kc block of A, each stored column by column, rows past mc are zero
+void PackA(size_t mc, size_t kc, const double *a, size_t lda, size_t mr, double *packed) {
+  for (size_t i0 = 0; i0 < mc; i0 += mr) {
+    const size_t rows = std::min(mr, mc - i0);
+    for (size_t i = 0; i < mr; i++) {
+      const double *row = a + ((i0 + i) * lda);
+      for (size_t p = 0; p < kc; p++) {
+        packed[(p * mr) + i] = i < rows ? row[p] : 0.0;
+      }
+    }
+    packed += mr * kc;
+  }
+}
+
+// slivers of nr columns of the kc x nc panel of B, each stored row by row, columns past nc are zero
+void PackB(size_t kc, size_t nc, const double *b, size_t ldb, size_t nr, double *packed) {
+  for (size_t j0 = 0; j0 < nc; j0 += nr) {
+    const size_t cols = std::min(nr, nc - j0);
+    for (size_t p = 0; p < kc; p++) {
+      const double *row = b + (p * ldb) + j0;
+      double *dst = packed + (p * nr);
+      std::copy_n(row, cols, dst);
+      std::fill(dst + cols, dst + nr, 0.0);
+    }
+    packed += nr * kc;
+  }
+}
+
+void Run(const Blocking &blk, size_t m, size_t n, size_t k, const double *a, size_t lda, const double *b, size_t ldb,
+         double *c, size_t ldc) {
+  if (m == 0 || n == 0 || k == 0) {
+    return;
+  }
+  thread_local ppc::util::AlignedVector<double> packed_a;
+  thread_local ppc::util::AlignedVector<double> packed_b;
+  alignas(64) double tile[kMaxTile];
+
+  for (size_t jc = 0; jc < n; jc += blk.nc) {
+    const size_t nc = std::min(blk.nc, n - jc);
+    for (size_t pc = 0; pc < k; pc += blk.kc) {
+      const size_t kc = std::min(blk.kc, k - pc);
+      packed_b.resize(std::max(packed_b.size(), RoundUp(nc, blk.nr) * kc));
+      PackB(kc, nc, b + (pc * ldb) + jc, ldb, blk.nr, packed_b.data());
+      for (size_t ic = 0; ic < m; ic += blk.mc) {
+        const size_t mc = std::min(blk.mc, m - ic);
+        packed_a.resize(std::max(packed_a.size(), RoundUp(mc, blk.mr) * kc));
+        PackA(mc, kc, a + (ic * lda) + pc, lda, blk.mr, packed_a.data());
+
+        for (size_t jr = 0; jr < nc; jr += blk.nr) {
+          const size_t nr = std::min(blk.nr, nc - jr);
+          const double *b_sliver = packed_b.data() + (jr * kc);
+          for (size_t ir = 0; ir < mc; ir += blk.mr) {
+            const size_t mr = std::min(blk.mr, mc - ir);
+            const double *a_sliver = packed_a.data() + (ir * kc);
+            double *c_tile = c + ((ic + ir) * ldc) + jc + jr;
+            if (mr == blk.mr && nr == blk.nr) {
+              blk.micro(kc, a_sliver, b_sliver, c_tile, ldc);
+              continue;
+            }
+            // edge tile: the full tile goes to a buffer and only its part inside C is added
+            std::fill_n(tile, blk.mr * blk.nr, 0.0);
+            blk.micro(kc, a_sliver, b_sliver, tile, blk.nr);
+            for (size_t i = 0; i < mr; i++) {
+              for (size_t j = 0; j < nr; j++) {
+                c_tile[(i * ldc) + j] += tile[(i * blk.nr) + j];
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+ppc::core::gemm::Kernel SelectKernel() {
+  using ppc::core::gemm::Kernel;
+  const std::string requested = ppc::util::GetEnvVariable("PPC_GEMM_KERNEL");
+  if (requested == "generic") {
+    return Kernel::kGeneric;
+  }
+  if (requested == "avx2" && ppc::core::gemm::IsSupported(Kernel::kAvx2)) {
+    return Kernel::kAvx2;
+  }
+  if (requested == "avx512" && ppc::core::gemm::IsSupported(Kernel::kAvx512)) {
+    return Kernel::kAvx512;
+  }
+  if (ppc::core::gemm::IsSupported(Kernel::kAvx512)) {
+    return Kernel::kAvx512;
+  }
+  if (ppc::core::gemm::IsSupported(Kernel::kAvx2)) {
+    return Kernel::kAvx2;
+  }
+  return Kernel::kGeneric;
+}
+
+}  // namespace
+
+bool ppc::core::gemm::IsSupported(Kernel kernel) {
+  switch (kernel) {
+    case Kernel::kGeneric:
+      return true;
+#ifdef PPC_X86_64
+    case Kernel::kAvx2:
+      return ppc::util::GetCpuFeatures().avx2 && ppc::util::GetCpuFeatures().fma;
+    case Kernel::kAvx512:
+      return ppc::util::GetCpuFeatures().avx512f;
+#else
+    case Kernel::kAvx2:
+    case Kernel::kAvx512:
+      return false;
+#endif
+  }
+  return false;
+}
+
+ppc::core::gemm::Kernel ppc::core::gemm::DefaultKernel() {
+  static const Kernel kKernel = SelectKernel();
+  return kKernel;
+}
+
+void ppc::core::gemm::Gemm(size_t m, size_t n, size_t k, const double *a, size_t lda, const double *b, size_t ldb,
+                           double *c, size_t ldc) {
+  Run(BlockingOf(DefaultKernel()), m, n, k, a, lda, b, ldb, c, ldc);
+}
+
+void ppc::core::gemm::Gemm(Kernel kernel, size_t m, size_t n, size_t k, const double *a, size_t lda, const double *b,
+                           size_t ldb, double *c, size_t ldc) {
+  if (!IsSupported(kernel)) {
+    throw std::invalid_argument("GEMM kernel is not supported by this processor");
+  }
+  Run(BlockingOf(kernel), m, n, k, a, lda, b, ldb, c, ldc);
+}
+
+void ppc::core::gemm::Multiply(std::span<const double> a, std::span<const double> b, std::span<double> c, size_t m,
+                               size_t k, size_t n) {
+  if (a.size() != m * k || b.size() != k * n || c.size() != m * n) {
+    throw std::invalid_argument("matrix sizes do not match the dimensions of the product");
+  }
+  std::ranges::fill(c, 0.0);
+  Gemm(m, n, k, a.data(), k, b.data(), n, c.data(), n);
+}
@@ -0,0 +1,301 @@
+#include "core/gemm/include/strassen.hpp"
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <span>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include "core/gemm/include/gemm.hpp"
+#include "core/util/include/util.hpp"
+
+namespace {
+
+// cutoffs tried by the calibration in increasing order; twice the last one is taken if none of them wins
+constexpr std::array<size_t, 4> kCutoffCandidates = {32, 64, 128, 256};
+// runs of each side of a comparison of the calibration, their medians are compared
+constexpr size_t kCalibrationRuns = 5;
+// one level has to beat Gemm by this fraction of its time, so near ties always go to Gemm
+constexpr double kMinLevelGain = 0.05;
+
+// fewest rows of a block of the Gemm which a plan without levels splits between tasks
+constexpr size_t kMinGemmRows = 32;
+
+// z = x + y for m x m views, z may be x or y
+void Add(size_t m, const double *x, size_t ldx, const double *y, size_t ldy, double *z, size_t ldz) {
+  for (size_t i = 0; i < m; i++) {
+    const double *xr = x + (i * ldx);
+    const double *yr = y + (i * ldy);
+    double *zr = z + (i * ldz);
+    for (size_t j = 0; j < m; j++) {
+      zr[j] = xr[j] + yr[j];
+    }
+  }
+}
+
+// z = x - y for m x m views, z may be x or y
+void Sub(size_t m, const double *x, size_t ldx, const double *y, size_t ldy, double *z, size_t ldz) {
+  for (size_t i = 0; i < m; i++) {
+    const double *xr = x + (i * ldx);
+    const double *yr = y + (i * ldy);
+    double *zr = z + (i * ldz);
+    for (size_t j = 0; j < m; j++) {
+      zr[j] = xr[j] - yr[j];
+    }
+  }
+}
+
+// copies the rows x cols matrix src into dst, rows and columns of dst beyond them are left as they are
+void CopyView(size_t rows, size_t cols, const double *src, size_t lds, double *dst, size_t ldd) {
+  for (size_t i = 0; i < rows; i++) {
+    std::copy_n(src + (i * lds), cols, dst + (i * ldd));
+  }
+}
+
+// Gemm of the rows [begin, end) of c = a * b for m x m views
+void GemmRows(size_t m, size_t begin, size_t end, const double *a, size_t lda, const double *b, size_t ldb, double *c,
+              size_t ldc) {
+  for (size_t i = begin; i < end; i++) {
+    std::fill_n(c + (i * ldc), m, 0.0);
+  }
+  ppc::core::gemm::Gemm(end - begin, m, m, a + (begin * lda), lda, b, ldb, c + (begin * ldc), ldc);
+}
+
+template <typename F>
+double MedianTime(const F &f) {
+  std::array<double, kCalibrationRuns> times{};
+  for (auto &time : times) {
+    const auto start = std::chrono::steady_clock::now();
+    f();
+    time = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  }
+  std::ranges::nth_element(times, times.begin() + (kCalibrationRuns / 2));
+  return times[kCalibrationRuns / 2];
+}
+
+// the smallest candidate s for which one Strassen-Winograd level over products of size s beats Gemm on size 2s
+size_t CalibrateCutoff() {
+  for (const size_t s : kCutoffCandidates) {
+    const size_t m = 2 * s;
+    std::vector<double> a(m * m);
+    std::vector<double> b(m * m);
+    std::vector<double> c(m * m);
+    for (size_t i = 0; i < m * m; i++) {
+      a[i] = static_cast<double>(i % 7) - 3.0;
+      b[i] = static_cast<double>(i % 5) - 2.0;
+    }
+    ppc::core::gemm::StrassenPlan plan(m, s);
+    const double gemm_time = MedianTime([&] {
+      std::ranges::fill(c, 0.0);
+      ppc::core::gemm::Gemm(m, m, m, a.data(), m, b.data(), m, c.data(), m);
+    });
+    const double strassen_time = MedianTime([&] { plan.Multiply(a.data(), m, b.data(), m, c.data(), m); });
+    if (strassen_time < (1.0 - kMinLevelGain) * gemm_time) {
+      return s;
+    }
+  }
+  return 2 * kCutoffCandidates.back();
+}
+
+}  // namespace
+
+size_t ppc::core::gemm::StrassenCutoff() {
+  static const size_t kCutoff = [] {
+    const std::string requested = ppc::util::GetEnvVariable("PPC_STRASSEN_CUTOFF");
+    size_t cutoff = 0;
+    const auto [end, error] = std::from_chars(requested.data(), requested.data() + requested.size(), cutoff);
+    if (error == std::errc() && end == requested.data() + requested.size() && cutoff > 0) {
+      return cutoff;
+    }
+    return CalibrateCutoff();
+  }();
+  return kCutoff;
+}
+
+ppc::core::gemm::StrassenPlan::StrassenPlan(size_t n, size_t cutoff, size_t parallel_levels) : n_(n) {
+  cutoff = std::max<size_t>(cutoff, 1);
+  // halve until the products fit the cutoff, the size is then rounded up to a multiple of 2^levels
+  size_t leaf = n;
+  while (leaf > cutoff) {
+    leaf = (leaf + 1) / 2;
+    levels_++;
+  }
+  padded_ = leaf << levels_;
+  parallel_levels_ = std::min(parallel_levels, levels_);
+  const size_t copies = padded_ != n_ ? 3 * padded_ * padded_ : 0;
+  arena_.resize(copies + WorkspaceSize(padded_, 0));
+}
+
+size_t ppc::core::gemm::StrassenPlan::WorkspaceSize(size_t m, size_t level) const {
+  if (level == levels_) {
+    return 0;
+  }
+  const size_t h = m / 2;
+  if (level < parallel_levels_) {
+    // S1..S4, T1..T4, P1, P2 and P4, and a workspace for each of the seven products
+    return (11 * h * h) + (7 * WorkspaceSize(h, level + 1));
+  }
+  // two operands, the products are computed one after another
+  return (2 * h * h) + WorkspaceSize(h, level + 1);
+}
+
+void ppc::core::gemm::StrassenPlan::Multiply(const double *a, size_t lda, const double *b, size_t ldb, double *c,
+                                             size_t ldc, const ParallelInvoke &invoke) {
+  if (n_ == 0) {
+    return;
+  }
+  if (padded_ == n_) {
+    Recurse(n_, a, lda, b, ldb, c, ldc, arena_.data(), 0, invoke);
+    return;
+  }
+  const size_t p = padded_;
+  double *pa = arena_.data();
+  double *pb = pa + (p * p);
+  double *pc = pb + (p * p);
+  std::fill(pa, pc, 0.0);
+  CopyView(n_, n_, a, lda, pa, p);
+  CopyView(n_, n_, b, ldb, pb, p);
+  Recurse(p, pa, p, pb, p, pc, p, pc + (p * p), 0, invoke);
+  CopyView(n_, n_, pc, p, c, ldc);
+}
+
+void ppc::core::gemm::StrassenPlan::Recurse(size_t m, const double *a, size_t lda, const double *b, size_t ldb,
+                                            double *c, size_t ldc, double *ws, size_t level,
+                                            const ParallelInvoke &invoke) {
+  if (level == levels_ && level == 0 && invoke) {
+    // no level to run in parallel: the tasks are blocks of rows of the one Gemm
+    const size_t blocks = std::min(ppc::util::GetPPCNumChunks(), (m + kMinGemmRows - 1) / kMinGemmRows);
+    std::vector<std::function<void()>> tasks;
+    tasks.reserve(blocks);
+    for (size_t block = 0; block < blocks; block++) {
+      tasks.emplace_back([=] { GemmRows(m, m * block / blocks, m * (block + 1) / blocks, a, lda, b, ldb, c, ldc); });
+    }
+    invoke(tasks);
+  } else if (level == levels_) {
+    GemmRows(m, 0, m, a, lda, b, ldb, c, ldc);
+  } else if (level < parallel_levels_) {
+    ParallelLevel(m, a, lda, b, ldb, c, ldc, ws, level, invoke);
+  } else {
+    SequentialLevel(m, a, lda, b, ldb, c, ldc, ws, level, invoke);
+  }
+}
+
+// Winograd's schedule with two temporaries: the quarters of C hold products until they are combined
+void ppc::core::gemm::StrassenPlan::SequentialLevel(size_t m, const double *a, size_t lda, const double *b,
+                                                    size_t ldb, double *c, size_t ldc, double *ws, size_t level,
+                                                    const ParallelInvoke &invoke) {
+  const size_t h = m / 2;
+  const double *a11 = a;
+  const double *a12 = a + h;
+  const double *a21 = a + (h * lda);
+  const double *a22 = a21 + h;
+  const double *b11 = b;
+  const double *b12 = b + h;
+  const double *b21 = b + (h * ldb);
+  const double *b22 = b21 + h;
+  double *c11 = c;
+  double *c12 = c + h;
+  double *c21 = c + (h * ldc);
+  double *c22 = c21 + h;
+  double *x = ws;
+  double *y = x + (h * h);
+  double *child = y + (h * h);
+  const size_t next = level + 1;
+
+  Sub(h, a11, lda, a21, lda, x, h);  // S3
+  Sub(h, b22, ldb, b12, ldb, y, h);  // T3
+  Recurse(h, x, h, y, h, c21, ldc, child, next, invoke);  // P7
+  Add(h, a21, lda, a22, lda, x, h);  // S1
+  Sub(h, b12, ldb, b11, ldb, y, h);  // T1
+  Recurse(h, x, h, y, h, c22, ldc, child, next, invoke);  // P5
+  Sub(h, x, h, a11, lda, x, h);  // S2 = S1 - A11
+  Sub(h, b22, ldb, y, h, y, h);  // T2 = B22 - T1
+  Recurse(h, x, h, y, h, c12, ldc, child, next, invoke);  // P6
+  Sub(h, a12, lda, x, h, x, h);  // S4 = A12 - S2
+  Recurse(h, x, h, b22, ldb, c11, ldc, child, next, invoke);  // P3
+  Recurse(h, a11, lda, b11, ldb, x, h, child, next, invoke);  // P1
+  Add(h, x, h, c12, ldc, c12, ldc);  // U2 = P1 + P6
+  Add(h, c12, ldc, c21, ldc, c21, ldc);  // U3 = U2 + P7
+  Add(h, c12, ldc, c22, ldc, c12, ldc);  // U4 = U2 + P5
+  Add(h, c21, ldc, c22, ldc, c22, ldc);  // C22 = U3 + P5
+  Add(h, c12, ldc, c11, ldc, c12, ldc);  // C12 = U4 + P3
+  Sub(h, y, h, b21, ldb, y, h);  // T4 = T2 - B21
+  Recurse(h, a22, lda, y, h, c11, ldc, child, next, invoke);  // P4
+  Sub(h, c21, ldc, c11, ldc, c21, ldc);  // C21 = U3 - P4
+  Recurse(h, a12, lda, b21, ldb, c11, ldc, child, next, invoke);  // P2
+  Add(h, x, h, c11, ldc, c11, ldc);  // C11 = P1 + P2
+}
+
+// All operands are formed first, then the seven products are independent tasks with workspaces of their own
+void ppc::core::gemm::StrassenPlan::ParallelLevel(size_t m, const double *a, size_t lda, const double *b,
+                                                  size_t ldb, double *c, size_t ldc, double *ws, size_t level,
+                                                  const ParallelInvoke &invoke) {
+  const size_t h = m / 2;
+  const size_t hh = h * h;
+  const double *a11 = a;
+  const double *a12 = a + h;
+  const double *a21 = a + (h * lda);
+  const double *a22 = a21 + h;
+  const double *b11 = b;
+  const double *b12 = b + h;
+  const double *b21 = b + (h * ldb);
+  const double *b22 = b21 + h;
+  double *c11 = c;
+  double *c12 = c + h;
+  double *c21 = c + (h * ldc);
+  double *c22 = c21 + h;
+  double *s1 = ws;
+  double *s2 = s1 + hh;
+  double *s3 = s2 + hh;
+  double *s4 = s3 + hh;
+  double *t1 = s4 + hh;
+  double *t2 = t1 + hh;
+  double *t3 = t2 + hh;
+  double *t4 = t3 + hh;
+  double *p1 = t4 + hh;
+  double *p2 = p1 + hh;
+  double *p4 = p2 + hh;
+  double *children = p4 + hh;
+  const size_t next = level + 1;
+  const size_t child_size = WorkspaceSize(h, next);
+
+  Add(h, a21, lda, a22, lda, s1, h);
+  Sub(h, s1, h, a11, lda, s2, h);
+  Sub(h, a11, lda, a21, lda, s3, h);
+  Sub(h, a12, lda, s2, h, s4, h);
+  Sub(h, b12, ldb, b11, ldb, t1, h);
+  Sub(h, b22, ldb, t1, h, t2, h);
+  Sub(h, b22, ldb, b12, ldb, t3, h);
+  Sub(h, t2, h, b21, ldb, t4, h);
+
+  auto product = [&](size_t index, const double *x, size_t ldx, const double *y, size_t ldy, double *z,
+                     size_t ldz) {
+    return [=, this, &invoke] { Recurse(h, x, ldx, y, ldy, z, ldz, children + (index * child_size), next, invoke); };
+  };
+  const std::array<std::function<void()>, 7> tasks = {
+      product(0, a11, lda, b11, ldb, p1, h),  product(1, a12, lda, b21, ldb, p2, h),
+      product(2, s4, h, b22, ldb, c11, ldc),  product(3, a22, lda, t4, h, p4, h),
+      product(4, s1, h, t1, h, c22, ldc),     product(5, s2, h, t2, h, c12, ldc),
+      product(6, s3, h, t3, h, c21, ldc),
+  };
+  if (invoke) {
+    invoke(tasks);
+  } else {
+    for (const auto &task : tasks) {
+      task();
+    }
+  }
+
+  Add(h, p1, h, c12, ldc, c12, ldc);  // U2 = P1 + P6
+  Add(h, c12, ldc, c21, ldc, c21, ldc);  // U3 = U2 + P7
+  Add(h, c12, ldc, c22, ldc, c12, ldc);  // U4 = U2 + P5
+  Add(h, c21, ldc, c22, ldc, c22, ldc);  // C22 = U3 + P5
+  Add(h, c12, ldc, c11, ldc, c12, ldc);  // C12 = U4 + P3
+  Sub(h, c21, ldc, p4, h, c21, ldc);  // C21 = U3 - P4
+  Add(h, p1, h, p2, h, c11, ldc);  // C11 = P1 + P2
+}
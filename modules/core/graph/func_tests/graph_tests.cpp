@@ -0,0 +1,263 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <queue>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "core/graph/include/adjacency_stream.hpp"
+#include "core/graph/include/csr_file.hpp"
+#include "core/graph/include/csr_graph.hpp"
+#include "core/graph/include/delta_stepping.hpp"
+#include "core/graph/include/graph_generators.hpp"
+#include "core/graph/include/multi_source.hpp"
+#include "core/task/include/task.hpp"
+#include "core/thread_pool/include/thread_pool.hpp"
+
+namespace {
+
+std::vector<int> ReferenceDijkstra(const ppc::core::graph::CsrGraphView &graph, size_t source) {
+  std::vector<int> dist(graph.NumVertices(), ppc::core::graph::kInfiniteDistance);
+  using Item = std::pair<int, size_t>;
+  std::priority_queue<Item, std::vector<Item>, std::greater<>> queue;
+  dist[source] = 0;
+  queue.emplace(0, source);
+  while (!queue.empty()) {
+    const auto [d, u] = queue.top();
+    queue.pop();
+    if (d > dist[u]) {
+      continue;
+    }
+    for (uint64_t e = graph.EdgesBegin(u); e < graph.EdgesEnd(u); e++) {
+      const auto v = graph.Target(e);
+      if (d + graph.Weight(e) < dist[v]) {
+        dist[v] = d + graph.Weight(e);
+        queue.emplace(dist[v], v);
+      }
+    }
+  }
+  return dist;
+}
+
+void SerialFor(size_t begin, size_t end, const std::function<void(size_t, size_t)> &body) { body(begin, end); }
+
+bool SameGraph(const ppc::core::graph::CsrGraphView &a, const ppc::core::graph::CsrGraphView &b) {
+  return std::ranges::equal(a.Offsets(), b.Offsets()) && std::ranges::equal(a.Targets(), b.Targets()) &&
+         std::ranges::equal(a.Weights(), b.Weights());
+}
+
+}  // namespace
+
+TEST(graph_tests, check_csr_graph_build) {
+  ppc::core::graph::CsrGraph graph;
+  graph.AddEdge(1, 5);
+  graph.AddEdge(2, 3);
+  graph.FinishVertex();
+  graph.FinishVertex();
+  graph.AddEdge(0, 7);
+  graph.FinishVertices(4);
+
+  ASSERT_EQ(graph.NumVertices(), 4U);
+  ASSERT_EQ(graph.NumEdges(), 3U);
+  EXPECT_EQ(graph.EdgesEnd(0) - graph.EdgesBegin(0), 2U);
+  EXPECT_EQ(graph.EdgesEnd(1) - graph.EdgesBegin(1), 0U);
+  EXPECT_EQ(graph.Target(graph.EdgesBegin(2)), 0U);
+  EXPECT_EQ(graph.Weight(graph.EdgesBegin(2)), 7);
+  EXPECT_EQ(graph.MaxWeight(), 7);
+
+  const auto stream = ppc::core::graph::ToAdjacencyStream(graph);
+  EXPECT_EQ(stream, (std::vector<int>{1, 5, 2, 3, -1, -1, 0, 7, -1, -1}));
+}
+
+TEST(graph_tests, check_delta_stepping_small) {
+  ppc::core::graph::CsrGraph graph;
+  graph.AddEdge(1, 4);
+  graph.AddEdge(2, 1);
+  graph.FinishVertex();
+  graph.AddEdge(3, 1);
+  graph.FinishVertex();
+  graph.AddEdge(1, 2);
+  graph.AddEdge(3, 5);
+  graph.FinishVertex();
+  graph.FinishVertices(5);
+
+  std::vector<int> dist(graph.NumVertices());
+  ppc::core::graph::DeltaStepping(graph, 0, 2, dist, 1, SerialFor);
+  EXPECT_EQ(dist, (std::vector<int>{0, 3, 1, 4, ppc::core::graph::kInfiniteDistance}));
+
+  ppc::core::graph::DeltaStepping(graph, 7, 2, dist, 1, SerialFor);
+  EXPECT_EQ(dist[0], ppc::core::graph::kInfiniteDistance);
+}
+
+TEST(graph_tests, check_delta_stepping_matches_dijkstra) {
+  ppc::core::ThreadPool pool(4);
+  auto pool_for = [&](size_t begin, size_t end, const auto &body) {
+    ppc::core::ParallelFor(begin, end, body, 1, pool);
+  };
+
+  const std::vector<ppc::core::graph::CsrGraph> graphs = {
+      ppc::core::graph::MakeGridGraph(40, 50, 100, 1), ppc::core::graph::MakeGridGraph(1, 30, 1, 2),
+      ppc::core::graph::MakeRmatGraph(11, 8, 1000, 3), ppc::core::graph::MakeRmatGraph(8, 4, 1, 4)};
+  for (const auto &graph : graphs) {
+    for (const size_t source : {size_t{0}, graph.NumVertices() / 2}) {
+      const auto expected = ReferenceDijkstra(graph, source);
+      std::vector<int> dist(graph.NumVertices());
+      for (const int delta : {1, 7, ppc::core::graph::ChooseDelta(graph), 5000}) {
+        ppc::core::graph::DeltaStepping(graph, source, delta, dist, 1, SerialFor);
+        EXPECT_EQ(dist, expected);
+        ppc::core::graph::DeltaStepping(graph, source, delta, dist, 16, pool_for);
+        EXPECT_EQ(dist, expected);
+      }
+    }
+  }
+}
+
+TEST(graph_tests, check_adjacency_stream_lenient) {
+  using ppc::core::graph::StreamCheck;
+  // target 9 and -5 are out of range, the list of the vertex 3 and the unpaired 2 are beyond 3 vertices
+  const std::vector<int> stream = {1, 4, 9, 1, -1, -5, 2, 2, 3, -1, -1, 0, 1, -1, 2};
+  ppc::core::graph::CsrGraph graph;
+  ASSERT_TRUE(ppc::core::graph::BuildFromAdjacencyStream(stream, 3, StreamCheck::kLenient, graph, 4, SerialFor));
+  ASSERT_EQ(graph.NumVertices(), 3U);
+  EXPECT_EQ(std::vector(graph.Offsets().begin(), graph.Offsets().end()), (std::vector<uint64_t>{0, 1, 2, 2}));
+  EXPECT_EQ(std::vector(graph.Targets().begin(), graph.Targets().end()), (std::vector<uint32_t>{1, 2}));
+  EXPECT_EQ(std::vector(graph.Weights().begin(), graph.Weights().end()), (std::vector<int32_t>{4, 3}));
+
+  // missing lists are empty, an unpaired last value is ignored
+  ASSERT_TRUE(ppc::core::graph::BuildFromAdjacencyStream(std::vector<int>{1, 2, -1, 0, 5, 2}, 4, StreamCheck::kLenient,
+                                                         graph, 3, SerialFor));
+  EXPECT_EQ(std::vector(graph.Offsets().begin(), graph.Offsets().end()), (std::vector<uint64_t>{0, 1, 2, 2, 2}));
+}
+
+TEST(graph_tests, check_adjacency_stream_rejects_invalid) {
+  using ppc::core::graph::StreamCheck;
+  ppc::core::graph::CsrGraph graph;
+  for (const auto check : {StreamCheck::kLenient, StreamCheck::kStrict}) {
+    EXPECT_FALSE(ppc::core::graph::BuildFromAdjacencyStream(std::vector<int>{1, 2, -1, 0, -3, -1}, 2, check, graph, 2,
+                                                            SerialFor));
+    // a weight -1 looks like the end of the list
+    EXPECT_FALSE(ppc::core::graph::BuildFromAdjacencyStream(std::vector<int>{1, 2, 0, -1, -1}, 2, check, graph, 2,
+                                                            SerialFor));
+  }
+  EXPECT_FALSE(ppc::core::graph::BuildFromAdjacencyStream(std::vector<int>{1, 2, -1, 2, 1, -1}, 2, StreamCheck::kStrict,
+                                                          graph, 2, SerialFor));
+  EXPECT_FALSE(ppc::core::graph::BuildFromAdjacencyStream(std::vector<int>{-1, -1, -1}, 2, StreamCheck::kStrict, graph,
+                                                          2, SerialFor));
+  EXPECT_FALSE(ppc::core::graph::BuildFromAdjacencyStream(std::vector<int>{1, 2, -1, 0}, 2, StreamCheck::kStrict, graph,
+                                                          2, SerialFor));
+  EXPECT_TRUE(ppc::core::graph::BuildFromAdjacencyStream(std::vector<int>{1, 2, -1, 0, 3}, 2, StreamCheck::kStrict,
+                                                         graph, 2, SerialFor));
+  EXPECT_EQ(graph.NumEdges(), 2U);
+}
+
+TEST(graph_tests, check_adjacency_stream_parallel_build) {
+  ppc::core::ThreadPool pool(4);
+  auto pool_for = [&](size_t begin, size_t end, const auto &body) {
+    ppc::core::ParallelFor(begin, end, body, 1, pool);
+  };
+  for (const auto &expected :
+       {ppc::core::graph::MakeRmatGraph(12, 8, 100, 5), ppc::core::graph::MakeGridGraph(30, 70, 10, 6)}) {
+    const auto stream = ppc::core::graph::ToAdjacencyStream(expected);
+    for (const size_t num_chunks : {1, 3, 16, 1000}) {
+      ppc::core::graph::CsrGraph graph;
+      ASSERT_TRUE(ppc::core::graph::BuildFromAdjacencyStream(stream, expected.NumVertices(),
+                                                             ppc::core::graph::StreamCheck::kStrict, graph, num_chunks,
+                                                             pool_for));
+      EXPECT_TRUE(SameGraph(graph, expected));
+    }
+  }
+}
+
+TEST(graph_tests, check_csr_file_round_trip) {
+  const auto path = std::filesystem::temp_directory_path() / "ppc_graph_tests.csr";
+  for (const auto &graph : {ppc::core::graph::MakeRmatGraph(9, 3, 50, 7), ppc::core::graph::MakeGridGraph(3, 3, 5, 8),
+                            ppc::core::graph::CsrGraph()}) {
+    ppc::core::graph::SaveCsrGraph(graph, path);
+    const ppc::core::graph::MappedCsrGraph mapped(path);
+    ASSERT_TRUE(SameGraph(mapped, graph));
+    if (graph.NumVertices() > 0) {
+      std::vector<int> dist(graph.NumVertices());
+      ppc::core::graph::DeltaStepping(mapped, 0, ppc::core::graph::ChooseDelta(mapped), dist, 1, SerialFor);
+      EXPECT_EQ(dist, ReferenceDijkstra(graph, 0));
+    }
+  }
+  std::filesystem::remove(path);
+}
+
+TEST(graph_tests, check_csr_file_rejects_bad_file) {
+  const auto path = std::filesystem::temp_directory_path() / "ppc_graph_tests_bad.csr";
+  EXPECT_ANY_THROW(ppc::core::graph::MappedCsrGraph{path / "missing"});
+
+  ppc::core::graph::SaveCsrGraph(ppc::core::graph::MakeGridGraph(2, 2, 5, 9), path);
+  std::filesystem::resize_file(path, std::filesystem::file_size(path) - 4);
+  EXPECT_ANY_THROW(ppc::core::graph::MappedCsrGraph{path});
+
+  std::ofstream(path, std::ios::binary | std::ios::trunc) << "not a graph file at all";
+  EXPECT_ANY_THROW(ppc::core::graph::MappedCsrGraph{path});
+  std::filesystem::remove(path);
+}
+
+TEST(graph_tests, check_multi_source_matches_dijkstra) {
+  ppc::core::ThreadPool pool(4);
+  auto pool_for = [&](size_t begin, size_t end, const auto &body) {
+    ppc::core::ParallelFor(begin, end, body, 1, pool);
+  };
+  const std::vector<ppc::core::graph::CsrGraph> graphs = {ppc::core::graph::MakeGridGraph(20, 30, 50, 10),
+                                                          ppc::core::graph::MakeRmatGraph(10, 6, 1000, 11)};
+  for (const auto &graph : graphs) {
+    const auto num_vertices = static_cast<int>(graph.NumVertices());
+    std::vector<int> sources;
+    for (int k = 0; k < 13; k++) {
+      sources.push_back((k * 97) % num_vertices);
+    }
+    sources[3] = sources[2];
+    sources[5] = num_vertices;
+
+    std::vector<int> dist(sources.size() * graph.NumVertices());
+    ppc::core::graph::MultiSourceShortestPaths(graph, sources, dist, pool_for);
+    for (size_t k = 0; k < sources.size(); k++) {
+      const std::vector<int> row(dist.begin() + static_cast<std::ptrdiff_t>(k * graph.NumVertices()),
+                                 dist.begin() + static_cast<std::ptrdiff_t>((k + 1) * graph.NumVertices()));
+      if (sources[k] == num_vertices) {
+        EXPECT_TRUE(std::ranges::all_of(row, [](int d) { return d == ppc::core::graph::kInfiniteDistance; }));
+      } else {
+        EXPECT_EQ(row, ReferenceDijkstra(graph, sources[k]));
+      }
+    }
+  }
+}
+
+TEST(graph_tests, check_batched_query_from_task_data) {
+  std::vector<int> sources = {0, 2};
+  std::vector<int> dist(2 * 5);
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.push_back(nullptr);
+  task_data->inputs_count.push_back(0);
+  task_data->outputs.push_back(reinterpret_cast<uint8_t *>(dist.data()));
+  task_data->outputs_count.push_back(5);
+  EXPECT_FALSE(ppc::core::graph::GetBatchedQuery(*task_data).has_value());
+
+  task_data->outputs.clear();
+  task_data->outputs_count.clear();
+  task_data->AddOutput(dist.data(), std::array<uint64_t, 2>{2, 5});
+  EXPECT_ANY_THROW((void)ppc::core::graph::GetBatchedQuery(*task_data));
+
+  task_data->inputs.push_back(reinterpret_cast<uint8_t *>(sources.data()));
+  task_data->inputs_count.push_back(sources.size());
+  const auto query = ppc::core::graph::GetBatchedQuery(*task_data);
+  ASSERT_TRUE(query.has_value());
+  EXPECT_EQ(query->num_vertices, 5U);
+  EXPECT_EQ(query->sources.size(), 2U);
+  EXPECT_EQ(query->distances.data(), dist.data());
+
+  task_data->inputs_count.back() = 1;
+  EXPECT_ANY_THROW((void)ppc::core::graph::GetBatchedQuery(*task_data));
+}
@@ -0,0 +1,145 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "core/graph/include/csr_graph.hpp"
+
+namespace ppc::core::graph {
+
+// Terminator of the edge list of a vertex in the stream used by task data of the Dijkstra tasks:
+// pairs (target, weight) of every vertex followed by -1
+constexpr int kEndOfVertexList = -1;
+
+enum class StreamCheck : uint8_t {
+  // edges to targets out of [0, num_vertices) are skipped, everything after num_vertices lists
+  // and an unpaired last value are ignored
+  kLenient,
+  // such edges and extra data make the stream invalid
+  kStrict,
+};
+
+// parallel_for which runs the whole range in the calling thread, for sequential tasks
+struct SequentialFor {
+  template <typename Body>
+  void operator()(size_t begin, size_t end, const Body &body) const {
+    body(begin, end);
+  }
+};
+
+// Parse the stream into the CSR graph of num_vertices vertices (missing lists are empty), false if the stream
+// is invalid: a negative weight or, in the strict mode, malformed data.
+// Lists are found in parallel (every -1 ends a list, valid weights are never -1), then vertices are counted
+// and filled in parallel. parallel_for(begin, end, body) and num_chunks are the same as for DeltaStepping.
+template <typename ParallelFor>
+bool BuildFromAdjacencyStream(std::span<const int> stream, size_t num_vertices, StreamCheck check, CsrGraph &graph,
+                              size_t num_chunks, const ParallelFor &parallel_for);
+
+namespace detail {
+
+// positions of all terminators of the stream in increasing order
+template <typename ParallelFor>
+std::vector<size_t> FindListEnds(std::span<const int> stream, size_t num_chunks, const ParallelFor &parallel_for) {
+  std::vector<size_t> chunk_starts(num_chunks + 1, 0);
+  parallel_for(0, num_chunks, [&](size_t chunk_begin, size_t chunk_end) {
+    for (size_t chunk = chunk_begin; chunk < chunk_end; chunk++) {
+      const auto first = stream.begin() + static_cast<std::ptrdiff_t>(stream.size() * chunk / num_chunks);
+      const auto last = stream.begin() + static_cast<std::ptrdiff_t>(stream.size() * (chunk + 1) / num_chunks);
+      chunk_starts[chunk + 1] = static_cast<size_t>(std::count(first, last, kEndOfVertexList));
+    }
+  });
+  std::inclusive_scan(chunk_starts.begin(), chunk_starts.end(), chunk_starts.begin());
+
+  std::vector<size_t> ends(chunk_starts.back());
+  parallel_for(0, num_chunks, [&](size_t chunk_begin, size_t chunk_end) {
+    for (size_t chunk = chunk_begin; chunk < chunk_end; chunk++) {
+      size_t out = chunk_starts[chunk];
+      for (size_t i = stream.size() * chunk / num_chunks; i < stream.size() * (chunk + 1) / num_chunks; i++) {
+        if (stream[i] == kEndOfVertexList) {
+          ends[out++] = i;
+        }
+      }
+    }
+  });
+  return ends;
+}
+
+}  // namespace detail
+
+template <typename ParallelFor>
+bool BuildFromAdjacencyStream(std::span<const int> stream, size_t num_vertices, StreamCheck check, CsrGraph &graph,
+                              size_t num_chunks, const ParallelFor &parallel_for) {
+  num_chunks = std::max<size_t>(num_chunks, 1);
+  const bool strict = check == StreamCheck::kStrict;
+  const std::vector<size_t> ends = detail::FindListEnds(stream, num_chunks, parallel_for);
+  if (strict && ends.size() >= num_vertices) {
+    // nothing may follow the last list
+    const size_t used = num_vertices == 0 ? 0 : ends[num_vertices - 1] + 1;
+    if (used != stream.size()) {
+      return false;
+    }
+  }
+
+  // values [first, last) of the list of v: pairs, an odd last value is the unpaired end of the stream
+  // or a weight -1 read as a terminator
+  auto list_of = [&](size_t v) {
+    const size_t first = v == 0 ? 0 : (v - 1 < ends.size() ? ends[v - 1] + 1 : stream.size());
+    const size_t last = v < ends.size() ? ends[v] : stream.size();
+    return std::pair{first, last};
+  };
+  auto keep_edge = [&](size_t i) { return static_cast<size_t>(stream[i]) < num_vertices; };
+
+  std::vector<uint64_t> offsets(num_vertices + 1, 0);
+  std::atomic<bool> valid = true;
+  auto for_vertices = [&](const auto &vertex_body) {
+    parallel_for(0, num_chunks, [&](size_t chunk_begin, size_t chunk_end) {
+      for (size_t v = num_vertices * chunk_begin / num_chunks; v < num_vertices * chunk_end / num_chunks; v++) {
+        vertex_body(v);
+      }
+    });
+  };
+  for_vertices([&](size_t v) {
+    const auto [first, last] = list_of(v);
+    if ((last - first) % 2 != 0 && (strict || v < ends.size())) {
+      valid.store(false, std::memory_order_relaxed);
+      return;
+    }
+    uint64_t degree = 0;
+    for (size_t i = first; i + 1 < last; i += 2) {
+      if (stream[i + 1] < 0 || (strict && !keep_edge(i))) {
+        valid.store(false, std::memory_order_relaxed);
+        return;
+      }
+      degree += keep_edge(i) ? 1 : 0;
+    }
+    offsets[v + 1] = degree;
+  });
+  if (!valid) {
+    return false;
+  }
+  std::inclusive_scan(offsets.begin(), offsets.end(), offsets.begin());
+
+  std::vector<uint32_t> targets(offsets.back());
+  std::vector<int32_t> weights(offsets.back());
+  for_vertices([&](size_t v) {
+    const auto [first, last] = list_of(v);
+    uint64_t out = offsets[v];
+    for (size_t i = first; i + 1 < last; i += 2) {
+      if (keep_edge(i)) {
+        targets[out] = static_cast<uint32_t>(stream[i]);
+        weights[out] = stream[i + 1];
+        out++;
+      }
+    }
+  });
+  graph.Assign(std::move(offsets), std::move(targets), std::move(weights));
+  return true;
+}
+
+}  // namespace ppc::core::graph
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <vector>
+
+#include "core/graph/include/csr_graph.hpp"
+
+namespace ppc::core::graph {
+
+// Binary graph file which is used in place without parsing. Layout, in the native byte order:
+// magic "PPCCSR01", count of vertices and count of edges (uint64), offsets (uint64, one per vertex and one more),
+// targets (uint32) padded with zeros to a multiple of 8 bytes, weights (int32).
+// Throws std::runtime_error if the file can not be written.
+void SaveCsrGraph(const CsrGraphView &graph, const std::filesystem::path &path);
+
+// Graph file mapped into memory read-only (read into a buffer where mmap is not available), so repeated
+// queries on the same graph skip parsing. Throws std::runtime_error if the file can not be read or its size
+// does not match the header; the arrays themselves are trusted.
+class MappedCsrGraph {
+ public:
+  explicit MappedCsrGraph(const std::filesystem::path &path);
+  MappedCsrGraph(const MappedCsrGraph &) = delete;
+  MappedCsrGraph &operator=(const MappedCsrGraph &) = delete;
+  ~MappedCsrGraph();
+
+  [[nodiscard]] CsrGraphView View() const { return view_; }
+  operator CsrGraphView() const { return view_; }  // NOLINT(google-explicit-constructor)
+
+ private:
+  void Unmap();
+
+  void *mapping_ = nullptr;
+  size_t mapping_size_ = 0;
+  std::vector<uint64_t> buffer_;
+  CsrGraphView view_;
+};
+
+}  // namespace ppc::core::graph
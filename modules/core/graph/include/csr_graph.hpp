@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace ppc::core::graph {
+
+// Read-only directed weighted graph in compressed sparse row form: edges of vertex v are
+// [offsets[v], offsets[v + 1]) in the parallel arrays of targets and weights.
+// It does not own the arrays, they come from a CsrGraph or from a mapped graph file.
+class CsrGraphView {
+ public:
+  CsrGraphView() = default;
+  CsrGraphView(std::span<const uint64_t> offsets, std::span<const uint32_t> targets, std::span<const int32_t> weights)
+      : offsets_(offsets), targets_(targets), weights_(weights) {}
+
+  [[nodiscard]] size_t NumVertices() const { return offsets_.empty() ? 0 : offsets_.size() - 1; }
+  [[nodiscard]] size_t NumEdges() const { return targets_.size(); }
+  [[nodiscard]] uint64_t EdgesBegin(size_t v) const { return offsets_[v]; }
+  [[nodiscard]] uint64_t EdgesEnd(size_t v) const { return offsets_[v + 1]; }
+  [[nodiscard]] uint32_t Target(uint64_t e) const { return targets_[e]; }
+  [[nodiscard]] int32_t Weight(uint64_t e) const { return weights_[e]; }
+
+  [[nodiscard]] std::span<const uint64_t> Offsets() const { return offsets_; }
+  [[nodiscard]] std::span<const uint32_t> Targets() const { return targets_; }
+  [[nodiscard]] std::span<const int32_t> Weights() const { return weights_; }
+
+  [[nodiscard]] int32_t MaxWeight() const;
+
+ private:
+  std::span<const uint64_t> offsets_;
+  std::span<const uint32_t> targets_;
+  std::span<const int32_t> weights_;
+};
+
+// Directed weighted graph in compressed sparse row form which owns its arrays
+class CsrGraph {
+ public:
+  CsrGraph() = default;
+
+  // append an edge to the vertex being built (the vertex number NumVertices())
+  void AddEdge(uint32_t target, int32_t weight) {
+    targets_.push_back(target);
+    weights_.push_back(weight);
+  }
+  // close the vertex being built
+  void FinishVertex() { offsets_.push_back(targets_.size()); }
+  // close vertices until there are num_vertices of them
+  void FinishVertices(size_t num_vertices);
+  // take ready arrays (offsets start with 0 and end with the count of edges)
+  void Assign(std::vector<uint64_t> offsets, std::vector<uint32_t> targets, std::vector<int32_t> weights);
+  void Clear();
+
+  [[nodiscard]] size_t NumVertices() const { return offsets_.size() - 1; }
+  [[nodiscard]] size_t NumEdges() const { return targets_.size(); }
+  [[nodiscard]] uint64_t EdgesBegin(size_t v) const { return offsets_[v]; }
+  [[nodiscard]] uint64_t EdgesEnd(size_t v) const { return offsets_[v + 1]; }
+  [[nodiscard]] uint32_t Target(uint64_t e) const { return targets_[e]; }
+  [[nodiscard]] int32_t Weight(uint64_t e) const { return weights_[e]; }
+
+  [[nodiscard]] std::span<const uint64_t> Offsets() const { return offsets_; }
+  [[nodiscard]] std::span<const uint32_t> Targets() const { return targets_; }
+  [[nodiscard]] std::span<const int32_t> Weights() const { return weights_; }
+
+  [[nodiscard]] int32_t MaxWeight() const { return View().MaxWeight(); }
+
+  [[nodiscard]] CsrGraphView View() const { return {offsets_, targets_, weights_}; }
+  // graph algorithms take views, so an owned graph can be passed to them directly
+  operator CsrGraphView() const { return View(); }  // NOLINT(google-explicit-constructor)
+
+ private:
+  std::vector<uint64_t> offsets_{0};
+  std::vector<uint32_t> targets_;
+  std::vector<int32_t> weights_;
+};
+
+}  // namespace ppc::core::graph
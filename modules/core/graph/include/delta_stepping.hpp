@@ -0,0 +1,178 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <vector>
+
+#include "core/graph/include/csr_graph.hpp"
+
+namespace ppc::core::graph {
+
+constexpr int kInfiniteDistance = std::numeric_limits<int>::max();
+
+// Bucket width for delta-stepping: about the maximal weight divided by the average degree,
+// so a bucket holds enough vertices to be processed in parallel without many re-relaxations
+int ChooseDelta(const CsrGraphView &graph);
+
+// Single-source shortest paths (non-negative weights) by delta-stepping (Meyer, Sanders).
+// Vertices are kept in buckets of width delta by their tentative distance. The lowest bucket is processed in
+// rounds: its vertices relax light edges (weight <= delta) in parallel, which may put vertices back into it;
+// once it is empty, heavy edges of all vertices removed from it are relaxed. Relaxation is an atomic minimum.
+// parallel_for(begin, end, body) must call body(chunk_begin, chunk_end) for chunks covering [begin, end),
+// num_chunks is the count of chunks work of one round is split into (a few per thread).
+// Unreachable vertices get kInfiniteDistance.
+template <typename ParallelFor>
+void DeltaStepping(const CsrGraphView &graph, size_t source, int delta, std::span<int> distances, size_t num_chunks,
+                   const ParallelFor &parallel_for);
+
+namespace detail {
+
+class DeltaBuckets {
+ public:
+  DeltaBuckets(size_t num_vertices, int delta, int max_weight)
+      : delta_(delta),
+        // vertices are queued at most max_weight above the lowest bucket, so buckets are reused cyclically
+        buckets_((static_cast<size_t>(max_weight) / static_cast<size_t>(delta)) + 2),
+        queued_in_(num_vertices, 0) {}
+
+  [[nodiscard]] size_t BucketOf(int distance) const { return static_cast<size_t>(distance / delta_); }
+  [[nodiscard]] bool Empty() const { return pending_ == 0; }
+
+  // queue the vertex to the bucket of its distance unless it is already there
+  void Push(uint32_t v, int distance) {
+    const size_t bucket = BucketOf(distance);
+    if (queued_in_[v] == bucket + 1) {
+      return;
+    }
+    queued_in_[v] = bucket + 1;
+    buckets_[bucket % buckets_.size()].push_back(v);
+    pending_++;
+  }
+
+  // index of the lowest non-empty bucket not below current
+  [[nodiscard]] size_t NextBucket(size_t current) const {
+    while (buckets_[current % buckets_.size()].empty()) {
+      current++;
+    }
+    return current;
+  }
+
+  // move out vertices of the bucket which still belong to it
+  void Take(size_t bucket, std::vector<uint32_t> &frontier, std::span<const int> distances) {
+    auto &slot = buckets_[bucket % buckets_.size()];
+    pending_ -= slot.size();
+    frontier.clear();
+    for (const auto v : slot) {
+      if (queued_in_[v] == bucket + 1) {
+        queued_in_[v] = 0;
+        if (BucketOf(distances[v]) == bucket) {
+          frontier.push_back(v);
+        }
+      }
+    }
+    slot.clear();
+  }
+
+ private:
+  int delta_;
+  std::vector<std::vector<uint32_t>> buckets_;
+  std::vector<size_t> queued_in_;
+  size_t pending_ = 0;
+};
+
+// relax light or heavy edges of vertices, improved vertices are collected per chunk
+template <typename ParallelFor>
+void RelaxEdges(const CsrGraphView &graph, std::span<const uint32_t> vertices, bool light, int delta,
+                std::span<int> distances, std::vector<std::vector<uint32_t>> &improved,
+                const ParallelFor &parallel_for) {
+  const size_t num_chunks = std::min(improved.size(), vertices.size());
+  parallel_for(0, num_chunks, [&](size_t chunk_begin, size_t chunk_end) {
+    for (size_t chunk = chunk_begin; chunk < chunk_end; chunk++) {
+      auto &out = improved[chunk];
+      const size_t first = vertices.size() * chunk / num_chunks;
+      const size_t last = vertices.size() * (chunk + 1) / num_chunks;
+      for (size_t i = first; i < last; i++) {
+        const uint32_t u = vertices[i];
+        const int64_t dist_u = std::atomic_ref<int>(distances[u]).load(std::memory_order_relaxed);
+        for (uint64_t e = graph.EdgesBegin(u); e < graph.EdgesEnd(u); e++) {
+          const int32_t weight = graph.Weight(e);
+          if ((weight <= delta) != light) {
+            continue;
+          }
+          const int64_t candidate = dist_u + weight;
+          if (candidate >= kInfiniteDistance) {
+            continue;
+          }
+          const uint32_t v = graph.Target(e);
+          std::atomic_ref<int> dist_v(distances[v]);
+          int old_dist = dist_v.load(std::memory_order_relaxed);
+          while (candidate < old_dist) {
+            if (dist_v.compare_exchange_weak(old_dist, static_cast<int>(candidate), std::memory_order_relaxed)) {
+              out.push_back(v);
+              break;
+            }
+          }
+        }
+      }
+    }
+  });
+}
+
+inline void QueueImproved(std::vector<std::vector<uint32_t>> &improved, std::span<const int> distances,
+                          DeltaBuckets &buckets) {
+  for (auto &out : improved) {
+    for (const auto v : out) {
+      buckets.Push(v, distances[v]);
+    }
+    out.clear();
+  }
+}
+
+}  // namespace detail
+
+template <typename ParallelFor>
+void DeltaStepping(const CsrGraphView &graph, size_t source, int delta, std::span<int> distances, size_t num_chunks,
+                   const ParallelFor &parallel_for) {
+  std::ranges::fill(distances, kInfiniteDistance);
+  if (source >= graph.NumVertices()) {
+    return;
+  }
+  delta = std::max(delta, 1);
+  distances[source] = 0;
+
+  detail::DeltaBuckets buckets(graph.NumVertices(), delta, graph.MaxWeight());
+  std::vector<std::vector<uint32_t>> improved(std::max<size_t>(num_chunks, 1));
+  std::vector<uint32_t> frontier;
+  std::vector<uint32_t> settled;
+  std::vector<uint8_t> is_settled(graph.NumVertices(), 0);
+
+  buckets.Push(static_cast<uint32_t>(source), 0);
+  size_t current = 0;
+  while (!buckets.Empty()) {
+    current = buckets.NextBucket(current);
+    settled.clear();
+    buckets.Take(current, frontier, distances);
+    while (!frontier.empty()) {
+      detail::RelaxEdges(graph, frontier, true, delta, distances, improved, parallel_for);
+      for (const auto v : frontier) {
+        if (is_settled[v] == 0) {
+          is_settled[v] = 1;
+          settled.push_back(v);
+        }
+      }
+      detail::QueueImproved(improved, distances, buckets);
+      buckets.Take(current, frontier, distances);
+    }
+    detail::RelaxEdges(graph, settled, false, delta, distances, improved, parallel_for);
+    detail::QueueImproved(improved, distances, buckets);
+    for (const auto v : settled) {
+      is_settled[v] = 0;
+    }
+  }
+}
+
+}  // namespace ppc::core::graph
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "core/graph/include/csr_graph.hpp"
+
+namespace ppc::core::graph {
+
+// Road-like graph: rows x cols grid, every vertex is connected with its 4 neighbours in both directions,
+// weights are uniform in [1, max_weight]
+CsrGraph MakeGridGraph(size_t rows, size_t cols, int max_weight, uint64_t seed);
+
+// Power-law graph: R-MAT (Graph500 parameters) with 2^scale vertices and edge_factor * 2^scale edges,
+// weights are uniform in [1, max_weight]
+CsrGraph MakeRmatGraph(unsigned scale, size_t edge_factor, int max_weight, uint64_t seed);
+
+// Stream used by task data of the Dijkstra tasks: pairs (target, weight) of every vertex followed by -1
+std::vector<int> ToAdjacencyStream(const CsrGraph &graph);
+
+}  // namespace ppc::core::graph
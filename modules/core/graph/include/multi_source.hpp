@@ -0,0 +1,61 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <optional>
+#include <span>
+
+#include "core/graph/include/csr_graph.hpp"
+#include "core/task/include/task.hpp"
+
+namespace ppc::core::graph {
+
+// Count of sources searched together by one pass over the edges
+constexpr size_t kSourceLanes = 8;
+
+// Shortest paths (non-negative weights) from every source: row k of distances (K x V, row-major) gets
+// the distances from sources[k], kInfiniteDistance for unreachable vertices and for a source out of range.
+// Sources are taken in groups of kSourceLanes. A vertex keeps a distance per source of its group, so one
+// relaxation of an edge updates all of them with vector instructions; the vertex is queued (by the least
+// improved distance) again whenever any of them improves, which makes the search label-correcting.
+// Groups run in parallel: parallel_for(begin, end, body) must call body(chunk_begin, chunk_end) for chunks
+// covering the range of groups.
+template <typename ParallelFor>
+void MultiSourceShortestPaths(const CsrGraphView &graph, std::span<const int> sources, std::span<int> distances,
+                              const ParallelFor &parallel_for);
+
+// Batched query in task data of the Dijkstra tasks: output 0 is added with shape {K, V}
+// (TaskData::AddOutput) and input 1 holds the K source vertices
+struct BatchedQuery {
+  std::span<const int> sources;
+  std::span<int> distances;
+  size_t num_vertices = 0;
+};
+
+// The query if output 0 has a rank-2 shape, std::nullopt for the single-source form.
+// Throws std::invalid_argument if input 1 does not hold one source per row.
+std::optional<BatchedQuery> GetBatchedQuery(const TaskData &task_data);
+
+namespace detail {
+
+// sources.size() <= kSourceLanes, distances has a row per source
+void ShortestPathsGroup(const CsrGraphView &graph, std::span<const int> sources, std::span<int> distances);
+
+}  // namespace detail
+
+template <typename ParallelFor>
+void MultiSourceShortestPaths(const CsrGraphView &graph, std::span<const int> sources, std::span<int> distances,
+                              const ParallelFor &parallel_for) {
+  const size_t num_vertices = graph.NumVertices();
+  const size_t num_groups = (sources.size() + kSourceLanes - 1) / kSourceLanes;
+  parallel_for(0, num_groups, [&](size_t group_begin, size_t group_end) {
+    for (size_t group = group_begin; group < group_end; group++) {
+      const size_t first = group * kSourceLanes;
+      const size_t count = std::min(kSourceLanes, sources.size() - first);
+      detail::ShortestPathsGroup(graph, sources.subspan(first, count),
+                                 distances.subspan(first * num_vertices, count * num_vertices));
+    }
+  });
+}
+
+}  // namespace ppc::core::graph
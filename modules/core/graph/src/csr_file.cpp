@@ -0,0 +1,148 @@
+#include "core/graph/include/csr_file.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <ios>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "core/graph/include/csr_graph.hpp"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+constexpr std::array<char, 8> kMagic = {'P', 'P', 'C', 'C', 'S', 'R', '0', '1'};
+
+struct FileHeader {
+  std::array<char, 8> magic;
+  uint64_t num_vertices;
+  uint64_t num_edges;
+};
+
+// byte offsets of the arrays in the file
+struct FileLayout {
+  size_t offsets;
+  size_t targets;
+  size_t weights;
+  size_t size;
+};
+
+FileLayout GetLayout(uint64_t num_vertices, uint64_t num_edges) {
+  FileLayout layout{};
+  layout.offsets = sizeof(FileHeader);
+  layout.targets = layout.offsets + ((num_vertices + 1) * sizeof(uint64_t));
+  layout.weights = layout.targets + ((num_edges * sizeof(uint32_t) + 7) / 8 * 8);
+  layout.size = layout.weights + (num_edges * sizeof(int32_t));
+  return layout;
+}
+
+ppc::core::graph::CsrGraphView ViewFile(const std::byte *data, size_t size, const std::filesystem::path &path) {
+  FileHeader header{};
+  if (size < sizeof(header)) {
+    throw std::runtime_error("Graph file is too short: " + path.string());
+  }
+  std::memcpy(&header, data, sizeof(header));
+  if (header.magic != kMagic) {
+    throw std::runtime_error("Not a graph file: " + path.string());
+  }
+  const FileLayout layout = GetLayout(header.num_vertices, header.num_edges);
+  if (layout.size != size) {
+    throw std::runtime_error("Graph file size does not match its header: " + path.string());
+  }
+  const std::span offsets(reinterpret_cast<const uint64_t *>(data + layout.offsets), header.num_vertices + 1);
+  if (offsets.front() != 0 || offsets.back() != header.num_edges) {
+    throw std::runtime_error("Graph file offsets do not match its header: " + path.string());
+  }
+  return {offsets, std::span(reinterpret_cast<const uint32_t *>(data + layout.targets), header.num_edges),
+          std::span(reinterpret_cast<const int32_t *>(data + layout.weights), header.num_edges)};
+}
+
+}  // namespace
+
+void ppc::core::graph::SaveCsrGraph(const CsrGraphView &graph, const std::filesystem::path &path) {
+  std::ofstream file(path, std::ios::binary | std::ios::trunc);
+  if (!file) {
+    throw std::runtime_error("Can't create graph file: " + path.string());
+  }
+  const FileHeader header{.magic = kMagic, .num_vertices = graph.NumVertices(), .num_edges = graph.NumEdges()};
+  const FileLayout layout = GetLayout(header.num_vertices, header.num_edges);
+  const std::array<char, 8> padding{};
+  auto write = [&file](const void *data, size_t size) {
+    file.write(static_cast<const char *>(data), static_cast<std::streamsize>(size));
+  };
+  write(&header, sizeof(header));
+  if (graph.NumVertices() == 0) {
+    const uint64_t zero = 0;
+    write(&zero, sizeof(zero));
+  } else {
+    write(graph.Offsets().data(), graph.Offsets().size_bytes());
+  }
+  write(graph.Targets().data(), graph.Targets().size_bytes());
+  write(padding.data(), layout.weights - layout.targets - graph.Targets().size_bytes());
+  write(graph.Weights().data(), graph.Weights().size_bytes());
+  if (!file) {
+    throw std::runtime_error("Can't write graph file: " + path.string());
+  }
+}
+
+ppc::core::graph::MappedCsrGraph::MappedCsrGraph(const std::filesystem::path &path) {
+#ifdef _WIN32
+  std::ifstream file(path, std::ios::binary);
+  if (!file) {
+    throw std::runtime_error("Can't open graph file: " + path.string());
+  }
+  const auto size = static_cast<size_t>(std::filesystem::file_size(path));
+  buffer_.resize((size + sizeof(uint64_t) - 1) / sizeof(uint64_t));
+  file.read(reinterpret_cast<char *>(buffer_.data()), static_cast<std::streamsize>(size));
+  if (!file) {
+    throw std::runtime_error("Can't read graph file: " + path.string());
+  }
+  view_ = ViewFile(reinterpret_cast<const std::byte *>(buffer_.data()), size, path);
+#else
+  const int fd = open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    throw std::runtime_error("Can't open graph file: " + path.string());
+  }
+  struct stat status{};
+  if (fstat(fd, &status) != 0 || status.st_size == 0) {
+    close(fd);
+    throw std::runtime_error("Can't read graph file: " + path.string());
+  }
+  mapping_size_ = static_cast<size_t>(status.st_size);
+  mapping_ = mmap(nullptr, mapping_size_, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (mapping_ == MAP_FAILED) {
+    mapping_ = nullptr;
+    throw std::runtime_error("Can't map graph file: " + path.string());
+  }
+  try {
+    view_ = ViewFile(static_cast<const std::byte *>(mapping_), mapping_size_, path);
+  } catch (...) {
+    Unmap();
+    throw;
+  }
+#endif
+}
+
+ppc::core::graph::MappedCsrGraph::~MappedCsrGraph() { Unmap(); }
+
+void ppc::core::graph::MappedCsrGraph::Unmap() {
+#ifndef _WIN32
+  if (mapping_ != nullptr) {
+    munmap(mapping_, mapping_size_);
+    mapping_ = nullptr;
+  }
+#endif
+}
@@ -0,0 +1,33 @@
+#include "core/graph/include/csr_graph.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+int32_t ppc::core::graph::CsrGraphView::MaxWeight() const {
+  return weights_.empty() ? 0 : *std::ranges::max_element(weights_);
+}
+
+void ppc::core::graph::CsrGraph::FinishVertices(size_t num_vertices) {
+  while (NumVertices() < num_vertices) {
+    FinishVertex();
+  }
+}
+
+void ppc::core::graph::CsrGraph::Assign(std::vector<uint64_t> offsets, std::vector<uint32_t> targets,
+                                        std::vector<int32_t> weights) {
+  offsets_ = std::move(offsets);
+  targets_ = std::move(targets);
+  weights_ = std::move(weights);
+  if (offsets_.empty()) {
+    offsets_.push_back(0);
+  }
+}
+
+void ppc::core::graph::CsrGraph::Clear() {
+  offsets_.assign(1, 0);
+  targets_.clear();
+  weights_.clear();
+}
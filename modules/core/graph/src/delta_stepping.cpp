@@ -0,0 +1,14 @@
+#include "core/graph/include/delta_stepping.hpp"
+
+#include <algorithm>
+#include <cstddef>
+
+#include "core/graph/include/csr_graph.hpp"
+
+int ppc::core::graph::ChooseDelta(const CsrGraphView &graph) {
+  if (graph.NumVertices() == 0 || graph.NumEdges() == 0) {
+    return 1;
+  }
+  const size_t average_degree = std::max<size_t>(graph.NumEdges() / graph.NumVertices(), 1);
+  return std::max(1, static_cast<int>(static_cast<size_t>(graph.MaxWeight()) / average_degree));
+}
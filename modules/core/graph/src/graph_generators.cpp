@@ -0,0 +1,94 @@
+#include "core/graph/include/graph_generators.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "core/graph/include/csr_graph.hpp"
+
+ppc::core::graph::CsrGraph ppc::core::graph::MakeGridGraph(size_t rows, size_t cols, int max_weight, uint64_t seed) {
+  std::mt19937_64 rng(seed);
+  std::uniform_int_distribution<int> weight(1, max_weight);
+  CsrGraph graph;
+  const std::array<std::array<int64_t, 2>, 4> shifts = {{{-1, 0}, {0, -1}, {0, 1}, {1, 0}}};
+  for (size_t r = 0; r < rows; r++) {
+    for (size_t c = 0; c < cols; c++) {
+      for (const auto &[dr, dc] : shifts) {
+        const auto nr = static_cast<int64_t>(r) + dr;
+        const auto nc = static_cast<int64_t>(c) + dc;
+        if (nr >= 0 && nr < static_cast<int64_t>(rows) && nc >= 0 && nc < static_cast<int64_t>(cols)) {
+          graph.AddEdge(static_cast<uint32_t>((nr * static_cast<int64_t>(cols)) + nc), weight(rng));
+        }
+      }
+      graph.FinishVertex();
+    }
+  }
+  return graph;
+}
+
+ppc::core::graph::CsrGraph ppc::core::graph::MakeRmatGraph(unsigned scale, size_t edge_factor, int max_weight,
+                                                           uint64_t seed) {
+  std::mt19937_64 rng(seed);
+  std::uniform_real_distribution<double> unit(0.0, 1.0);
+  std::uniform_int_distribution<int> weight(1, max_weight);
+  const size_t num_vertices = size_t{1} << scale;
+  const size_t num_edges = edge_factor * num_vertices;
+
+  // quadrant probabilities a, b, c (d is the rest)
+  constexpr double kA = 0.57;
+  constexpr double kB = 0.19;
+  constexpr double kC = 0.19;
+  std::vector<uint32_t> sources(num_edges);
+  std::vector<uint32_t> targets(num_edges);
+  for (size_t e = 0; e < num_edges; e++) {
+    uint32_t u = 0;
+    uint32_t v = 0;
+    for (unsigned bit = 0; bit < scale; bit++) {
+      const double p = unit(rng);
+      const bool right = (p >= kA && p < kA + kB) || p >= kA + kB + kC;
+      const bool down = p >= kA + kB;
+      u |= static_cast<uint32_t>(down) << bit;
+      v |= static_cast<uint32_t>(right) << bit;
+    }
+    sources[e] = u;
+    targets[e] = v;
+  }
+
+  // group edges by source with a counting sort
+  std::vector<size_t> offsets(num_vertices + 1, 0);
+  for (const auto u : sources) {
+    offsets[u + 1]++;
+  }
+  for (size_t v = 0; v < num_vertices; v++) {
+    offsets[v + 1] += offsets[v];
+  }
+  std::vector<uint32_t> sorted_targets(num_edges);
+  auto position = offsets;
+  for (size_t e = 0; e < num_edges; e++) {
+    sorted_targets[position[sources[e]]++] = targets[e];
+  }
+
+  CsrGraph graph;
+  for (size_t u = 0; u < num_vertices; u++) {
+    for (size_t e = offsets[u]; e < offsets[u + 1]; e++) {
+      graph.AddEdge(sorted_targets[e], weight(rng));
+    }
+    graph.FinishVertex();
+  }
+  return graph;
+}
+
+std::vector<int> ppc::core::graph::ToAdjacencyStream(const CsrGraph &graph) {
+  std::vector<int> stream;
+  stream.reserve((2 * graph.NumEdges()) + graph.NumVertices());
+  for (size_t u = 0; u < graph.NumVertices(); u++) {
+    for (uint64_t e = graph.EdgesBegin(u); e < graph.EdgesEnd(u); e++) {
+      stream.push_back(static_cast<int>(graph.Target(e)));
+      stream.push_back(graph.Weight(e));
+    }
+    stream.push_back(-1);
+  }
+  return stream;
+}
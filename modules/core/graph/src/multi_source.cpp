@@ -0,0 +1,112 @@
+#include "core/graph/include/multi_source.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <queue>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "core/graph/include/csr_graph.hpp"
+#include "core/graph/include/delta_stepping.hpp"
+#include "core/task/include/task.hpp"
+
+namespace {
+
+using Lanes = std::array<int, ppc::core::graph::kSourceLanes>;
+static_assert(ppc::core::graph::kSourceLanes <= 8, "lane masks are bytes");
+
+// to = min(to, from + weight) lane-wise, sums saturate at kInfiniteDistance; the mask of improved lanes
+uint32_t RelaxLanes(const Lanes &from, int weight, Lanes &to) {
+  const int limit = ppc::core::graph::kInfiniteDistance - weight;
+  uint32_t improved = 0;
+  for (size_t lane = 0; lane < to.size(); lane++) {
+    const int candidate = std::min(from[lane], limit) + weight;
+    improved |= static_cast<uint32_t>(candidate < to[lane]) << lane;
+    to[lane] = std::min(to[lane], candidate);
+  }
+  return improved;
+}
+
+int MinOfLanes(const Lanes &lanes, uint32_t mask) {
+  int res = ppc::core::graph::kInfiniteDistance;
+  for (size_t lane = 0; lane < lanes.size(); lane++) {
+    if (((mask >> lane) & 1U) != 0) {
+      res = std::min(res, lanes[lane]);
+    }
+  }
+  return res;
+}
+
+}  // namespace
+
+void ppc::core::graph::detail::ShortestPathsGroup(const CsrGraphView &graph, std::span<const int> sources,
+                                                  std::span<int> distances) {
+  const size_t num_vertices = graph.NumVertices();
+  Lanes infinite;
+  infinite.fill(kInfiniteDistance);
+  std::vector<Lanes> dist(num_vertices, infinite);
+  // lanes improved since the vertex was expanded last time
+  std::vector<uint8_t> pending(num_vertices, 0);
+  using Item = std::pair<int, uint32_t>;
+  std::priority_queue<Item, std::vector<Item>, std::greater<>> queue;
+
+  for (size_t lane = 0; lane < sources.size(); lane++) {
+    const auto source = static_cast<size_t>(sources[lane]);
+    if (sources[lane] >= 0 && source < num_vertices) {
+      dist[source][lane] = 0;
+      pending[source] |= static_cast<uint8_t>(1U << lane);
+      queue.emplace(0, static_cast<uint32_t>(source));
+    }
+  }
+
+  while (!queue.empty()) {
+    const auto [key, u] = queue.top();
+    queue.pop();
+    if (pending[u] == 0 || key != MinOfLanes(dist[u], pending[u])) {
+      continue;
+    }
+    pending[u] = 0;
+    const Lanes from = dist[u];
+    for (uint64_t e = graph.EdgesBegin(u); e < graph.EdgesEnd(u); e++) {
+      const uint32_t v = graph.Target(e);
+      const uint32_t improved = RelaxLanes(from, graph.Weight(e), dist[v]);
+      if (improved != 0) {
+        pending[v] |= static_cast<uint8_t>(improved);
+        queue.emplace(MinOfLanes(dist[v], pending[v]), v);
+      }
+    }
+  }
+
+  for (size_t lane = 0; lane < sources.size(); lane++) {
+    auto row = distances.subspan(lane * num_vertices, num_vertices);
+    for (size_t v = 0; v < num_vertices; v++) {
+      row[v] = dist[v][lane];
+    }
+  }
+}
+
+std::optional<ppc::core::graph::BatchedQuery> ppc::core::graph::GetBatchedQuery(const TaskData &task_data) {
+  if (!task_data.HasOutputInfo(0) || task_data.outputs_info[0].extents.size() != 2) {
+    return std::nullopt;
+  }
+  const auto matrix = task_data.GetOutputView<int, 2>(0);
+  if (!matrix.IsContiguous()) {
+    throw std::invalid_argument("Batched query needs a contiguous distance matrix");
+  }
+  if (task_data.inputs.size() < 2) {
+    throw std::invalid_argument("Batched query needs the sources in input 1");
+  }
+  const auto sources = task_data.GetInput<const int>(1);
+  if (sources.size() != matrix.Extent(0)) {
+    throw std::invalid_argument("Batched query needs one source per row of the distance matrix");
+  }
+  return BatchedQuery{.sources = sources,
+                      .distances = std::span(matrix.Data(), matrix.Size()),
+                      .num_vertices = matrix.Extent(1)};
+}
@@ -1,12 +1,21 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <chrono>
 #include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
 #include <memory>
+#include <string>
+#include <thread>
 #include <vector>
 
 #include "core/perf/func_tests/test_task.hpp"
 #include "core/perf/include/perf.hpp"
+#include "core/perf/include/perf_counters.hpp"
+#include "core/perf/include/thread_sweep.hpp"
+#include "core/perf/include/timers.hpp"
 #include "core/task/include/task.hpp"
 
 TEST(perf_tests, check_perf_pipeline) {
@@ -175,3 +184,348 @@ TEST(perf_tests, check_perf_task_float) {
   ASSERT_LE(perf_results->time_sec, ppc::core::PerfResults::kMaxTime);
   EXPECT_EQ(out[0], in.size());
 }
+
+TEST(perf_tests, check_perf_samples_and_warmup) {
+  // Create data
+  std::vector<uint32_t> in(2000, 1);
+  std::vector<uint32_t> out(1, 0);
+
+  // Create task_data
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  task_data->inputs_count.emplace_back(in.size());
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  task_data->outputs_count.emplace_back(out.size());
+
+  // Create Task
+  auto test_task = std::make_shared<ppc::test::perf::TestTask<uint32_t>>(task_data);
+
+  // Create Perf attributes: every timed run takes 1, 2, 3, ... ms
+  auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
+  perf_attr->num_running = 10;
+  perf_attr->num_warmup = 3;
+  double fake_time = 0.0;
+  uint64_t timer_calls = 0;
+  perf_attr->current_timer = [&] {
+    timer_calls++;
+    if (timer_calls % 2 == 0) {
+      fake_time += 1e-3 * static_cast<double>(timer_calls / 2);
+    }
+    return fake_time;
+  };
+
+  // Create and init perf results
+  auto perf_results = std::make_shared<ppc::core::PerfResults>();
+
+  // Create Perf analyzer
+  ppc::core::Perf perf_analyzer(test_task);
+  perf_analyzer.PipelineRun(perf_attr, perf_results);
+
+  EXPECT_EQ(timer_calls, 2 * perf_attr->num_running);
+  ASSERT_EQ(perf_results->samples_sec.size(), perf_attr->num_running);
+  EXPECT_EQ(perf_results->num_warmup, 3U);
+  EXPECT_FALSE(perf_results->stopped_early);
+  EXPECT_NEAR(perf_results->time_sec, 55e-3, 1e-9);
+  EXPECT_NEAR(perf_results->min_sec, 1e-3, 1e-9);
+  EXPECT_NEAR(perf_results->max_sec, 10e-3, 1e-9);
+  EXPECT_NEAR(perf_results->mean_sec, 5.5e-3, 1e-9);
+  EXPECT_NEAR(perf_results->median_sec, 5.5e-3, 1e-9);
+  EXPECT_NEAR(perf_results->p90_sec, 9.1e-3, 1e-9);
+  EXPECT_LE(perf_results->p90_sec, perf_results->p99_sec);
+  EXPECT_GT(perf_results->stddev_sec, 0.0);
+  EXPECT_LT(perf_results->ci_low_sec, perf_results->mean_sec);
+  EXPECT_GT(perf_results->ci_high_sec, perf_results->mean_sec);
+  EXPECT_EQ(out[0], in.size());
+}
+
+TEST(perf_tests, check_perf_early_stop_on_stable_samples) {
+  // Create data
+  std::vector<uint32_t> in(2000, 1);
+  std::vector<uint32_t> out(1, 0);
+
+  // Create task_data
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  task_data->inputs_count.emplace_back(in.size());
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  task_data->outputs_count.emplace_back(out.size());
+
+  // Create Task
+  auto test_task = std::make_shared<ppc::test::perf::TestTask<uint32_t>>(task_data);
+
+  // Create Perf attributes: every timed run takes exactly 2 ms
+  auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
+  perf_attr->num_running = 100;
+  perf_attr->min_running = 5;
+  perf_attr->target_rel_ci = 0.01;
+  double fake_time = 0.0;
+  perf_attr->current_timer = [&] {
+    fake_time += 1e-3;
+    return fake_time;
+  };
+
+  // Create and init perf results
+  auto perf_results = std::make_shared<ppc::core::PerfResults>();
+
+  // Create Perf analyzer
+  ppc::core::Perf perf_analyzer(test_task);
+  perf_analyzer.TaskRun(perf_attr, perf_results);
+
+  EXPECT_TRUE(perf_results->stopped_early);
+  EXPECT_EQ(perf_results->samples_sec.size(), perf_attr->min_running);
+  EXPECT_NEAR(perf_results->mean_sec, 1e-3, 1e-9);
+  EXPECT_NEAR(perf_results->time_sec, 1e-3 * static_cast<double>(perf_attr->num_running), 1e-9);
+  EXPECT_NEAR(perf_results->stddev_sec, 0.0, 1e-9);
+  EXPECT_EQ(out[0], in.size());
+}
+
+TEST(perf_tests, check_perf_early_stop_from_env) {
+  std::vector<uint32_t> in(2000, 1);
+  std::vector<uint32_t> out(1, 0);
+
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  task_data->inputs_count.emplace_back(in.size());
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  task_data->outputs_count.emplace_back(out.size());
+
+  auto test_task = std::make_shared<ppc::test::perf::TestTask<uint32_t>>(task_data);
+
+  // target_rel_ci is left at 0, so PPC_PERF_TARGET_REL_CI enables the early stop
+  auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
+  perf_attr->num_running = 100;
+  perf_attr->min_running = 5;
+  double fake_time = 0.0;
+  perf_attr->current_timer = [&] {
+    fake_time += 1e-3;
+    return fake_time;
+  };
+
+  auto perf_results = std::make_shared<ppc::core::PerfResults>();
+  ppc::core::Perf perf_analyzer(test_task);
+  setenv("PPC_PERF_TARGET_REL_CI", "0.01", 1);  // NOLINT(misc-include-cleaner)
+  perf_analyzer.TaskRun(perf_attr, perf_results);
+  unsetenv("PPC_PERF_TARGET_REL_CI");  // NOLINT(misc-include-cleaner)
+  EXPECT_TRUE(perf_results->stopped_early);
+  EXPECT_EQ(perf_results->samples_sec.size(), perf_attr->min_running);
+
+  perf_analyzer.TaskRun(perf_attr, perf_results);
+  EXPECT_FALSE(perf_results->stopped_early);
+  EXPECT_EQ(perf_results->samples_sec.size(), perf_attr->num_running);
+}
+
+TEST(perf_tests, check_perf_structured_output) {
+  auto perf_results = std::make_shared<ppc::core::PerfResults>();
+  perf_results->task_id = "example";
+  perf_results->backend = "omp";
+  perf_results->num_threads = 4;
+  perf_results->input_size = 2000;
+  perf_results->type_of_running = ppc::core::PerfResults::kPipeline;
+  perf_results->samples_sec = {0.5, 0.25};
+  perf_results->counters["cycles"] = 42;
+  ppc::core::Perf::ComputeStatistics(perf_results);
+
+  const auto json = ppc::core::Perf::FormatJson(*perf_results);
+  EXPECT_NE(json.find("\"task_id\":\"example\""), std::string::npos);
+  EXPECT_NE(json.find("\"backend\":\"omp\""), std::string::npos);
+  EXPECT_NE(json.find("\"type_of_running\":\"pipeline\""), std::string::npos);
+  EXPECT_NE(json.find("\"num_threads\":4"), std::string::npos);
+  EXPECT_NE(json.find("\"input_size\":2000"), std::string::npos);
+  EXPECT_NE(json.find("\"samples_sec\":[0.5,0.25]"), std::string::npos);
+  EXPECT_NE(json.find("\"counters\":{\"cycles\":42}"), std::string::npos);
+
+  const auto csv = ppc::core::Perf::FormatCsv(*perf_results);
+  const auto header = ppc::core::Perf::CsvHeader();
+  EXPECT_EQ(std::count(csv.begin(), csv.end(), ','), std::count(header.begin(), header.end(), ','));
+  EXPECT_EQ(csv.rfind("example,omp,pipeline,4,2000,", 0), 0U);
+  EXPECT_NE(csv.find("0.5;0.25,cycles=42"), std::string::npos);
+
+  perf_results->task_id = "a\"b\\c\n\t\x01";
+  EXPECT_NE(ppc::core::Perf::FormatJson(*perf_results).find(R"("task_id":"a\"b\\c\u000a\u0009\u0001")"),
+            std::string::npos);
+}
+
+TEST(perf_tests, check_perf_export_to_file) {
+#ifndef _WIN32
+  const auto path = std::filesystem::temp_directory_path() / "ppc_perf_export_test.jsonl";
+  std::filesystem::remove(path);
+  setenv("PPC_PERF_OUTPUT", path.string().c_str(), 1);  // NOLINT(misc-include-cleaner)
+
+  auto perf_results = std::make_shared<ppc::core::PerfResults>();
+  perf_results->samples_sec = {0.1};
+  ppc::core::Perf::ComputeStatistics(perf_results);
+  ppc::core::Perf::ExportPerfStatistic(perf_results);
+  ppc::core::Perf::ExportPerfStatistic(perf_results);
+  unsetenv("PPC_PERF_OUTPUT");  // NOLINT(misc-include-cleaner)
+
+  std::ifstream input(path);
+  std::vector<std::string> lines;
+  for (std::string line; std::getline(input, line);) {
+    lines.push_back(line);
+  }
+  ASSERT_EQ(lines.size(), 2U);
+  EXPECT_NE(lines[0].find("\"task_id\":\"perf_tests\""), std::string::npos);
+  EXPECT_NE(lines[0].find("\"backend\":\"none\""), std::string::npos);
+  std::filesystem::remove(path);
+#else
+  GTEST_SKIP();
+#endif
+}
+
+TEST(perf_tests, check_perf_hw_counters) {
+  // Create data
+  std::vector<uint32_t> in(2000, 1);
+  std::vector<uint32_t> out(1, 0);
+
+  // Create task_data
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  task_data->inputs_count.emplace_back(in.size());
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  task_data->outputs_count.emplace_back(out.size());
+
+  // Create Task
+  auto test_task = std::make_shared<ppc::test::perf::TestTask<uint32_t>>(task_data);
+
+  // Create Perf attributes
+  auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
+  perf_attr->num_running = 10;
+  perf_attr->hw_counters = true;
+
+  // Create and init perf results
+  auto perf_results = std::make_shared<ppc::core::PerfResults>();
+
+  // Create Perf analyzer
+  ppc::core::Perf perf_analyzer(test_task);
+  perf_analyzer.PipelineRun(perf_attr, perf_results);
+
+  // Counters may be unavailable (containers, perf_event_paranoid), then the run still succeeds without them
+  const ppc::core::PerfCounters counters;
+  if (!counters.IsAvailable()) {
+    EXPECT_TRUE(perf_results->counters.empty());
+  } else {
+    EXPECT_FALSE(perf_results->counters.empty());
+  }
+  if (perf_results->counters.contains("cycles") && perf_results->counters.contains("instructions")) {
+    EXPECT_GT(perf_results->counters["ipc"], 0.0);
+  }
+  EXPECT_EQ(out[0], in.size());
+}
+
+TEST(perf_tests, check_thread_sweep_parse_counts) {
+  EXPECT_EQ(ppc::core::ThreadSweep::ParseThreadCounts("1,2,4", 8), (std::vector<int>{1, 2, 4}));
+  EXPECT_EQ(ppc::core::ThreadSweep::ParseThreadCounts("max", 8), (std::vector<int>{1, 2, 4, 8}));
+  EXPECT_EQ(ppc::core::ThreadSweep::ParseThreadCounts("max", 6), (std::vector<int>{1, 2, 4, 6}));
+  EXPECT_EQ(ppc::core::ThreadSweep::ParseThreadCounts("max", 1), (std::vector<int>{1}));
+  EXPECT_ANY_THROW(ppc::core::ThreadSweep::ParseThreadCounts("1,x", 8));
+  EXPECT_ANY_THROW(ppc::core::ThreadSweep::ParseThreadCounts("0", 8));
+}
+
+TEST(perf_tests, check_thread_sweep_table) {
+  std::vector<ppc::core::ThreadSweep::Record> records = {
+      {.task_id = "example", .backend = "omp", .type_of_running = "pipeline", .num_threads = 1, .time_sec = 8.0},
+      {.task_id = "example", .backend = "omp", .type_of_running = "pipeline", .num_threads = 2, .time_sec = 4.0},
+      {.task_id = "example", .backend = "omp", .type_of_running = "pipeline", .num_threads = 4, .time_sec = 2.5},
+      {.task_id = "example", .backend = "omp", .type_of_running = "pipeline", .num_threads = 8, .time_sec = 2.0},
+      {.task_id = "other", .backend = "tbb", .type_of_running = "task_run", .num_threads = 1, .time_sec = 1.0},
+      {.task_id = "other", .backend = "tbb", .type_of_running = "task_run", .num_threads = 2, .time_sec = 0.5}};
+
+  const auto table = ppc::core::ThreadSweep::FormatTable(records, 0.6);
+  EXPECT_NE(table.find("Thread scaling omp/example:pipeline"), std::string::npos);
+  EXPECT_NE(table.find("Thread scaling tbb/other:task_run"), std::string::npos);
+  // E(4) = 3.2 / 4 = 0.8, E(8) = 4 / 8 = 0.5
+  EXPECT_NE(table.find("omp/example:pipeline drops below 0.6 beyond 4 threads"), std::string::npos);
+  EXPECT_EQ(table.find("tbb/other:task_run drops below"), std::string::npos);
+}
+
+TEST(perf_tests, check_pipeline_overhead_is_constant) {
+  // Microbenchmark of the framework itself: a kernel over one element is dominated by the cost of
+  // Validation() -> PreProcessing() -> Run() -> PostProcessing() calls
+  std::vector<uint32_t> in(1, 1);
+  std::vector<uint32_t> out(1, 0);
+
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  task_data->inputs_count.emplace_back(in.size());
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  task_data->outputs_count.emplace_back(out.size());
+
+  auto test_task = std::make_shared<ppc::test::perf::TestTask<uint32_t>>(task_data);
+  ppc::core::Perf perf_analyzer(test_task);
+
+  auto run = [&](uint64_t num_running) {
+    auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
+    perf_attr->num_running = num_running;
+    const auto t0 = std::chrono::high_resolution_clock::now();
+    perf_attr->current_timer = [&] {
+      auto current_time_point = std::chrono::high_resolution_clock::now();
+      auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(current_time_point - t0).count();
+      return static_cast<double>(duration) * 1e-9;
+    };
+    auto perf_results = std::make_shared<ppc::core::PerfResults>();
+    perf_analyzer.PipelineRun(perf_attr, perf_results);
+    return perf_results->median_sec;
+  };
+
+  const double short_series = run(1000);
+  const double long_series = run(100000);
+
+  // the order check doesn't depend on the count of previous runs
+  EXPECT_LT(long_series, (10 * short_series) + 1e-6);
+}
+
+TEST(perf_tests, check_timers_are_monotonic) {
+  for (const auto kind : {ppc::core::TimerKind::kSteadyClock, ppc::core::TimerKind::kMonotonicRaw,
+                          ppc::core::TimerKind::kTsc, ppc::core::TimerKind::kProcessCpu,
+                          ppc::core::TimerKind::kThreadCpu}) {
+    auto timer = ppc::core::MakeTimer(kind);
+    const double begin = timer();
+    volatile double sink = 0.0;
+    for (int i = 0; i < 1000000; i++) {
+      sink = sink + (i * 0.5);
+    }
+    const double end = timer();
+    EXPECT_GT(end, begin) << ppc::core::GetTimerName(kind);
+    EXPECT_LT(end - begin, 10.0) << ppc::core::GetTimerName(kind);
+  }
+}
+
+TEST(perf_tests, check_tsc_matches_wall_clock) {
+  if (!ppc::core::IsTscAvailable()) {
+    GTEST_SKIP();
+  }
+  EXPECT_GT(ppc::core::TscFrequency(), 1e7);
+  const double tsc_begin = ppc::core::TscTime();
+  const double raw_begin = ppc::core::MonotonicRawTime();
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  const double tsc_time = ppc::core::TscTime() - tsc_begin;
+  const double raw_time = ppc::core::MonotonicRawTime() - raw_begin;
+  EXPECT_NEAR(tsc_time, raw_time, 0.05 * raw_time);
+}
+
+TEST(perf_tests, check_perf_cpu_time) {
+  std::vector<uint32_t> in(2000, 1);
+  std::vector<uint32_t> out(1, 0);
+
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  task_data->inputs_count.emplace_back(in.size());
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  task_data->outputs_count.emplace_back(out.size());
+
+  // a task which sleeps uses almost no CPU time
+  auto test_task = std::make_shared<ppc::test::perf::FakeSleepTask<uint32_t>>(task_data);
+
+  auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
+  perf_attr->num_running = 3;
+  perf_attr->current_timer = ppc::core::MakeTimer(ppc::core::TimerKind::kMonotonicRaw);
+
+  auto perf_results = std::make_shared<ppc::core::PerfResults>();
+  ppc::core::Perf perf_analyzer(test_task);
+  perf_analyzer.TaskRun(perf_attr, perf_results);
+
+  EXPECT_GE(perf_results->time_sec, 0.03);
+  EXPECT_GE(perf_results->cpu_time_sec, 0.0);
+  EXPECT_LT(perf_results->cpu_utilization, 0.5);
+  EXPECT_NE(ppc::core::Perf::FormatJson(*perf_results).find("\"cpu_utilization\":"), std::string::npos);
+}
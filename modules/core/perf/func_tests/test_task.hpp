@@ -48,4 +48,15 @@ class FakePerfTask : public TestTask<T> {
   }
 };
 
+template <class T>
+class FakeSleepTask : public TestTask<T> {
+ public:
+  explicit FakeSleepTask(ppc::core::TaskDataPtr perf_task_data) : TestTask<T>(perf_task_data) {}
+
+  bool RunImpl() override {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    return TestTask<T>::RunImpl();
+  }
+};
+
 }  // namespace ppc::test::perf
@@ -2,8 +2,12 @@
 
 #include <cstdint>
 #include <functional>
+#include <map>
 #include <memory>
+#include <string>
+#include <vector>
 
+#include "core/perf/include/timers.hpp"
 #include "core/task/include/task.hpp"
 
 namespace ppc::core {
@@ -11,14 +15,52 @@ namespace ppc::core {
 struct PerfAttr {
   // count of task's running
   uint64_t num_running;
-  std::function<double()> current_timer = [&] { return 0.0; };
+  // count of untimed runs before measurement (cold caches, lazy allocations, thread pool start-up)
+  uint64_t num_warmup = 0;
+  // early stop: minimal count of timed runs before the stability check is applied
+  uint64_t min_running = 5;
+  // early stop: stop when the 95% confidence half-width of the mean is below this fraction of the mean
+  // (0 takes it from PPC_PERF_TARGET_REL_CI; 0 there too disables early stop, so exactly num_running runs are timed)
+  double target_rel_ci = 0.0;
+  // collect hardware counters of timed runs (also enabled by PPC_PERF_COUNTERS=1)
+  bool hw_counters = false;
+  // time source in seconds, see MakeTimer() for the built-in ones
+  std::function<double()> current_timer = SteadyClockTime;
 };
 
 struct PerfResults {
-  // measurement of task's time (in seconds)
+  // measurement of task's time (in seconds) for num_running runs
   double time_sec = 0.0;
   enum TypeOfRunning : uint8_t { kPipeline, kTaskRun, kNone } type_of_running = kNone;
   constexpr static double kMaxTime = 10.0;
+
+  // per-run samples (in seconds) and their statistics
+  std::vector<double> samples_sec;
+  uint64_t num_warmup = 0;
+  bool stopped_early = false;
+  double min_sec = 0.0;
+  double max_sec = 0.0;
+  double mean_sec = 0.0;
+  double median_sec = 0.0;
+  double p90_sec = 0.0;
+  double p99_sec = 0.0;
+  double stddev_sec = 0.0;
+  // 95% confidence interval of the mean run time
+  double ci_low_sec = 0.0;
+  double ci_high_sec = 0.0;
+
+  // CPU time of all threads of the process during the timed runs and its ratio to their wall time
+  // (about num_threads for a well loaded parallel task, more means oversubscription or spinning)
+  double cpu_time_sec = 0.0;
+  double cpu_utilization = 0.0;
+
+  // description of the measured task for structured output
+  std::string task_id;
+  std::string backend;
+  int num_threads = 1;
+  uint64_t input_size = 0;
+  // named extra metrics (e.g. hardware counters) exported together with the timings
+  std::map<std::string, double> counters;
 };
 
 class Perf {
@@ -35,6 +77,15 @@ class Perf {
   void TaskRun(const std::shared_ptr<PerfAttr>& perf_attr, const std::shared_ptr<PerfResults>& perf_results) const;
   // Pint results for automation checkers
   static void PrintPerfStatistic(const std::shared_ptr<PerfResults>& perf_results);
+  // Append results to the file set by PPC_PERF_OUTPUT: JSON lines for *.jsonl / *.json, CSV for *.csv
+  static void ExportPerfStatistic(const std::shared_ptr<PerfResults>& perf_results);
+  // Structured representations of results used by ExportPerfStatistic
+  static std::string FormatJson(const PerfResults& perf_results);
+  static std::string FormatCsv(const PerfResults& perf_results);
+  static std::string CsvHeader();
+  static std::string GetTypeOfRunningName(PerfResults::TypeOfRunning type_of_running);
+  // Fill statistics of perf_results from its samples
+  static void ComputeStatistics(const std::shared_ptr<PerfResults>& perf_results);
 
  private:
   std::shared_ptr<Task> task_;
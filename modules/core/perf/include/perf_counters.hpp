@@ -0,0 +1,37 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <map>
+#include <string>
+
+namespace ppc::core {
+
+// Hardware and software event counters of the current process (Linux perf_event_open).
+// Events are opened disabled with inheritance, so threads created after construction are counted too.
+// Events that can't be opened (no PMU in a container, perf_event_paranoid, other OS) are skipped.
+class PerfCounters {
+ public:
+  enum Event : uint8_t { kCycles, kInstructions, kLlcMisses, kBranchMisses, kContextSwitches, kNumEvents };
+
+  PerfCounters();
+  PerfCounters(const PerfCounters&) = delete;
+  PerfCounters& operator=(const PerfCounters&) = delete;
+  ~PerfCounters();
+
+  // true if at least one event is opened
+  [[nodiscard]] bool IsAvailable() const;
+  // reset and enable all opened events
+  void Start();
+  // disable all opened events
+  void Stop();
+  // values of opened events by name (scaled if the kernel multiplexed them)
+  [[nodiscard]] std::map<std::string, double> Read() const;
+
+  static std::string EventName(Event event);
+
+ private:
+  std::array<int, kNumEvents> fds_{};
+};
+
+}  // namespace ppc::core
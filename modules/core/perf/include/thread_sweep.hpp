@@ -0,0 +1,49 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "core/perf/include/perf.hpp"
+
+namespace ppc::core {
+
+// Strong-scaling sweep: the test program is repeated once per thread count listed in PPC_THREAD_SWEEP
+// ("1,2,4" or "max" for 1, 2, 4, ... up to the hardware concurrency). Before every repetition the thread
+// count is set for GetPPCNumThreads and the shared ThreadPool and passed to the backend callback
+// (omp_set_num_threads, TBB global_control). At the end a speedup/efficiency table is printed for every measured task, and tasks
+// whose efficiency drops below PPC_SWEEP_MIN_EFFICIENCY (0.5 by default) are flagged.
+class ThreadSweep : public ::testing::EmptyTestEventListener {
+ public:
+  using SetThreads = std::function<void(int)>;
+
+  struct Record {
+    std::string task_id;
+    std::string backend;
+    std::string type_of_running;
+    int num_threads;
+    double time_sec;
+  };
+
+  ThreadSweep(std::vector<int> thread_counts, SetThreads set_threads, double min_efficiency);
+
+  void OnTestIterationStart(const ::testing::UnitTest& unit_test, int iteration) override;
+  void OnTestProgramEnd(const ::testing::UnitTest& unit_test) override;
+
+  // Register sweep listener and repeat count if PPC_THREAD_SWEEP is set, must be called after InitGoogleTest
+  static bool Enable(const SetThreads& set_threads);
+  // Store result of perf test for the final table (no-op if the sweep is not enabled)
+  static void AddResult(const PerfResults& perf_results);
+
+  static std::vector<int> ParseThreadCounts(const std::string& spec, int max_threads);
+  static std::string FormatTable(const std::vector<Record>& records, double min_efficiency);
+
+ private:
+  std::vector<int> thread_counts_;
+  SetThreads set_threads_;
+  double min_efficiency_;
+};
+
+}  // namespace ppc::core
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <string>
+
+namespace ppc::core {
+
+// Built-in time sources for PerfAttr::current_timer, all of them return seconds from an arbitrary point
+enum class TimerKind : uint8_t {
+  // std::chrono::steady_clock
+  kSteadyClock,
+  // CLOCK_MONOTONIC_RAW: not slewed by NTP (steady clock on other systems)
+  kMonotonicRaw,
+  // invariant time stamp counter calibrated against kMonotonicRaw (kMonotonicRaw if there is no such counter)
+  kTsc,
+  // CPU time of all threads of the process
+  kProcessCpu,
+  // CPU time of the calling thread
+  kThreadCpu
+};
+
+std::function<double()> MakeTimer(TimerKind kind);
+std::string GetTimerName(TimerKind kind);
+
+double SteadyClockTime();
+double MonotonicRawTime();
+double TscTime();
+double ProcessCpuTime();
+double ThreadCpuTime();
+
+// true if the invariant TSC is used by TscTime()
+bool IsTscAvailable();
+// ticks of the TSC per second (0 if it is not available), calibrated once
+double TscFrequency();
+
+}  // namespace ppc::core
@@ -2,16 +2,147 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
 #include <cstdint>
+#include <filesystem>
+#include <fstream>
 #include <functional>
 #include <iomanip>
 #include <iostream>
 #include <memory>
+#include <numeric>
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <string_view>
+#include <vector>
 
+#include "core/perf/include/perf_counters.hpp"
+#include "core/perf/include/thread_sweep.hpp"
+#include "core/perf/include/timers.hpp"
 #include "core/task/include/task.hpp"
+#include "core/util/include/util.hpp"
+
+namespace {
+
+// CPU time above this multiple of the wall time per thread is reported as oversubscription
+constexpr double kOversubscriptionRatio = 1.25;
+
+// Two-sided 95% quantiles of Student's t-distribution for 1..30 degrees of freedom
+constexpr std::array<double, 30> kStudentT95 = {12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306,
+                                                2.262,  2.228, 2.201, 2.179, 2.160, 2.145, 2.131, 2.120,
+                                                2.110,  2.101, 2.093, 2.086, 2.080, 2.074, 2.069, 2.064,
+                                                2.060,  2.056, 2.052, 2.048, 2.045, 2.042};
+
+double StudentT95(uint64_t degrees_of_freedom) {
+  if (degrees_of_freedom == 0) {
+    return 0.0;
+  }
+  if (degrees_of_freedom <= kStudentT95.size()) {
+    return kStudentT95[degrees_of_freedom - 1];
+  }
+  return 1.960;
+}
+
+// target_rel_ci of perf_attr, or PPC_PERF_TARGET_REL_CI when the test leaves it at 0
+double TargetRelCi(const ppc::core::PerfAttr& perf_attr) {
+  if (perf_attr.target_rel_ci > 0.0) {
+    return perf_attr.target_rel_ci;
+  }
+  const std::string target = ppc::util::GetEnvVariable("PPC_PERF_TARGET_REL_CI");
+  return target.empty() ? 0.0 : std::stod(target);
+}
+
+// Linear interpolation between closest ranks of sorted samples
+double Percentile(const std::vector<double>& sorted, double q) {
+  if (sorted.empty()) {
+    return 0.0;
+  }
+  const double pos = q * static_cast<double>(sorted.size() - 1);
+  const auto lo = static_cast<size_t>(std::floor(pos));
+  const auto hi = std::min(lo + 1, sorted.size() - 1);
+  const double frac = pos - static_cast<double>(lo);
+  return sorted[lo] + ((sorted[hi] - sorted[lo]) * frac);
+}
+
+std::string JsonEscape(const std::string& str) {
+  std::string res;
+  res.reserve(str.size());
+  for (const char c : str) {
+    if (c == '"' || c == '\\') {
+      res += '\\';
+      res += c;
+    } else if (static_cast<unsigned char>(c) < 0x20) {
+      // control characters are not allowed unescaped in JSON strings
+      constexpr std::string_view kHex = "0123456789abcdef";
+      res += "\\u00";
+      res += kHex[static_cast<unsigned char>(c) >> 4];
+      res += kHex[static_cast<unsigned char>(c) & 0xF];
+    } else {
+      res += c;
+    }
+  }
+  return res;
+}
+
+// Fill task_id and backend from the path of the current test file: tasks/<backend>/<task_id>/perf_tests/...
+void FillTaskIdentity(ppc::core::PerfResults& perf_results) {
+  if (!perf_results.task_id.empty()) {
+    return;
+  }
+  const auto* test_info = ::testing::UnitTest::GetInstance()->current_test_info();
+  if (test_info == nullptr) {
+    return;
+  }
+  std::string path(test_info->file());
+  std::ranges::replace(path, '\\', '/');
+
+  std::vector<std::string> parts;
+  std::stringstream path_stream(path);
+  for (std::string part; std::getline(path_stream, part, '/');) {
+    parts.push_back(part);
+  }
+  for (size_t i = parts.size(); i-- > 0;) {
+    if (parts[i] == "tasks" && i + 2 < parts.size()) {
+      perf_results.backend = parts[i + 1];
+      perf_results.task_id = parts[i + 2];
+      return;
+    }
+  }
+  perf_results.backend = "none";
+  perf_results.task_id = test_info->test_suite_name();
+}
+
+void FillTaskSize(const std::shared_ptr<ppc::core::Task>& task, ppc::core::PerfResults& perf_results) {
+  perf_results.input_size = 0;
+  for (const auto count : task->GetData()->inputs_count) {
+    perf_results.input_size += count;
+  }
+  perf_results.num_threads = ppc::util::GetPPCNumThreads();
+}
+
+// Raw counters of all timed runs plus IPC and per-element rates
+void FillCounters(const ppc::core::PerfCounters& counters, ppc::core::PerfResults& perf_results) {
+  perf_results.counters = counters.Read();
+  auto& res = perf_results.counters;
+  if (res.contains("cycles") && res.contains("instructions") && res["cycles"] > 0.0) {
+    res["ipc"] = res["instructions"] / res["cycles"];
+  }
+  const double elements =
+      static_cast<double>(perf_results.input_size) * static_cast<double>(perf_results.samples_sec.size());
+  if (elements > 0.0) {
+    for (const std::string name : {"llc_misses", "branch_misses"}) {
+      if (res.contains(name)) {
+        res[name + "_per_element"] = res[name] / elements;
+      }
+    }
+  }
+}
+
+}  // namespace
 
 ppc::core::Perf::Perf(const std::shared_ptr<Task>& task_ptr) { SetTask(task_ptr); }
 
@@ -23,6 +154,7 @@ void ppc::core::Perf::SetTask(const std::shared_ptr<Task>& task_ptr) {
 void ppc::core::Perf::PipelineRun(const std::shared_ptr<PerfAttr>& perf_attr,
                                   const std::shared_ptr<ppc::core::PerfResults>& perf_results) const {
   perf_results->type_of_running = PerfResults::TypeOfRunning::kPipeline;
+  FillTaskSize(task_, *perf_results);
 
   CommonRun(
       perf_attr,
@@ -38,6 +170,7 @@ void ppc::core::Perf::PipelineRun(const std::shared_ptr<PerfAttr>& perf_attr,
 void ppc::core::Perf::TaskRun(const std::shared_ptr<PerfAttr>& perf_attr,
                               const std::shared_ptr<ppc::core::PerfResults>& perf_results) const {
   perf_results->type_of_running = PerfResults::TypeOfRunning::kTaskRun;
+  FillTaskSize(task_, *perf_results);
 
   task_->Validation();
   task_->PreProcessing();
@@ -52,35 +185,132 @@ void ppc::core::Perf::TaskRun(const std::shared_ptr<PerfAttr>& perf_attr,
 
 void ppc::core::Perf::CommonRun(const std::shared_ptr<PerfAttr>& perf_attr, const std::function<void()>& pipeline,
                                 const std::shared_ptr<ppc::core::PerfResults>& perf_results) {
-  auto begin = perf_attr->current_timer();
+  // opened before warmup, so worker threads spawned by the first runs are counted as well
+  std::unique_ptr<PerfCounters> counters;
+  if (perf_attr->hw_counters || ppc::util::GetEnvVariable("PPC_PERF_COUNTERS") == "1") {
+    counters = std::make_unique<PerfCounters>();
+  }
+
+  for (uint64_t i = 0; i < perf_attr->num_warmup; i++) {
+    pipeline();
+  }
+  perf_results->num_warmup = perf_attr->num_warmup;
+  perf_results->stopped_early = false;
+  perf_results->samples_sec.clear();
+  perf_results->samples_sec.reserve(perf_attr->num_running);
+
+  // Welford's running mean and variance for the early stop check
+  double mean = 0.0;
+  double m2 = 0.0;
+  perf_results->counters.clear();
+  const double target_rel_ci = TargetRelCi(*perf_attr);
+  if (counters) {
+    counters->Start();
+  }
+  double cpu_time = 0.0;
   for (uint64_t i = 0; i < perf_attr->num_running; i++) {
+    // CPU time is read outside of the timed interval, so it doesn't add to the samples
+    const double cpu_begin = ProcessCpuTime();
+    auto begin = perf_attr->current_timer();
     pipeline();
+    auto end = perf_attr->current_timer();
+    cpu_time += ProcessCpuTime() - cpu_begin;
+
+    const double sample = end - begin;
+    perf_results->samples_sec.push_back(sample);
+
+    const auto n = static_cast<double>(i + 1);
+    const double delta = sample - mean;
+    mean += delta / n;
+    m2 += delta * (sample - mean);
+
+    if (target_rel_ci > 0.0 && i + 1 >= std::max<uint64_t>(perf_attr->min_running, 2) &&
+        i + 1 < perf_attr->num_running) {
+      const double half_width = StudentT95(i) * std::sqrt(m2 / (n - 1.0) / n);
+      if (half_width <= target_rel_ci * mean) {
+        perf_results->stopped_early = true;
+        break;
+      }
+    }
+  }
+
+  if (counters) {
+    counters->Stop();
+    FillCounters(*counters, *perf_results);
+  }
+
+  ComputeStatistics(perf_results);
+  const double wall_time = std::accumulate(perf_results->samples_sec.begin(), perf_results->samples_sec.end(), 0.0);
+  perf_results->cpu_time_sec = cpu_time;
+  perf_results->cpu_utilization = wall_time > 0.0 ? cpu_time / wall_time : 0.0;
+  // Keep the time of num_running runs comparable between runs that stopped early and full runs
+  if (perf_results->stopped_early) {
+    perf_results->time_sec = perf_results->mean_sec * static_cast<double>(perf_attr->num_running);
+  } else {
+    perf_results->time_sec = wall_time;
   }
-  auto end = perf_attr->current_timer();
-  perf_results->time_sec = end - begin;
+}
+
+void ppc::core::Perf::ComputeStatistics(const std::shared_ptr<ppc::core::PerfResults>& perf_results) {
+  const auto& samples = perf_results->samples_sec;
+  if (samples.empty()) {
+    perf_results->min_sec = perf_results->max_sec = perf_results->mean_sec = perf_results->median_sec = 0.0;
+    perf_results->p90_sec = perf_results->p99_sec = perf_results->stddev_sec = 0.0;
+    perf_results->ci_low_sec = perf_results->ci_high_sec = 0.0;
+    return;
+  }
+
+  std::vector<double> sorted(samples);
+  std::ranges::sort(sorted);
+  const auto n = static_cast<double>(sorted.size());
+
+  const double mean = std::accumulate(sorted.begin(), sorted.end(), 0.0) / n;
+  double sq_sum = 0.0;
+  for (const double sample : sorted) {
+    sq_sum += (sample - mean) * (sample - mean);
+  }
+  const double stddev = sorted.size() > 1 ? std::sqrt(sq_sum / (n - 1.0)) : 0.0;
+  const double half_width = StudentT95(sorted.size() - 1) * stddev / std::sqrt(n);
+
+  perf_results->min_sec = sorted.front();
+  perf_results->max_sec = sorted.back();
+  perf_results->mean_sec = mean;
+  perf_results->median_sec = Percentile(sorted, 0.5);
+  perf_results->p90_sec = Percentile(sorted, 0.9);
+  perf_results->p99_sec = Percentile(sorted, 0.99);
+  perf_results->stddev_sec = stddev;
+  perf_results->ci_low_sec = mean - half_width;
+  perf_results->ci_high_sec = mean + half_width;
 }
 
 void ppc::core::Perf::PrintPerfStatistic(const std::shared_ptr<PerfResults>& perf_results) {
-  std::string relative_path(::testing::UnitTest::GetInstance()->current_test_info()->file());
-  std::string ppc_regex_template("parallel_programming_course");
-  std::string perf_regex_template("perf_tests");
-  std::string type_test_name;
+  std::string type_test_name = GetTypeOfRunningName(perf_results->type_of_running);
 
   auto time_secs = perf_results->time_sec;
+  ExportPerfStatistic(perf_results);
+  ThreadSweep::AddResult(*perf_results);
 
-  if (perf_results->type_of_running == PerfResults::TypeOfRunning::kTaskRun) {
-    type_test_name = "task_run";
-  } else if (perf_results->type_of_running == PerfResults::TypeOfRunning::kPipeline) {
-    type_test_name = "pipeline";
-  } else {
-    type_test_name = "none";
+  if (perf_results->cpu_utilization > kOversubscriptionRatio * perf_results->num_threads) {
+    std::cerr << "WARNING: " << perf_results->task_id << ":" << type_test_name << " used "
+              << perf_results->cpu_utilization << " CPUs with " << perf_results->num_threads
+              << " threads (oversubscription or busy waiting)\n";
   }
 
-  auto first_found_position = relative_path.find(ppc_regex_template) + ppc_regex_template.length() + 1;
-  relative_path.erase(0, first_found_position);
-
-  auto last_found_position = relative_path.find(perf_regex_template) - 1;
-  relative_path.erase(last_found_position, relative_path.length() - 1);
+  // tasks/<backend>/<task_id> for task tests, otherwise the test file path relative to the project
+  std::string relative_path;
+  if (perf_results->backend != "none") {
+    relative_path = "tasks/" + perf_results->backend + "/" + perf_results->task_id;
+  } else {
+    relative_path = ::testing::UnitTest::GetInstance()->current_test_info()->file();
+    const std::string project_path(PPC_PATH_TO_PROJECT);
+    if (relative_path.starts_with(project_path)) {
+      relative_path.erase(0, project_path.length() + 1);
+    }
+    const auto test_dir_position = relative_path.find_last_of("/\\");
+    if (test_dir_position != std::string::npos) {
+      relative_path.erase(test_dir_position);
+    }
+  }
 
   std::stringstream perf_res_str;
   if (time_secs < PerfResults::kMaxTime) {
@@ -96,3 +326,102 @@ void ppc::core::Perf::PrintPerfStatistic(const std::shared_ptr<PerfResults>& per
     throw std::runtime_error(err_msg.str().c_str());
   }
 }
+
+void ppc::core::Perf::ExportPerfStatistic(const std::shared_ptr<PerfResults>& perf_results) {
+  FillTaskIdentity(*perf_results);
+
+  const std::string output_path = ppc::util::GetEnvVariable("PPC_PERF_OUTPUT");
+  if (output_path.empty()) {
+    return;
+  }
+  const std::filesystem::path path(output_path);
+  const bool is_csv = path.extension() == ".csv";
+  const bool need_header = is_csv && (!std::filesystem::exists(path) || std::filesystem::file_size(path) == 0);
+
+  std::ofstream output(path, std::ios::app);
+  if (!output.is_open()) {
+    throw std::runtime_error("Can't open perf output file: " + output_path);
+  }
+  if (need_header) {
+    output << CsvHeader() << '\n';
+  }
+  output << (is_csv ? FormatCsv(*perf_results) : FormatJson(*perf_results)) << '\n';
+}
+
+std::string ppc::core::Perf::FormatJson(const PerfResults& perf_results) {
+  std::stringstream res;
+  res << std::setprecision(10);
+  res << "{\"task_id\":\"" << JsonEscape(perf_results.task_id) << "\",";
+  res << "\"backend\":\"" << JsonEscape(perf_results.backend) << "\",";
+  res << "\"type_of_running\":\"" << GetTypeOfRunningName(perf_results.type_of_running) << "\",";
+  res << "\"num_threads\":" << perf_results.num_threads << ",";
+  res << "\"input_size\":" << perf_results.input_size << ",";
+  res << "\"num_warmup\":" << perf_results.num_warmup << ",";
+  res << "\"stopped_early\":" << (perf_results.stopped_early ? "true" : "false") << ",";
+  res << "\"time_sec\":" << perf_results.time_sec << ",";
+  res << "\"min_sec\":" << perf_results.min_sec << ",";
+  res << "\"max_sec\":" << perf_results.max_sec << ",";
+  res << "\"mean_sec\":" << perf_results.mean_sec << ",";
+  res << "\"median_sec\":" << perf_results.median_sec << ",";
+  res << "\"p90_sec\":" << perf_results.p90_sec << ",";
+  res << "\"p99_sec\":" << perf_results.p99_sec << ",";
+  res << "\"stddev_sec\":" << perf_results.stddev_sec << ",";
+  res << "\"ci_low_sec\":" << perf_results.ci_low_sec << ",";
+  res << "\"ci_high_sec\":" << perf_results.ci_high_sec << ",";
+  res << "\"cpu_time_sec\":" << perf_results.cpu_time_sec << ",";
+  res << "\"cpu_utilization\":" << perf_results.cpu_utilization << ",";
+  res << "\"samples_sec\":[";
+  for (size_t i = 0; i < perf_results.samples_sec.size(); i++) {
+    res << (i == 0 ? "" : ",") << perf_results.samples_sec[i];
+  }
+  res << "],\"counters\":{";
+  bool first = true;
+  for (const auto& [name, value] : perf_results.counters) {
+    res << (first ? "" : ",") << "\"" << JsonEscape(name) << "\":" << value;
+    first = false;
+  }
+  res << "}}";
+  return res.str();
+}
+
+std::string ppc::core::Perf::CsvHeader() {
+  return "task_id,backend,type_of_running,num_threads,input_size,num_warmup,num_samples,stopped_early,time_sec,"
+         "min_sec,max_sec,mean_sec,median_sec,p90_sec,p99_sec,stddev_sec,ci_low_sec,ci_high_sec,cpu_time_sec,"
+         "cpu_utilization,samples_sec,counters";
+}
+
+std::string ppc::core::Perf::FormatCsv(const PerfResults& perf_results) {
+  std::stringstream res;
+  res << std::setprecision(10);
+  res << perf_results.task_id << ',' << perf_results.backend << ','
+      << GetTypeOfRunningName(perf_results.type_of_running) << ',' << perf_results.num_threads << ','
+      << perf_results.input_size << ',' << perf_results.num_warmup << ',' << perf_results.samples_sec.size() << ','
+      << (perf_results.stopped_early ? 1 : 0) << ',' << perf_results.time_sec << ',' << perf_results.min_sec << ','
+      << perf_results.max_sec << ',' << perf_results.mean_sec << ',' << perf_results.median_sec << ','
+      << perf_results.p90_sec << ',' << perf_results.p99_sec << ',' << perf_results.stddev_sec << ','
+      << perf_results.ci_low_sec << ',' << perf_results.ci_high_sec << ',' << perf_results.cpu_time_sec << ','
+      << perf_results.cpu_utilization << ',';
+  // lists are kept in one column each: samples separated by ';', counters as name=value pairs
+  for (size_t i = 0; i < perf_results.samples_sec.size(); i++) {
+    res << (i == 0 ? "" : ";") << perf_results.samples_sec[i];
+  }
+  res << ',';
+  bool first = true;
+  for (const auto& [name, value] : perf_results.counters) {
+    res << (first ? "" : ";") << name << '=' << value;
+    first = false;
+  }
+  return res.str();
+}
+
+std::string ppc::core::Perf::GetTypeOfRunningName(PerfResults::TypeOfRunning type_of_running) {
+  switch (type_of_running) {
+    case PerfResults::TypeOfRunning::kTaskRun:
+      return "task_run";
+    case PerfResults::TypeOfRunning::kPipeline:
+      return "pipeline";
+    case PerfResults::TypeOfRunning::kNone:
+    default:
+      return "none";
+  }
+}
@@ -0,0 +1,150 @@
+#include "core/perf/include/perf_counters.hpp"
+
+#include <cstdint>
+#include <map>
+#include <string>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace {
+
+struct EventConfig {
+  uint32_t type;
+  uint64_t config;
+};
+
+EventConfig GetEventConfig(ppc::core::PerfCounters::Event event) {
+  switch (event) {
+    case ppc::core::PerfCounters::kCycles:
+      return {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES};
+    case ppc::core::PerfCounters::kInstructions:
+      return {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS};
+    case ppc::core::PerfCounters::kLlcMisses:
+      return {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES};
+    case ppc::core::PerfCounters::kBranchMisses:
+      return {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES};
+    case ppc::core::PerfCounters::kContextSwitches:
+    case ppc::core::PerfCounters::kNumEvents:
+    default:
+      return {PERF_TYPE_SOFTWARE, PERF_COUNT_SW_CONTEXT_SWITCHES};
+  }
+}
+
+int OpenEvent(ppc::core::PerfCounters::Event event, bool exclude_kernel) {
+  const auto event_config = GetEventConfig(event);
+  perf_event_attr attr{};
+  attr.size = sizeof(attr);
+  attr.type = event_config.type;
+  attr.config = event_config.config;
+  attr.disabled = 1;
+  attr.inherit = 1;
+  attr.exclude_kernel = exclude_kernel ? 1 : 0;
+  attr.exclude_hv = 1;
+  attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+  return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+}
+
+}  // namespace
+
+ppc::core::PerfCounters::PerfCounters() {
+  for (int i = 0; i < kNumEvents; i++) {
+    const auto event = static_cast<Event>(i);
+    fds_[i] = OpenEvent(event, false);
+    if (fds_[i] < 0) {
+      // unprivileged processes (perf_event_paranoid >= 2) may count only user space
+      fds_[i] = OpenEvent(event, true);
+    }
+  }
+}
+
+ppc::core::PerfCounters::~PerfCounters() {
+  for (const int fd : fds_) {
+    if (fd >= 0) {
+      close(fd);
+    }
+  }
+}
+
+bool ppc::core::PerfCounters::IsAvailable() const {
+  for (const int fd : fds_) {
+    if (fd >= 0) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void ppc::core::PerfCounters::Start() {
+  for (const int fd : fds_) {
+    if (fd >= 0) {
+      ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+      ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+    }
+  }
+}
+
+void ppc::core::PerfCounters::Stop() {
+  for (const int fd : fds_) {
+    if (fd >= 0) {
+      ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+    }
+  }
+}
+
+std::map<std::string, double> ppc::core::PerfCounters::Read() const {
+  std::map<std::string, double> res;
+  for (int i = 0; i < kNumEvents; i++) {
+    if (fds_[i] < 0) {
+      continue;
+    }
+    // value, time enabled, time running
+    uint64_t values[3] = {0, 0, 0};
+    if (read(fds_[i], values, sizeof(values)) != static_cast<ssize_t>(sizeof(values))) {
+      continue;
+    }
+    double value = static_cast<double>(values[0]);
+    if (values[2] != 0 && values[2] < values[1]) {
+      value *= static_cast<double>(values[1]) / static_cast<double>(values[2]);
+    }
+    res[EventName(static_cast<Event>(i))] = value;
+  }
+  return res;
+}
+
+#else
+
+ppc::core::PerfCounters::PerfCounters() { fds_.fill(-1); }
+
+ppc::core::PerfCounters::~PerfCounters() = default;
+
+bool ppc::core::PerfCounters::IsAvailable() const { return false; }
+
+void ppc::core::PerfCounters::Start() {}
+
+void ppc::core::PerfCounters::Stop() {}
+
+std::map<std::string, double> ppc::core::PerfCounters::Read() const { return {}; }
+
+#endif
+
+std::string ppc::core::PerfCounters::EventName(Event event) {
+  switch (event) {
+    case kCycles:
+      return "cycles";
+    case kInstructions:
+      return "instructions";
+    case kLlcMisses:
+      return "llc_misses";
+    case kBranchMisses:
+      return "branch_misses";
+    case kContextSwitches:
+      return "context_switches";
+    case kNumEvents:
+    default:
+      return "unknown";
+  }
+}
@@ -0,0 +1,153 @@
+#include "core/perf/include/thread_sweep.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "core/perf/include/perf.hpp"
+#include "core/thread_pool/include/thread_pool.hpp"
+#include "core/util/include/util.hpp"
+
+namespace {
+
+bool sweep_enabled = false;
+std::vector<ppc::core::ThreadSweep::Record> sweep_records;
+
+}  // namespace
+
+ppc::core::ThreadSweep::ThreadSweep(std::vector<int> thread_counts, SetThreads set_threads, double min_efficiency)
+    : thread_counts_(std::move(thread_counts)), set_threads_(std::move(set_threads)), min_efficiency_(min_efficiency) {}
+
+void ppc::core::ThreadSweep::OnTestIterationStart(const ::testing::UnitTest& /*unit_test*/, int iteration) {
+  const int num_threads = thread_counts_[static_cast<size_t>(iteration) % thread_counts_.size()];
+  ppc::util::SetPPCNumThreads(num_threads);
+  ppc::core::ThreadPool::Reset(num_threads);
+  if (set_threads_) {
+    set_threads_(num_threads);
+  }
+  std::cout << "[  THREADS  ] " << num_threads << '\n';
+}
+
+void ppc::core::ThreadSweep::OnTestProgramEnd(const ::testing::UnitTest& /*unit_test*/) {
+  if (!sweep_records.empty()) {
+    std::cout << FormatTable(sweep_records, min_efficiency_);
+  }
+}
+
+bool ppc::core::ThreadSweep::Enable(const SetThreads& set_threads) {
+  const std::string spec = ppc::util::GetEnvVariable("PPC_THREAD_SWEEP");
+  if (spec.empty()) {
+    return false;
+  }
+  auto thread_counts = ParseThreadCounts(spec, static_cast<int>(std::thread::hardware_concurrency()));
+
+  double min_efficiency = 0.5;
+  const std::string min_efficiency_str = ppc::util::GetEnvVariable("PPC_SWEEP_MIN_EFFICIENCY");
+  if (!min_efficiency_str.empty()) {
+    min_efficiency = std::stod(min_efficiency_str);
+  }
+
+  GTEST_FLAG_SET(repeat, static_cast<int>(thread_counts.size()));
+  auto& listeners = ::testing::UnitTest::GetInstance()->listeners();
+  listeners.Append(new ThreadSweep(std::move(thread_counts), set_threads, min_efficiency));
+  sweep_enabled = true;
+  return true;
+}
+
+void ppc::core::ThreadSweep::AddResult(const PerfResults& perf_results) {
+  if (!sweep_enabled) {
+    return;
+  }
+  sweep_records.push_back({.task_id = perf_results.task_id,
+                           .backend = perf_results.backend,
+                           .type_of_running = Perf::GetTypeOfRunningName(perf_results.type_of_running),
+                           .num_threads = perf_results.num_threads,
+                           .time_sec = perf_results.time_sec});
+}
+
+std::vector<int> ppc::core::ThreadSweep::ParseThreadCounts(const std::string& spec, int max_threads) {
+  std::vector<int> res;
+  if (spec == "max") {
+    max_threads = std::max(max_threads, 1);
+    for (int num_threads = 1; num_threads < max_threads; num_threads *= 2) {
+      res.push_back(num_threads);
+    }
+    res.push_back(max_threads);
+    return res;
+  }
+
+  std::stringstream spec_stream(spec);
+  for (std::string item; std::getline(spec_stream, item, ',');) {
+    size_t pos = 0;
+    const int num_threads = std::stoi(item, &pos);
+    if (pos != item.size() || num_threads < 1) {
+      throw std::invalid_argument("Wrong thread count in PPC_THREAD_SWEEP: " + item);
+    }
+    res.push_back(num_threads);
+  }
+  if (res.empty()) {
+    throw std::invalid_argument("Empty PPC_THREAD_SWEEP");
+  }
+  return res;
+}
+
+std::string ppc::core::ThreadSweep::FormatTable(const std::vector<Record>& records, double min_efficiency) {
+  // group records by task keeping the order of the first appearance, the last record per thread count wins
+  std::vector<std::tuple<std::string, std::string, std::string>> keys;
+  for (const auto& record : records) {
+    auto key = std::make_tuple(record.backend, record.task_id, record.type_of_running);
+    if (std::ranges::find(keys, key) == keys.end()) {
+      keys.push_back(std::move(key));
+    }
+  }
+
+  std::stringstream res;
+  for (const auto& [backend, task_id, type_of_running] : keys) {
+    std::vector<std::pair<int, double>> times;
+    for (const auto& record : records) {
+      if (record.backend != backend || record.task_id != task_id || record.type_of_running != type_of_running) {
+        continue;
+      }
+      auto it = std::ranges::find_if(times, [&](const auto& t) { return t.first == record.num_threads; });
+      if (it != times.end()) {
+        it->second = record.time_sec;
+      } else {
+        times.emplace_back(record.num_threads, record.time_sec);
+      }
+    }
+    std::ranges::sort(times);
+
+    // strong scaling relative to the smallest measured thread count
+    const auto [base_threads, base_time] = times.front();
+    res << "Thread scaling " << backend << '/' << task_id << ':' << type_of_running << '\n';
+    res << std::setw(8) << "threads" << std::setw(16) << "time" << std::setw(10) << "speedup" << std::setw(12)
+        << "efficiency" << '\n';
+    int collapse_after = 0;
+    int prev_threads = base_threads;
+    for (const auto& [num_threads, time_sec] : times) {
+      const double speedup = time_sec > 0.0 ? base_time / time_sec : 0.0;
+      const double efficiency = speedup * base_threads / num_threads;
+      res << std::setw(8) << num_threads << std::setw(16) << std::fixed << std::setprecision(10) << time_sec
+          << std::setw(10) << std::setprecision(2) << speedup << std::setw(12) << efficiency << '\n';
+      if (collapse_after == 0 && efficiency < min_efficiency) {
+        collapse_after = prev_threads;
+      }
+      prev_threads = num_threads;
+    }
+    if (collapse_after != 0) {
+      res << "WARNING: efficiency of " << backend << '/' << task_id << ':' << type_of_running << " drops below "
+          << std::defaultfloat << min_efficiency << " beyond " << collapse_after << " threads\n";
+    }
+  }
+  return res.str();
+}
@@ -0,0 +1,161 @@
+#include "core/perf/include/timers.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <ctime>
+#include <functional>
+#include <string>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64)
+#define PPC_HAS_TSC 1
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#include <x86intrin.h>
+#endif
+#endif
+
+namespace {
+
+#if defined(__linux__) || defined(__APPLE__)
+double ClockTime(clockid_t clock_id) {
+  timespec ts{};
+  clock_gettime(clock_id, &ts);
+  return static_cast<double>(ts.tv_sec) + (static_cast<double>(ts.tv_nsec) * 1e-9);
+}
+#endif
+
+#ifdef PPC_HAS_TSC
+bool HasInvariantTsc() {
+#if defined(_MSC_VER)
+  int regs[4] = {};
+  __cpuid(regs, static_cast<int>(0x80000000));
+  if (static_cast<unsigned>(regs[0]) < 0x80000007U) {
+    return false;
+  }
+  __cpuid(regs, static_cast<int>(0x80000007));
+  return (static_cast<unsigned>(regs[3]) & (1U << 8)) != 0;
+#else
+  unsigned eax = 0;
+  unsigned ebx = 0;
+  unsigned ecx = 0;
+  unsigned edx = 0;
+  if (__get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx) == 0) {
+    return false;
+  }
+  return (edx & (1U << 8)) != 0;
+#endif
+}
+
+struct TscCalibration {
+  uint64_t base_ticks = 0;
+  double frequency = 0.0;
+};
+
+// Ticks of the counter against CLOCK_MONOTONIC_RAW during ~20 ms of busy waiting
+const TscCalibration &GetTscCalibration() {
+  static const TscCalibration kCalibration = [] {
+    TscCalibration calibration;
+    if (!HasInvariantTsc()) {
+      return calibration;
+    }
+    const double begin_time = ppc::core::MonotonicRawTime();
+    const uint64_t begin_ticks = __rdtsc();
+    double end_time = begin_time;
+    while (end_time - begin_time < 0.02) {
+      end_time = ppc::core::MonotonicRawTime();
+    }
+    const uint64_t end_ticks = __rdtsc();
+    calibration.base_ticks = begin_ticks;
+    calibration.frequency = static_cast<double>(end_ticks - begin_ticks) / (end_time - begin_time);
+    return calibration;
+  }();
+  return kCalibration;
+}
+#endif
+
+}  // namespace
+
+double ppc::core::SteadyClockTime() {
+  const auto duration = std::chrono::steady_clock::now().time_since_epoch();
+  return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count()) * 1e-9;
+}
+
+double ppc::core::MonotonicRawTime() {
+#if defined(__linux__)
+  return ClockTime(CLOCK_MONOTONIC_RAW);
+#else
+  return SteadyClockTime();
+#endif
+}
+
+double ppc::core::TscTime() {
+#ifdef PPC_HAS_TSC
+  const auto &calibration = GetTscCalibration();
+  if (calibration.frequency > 0.0) {
+    return static_cast<double>(__rdtsc() - calibration.base_ticks) / calibration.frequency;
+  }
+#endif
+  return MonotonicRawTime();
+}
+
+double ppc::core::ProcessCpuTime() {
+#if defined(__linux__) || defined(__APPLE__)
+  return ClockTime(CLOCK_PROCESS_CPUTIME_ID);
+#else
+  return static_cast<double>(std::clock()) / CLOCKS_PER_SEC;
+#endif
+}
+
+double ppc::core::ThreadCpuTime() {
+#if defined(__linux__) || defined(__APPLE__)
+  return ClockTime(CLOCK_THREAD_CPUTIME_ID);
+#else
+  return ProcessCpuTime();
+#endif
+}
+
+bool ppc::core::IsTscAvailable() { return TscFrequency() > 0.0; }
+
+double ppc::core::TscFrequency() {
+#ifdef PPC_HAS_TSC
+  return GetTscCalibration().frequency;
+#else
+  return 0.0;
+#endif
+}
+
+std::function<double()> ppc::core::MakeTimer(TimerKind kind) {
+  switch (kind) {
+    case TimerKind::kSteadyClock:
+      return SteadyClockTime;
+    case TimerKind::kMonotonicRaw:
+      return MonotonicRawTime;
+    case TimerKind::kTsc:
+      // calibrate before the first measurement
+      TscFrequency();
+      return TscTime;
+    case TimerKind::kProcessCpu:
+      return ProcessCpuTime;
+    case TimerKind::kThreadCpu:
+      return ThreadCpuTime;
+  }
+  return SteadyClockTime;
+}
+
+std::string ppc::core::GetTimerName(TimerKind kind) {
+  switch (kind) {
+    case TimerKind::kSteadyClock:
+      return "steady_clock";
+    case TimerKind::kMonotonicRaw:
+      return "monotonic_raw";
+    case TimerKind::kTsc:
+      return "tsc";
+    case TimerKind::kProcessCpu:
+      return "process_cpu";
+    case TimerKind::kThreadCpu:
+      return "thread_cpu";
+  }
+  return "unknown";
+}
@@ -0,0 +1,216 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "core/sort/func_tests/test_sort.hpp"
+#include "core/sort/include/batcher_sort.hpp"
+#include "core/thread_pool/include/thread_pool.hpp"
+#include "core/util/include/util.hpp"
+
+namespace {
+
+using ppc::core::sort::BatcherSort;
+using ppc::core::sort::BitonicMergeSort;
+using ppc::test::sort::PoolFor;
+using ppc::test::sort::RandomDoubles;
+using ppc::test::sort::RandomInts;
+using ppc::test::sort::SerialFor;
+
+template <typename T>
+void CheckBatcherSort(std::vector<T> keys, size_t num_blocks) {
+  auto expected = keys;
+  std::ranges::sort(expected);
+  BatcherSort(std::span<T>(keys), num_blocks, SerialFor{});
+  ASSERT_EQ(keys, expected) << "n=" << keys.size() << " blocks=" << num_blocks;
+}
+
+template <typename T>
+void CheckBitonicMergeSort(std::vector<T> keys) {
+  auto expected = keys;
+  std::ranges::sort(expected);
+  std::vector<T> buffer(keys.size());
+  BitonicMergeSort(std::span<T>(keys), std::span<T>(buffer));
+  ASSERT_EQ(keys, expected) << "n=" << keys.size();
+}
+
+// the pipeline of the batcher tasks before BatcherSort: blocks sorted in parallel, then rounds of std::inplace_merge
+// of neighbouring blocks
+void SortAndMergeTree(std::vector<double> &keys, ppc::core::ThreadPool &pool) {
+  const auto blocks = static_cast<size_t>(pool.NumThreads());
+  const auto bound = [&](size_t b) { return keys.begin() + static_cast<std::ptrdiff_t>(keys.size() * b / blocks); };
+  ppc::core::ParallelFor(
+      0, blocks,
+      [&](size_t begin, size_t end) {
+        for (size_t b = begin; b < end; b++) {
+          std::sort(bound(b), bound(b + 1));
+        }
+      },
+      1, pool);
+  for (size_t width = 1; width < blocks; width *= 2) {
+    ppc::core::ParallelFor(
+        0, (blocks + (2 * width) - 1) / (2 * width),
+        [&](size_t begin, size_t end) {
+          for (size_t pair = begin; pair < end; pair++) {
+            const size_t first = 2 * width * pair;
+            if (first + width < blocks) {
+              std::inplace_merge(bound(first), bound(first + width), bound(std::min(first + (2 * width), blocks)));
+            }
+          }
+        },
+        1, pool);
+  }
+}
+
+}  // namespace
+
+TEST(batcher_sort_tests, check_merge_exchange_network_sorts_zeros_and_ones) {
+  for (size_t blocks = 1; blocks <= 13; blocks++) {
+    const auto stages = ppc::core::sort::detail::MergeExchangeStages(blocks);
+    for (uint32_t bits = 0; bits < (uint32_t{1} << blocks); bits++) {
+      std::vector<int> keys(blocks);
+      for (size_t i = 0; i < blocks; i++) {
+        keys[i] = static_cast<int>((bits >> i) & 1);
+      }
+      for (const auto &stage : stages) {
+        std::vector<bool> used(blocks);
+        for (const auto &[lower, upper] : stage) {
+          ASSERT_LT(lower, upper);
+          ASSERT_FALSE(used[lower] || used[upper]) << "a block is compared twice in a stage";
+          used[lower] = used[upper] = true;
+          if (keys[upper] < keys[lower]) {
+            std::swap(keys[lower], keys[upper]);
+          }
+        }
+      }
+      ASSERT_TRUE(std::ranges::is_sorted(keys)) << "blocks=" << blocks << " bits=" << bits;
+    }
+  }
+}
+
+TEST(batcher_sort_tests, check_random_doubles) {
+  for (const size_t n : {0, 1, 7, 1000, 5000, 100000}) {
+    const auto keys = RandomDoubles(n, -1e6, 1e6, static_cast<unsigned>(n));
+    for (const size_t blocks : {1, 2, 3, 5, 8, 13}) {
+      CheckBatcherSort(keys, blocks);
+    }
+  }
+}
+
+TEST(batcher_sort_tests, check_random_ints) {
+  for (const size_t n : {0, 1, 9, 3000, 100000}) {
+    const auto keys = RandomInts(n, std::numeric_limits<int>::min(), std::numeric_limits<int>::max(), 1);
+    for (const size_t blocks : {1, 4, 7}) {
+      CheckBatcherSort(keys, blocks);
+    }
+  }
+  // many equal keys
+  CheckBatcherSort(RandomInts(50000, -3, 3, 2), 6);
+}
+
+TEST(batcher_sort_tests, check_sorted_and_reversed_keys) {
+  auto keys = RandomDoubles(60000, -10.0, 10.0, 3);
+  std::ranges::sort(keys);
+  CheckBatcherSort(keys, 9);
+  std::ranges::reverse(keys);
+  CheckBatcherSort(keys, 9);
+}
+
+TEST(batcher_sort_tests, check_own_block_sort) {
+  auto keys = RandomInts(70000, -1000, 1000, 4);
+  auto expected = keys;
+  std::ranges::sort(expected);
+  size_t sorted_blocks = 0;
+  BatcherSort(
+      std::span<int>(keys), 10,
+      [&](std::span<int> block) {
+        sorted_blocks++;
+        std::ranges::sort(block);
+      },
+      SerialFor{});
+  EXPECT_EQ(keys, expected);
+  EXPECT_EQ(sorted_blocks, 10U);
+}
+
+TEST(batcher_sort_tests, check_bitonic_merge_sort) {
+  for (size_t n = 0; n <= 70; n++) {
+    CheckBitonicMergeSort(RandomDoubles(n, -1.0, 1.0, static_cast<unsigned>(n)));
+    CheckBitonicMergeSort(RandomInts(n, -50, 50, static_cast<unsigned>(n)));
+  }
+  CheckBitonicMergeSort(RandomDoubles(100003, -1e3, 1e3, 5));
+  CheckBitonicMergeSort(RandomInts(100003, -100, 100, 6));
+  // keys without vector merges
+  CheckBitonicMergeSort(std::vector<int64_t>{5, -1, 3, 3, 0});
+
+  std::vector<double> keys(10);
+  std::vector<double> buffer(9);
+  EXPECT_THROW(BitonicMergeSort(std::span<double>(keys), std::span<double>(buffer)), std::invalid_argument);
+}
+
+TEST(batcher_sort_tests, check_signed_zeros_are_kept) {
+  std::vector<double> keys(4096);
+  for (size_t i = 0; i < keys.size(); i++) {
+    keys[i] = i % 3 == 0 ? -0.0 : (i % 3 == 1 ? 0.0 : 1.0);
+  }
+  std::ranges::shuffle(keys, std::mt19937_64(7));
+  std::vector<double> buffer(keys.size());
+  BitonicMergeSort(std::span<double>(keys), std::span<double>(buffer));
+  const auto negative_zeros = std::ranges::count_if(keys, [](double x) { return x == 0.0 && std::signbit(x); });
+  EXPECT_EQ(negative_zeros, 1366);
+  EXPECT_TRUE(std::ranges::is_sorted(keys));
+}
+
+TEST(batcher_sort_tests, check_on_thread_pool) {
+  ppc::core::ThreadPool pool(4);
+  auto keys = RandomDoubles(300000, -1e3, 1e3, 8);
+  auto expected = keys;
+  std::ranges::sort(expected);
+  auto tree = keys;
+  BatcherSort(std::span<double>(keys), 8, PoolFor{&pool});
+  SortAndMergeTree(tree, pool);
+  EXPECT_EQ(keys, expected);
+  EXPECT_EQ(tree, expected);
+}
+
+// seconds of BatcherSort on the shared pool against blocks merged by a tree of std::inplace_merge and std::sort,
+// from 10^6 keys up to PPC_BATCHER_BENCH_MAX_KEYS, recorded as test properties; skipped unless that variable is set
+TEST(batcher_sort_tests, benchmark_double_keys_slow) {
+  const std::string max_keys = ppc::util::GetEnvVariable("PPC_BATCHER_BENCH_MAX_KEYS");
+  if (max_keys.empty()) {
+    GTEST_SKIP() << "PPC_BATCHER_BENCH_MAX_KEYS is not set";
+  }
+  const size_t limit = std::stoull(max_keys);
+  auto &pool = ppc::core::ThreadPool::Instance();
+  const auto seconds = [](const auto &sort, std::vector<double> &keys) {
+    const auto start = std::chrono::steady_clock::now();
+    sort(keys);
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  };
+  for (size_t n = 1000000; n <= limit; n *= 10) {
+    const auto keys = RandomDoubles(n, -1e6, 1e6, 9);
+    auto expected = keys;
+    auto batcher = keys;
+    auto tree = keys;
+    const double sort_time = seconds([](std::vector<double> &k) { std::ranges::sort(k); }, expected);
+    const double batcher_time = seconds(
+        [&](std::vector<double> &k) {
+          BatcherSort(std::span<double>(k), static_cast<size_t>(pool.NumThreads()) * 2, PoolFor{&pool});
+        },
+        batcher);
+    const double tree_time = seconds([&](std::vector<double> &k) { SortAndMergeTree(k, pool); }, tree);
+    ASSERT_EQ(batcher, expected);
+    ASSERT_EQ(tree, expected);
+    RecordProperty("batcher_" + std::to_string(n), std::to_string(batcher_time));
+    RecordProperty("merge_tree_" + std::to_string(n), std::to_string(tree_time));
+    RecordProperty("std_sort_" + std::to_string(n), std::to_string(sort_time));
+  }
+}
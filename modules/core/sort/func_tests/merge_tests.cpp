@@ -0,0 +1,283 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "core/sort/func_tests/test_sort.hpp"
+#include "core/sort/include/merge.hpp"
+#include "core/thread_pool/include/thread_pool.hpp"
+#include "core/util/include/util.hpp"
+
+namespace {
+
+using ppc::core::sort::KWayMerge;
+using ppc::core::sort::LoserTreeMerge;
+using ppc::core::sort::MergeRuns;
+using ppc::core::sort::ParallelMerge;
+using ppc::test::sort::PoolFor;
+using ppc::test::sort::RandomInts;
+using ppc::test::sort::SerialFor;
+
+// a key and the place it came from, ordered by the key only
+using Tagged = std::pair<int, size_t>;
+
+constexpr auto kByKey = [](const Tagged &a, const Tagged &b) { return a.first < b.first; };
+
+// bounds of runs of random lengths up to max_run over n keys, empty runs included
+std::vector<size_t> RandomBounds(size_t n, size_t max_run, unsigned seed) {
+  std::mt19937_64 gen(seed);
+  std::uniform_int_distribution<size_t> dist(0, max_run);
+  std::vector<size_t> bounds{0};
+  while (bounds.back() < n) {
+    bounds.push_back(std::min(n, bounds.back() + dist(gen)));
+  }
+  return bounds;
+}
+
+// keys tagged with their places, every run of bounds sorted by key
+std::vector<Tagged> SortedRuns(const std::vector<int> &keys, const std::vector<size_t> &bounds) {
+  std::vector<Tagged> tagged(keys.size());
+  for (size_t i = 0; i < keys.size(); i++) {
+    tagged[i] = {keys[i], i};
+  }
+  for (size_t r = 0; r + 1 < bounds.size(); r++) {
+    std::stable_sort(tagged.begin() + static_cast<std::ptrdiff_t>(bounds[r]),
+                     tagged.begin() + static_cast<std::ptrdiff_t>(bounds[r + 1]), kByKey);
+  }
+  return tagged;
+}
+
+std::vector<std::span<const Tagged>> Runs(const std::vector<Tagged> &keys, const std::vector<size_t> &bounds) {
+  std::vector<std::span<const Tagged>> runs;
+  for (size_t r = 0; r + 1 < bounds.size(); r++) {
+    runs.emplace_back(keys.data() + bounds[r], bounds[r + 1] - bounds[r]);
+  }
+  return runs;
+}
+
+// the merge of the runs of SortedRuns, stable in the order of the runs
+void CheckMerges(const std::vector<int> &keys, const std::vector<size_t> &bounds) {
+  const auto sorted = SortedRuns(keys, bounds);
+  auto expected = sorted;
+  std::ranges::stable_sort(expected, kByKey);
+  const auto runs = Runs(sorted, bounds);
+  for (const size_t chunks : {1, 3, 8, 33}) {
+    auto merged = sorted;
+    std::vector<Tagged> buffer(merged.size());
+    MergeRuns(std::span<Tagged>(merged), std::span<const size_t>(bounds), std::span<Tagged>(buffer), chunks,
+              SerialFor{}, kByKey);
+    ASSERT_EQ(merged, expected) << "merge_runs n=" << keys.size() << " runs=" << runs.size() << " chunks=" << chunks;
+
+    std::vector<Tagged> out(keys.size());
+    KWayMerge(std::span<const std::span<const Tagged>>(runs), std::span<Tagged>(out), chunks, SerialFor{}, kByKey);
+    ASSERT_EQ(out, expected) << "k_way n=" << keys.size() << " runs=" << runs.size() << " chunks=" << chunks;
+  }
+}
+
+// the merge of the runs as smirnov_i_radix_sort_simple_merge did it: pairs of runs taken from a deque under a lock,
+// merged into fresh vectors by one thread each, round after round
+std::vector<int> DequeMerge(std::vector<std::vector<int>> runs, ppc::core::ThreadPool &pool) {
+  std::deque<std::vector<int>> current(std::make_move_iterator(runs.begin()), std::make_move_iterator(runs.end()));
+  std::deque<std::vector<int>> next;
+  std::mutex mtx;
+  while (current.size() > 1) {
+    const size_t pairs = current.size() / 2;
+    ppc::core::ParallelFor(
+        0, pairs,
+        [&](size_t begin, size_t end) {
+          for (size_t p = begin; p < end; p++) {
+            std::vector<int> a;
+            std::vector<int> b;
+            {
+              std::lock_guard<std::mutex> lock(mtx);
+              a = std::move(current.front());
+              current.pop_front();
+              b = std::move(current.front());
+              current.pop_front();
+            }
+            std::vector<int> merged(a.size() + b.size());
+            std::ranges::merge(a, b, merged.begin());
+            std::lock_guard<std::mutex> lock(mtx);
+            next.push_back(std::move(merged));
+          }
+        },
+        1, pool);
+    if (!current.empty()) {
+      next.push_back(std::move(current.front()));
+      current.pop_front();
+    }
+    std::swap(current, next);
+  }
+  return current.empty() ? std::vector<int>{} : std::move(current.front());
+}
+
+}  // namespace
+
+TEST(merge_tests, check_parallel_merge) {
+  for (const auto &[na, nb] : {std::pair<size_t, size_t>{0, 0}, {0, 5}, {7, 0}, {1, 1}, {100, 3}, {5000, 7000}}) {
+    const auto sorted = SortedRuns(RandomInts(na + nb, -50, 50, static_cast<unsigned>(na)), {0, na, na + nb});
+    auto expected = sorted;
+    std::ranges::stable_sort(expected, kByKey);
+    for (const size_t chunks : {1, 2, 5, 64}) {
+      std::vector<Tagged> out(na + nb);
+      ParallelMerge(std::span<const Tagged>(sorted.data(), na), std::span<const Tagged>(sorted.data() + na, nb),
+                    std::span<Tagged>(out), chunks, SerialFor{}, kByKey);
+      ASSERT_EQ(out, expected) << "na=" << na << " nb=" << nb << " chunks=" << chunks;
+    }
+  }
+  // one run entirely before the other
+  std::vector<int> low(1000);
+  std::vector<int> high(3000);
+  for (size_t i = 0; i < high.size(); i++) {
+    high[i] = static_cast<int>(i + low.size());
+    if (i < low.size()) {
+      low[i] = static_cast<int>(i);
+    }
+  }
+  std::vector<int> out(low.size() + high.size());
+  ParallelMerge(std::span<const int>(high), std::span<const int>(low), std::span<int>(out), 7, SerialFor{});
+  EXPECT_TRUE(std::ranges::is_sorted(out));
+  EXPECT_EQ(out.front(), 0);
+  EXPECT_EQ(out.back(), 3999);
+}
+
+TEST(merge_tests, check_runs_of_random_lengths) {
+  for (const auto &[n, max_run] : {std::pair<size_t, size_t>{0, 1}, {1, 1}, {10, 3}, {1000, 50}, {20000, 3000}}) {
+    CheckMerges(RandomInts(n, -1000, 1000, static_cast<unsigned>(n)), RandomBounds(n, max_run, 1));
+  }
+  // many equal keys over many runs
+  CheckMerges(RandomInts(30000, 0, 3, 2), RandomBounds(30000, 1000, 3));
+}
+
+TEST(merge_tests, check_equal_sized_runs) {
+  for (const size_t runs : {1, 2, 3, 4, 7, 16, 17}) {
+    std::vector<size_t> bounds(runs + 1);
+    for (size_t r = 0; r <= runs; r++) {
+      bounds[r] = 50000 * r / runs;
+    }
+    CheckMerges(RandomInts(50000, -100000, 100000, static_cast<unsigned>(runs)), bounds);
+  }
+}
+
+TEST(merge_tests, check_loser_tree_merge) {
+  const std::vector<std::vector<int>> runs{{}, {1, 4, 4, 9}, {}, {0, 4, 10, 11, 12}, {4}, {}};
+  const std::vector<std::span<const int>> spans(runs.begin(), runs.end());
+  std::vector<int> out(10);
+  LoserTreeMerge(std::span<const std::span<const int>>(spans), out.data());
+  EXPECT_EQ(out, (std::vector<int>{0, 1, 4, 4, 4, 4, 9, 10, 11, 12}));
+
+  const std::vector<int> single{3, 2, 1};
+  const std::vector<std::span<const int>> one{std::span<const int>(single)};
+  std::vector<int> copy(3);
+  LoserTreeMerge(std::span<const std::span<const int>>(one), copy.data(), std::greater{});
+  EXPECT_EQ(copy, single);
+}
+
+TEST(merge_tests, check_small_outputs_throw) {
+  std::vector<int> keys(10);
+  std::vector<int> small(9);
+  const std::vector<size_t> bounds{0, 5, 10};
+  EXPECT_THROW(MergeRuns(std::span<int>(keys), std::span<const size_t>(bounds), std::span<int>(small), 2, SerialFor{}),
+               std::invalid_argument);
+  const std::vector<size_t> short_bounds{0, 5};
+  EXPECT_THROW(
+      MergeRuns(std::span<int>(keys), std::span<const size_t>(short_bounds), std::span<int>(keys), 2, SerialFor{}),
+      std::invalid_argument);
+  const std::vector<std::span<const int>> runs{std::span<const int>(keys)};
+  EXPECT_THROW(KWayMerge(std::span<const std::span<const int>>(runs), std::span<int>(small), 2, SerialFor{}),
+               std::invalid_argument);
+}
+
+TEST(merge_tests, check_on_thread_pool) {
+  ppc::core::ThreadPool pool(4);
+  auto keys = RandomInts(400000, -1000000, 1000000, 4);
+  std::vector<size_t> bounds(5);
+  for (size_t r = 0; r <= 4; r++) {
+    bounds[r] = keys.size() * r / 4;
+  }
+  for (size_t r = 0; r < 4; r++) {
+    std::sort(keys.begin() + static_cast<std::ptrdiff_t>(bounds[r]),
+              keys.begin() + static_cast<std::ptrdiff_t>(bounds[r + 1]));
+  }
+  auto expected = keys;
+  std::ranges::sort(expected);
+
+  std::vector<std::span<const int>> runs;
+  std::vector<std::vector<int>> vectors;
+  for (size_t r = 0; r < 4; r++) {
+    runs.emplace_back(keys.data() + bounds[r], bounds[r + 1] - bounds[r]);
+    vectors.emplace_back(runs.back().begin(), runs.back().end());
+  }
+  std::vector<int> k_way(keys.size());
+  KWayMerge(std::span<const std::span<const int>>(runs), std::span<int>(k_way), 16, PoolFor{&pool});
+  EXPECT_EQ(k_way, expected);
+  EXPECT_EQ(DequeMerge(vectors, pool), expected);
+  std::vector<int> buffer(keys.size());
+  MergeRuns(std::span<int>(keys), std::span<const size_t>(bounds), std::span<int>(buffer), 16, PoolFor{&pool});
+  EXPECT_EQ(keys, expected);
+}
+
+// seconds of MergeRuns and KWayMerge on the shared pool against the deque merge of the simple merge tasks, from 10^6
+// keys up to PPC_MERGE_BENCH_MAX_KEYS, recorded as test properties; skipped unless that variable is set. The tasks
+// merge one sorted run per thread, here there are at least kMinRuns runs so that few threads still merge something.
+TEST(merge_tests, benchmark_int_runs_slow) {
+  const std::string max_keys = ppc::util::GetEnvVariable("PPC_MERGE_BENCH_MAX_KEYS");
+  if (max_keys.empty()) {
+    GTEST_SKIP() << "PPC_MERGE_BENCH_MAX_KEYS is not set";
+  }
+  const size_t limit = std::stoull(max_keys);
+  constexpr size_t kMinRuns = 8;
+  auto &pool = ppc::core::ThreadPool::Instance();
+  const auto threads = static_cast<size_t>(pool.NumThreads());
+  const size_t run_count = std::max(threads, kMinRuns);
+  const auto seconds = [](const auto &merge) {
+    const auto start = std::chrono::steady_clock::now();
+    merge();
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  };
+  for (size_t n = 1000000; n <= limit; n *= 10) {
+    auto keys = RandomInts(n, -1000000000, 1000000000, 5);
+    std::vector<size_t> bounds(run_count + 1);
+    for (size_t r = 0; r <= run_count; r++) {
+      bounds[r] = n * r / run_count;
+    }
+    std::vector<std::span<const int>> runs;
+    std::vector<std::vector<int>> vectors;
+    for (size_t r = 0; r < run_count; r++) {
+      std::sort(keys.begin() + static_cast<std::ptrdiff_t>(bounds[r]),
+                keys.begin() + static_cast<std::ptrdiff_t>(bounds[r + 1]));
+      runs.emplace_back(keys.data() + bounds[r], bounds[r + 1] - bounds[r]);
+      vectors.emplace_back(runs.back().begin(), runs.back().end());
+    }
+    auto expected = keys;
+    std::ranges::sort(expected);
+
+    std::vector<int> k_way(n);
+    const double k_way_time = seconds([&] {
+      KWayMerge(std::span<const std::span<const int>>(runs), std::span<int>(k_way), 4 * threads, PoolFor{&pool});
+    });
+    std::vector<int> deque;
+    const double deque_time = seconds([&] { deque = DequeMerge(vectors, pool); });
+    std::vector<int> buffer(n);
+    const double pairwise_time = seconds([&] {
+      MergeRuns(std::span<int>(keys), std::span<const size_t>(bounds), std::span<int>(buffer), 4 * threads,
+                PoolFor{&pool});
+    });
+    ASSERT_EQ(k_way, expected);
+    ASSERT_EQ(deque, expected);
+    ASSERT_EQ(keys, expected);
+    RecordProperty("merge_runs_" + std::to_string(n), std::to_string(pairwise_time));
+    RecordProperty("k_way_" + std::to_string(n), std::to_string(k_way_time));
+    RecordProperty("deque_" + std::to_string(n), std::to_string(deque_time));
+  }
+}
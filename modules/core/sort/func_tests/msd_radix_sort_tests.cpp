@@ -0,0 +1,186 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "core/sort/func_tests/test_sort.hpp"
+#include "core/sort/include/msd_radix_sort.hpp"
+#include "core/thread_pool/include/thread_pool.hpp"
+#include "core/util/include/util.hpp"
+
+namespace {
+
+using ppc::core::sort::MsdRadixSort;
+using ppc::test::sort::PoolFor;
+using ppc::test::sort::RandomDoubles;
+using ppc::test::sort::SerialFor;
+
+template <typename Sort>
+void CheckSort(std::vector<double> keys, const Sort &sort) {
+  auto expected = keys;
+  std::ranges::sort(expected);
+  sort(keys);
+  ASSERT_EQ(keys, expected) << "n=" << keys.size();
+}
+
+void CheckAllWays(const std::vector<double> &keys) {
+  CheckSort(keys, [](std::vector<double> &k) { MsdRadixSort(std::span<double>(k)); });
+  CheckSort(keys, [](std::vector<double> &k) { MsdRadixSort(std::span<double>(k), 7, SerialFor{}); });
+}
+
+// the pipeline of the double radix tasks before MsdRadixSort: LSD byte passes through a buffer in every block,
+// then merges of neighbouring blocks
+void LsdBlocksAndMerge(std::vector<double> &keys, ppc::core::ThreadPool &pool) {
+  const auto blocks = static_cast<size_t>(pool.NumThreads());
+  const auto bound = [&](size_t b) { return static_cast<std::ptrdiff_t>(keys.size() * b / blocks); };
+  ppc::core::ParallelFor(
+      0, blocks,
+      [&](size_t begin, size_t end) {
+        for (size_t b = begin; b < end; b++) {
+          std::span<double> block(keys.begin() + bound(b), keys.begin() + bound(b + 1));
+          std::vector<double> buffer(block.size());
+          for (size_t shift = 0; shift < 64; shift += 8) {
+            std::array<size_t, 257> offsets{};
+            for (const double x : block) {
+              offsets[((ppc::core::sort::detail::MsdKey(x) >> shift) & 255) + 1]++;
+            }
+            for (size_t d = 1; d < offsets.size(); d++) {
+              offsets[d] += offsets[d - 1];
+            }
+            for (const double x : block) {
+              buffer[offsets[(ppc::core::sort::detail::MsdKey(x) >> shift) & 255]++] = x;
+            }
+            std::ranges::copy(buffer, block.begin());
+          }
+        }
+      },
+      1, pool);
+  for (size_t width = 1; width < blocks; width *= 2) {
+    ppc::core::ParallelFor(
+        0, (blocks + (2 * width) - 1) / (2 * width),
+        [&](size_t begin, size_t end) {
+          for (size_t pair = begin; pair < end; pair++) {
+            const size_t first = 2 * width * pair;
+            if (first + width < blocks) {
+              std::inplace_merge(keys.begin() + bound(first), keys.begin() + bound(first + width),
+                                 keys.begin() + bound(std::min(first + (2 * width), blocks)));
+            }
+          }
+        },
+        1, pool);
+  }
+}
+
+}  // namespace
+
+TEST(msd_radix_sort_tests, check_random_keys) {
+  for (const size_t n : {0, 1, 2, 31, 33, 1000, 100000, 300000}) {
+    CheckAllWays(RandomDoubles(n, -1e6, 1e6, static_cast<unsigned>(n)));
+    CheckAllWays(RandomDoubles(n, 0.0, 1.0, static_cast<unsigned>(n) + 1));
+  }
+}
+
+TEST(msd_radix_sort_tests, check_special_values) {
+  constexpr double kInf = std::numeric_limits<double>::infinity();
+  const std::vector<double> special = {0.0,
+                                       -0.0,
+                                       kInf,
+                                       -kInf,
+                                       std::numeric_limits<double>::max(),
+                                       std::numeric_limits<double>::lowest(),
+                                       std::numeric_limits<double>::min(),
+                                       -std::numeric_limits<double>::min(),
+                                       std::numeric_limits<double>::denorm_min(),
+                                       -std::numeric_limits<double>::denorm_min(),
+                                       1.0,
+                                       -1.0};
+  std::vector<double> keys;
+  for (int copy = 0; copy < 20000; copy++) {
+    keys.push_back(special[static_cast<size_t>(copy) * 7 % special.size()]);
+  }
+  CheckAllWays(keys);
+
+  // -0.0 is ordered before 0.0
+  std::vector<double> zeros = {0.0, -0.0, 0.0, -0.0};
+  MsdRadixSort(std::span<double>(zeros));
+  EXPECT_TRUE(std::signbit(zeros[0]) && std::signbit(zeros[1]));
+  EXPECT_FALSE(std::signbit(zeros[2]) || std::signbit(zeros[3]));
+}
+
+TEST(msd_radix_sort_tests, check_keys_with_constant_digits) {
+  // every level is skipped
+  CheckAllWays(std::vector<double>(200000, -3.5));
+  // keys which differ only in their lowest byte
+  std::vector<double> close(200000);
+  for (size_t i = 0; i < close.size(); i++) {
+    close[i] = std::bit_cast<double>(std::bit_cast<uint64_t>(1.0) + ((i * 37) % 256));
+  }
+  CheckAllWays(close);
+  // one value with rare others
+  auto skewed = RandomDoubles(200000, -10.0, 10.0, 6);
+  for (size_t i = 0; i < skewed.size(); i++) {
+    if (i % 10 != 0) {
+      skewed[i] = 2.0;
+    }
+  }
+  CheckAllWays(skewed);
+}
+
+TEST(msd_radix_sort_tests, check_sorted_and_reversed_keys) {
+  auto keys = RandomDoubles(200000, -100.0, 100.0, 7);
+  std::ranges::sort(keys);
+  CheckAllWays(keys);
+  std::ranges::reverse(keys);
+  CheckAllWays(keys);
+}
+
+TEST(msd_radix_sort_tests, check_on_thread_pool) {
+  ppc::core::ThreadPool pool(4);
+  const auto keys = RandomDoubles(500000, -1e3, 1e3, 8);
+  CheckSort(keys, [&](std::vector<double> &k) { MsdRadixSort(std::span<double>(k), 16, PoolFor{&pool}); });
+  CheckSort(keys, [&](std::vector<double> &k) { LsdBlocksAndMerge(k, pool); });
+}
+
+// seconds of MsdRadixSort on the shared pool against the LSD blocks and merges pipeline and std::sort from 10^6
+// keys up to PPC_RADIX_BENCH_MAX_KEYS, recorded as test properties; skipped unless that variable is set
+TEST(msd_radix_sort_tests, benchmark_double_keys_slow) {
+  const std::string max_keys = ppc::util::GetEnvVariable("PPC_RADIX_BENCH_MAX_KEYS");
+  if (max_keys.empty()) {
+    GTEST_SKIP() << "PPC_RADIX_BENCH_MAX_KEYS is not set";
+  }
+  const size_t limit = std::stoull(max_keys);
+  auto &pool = ppc::core::ThreadPool::Instance();
+  const auto seconds = [](const auto &sort, std::vector<double> &keys) {
+    const auto start = std::chrono::steady_clock::now();
+    sort(keys);
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  };
+  for (size_t n = 1000000; n <= limit; n *= 10) {
+    const auto keys = RandomDoubles(n, -1e6, 1e6, 9);
+    auto expected = keys;
+    auto msd = keys;
+    auto lsd = keys;
+    const double sort_time = seconds([](std::vector<double> &k) { std::ranges::sort(k); }, expected);
+    const double msd_time = seconds(
+        [&](std::vector<double> &k) {
+          MsdRadixSort(std::span<double>(k), static_cast<size_t>(pool.NumThreads()) * 4, PoolFor{&pool});
+        },
+        msd);
+    const double lsd_time = seconds([&](std::vector<double> &k) { LsdBlocksAndMerge(k, pool); }, lsd);
+    ASSERT_EQ(msd, expected);
+    ASSERT_EQ(lsd, expected);
+    RecordProperty("msd_" + std::to_string(n), std::to_string(msd_time));
+    RecordProperty("lsd_blocks_merge_" + std::to_string(n), std::to_string(lsd_time));
+    RecordProperty("std_sort_" + std::to_string(n), std::to_string(sort_time));
+  }
+}
@@ -0,0 +1,188 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "core/sort/func_tests/test_sort.hpp"
+#include "core/sort/include/quick_sort.hpp"
+#include "core/thread_pool/include/thread_pool.hpp"
+#include "core/util/include/util.hpp"
+
+namespace {
+
+using ppc::core::sort::QuickSort;
+using ppc::test::sort::CheckAllWays;
+using ppc::test::sort::PoolFor;
+using ppc::test::sort::RandomDoubles;
+using ppc::test::sort::RandomInts;
+
+// QuickSort as an object for CheckAllWays
+constexpr auto kQuickSort = [](auto &&...args) { QuickSort(std::forward<decltype(args)>(args)...); };
+
+// comparisons of QuickSort on keys over n log2 n
+double ComparisonsPerKeyLog(std::vector<int> keys) {
+  size_t comparisons = 0;
+  QuickSort(std::span<int>(keys), [&](int a, int b) {
+    comparisons++;
+    return a < b;
+  });
+  EXPECT_TRUE(std::ranges::is_sorted(keys));
+  const auto n = static_cast<double>(keys.size());
+  return static_cast<double>(comparisons) / (n * static_cast<double>(std::bit_width(keys.size())));
+}
+
+// the quicksort of the hoare sort tasks before QuickSort: a Lomuto partition around the last key in every block,
+// then rounds of std::inplace_merge of neighbouring blocks
+void LomutoSort(double *keys, std::ptrdiff_t low, std::ptrdiff_t high) {
+  while (low < high) {
+    const double pivot = keys[high];
+    std::ptrdiff_t i = low - 1;
+    for (std::ptrdiff_t j = low; j < high; j++) {
+      if (keys[j] <= pivot) {
+        std::swap(keys[++i], keys[j]);
+      }
+    }
+    std::swap(keys[i + 1], keys[high]);
+    LomutoSort(keys, low, i);
+    low = i + 2;
+  }
+}
+
+void LomutoBlocksAndMerge(std::vector<double> &keys, ppc::core::ThreadPool &pool) {
+  const auto blocks = static_cast<size_t>(pool.NumThreads());
+  const auto bound = [&](size_t b) { return static_cast<std::ptrdiff_t>(keys.size() * b / blocks); };
+  ppc::core::ParallelFor(
+      0, blocks,
+      [&](size_t begin, size_t end) {
+        for (size_t b = begin; b < end; b++) {
+          LomutoSort(keys.data(), bound(b), bound(b + 1) - 1);
+        }
+      },
+      1, pool);
+  for (size_t width = 1; width < blocks; width *= 2) {
+    ppc::core::ParallelFor(
+        0, (blocks + (2 * width) - 1) / (2 * width),
+        [&](size_t begin, size_t end) {
+          for (size_t pair = begin; pair < end; pair++) {
+            const size_t first = 2 * width * pair;
+            if (first + width < blocks) {
+              std::inplace_merge(keys.begin() + bound(first), keys.begin() + bound(first + width),
+                                 keys.begin() + bound(std::min(first + (2 * width), blocks)));
+            }
+          }
+        },
+        1, pool);
+  }
+}
+
+}  // namespace
+
+TEST(quick_sort_tests, check_random_keys) {
+  for (const size_t n : {0, 1, 2, 3, 24, 25, 129, 1000, 100000, 300000}) {
+    CheckAllWays(RandomDoubles(n, -1e6, 1e6, static_cast<unsigned>(n)), kQuickSort);
+    CheckAllWays(RandomInts(n, std::numeric_limits<int>::min(), std::numeric_limits<int>::max(), 1), kQuickSort);
+  }
+  CheckAllWays(RandomDoubles(200000, -1.0, 1.0, 2), kQuickSort, std::greater{});
+}
+
+TEST(quick_sort_tests, check_sorted_reversed_and_equal_keys) {
+  auto keys = RandomInts(200000, -1000000, 1000000, 3);
+  std::ranges::sort(keys);
+  CheckAllWays(keys, kQuickSort);
+  std::ranges::reverse(keys);
+  CheckAllWays(keys, kQuickSort);
+  CheckAllWays(std::vector<int>(200000, 7), kQuickSort);
+  CheckAllWays(RandomInts(200000, 0, 3, 4), kQuickSort);
+  // organ pipe
+  std::vector<int> pipe(200000);
+  for (size_t i = 0; i < pipe.size(); i++) {
+    pipe[i] = static_cast<int>(std::min(i, pipe.size() - i));
+  }
+  CheckAllWays(pipe, kQuickSort);
+}
+
+TEST(quick_sort_tests, check_extreme_pivots_of_parallel_partition) {
+  // one minimum in an even chunk and a maximum among equal keys: the pivot keeps one side empty
+  std::vector<int> keys(100000, 5);
+  keys[0] = -1;
+  CheckAllWays(keys, kQuickSort);
+  keys[0] = 5;
+  keys[keys.size() / 2] = 9;
+  CheckAllWays(keys, kQuickSort);
+  CheckAllWays(RandomInts(100000, 0, 1, 5), kQuickSort);
+}
+
+TEST(quick_sort_tests, check_comparisons_stay_n_log_n) {
+  constexpr size_t kN = 1 << 17;
+  std::vector<int> sorted(kN);
+  for (size_t i = 0; i < kN; i++) {
+    sorted[i] = static_cast<int>(i);
+  }
+  auto reversed = sorted;
+  std::ranges::reverse(reversed);
+  // every key but the last one in the middle of the others, the worst case of median of three around the middle
+  std::vector<int> zigzag(kN);
+  for (size_t i = 0; i < kN; i++) {
+    zigzag[i] = static_cast<int>(i % 2 == 0 ? i / 2 : (kN / 2) + (i / 2));
+  }
+  for (const auto &keys : {sorted, reversed, zigzag, std::vector<int>(kN, 1), RandomInts(kN, 0, 1, 6),
+                           RandomInts(kN, -1000000, 1000000, 7)}) {
+    EXPECT_LT(ComparisonsPerKeyLog(keys), 2.0);
+  }
+}
+
+TEST(quick_sort_tests, check_on_thread_pool) {
+  ppc::core::ThreadPool pool(4);
+  const auto keys = RandomDoubles(500000, -1e3, 1e3, 8);
+  auto expected = keys;
+  std::ranges::sort(expected);
+  auto quick = keys;
+  auto lomuto = keys;
+  QuickSort(std::span<double>(quick), 16, PoolFor{&pool});
+  LomutoBlocksAndMerge(lomuto, pool);
+  EXPECT_EQ(quick, expected);
+  EXPECT_EQ(lomuto, expected);
+}
+
+// seconds of QuickSort on the shared pool against Lomuto blocks merged by std::inplace_merge and std::sort from 10^6
+// keys up to PPC_QUICK_BENCH_MAX_KEYS, recorded as test properties; skipped unless that variable is set
+TEST(quick_sort_tests, benchmark_double_keys_slow) {
+  const std::string max_keys = ppc::util::GetEnvVariable("PPC_QUICK_BENCH_MAX_KEYS");
+  if (max_keys.empty()) {
+    GTEST_SKIP() << "PPC_QUICK_BENCH_MAX_KEYS is not set";
+  }
+  const size_t limit = std::stoull(max_keys);
+  auto &pool = ppc::core::ThreadPool::Instance();
+  const auto seconds = [](const auto &sort, std::vector<double> &keys) {
+    const auto start = std::chrono::steady_clock::now();
+    sort(keys);
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  };
+  for (size_t n = 1000000; n <= limit; n *= 10) {
+    const auto keys = RandomDoubles(n, -1e6, 1e6, 9);
+    auto expected = keys;
+    auto quick = keys;
+    auto lomuto = keys;
+    const double sort_time = seconds([](std::vector<double> &k) { std::ranges::sort(k); }, expected);
+    const double quick_time = seconds(
+        [&](std::vector<double> &k) {
+          QuickSort(std::span<double>(k), static_cast<size_t>(pool.NumThreads()) * 4, PoolFor{&pool});
+        },
+        quick);
+    const double lomuto_time = seconds([&](std::vector<double> &k) { LomutoBlocksAndMerge(k, pool); }, lomuto);
+    ASSERT_EQ(quick, expected);
+    ASSERT_EQ(lomuto, expected);
+    RecordProperty("quick_" + std::to_string(n), std::to_string(quick_time));
+    RecordProperty("lomuto_blocks_merge_" + std::to_string(n), std::to_string(lomuto_time));
+    RecordProperty("std_sort_" + std::to_string(n), std::to_string(sort_time));
+  }
+}
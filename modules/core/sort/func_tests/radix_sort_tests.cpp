@@ -0,0 +1,134 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "core/sort/func_tests/test_sort.hpp"
+#include "core/sort/include/radix_sort.hpp"
+#include "core/thread_pool/include/thread_pool.hpp"
+#include "core/util/include/util.hpp"
+
+namespace {
+
+using ppc::test::sort::PoolFor;
+using ppc::test::sort::SerialFor;
+
+template <typename T>
+std::vector<T> RandomKeys(size_t n, T lo, T hi, unsigned seed) {
+  std::mt19937_64 gen(seed);
+  std::uniform_int_distribution<int64_t> dist(static_cast<int64_t>(lo), static_cast<int64_t>(hi));
+  std::vector<T> keys(n);
+  for (auto &key : keys) {
+    key = static_cast<T>(dist(gen));
+  }
+  return keys;
+}
+
+template <typename T, typename ParallelFor>
+void CheckSort(std::vector<T> keys, size_t num_chunks, const ParallelFor &parallel_for) {
+  auto expected = keys;
+  std::ranges::sort(expected);
+  ppc::core::sort::RadixSort(std::span<T>(keys), num_chunks, parallel_for);
+  ASSERT_EQ(keys, expected) << "n=" << keys.size() << " chunks=" << num_chunks;
+}
+
+template <typename T>
+void CheckType(T lo, T hi) {
+  for (const size_t n : {0, 1, 255, 256, 1000, 100000}) {
+    const auto keys = RandomKeys<T>(n, lo, hi, static_cast<unsigned>(n));
+    CheckSort(keys, 1, SerialFor{});
+    CheckSort(keys, 7, SerialFor{});
+  }
+}
+
+}  // namespace
+
+TEST(radix_sort_tests, check_signed_32_bit_keys) {
+  CheckType<int32_t>(std::numeric_limits<int32_t>::min(), std::numeric_limits<int32_t>::max());
+  CheckType<int32_t>(-1000, 1000);
+}
+
+TEST(radix_sort_tests, check_unsigned_32_bit_keys) {
+  CheckType<uint32_t>(0, std::numeric_limits<uint32_t>::max());
+}
+
+TEST(radix_sort_tests, check_64_bit_keys) {
+  CheckType<int64_t>(std::numeric_limits<int64_t>::min() / 2, std::numeric_limits<int64_t>::max() / 2);
+  CheckType<uint64_t>(0, std::numeric_limits<int64_t>::max());
+}
+
+TEST(radix_sort_tests, check_8_and_16_bit_keys) {
+  CheckType<int8_t>(std::numeric_limits<int8_t>::min(), std::numeric_limits<int8_t>::max());
+  CheckType<uint16_t>(0, std::numeric_limits<uint16_t>::max());
+  // enough keys for one 16-bit pass
+  const auto keys = RandomKeys<int16_t>(size_t{1} << 20, -30000, 30000, 16);
+  CheckSort(keys, 1, SerialFor{});
+  CheckSort(keys, 3, SerialFor{});
+}
+
+TEST(radix_sort_tests, check_keys_with_constant_digits) {
+  // passes over the constant top digits are skipped, which leaves the keys in the buffer after an odd count
+  CheckSort(RandomKeys<int>(5000, 0, 2000, 1), 4, SerialFor{});
+  CheckSort(RandomKeys<int>(5000, -5, 5, 2), 4, SerialFor{});
+  CheckSort(std::vector<int>(5000, -7), 4, SerialFor{});
+  std::vector<int> extremes(3000, std::numeric_limits<int>::max());
+  std::fill_n(extremes.begin(), 1000, std::numeric_limits<int>::min());
+  std::fill_n(extremes.begin() + 1000, 1000, 0);
+  std::ranges::reverse(extremes);
+  CheckSort(extremes, 4, SerialFor{});
+}
+
+TEST(radix_sort_tests, check_on_thread_pool) {
+  ppc::core::ThreadPool pool(4);
+  const auto keys = RandomKeys<int>(300000, -1000000, 1000000, 3);
+  CheckSort(keys, 16, PoolFor{&pool});
+  CheckSort(keys, 1, PoolFor{&pool});
+}
+
+TEST(radix_sort_tests, check_sequential_overload_and_buffer_size) {
+  auto keys = RandomKeys<int>(10000, -100, 100, 4);
+  auto expected = keys;
+  std::ranges::sort(expected);
+  ppc::core::sort::RadixSort(std::span<int>(keys));
+  EXPECT_EQ(keys, expected);
+
+  std::vector<int> buffer(keys.size() - 1);
+  EXPECT_THROW(ppc::core::sort::RadixSort(std::span<int>(keys), std::span<int>(buffer), 1, SerialFor{}),
+               std::invalid_argument);
+}
+
+// seconds of RadixSort on the shared pool against std::sort from 10^6 keys up to PPC_RADIX_BENCH_MAX_KEYS (10^9 needs
+// 8 GB), recorded as test properties for --gtest_output; skipped unless that variable is set
+TEST(radix_sort_tests, benchmark_int32_keys_slow) {
+  const std::string max_keys = ppc::util::GetEnvVariable("PPC_RADIX_BENCH_MAX_KEYS");
+  if (max_keys.empty()) {
+    GTEST_SKIP() << "PPC_RADIX_BENCH_MAX_KEYS is not set";
+  }
+  const size_t limit = std::stoull(max_keys);
+  auto &pool = ppc::core::ThreadPool::Instance();
+  for (size_t n = 1000000; n <= limit; n *= 10) {
+    auto keys = RandomKeys<int32_t>(n, std::numeric_limits<int32_t>::min(), std::numeric_limits<int32_t>::max(), 5);
+    auto expected = keys;
+    const auto seconds = [](auto start) {
+      return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    };
+    auto start = std::chrono::steady_clock::now();
+    std::ranges::sort(expected);
+    const double sort_time = seconds(start);
+    start = std::chrono::steady_clock::now();
+    ppc::core::sort::RadixSort(std::span<int32_t>(keys), static_cast<size_t>(pool.NumThreads()) * 4,
+                               PoolFor{&pool});
+    const double radix_time = seconds(start);
+    ASSERT_EQ(keys, expected);
+    RecordProperty("radix_" + std::to_string(n), std::to_string(radix_time));
+    RecordProperty("std_sort_" + std::to_string(n), std::to_string(sort_time));
+  }
+}
@@ -0,0 +1,170 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "core/sort/func_tests/test_sort.hpp"
+#include "core/sort/include/shell_sort.hpp"
+#include "core/thread_pool/include/thread_pool.hpp"
+#include "core/util/include/util.hpp"
+
+namespace {
+
+using ppc::core::sort::ShellGaps;
+using ppc::core::sort::ShellSort;
+using ppc::test::sort::CheckAllWays;
+using ppc::test::sort::PoolFor;
+using ppc::test::sort::RandomDoubles;
+using ppc::test::sort::RandomInts;
+using ppc::test::sort::SerialFor;
+
+// ShellSort as an object for CheckAllWays
+constexpr auto kShellSort = [](auto &&...args) { ShellSort(std::forward<decltype(args)>(args)...); };
+
+// the Shell sort of the shell sort tasks before ShellSort: Knuth's gaps 1, 4, 13, ... on one block per thread, then
+// rounds of std::inplace_merge of neighbouring blocks
+void KnuthShellSort(int *keys, size_t n) {
+  size_t gap = 1;
+  while (gap <= n / 3) {
+    gap = (gap * 3) + 1;
+  }
+  for (; gap > 0; gap /= 3) {
+    for (size_t i = gap; i < n; i++) {
+      const int x = keys[i];
+      size_t j = i;
+      for (; j >= gap && keys[j - gap] > x; j -= gap) {
+        keys[j] = keys[j - gap];
+      }
+      keys[j] = x;
+    }
+  }
+}
+
+void KnuthBlocksAndMerge(std::vector<int> &keys, ppc::core::ThreadPool &pool) {
+  const auto blocks = static_cast<size_t>(pool.NumThreads());
+  const auto bound = [&](size_t b) { return keys.size() * b / blocks; };
+  ppc::core::ParallelFor(
+      0, blocks,
+      [&](size_t begin, size_t end) {
+        for (size_t b = begin; b < end; b++) {
+          KnuthShellSort(keys.data() + bound(b), bound(b + 1) - bound(b));
+        }
+      },
+      1, pool);
+  for (size_t width = 1; width < blocks; width *= 2) {
+    ppc::core::ParallelFor(
+        0, (blocks + (2 * width) - 1) / (2 * width),
+        [&](size_t begin, size_t end) {
+          for (size_t pair = begin; pair < end; pair++) {
+            const size_t first = 2 * width * pair;
+            if (first + width < blocks) {
+              const auto at = [&](size_t b) { return keys.begin() + static_cast<std::ptrdiff_t>(bound(b)); };
+              std::inplace_merge(at(first), at(first + width), at(std::min(first + (2 * width), blocks)));
+            }
+          }
+        },
+        1, pool);
+  }
+}
+
+}  // namespace
+
+TEST(shell_sort_tests, check_gaps) {
+  EXPECT_EQ(ShellGaps(0), std::vector<size_t>{1});
+  EXPECT_EQ(ShellGaps(2), std::vector<size_t>{1});
+  EXPECT_EQ(ShellGaps(57), (std::vector<size_t>{23, 10, 4, 1}));
+  EXPECT_EQ(ShellGaps(1751), (std::vector<size_t>{1750, 701, 301, 132, 57, 23, 10, 4, 1}));
+  EXPECT_EQ(ShellGaps(3938).front(), 3937);
+  const auto gaps = ShellGaps(10000000);
+  EXPECT_LT(gaps.front(), 10000000);
+  EXPECT_GE(gaps.front() * 9 / 4, 10000000 - 1);
+  EXPECT_EQ(gaps.back(), 1);
+  EXPECT_TRUE(std::ranges::is_sorted(gaps, std::greater{}));
+}
+
+TEST(shell_sort_tests, check_random_keys) {
+  for (const size_t n : {0, 1, 2, 3, 56, 57, 58, 1000, 32767, 32768, 32769, 65536, 65537, 300000}) {
+    CheckAllWays(RandomDoubles(n, -1e6, 1e6, static_cast<unsigned>(n)), kShellSort);
+    CheckAllWays(RandomInts(n, std::numeric_limits<int>::min(), std::numeric_limits<int>::max(), 1), kShellSort);
+  }
+  CheckAllWays(RandomDoubles(200000, -1.0, 1.0, 2), kShellSort, std::greater{});
+}
+
+TEST(shell_sort_tests, check_sorted_reversed_and_equal_keys) {
+  auto keys = RandomInts(300000, -1000000, 1000000, 3);
+  std::ranges::sort(keys);
+  CheckAllWays(keys, kShellSort);
+  std::ranges::reverse(keys);
+  CheckAllWays(keys, kShellSort);
+  CheckAllWays(std::vector<int>(300000, 7), kShellSort);
+  CheckAllWays(RandomInts(300000, 0, 3, 4), kShellSort);
+  // organ pipe
+  std::vector<int> pipe(300000);
+  for (size_t i = 0; i < pipe.size(); i++) {
+    pipe[i] = static_cast<int>(std::min(i, pipe.size() - i));
+  }
+  CheckAllWays(pipe, kShellSort);
+}
+
+TEST(shell_sort_tests, check_string_keys) {
+  const auto ints = RandomInts(100000, 0, 1000000, 5);
+  std::vector<std::string> keys(ints.size());
+  for (size_t i = 0; i < ints.size(); i++) {
+    keys[i] = std::to_string(ints[i]);
+  }
+  CheckAllWays(keys, kShellSort);
+}
+
+TEST(shell_sort_tests, check_on_thread_pool) {
+  ppc::core::ThreadPool pool(4);
+  const auto keys = RandomInts(500000, -1000000, 1000000, 6);
+  auto expected = keys;
+  std::ranges::sort(expected);
+  auto shell = keys;
+  auto knuth = keys;
+  ShellSort(std::span<int>(shell), 16, PoolFor{&pool});
+  KnuthBlocksAndMerge(knuth, pool);
+  EXPECT_EQ(shell, expected);
+  EXPECT_EQ(knuth, expected);
+}
+
+// seconds of ShellSort on the shared pool against Knuth-gap blocks merged by std::inplace_merge and std::sort from
+// 10^6 keys up to PPC_SHELL_BENCH_MAX_KEYS, skipped unless it is set
+TEST(shell_sort_tests, benchmark_int_keys_slow) {
+  const std::string max_keys = ppc::util::GetEnvVariable("PPC_SHELL_BENCH_MAX_KEYS");
+  if (max_keys.empty()) {
+    GTEST_SKIP() << "PPC_SHELL_BENCH_MAX_KEYS is not set";
+  }
+  const size_t limit = std::stoull(max_keys);
+  auto &pool = ppc::core::ThreadPool::Instance();
+  const auto seconds = [](const auto &sort, std::vector<int> &keys) {
+    const auto start = std::chrono::steady_clock::now();
+    sort(keys);
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  };
+  for (size_t n = 1000000; n <= limit; n *= 10) {
+    const auto keys = RandomInts(n, std::numeric_limits<int>::min(), std::numeric_limits<int>::max(), 7);
+    auto expected = keys;
+    auto shell = keys;
+    auto knuth = keys;
+    const double sort_time = seconds([](std::vector<int> &k) { std::ranges::sort(k); }, expected);
+    const double shell_time = seconds(
+        [&](std::vector<int> &k) {
+          ShellSort(std::span<int>(k), static_cast<size_t>(pool.NumThreads()) * 4, PoolFor{&pool});
+        },
+        shell);
+    const double knuth_time = seconds([&](std::vector<int> &k) { KnuthBlocksAndMerge(k, pool); }, knuth);
+    ASSERT_EQ(shell, expected);
+    ASSERT_EQ(knuth, expected);
+    RecordProperty("shell_" + std::to_string(n), std::to_string(shell_time));
+    RecordProperty("knuth_blocks_merge_" + std::to_string(n), std::to_string(knuth_time));
+    RecordProperty("std_sort_" + std::to_string(n), std::to_string(sort_time));
+  }
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <random>
+#include <span>
+#include <vector>
+
+#include "core/thread_pool/include/thread_pool.hpp"
+
+namespace ppc::test::sort {
+
+// runs the chunks one after another, in reverse order to catch dependencies between chunks
+struct SerialFor {
+  template <typename Body>
+  void operator()(size_t begin, size_t end, const Body &body) const {
+    for (size_t chunk = end; chunk > begin; chunk--) {
+      body(chunk - 1, chunk);
+    }
+  }
+};
+
+struct PoolFor {
+  ppc::core::ThreadPool *pool;
+
+  template <typename Body>
+  void operator()(size_t begin, size_t end, const Body &body) const {
+    ppc::core::ParallelFor(begin, end, body, 1, *pool);
+  }
+};
+
+inline std::vector<double> RandomDoubles(size_t n, double lo, double hi, unsigned seed) {
+  std::mt19937_64 gen(seed);
+  std::uniform_real_distribution<double> dist(lo, hi);
+  std::vector<double> keys(n);
+  for (auto &key : keys) {
+    key = dist(gen);
+  }
+  return keys;
+}
+
+inline std::vector<int> RandomInts(size_t n, int lo, int hi, unsigned seed) {
+  std::mt19937_64 gen(seed);
+  std::uniform_int_distribution<int> dist(lo, hi);
+  std::vector<int> keys(n);
+  for (auto &key : keys) {
+    key = dist(gen);
+  }
+  return keys;
+}
+
+// checks both overloads of a sort of ppc::core::sort against std::ranges::sort, the parallel one on 2, 7 and 16
+// chunks of SerialFor; sort(keys, comp) and sort(keys, num_chunks, parallel_for, comp) call them
+template <typename T, typename Sort, typename Compare = std::less<>>
+void CheckAllWays(const std::vector<T> &keys, const Sort &sort, Compare comp = {}) {
+  auto expected = keys;
+  std::ranges::sort(expected, comp);
+  auto sequential = keys;
+  sort(std::span<T>(sequential), comp);
+  ASSERT_EQ(sequential, expected) << "n=" << keys.size();
+  for (const size_t chunks : {2, 7, 16}) {
+    auto parallel = keys;
+    sort(std::span<T>(parallel), chunks, SerialFor{}, comp);
+    ASSERT_EQ(parallel, expected) << "n=" << keys.size() << " chunks=" << chunks;
+  }
+}
+
+}  // namespace ppc::test::sort
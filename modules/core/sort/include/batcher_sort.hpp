@@ -0,0 +1,351 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "core/util/include/aligned_allocator.hpp"
+#include "core/util/include/cpu_features.hpp"
+
+#ifdef PPC_X86_64
+#include <immintrin.h>
+#endif
+
+namespace ppc::core::sort {
+
+// Sorts keys in ascending order: sort_block(std::span<T>) sorts blocks of ceil(n / num_blocks) keys (the last one
+// may be shorter) by parallel_for, then Batcher's merge-exchange network over the blocks (Knuth, TAOCP 5.2.2,
+// algorithm M) puts them in order. A comparator of the network merges two sorted blocks and leaves the smallest keys
+// in the lower block and the largest in the upper one. The comparators of a stage touch distinct blocks and run by
+// parallel_for, so every stage is spread over all threads instead of ending in one merge of all keys as a tree of
+// merges does. Blocks have at least detail::kMinBatcherBlockKeys keys and all stages share one scratch buffer.
+// On processors with AVX2 (checked at run time) double and int32_t keys are merged by bitonic networks of vector
+// min/max, other keys by std::merge. NaNs are not ordered. parallel_for as in RadixSort.
+template <typename T, typename SortBlock, typename ParallelFor>
+void BatcherSort(std::span<T> keys, size_t num_blocks, const SortBlock &sort_block, const ParallelFor &parallel_for);
+
+// BatcherSort with blocks sorted by BitonicMergeSort in the scratch buffer
+template <typename T, typename ParallelFor>
+void BatcherSort(std::span<T> keys, size_t num_blocks, const ParallelFor &parallel_for);
+
+// Sorts keys in ascending order through buffer: bitonic networks in registers sort runs of two vectors, then passes
+// of the vector merges of BatcherSort double the runs. Keys without vector merges are sorted by std::sort.
+// Throws std::invalid_argument if buffer is smaller than keys.
+template <typename T>
+void BitonicMergeSort(std::span<T> keys, std::span<T> buffer);
+
+namespace detail {
+
+// smaller blocks cost more in stages than their merges save
+constexpr size_t kMinBatcherBlockKeys = 1024;
+
+// AVX2 operations on keys of type T if kEnabled
+template <typename T>
+struct SimdKeys {
+  static constexpr bool kEnabled = false;
+};
+
+// true if keys of type T have vector merges and the processor runs them
+template <typename T>
+bool UseSimd() {
+  return SimdKeys<T>::kEnabled && ppc::util::GetCpuFeatures().avx2;
+}
+
+#ifdef PPC_X86_64
+
+// Min and Max return their second operand for equal keys (and NaNs): the operand order below keeps every key,
+// down to the sign of zeros
+
+template <>
+struct SimdKeys<double> {
+  static constexpr bool kEnabled = true;
+  static constexpr size_t kLanes = 4;
+  using V = __m256d;
+
+  PPC_TARGET("avx2") static V Load(const double *p) { return _mm256_loadu_pd(p); }
+  PPC_TARGET("avx2") static void Store(double *p, V v) { _mm256_storeu_pd(p, v); }
+  PPC_TARGET("avx2") static V Min(V a, V b) { return _mm256_min_pd(a, b); }
+  PPC_TARGET("avx2") static V Max(V a, V b) { return _mm256_max_pd(a, b); }
+  PPC_TARGET("avx2") static V Reverse(V v) { return _mm256_permute4x64_pd(v, 0x1B); }
+  // lane i gets lane i ^ kDistance
+  template <int kDistance>
+  PPC_TARGET("avx2") static V Swap(V v) {
+    if constexpr (kDistance == 1) {
+      return _mm256_permute_pd(v, 0x5);
+    } else {
+      return _mm256_permute2f128_pd(v, v, 1);
+    }
+  }
+  // lanes set in kMask from b, the others from a
+  template <int kMask>
+  PPC_TARGET("avx2") static V Blend(V a, V b) {
+    return _mm256_blend_pd(a, b, kMask);
+  }
+};
+
+template <>
+struct SimdKeys<int32_t> {
+  static constexpr bool kEnabled = true;
+  static constexpr size_t kLanes = 8;
+  using V = __m256i;
+
+  PPC_TARGET("avx2") static V Load(const int32_t *p) {
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p));
+  }
+  PPC_TARGET("avx2") static void Store(int32_t *p, V v) { _mm256_storeu_si256(reinterpret_cast<__m256i *>(p), v); }
+  PPC_TARGET("avx2") static V Min(V a, V b) { return _mm256_min_epi32(a, b); }
+  PPC_TARGET("avx2") static V Max(V a, V b) { return _mm256_max_epi32(a, b); }
+  PPC_TARGET("avx2") static V Reverse(V v) {
+    return _mm256_permutevar8x32_epi32(v, _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0));
+  }
+  template <int kDistance>
+  PPC_TARGET("avx2") static V Swap(V v) {
+    if constexpr (kDistance == 1) {
+      return _mm256_shuffle_epi32(v, 0xB1);
+    } else if constexpr (kDistance == 2) {
+      return _mm256_shuffle_epi32(v, 0x4E);
+    } else {
+      return _mm256_permute2x128_si256(v, v, 1);
+    }
+  }
+  template <int kMask>
+  PPC_TARGET("avx2") static V Blend(V a, V b) {
+    return _mm256_blend_epi32(a, b, kMask);
+  }
+};
+
+// compare-exchange of lanes i and i ^ kDistance in one vector, the lanes set in kMaxMask get the larger key
+template <typename S, int kDistance, int kMaxMask>
+PPC_TARGET("avx2") typename S::V Exchange(typename S::V v) {
+  const typename S::V partner = S::template Swap<kDistance>(v);
+  return S::template Blend<kMaxMask>(S::Min(v, partner), S::Max(v, partner));
+}
+
+// sorts a bitonic vector
+template <typename S>
+PPC_TARGET("avx2") typename S::V CleanBitonic(typename S::V v) {
+  constexpr int kAll = (1 << S::kLanes) - 1;
+  if constexpr (S::kLanes == 8) {
+    v = Exchange<S, 4, 0xF0>(v);
+  }
+  v = Exchange<S, 2, 0xCC & kAll>(v);
+  return Exchange<S, 1, 0xAA & kAll>(v);
+}
+
+// bitonic sort of a vector: pairs sorted in alternating directions, then (for 8 lanes) quads, then the whole vector
+template <typename S>
+PPC_TARGET("avx2") typename S::V SortVector(typename S::V v) {
+  constexpr int kAll = (1 << S::kLanes) - 1;
+  v = Exchange<S, 1, 0x66 & kAll>(v);
+  if constexpr (S::kLanes == 8) {
+    v = Exchange<S, 1, 0x5A>(Exchange<S, 2, 0x3C>(v));
+  }
+  return CleanBitonic<S>(v);
+}
+
+// a and b sorted: a gets the smallest keys of both and b the largest, both sorted
+template <typename S>
+PPC_TARGET("avx2") void MergeVectors(typename S::V &a, typename S::V &b) {
+  const typename S::V reversed = S::Reverse(b);
+  b = CleanBitonic<S>(S::Max(reversed, a));
+  a = CleanBitonic<S>(S::Min(a, reversed));
+}
+
+// merges the sorted runs a and b of at least S::kLanes keys each into out: vectors are read from the run with the
+// smaller next key and merged with the largest keys read so far, which stay in a register; the rest of a run shorter
+// than a vector ends in std::merge
+template <typename T>
+PPC_TARGET("avx2") void MergeRunsSimd(const T *a, size_t na, const T *b, size_t nb, T *out) {
+  using S = SimdKeys<T>;
+  constexpr size_t kLanes = S::kLanes;
+  typename S::V low = S::Load(a);
+  typename S::V high = S::Load(b);
+  size_t ia = kLanes;
+  size_t ib = kLanes;
+  MergeVectors<S>(low, high);
+  S::Store(out, low);
+  out += kLanes;
+  while (ia + kLanes <= na && ib + kLanes <= nb) {
+    const bool from_a = a[ia] <= b[ib];
+    low = S::Load(from_a ? a + ia : b + ib);
+    ia += from_a ? kLanes : 0;
+    ib += from_a ? 0 : kLanes;
+    MergeVectors<S>(low, high);
+    S::Store(out, low);
+    out += kLanes;
+  }
+  T high_keys[kLanes];
+  S::Store(high_keys, high);
+  T rest[2 * kLanes];
+  const bool a_short = ia + kLanes > na;
+  const T *short_run = a_short ? a + ia : b + ib;
+  const T *short_end = a_short ? a + na : b + nb;
+  T *rest_end = std::merge(high_keys, high_keys + kLanes, short_run, short_end, rest);
+  std::merge(rest, rest_end, a_short ? b + ib : a + ia, a_short ? b + nb : a + na, out);
+}
+
+// sorts keys[0, n) in runs of two vectors by bitonic networks in registers, returns the end of the last full run
+template <typename T>
+PPC_TARGET("avx2") size_t SortVectorRuns(T *keys, size_t n) {
+  using S = SimdKeys<T>;
+  constexpr size_t kRun = 2 * S::kLanes;
+  size_t first = 0;
+  for (; first + kRun <= n; first += kRun) {
+    auto low = SortVector<S>(S::Load(keys + first));
+    auto high = SortVector<S>(S::Load(keys + first + S::kLanes));
+    MergeVectors<S>(low, high);
+    S::Store(keys + first, low);
+    S::Store(keys + first + S::kLanes, high);
+  }
+  return first;
+}
+
+#endif
+
+// merges the sorted runs a and b into out, by MergeRunsSimd if simd (UseSimd) and both runs fill a vector
+template <typename T>
+void MergeRuns(const T *a, size_t na, const T *b, size_t nb, T *out, bool simd) {
+  if constexpr (SimdKeys<T>::kEnabled) {
+    if (simd && na >= SimdKeys<T>::kLanes && nb >= SimdKeys<T>::kLanes) {
+      MergeRunsSimd(a, na, b, nb, out);
+      return;
+    }
+  }
+  std::merge(a, a + na, b, b + nb, out);
+}
+
+// comparator of the network on the sorted blocks lower and upper: keys of lower below upper.front() and keys of
+// upper above lower.back() stay, the others are merged into scratch and copied back
+template <typename T>
+void MergeSplit(std::span<T> lower, std::span<T> upper, T *scratch, bool simd) {
+  if (lower.empty() || upper.empty() || !(upper.front() < lower.back())) {
+    return;
+  }
+  const auto low_first = std::upper_bound(lower.begin(), lower.end(), upper.front());
+  const auto high_last = std::lower_bound(upper.begin(), upper.end(), lower.back());
+  const auto low_count = static_cast<size_t>(lower.end() - low_first);
+  const auto high_count = static_cast<size_t>(high_last - upper.begin());
+  MergeRuns(&*low_first, low_count, upper.data(), high_count, scratch, simd);
+  std::copy_n(scratch, low_count, low_first);
+  std::copy_n(scratch + low_count, high_count, upper.begin());
+}
+
+// comparators (lower block, upper block) of the stages of Batcher's merge-exchange network on num_blocks blocks,
+// each stage compares distinct blocks
+inline std::vector<std::vector<std::pair<size_t, size_t>>> MergeExchangeStages(size_t num_blocks) {
+  std::vector<std::vector<std::pair<size_t, size_t>>> stages;
+  if (num_blocks < 2) {
+    return stages;
+  }
+  // 2^(t - 1) for t = ceil(lg num_blocks)
+  const size_t top = std::bit_floor(num_blocks - 1);
+  for (size_t p = top; p > 0; p >>= 1) {
+    size_t q = top;
+    size_t r = 0;
+    size_t d = p;
+    while (true) {
+      std::vector<std::pair<size_t, size_t>> stage;
+      for (size_t i = 0; i + d < num_blocks; i++) {
+        if ((i & p) == r) {
+          stage.emplace_back(i, i + d);
+        }
+      }
+      if (!stage.empty()) {
+        stages.push_back(std::move(stage));
+      }
+      if (q == p) {
+        break;
+      }
+      d = q - p;
+      q >>= 1;
+      r = p;
+    }
+  }
+  return stages;
+}
+
+// BatcherSort with sort_block(block, scratch) which may use scratch[0, block.size())
+template <typename T, typename SortBlock, typename ParallelFor>
+void BatcherSortBlocks(std::span<T> keys, size_t num_blocks, const SortBlock &sort_block,
+                       const ParallelFor &parallel_for) {
+  const size_t n = keys.size();
+  if (n < 2) {
+    return;
+  }
+  const size_t wanted = std::clamp<size_t>(num_blocks, 1, std::max<size_t>(n / kMinBatcherBlockKeys, 1));
+  const size_t block_size = (n + wanted - 1) / wanted;
+  const size_t blocks = (n + block_size - 1) / block_size;
+  const auto block = [&](size_t b) { return keys.subspan(b * block_size, std::min(block_size, n - (b * block_size))); };
+
+  // block b sorts in scratch[b * block_size, ...), comparator c of a stage merges in scratch[2 * c * block_size, ...)
+  ppc::util::AlignedVector<T> scratch(blocks * block_size);
+  const bool simd = UseSimd<T>();
+  parallel_for(0, blocks, [&](size_t begin, size_t end) {
+    for (size_t b = begin; b < end; b++) {
+      sort_block(block(b), scratch.data() + (b * block_size));
+    }
+  });
+  for (const auto &stage : MergeExchangeStages(blocks)) {
+    parallel_for(0, stage.size(), [&](size_t begin, size_t end) {
+      for (size_t c = begin; c < end; c++) {
+        MergeSplit(block(stage[c].first), block(stage[c].second), scratch.data() + (2 * c * block_size), simd);
+      }
+    });
+  }
+}
+
+}  // namespace detail
+
+template <typename T, typename SortBlock, typename ParallelFor>
+void BatcherSort(std::span<T> keys, size_t num_blocks, const SortBlock &sort_block, const ParallelFor &parallel_for) {
+  detail::BatcherSortBlocks(
+      keys, num_blocks, [&](std::span<T> block, T *) { sort_block(block); }, parallel_for);
+}
+
+template <typename T, typename ParallelFor>
+void BatcherSort(std::span<T> keys, size_t num_blocks, const ParallelFor &parallel_for) {
+  detail::BatcherSortBlocks(
+      keys, num_blocks,
+      [](std::span<T> block, T *scratch) { BitonicMergeSort(block, std::span<T>(scratch, block.size())); },
+      parallel_for);
+}
+
+template <typename T>
+void BitonicMergeSort(std::span<T> keys, std::span<T> buffer) {
+  if (buffer.size() < keys.size()) {
+    throw std::invalid_argument("BitonicMergeSort needs a buffer of at least the size of keys");
+  }
+  if constexpr (!detail::SimdKeys<T>::kEnabled) {
+    std::ranges::sort(keys);
+  } else {
+    if (!detail::UseSimd<T>()) {
+      std::ranges::sort(keys);
+      return;
+    }
+    constexpr size_t kRun = 2 * detail::SimdKeys<T>::kLanes;
+    const size_t n = keys.size();
+    const size_t first = detail::SortVectorRuns(keys.data(), n);
+    std::sort(keys.begin() + static_cast<std::ptrdiff_t>(first), keys.end());
+
+    T *src = keys.data();
+    T *dst = buffer.data();
+    for (size_t width = kRun; width < n; width *= 2) {
+      for (size_t begin = 0; begin < n; begin += 2 * width) {
+        const size_t mid = std::min(begin + width, n);
+        const size_t end = std::min(begin + (2 * width), n);
+        detail::MergeRuns(src + begin, mid - begin, src + mid, end - mid, dst + begin, true);
+      }
+      std::swap(src, dst);
+    }
+    if (src != keys.data()) {
+      std::copy_n(src, n, keys.data());
+    }
+  }
+}
+
+}  // namespace ppc::core::sort
@@ -0,0 +1,290 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace ppc::core::sort {
+
+// Merges the sorted runs a and b into out, keys of a first among equal keys (T is deduced from out). The output is
+// cut into num_chunks slices of equal size and every chunk finds where its slice starts and ends in a and b by a
+// binary search along the cross diagonal of the merge path, so each chunk merges the same number of keys whatever the
+// keys are. parallel_for as in RadixSort.
+// Throws std::invalid_argument if out is smaller than a and b together.
+template <typename T, typename ParallelFor, typename Compare = std::less<>>
+void ParallelMerge(std::span<const std::type_identity_t<T>> a, std::span<const std::type_identity_t<T>> b,
+                   std::span<T> out, size_t num_chunks, const ParallelFor &parallel_for, Compare comp = {});
+
+// Merges the sorted runs keys[bounds[i], bounds[i + 1]) into sorted keys by rounds of pairwise merges which go back
+// and forth between keys and buffer (of the same size). A round is one parallel_for in which every chunk merges an
+// equal slice of the output of all pairs as in ParallelMerge, so the last merge of two halves keeps all chunks busy
+// too. Stable. parallel_for as in RadixSort.
+// Throws std::invalid_argument if buffer is smaller than keys or bounds do not span keys.
+template <typename T, typename ParallelFor, typename Compare = std::less<>>
+void MergeRuns(std::span<T> keys, std::span<const size_t> bounds, std::span<T> buffer, size_t num_chunks,
+               const ParallelFor &parallel_for, Compare comp = {});
+
+// Merges the sorted runs into out in one pass: the output is cut into num_chunks slices of equal size, the keys of
+// every run before a slice are found by a multiway selection and every chunk merges its part of all runs by
+// LoserTreeMerge. Stable, runs in their order. parallel_for as in RadixSort.
+// Keys are read and written once instead of log2(runs) times as in MergeRuns, which pays off when the merge is bound
+// by memory bandwidth; the matches of a key depend on each other, so on few cores MergeRuns is faster.
+// Throws std::invalid_argument if out is smaller than the runs together.
+template <typename T, typename ParallelFor, typename Compare = std::less<>>
+void KWayMerge(std::span<const std::span<const std::type_identity_t<T>>> runs, std::span<T> out, size_t num_chunks,
+               const ParallelFor &parallel_for, Compare comp = {});
+
+// Merges the sorted runs into out in the calling thread by a tree of losers: the root holds the run with the smallest
+// head and every inner node the loser of the match played there, so the next head of the winning run replays only
+// its path to the root, log2(runs) comparisons per key. Stable, runs in their order.
+template <typename T, typename Compare = std::less<>>
+void LoserTreeMerge(std::span<const std::span<const std::type_identity_t<T>>> runs, T *out, Compare comp = {});
+
+namespace detail {
+
+// keys of a among the first diagonal keys of the stable merge of a and b
+template <typename T, typename Compare>
+size_t MergePathSplit(const T *a, size_t na, const T *b, size_t nb, size_t diagonal, const Compare &comp) {
+  size_t lo = diagonal > nb ? diagonal - nb : 0;
+  size_t hi = std::min(diagonal, na);
+  while (lo < hi) {
+    const size_t mid = lo + ((hi - lo) / 2);
+    if (comp(b[diagonal - mid - 1], a[mid])) {
+      hi = mid;
+    } else {
+      lo = mid + 1;
+    }
+  }
+  return lo;
+}
+
+// merges the output keys [first, last) of the stable merge of a and b into out + first
+template <typename T, typename Compare>
+void MergeSlice(const T *a, size_t na, const T *b, size_t nb, size_t first, size_t last, T *out, const Compare &comp) {
+  const size_t a_first = MergePathSplit(a, na, b, nb, first, comp);
+  const size_t a_last = MergePathSplit(a, na, b, nb, last, comp);
+  std::merge(a + a_first, a + a_last, b + (first - a_first), b + (last - a_last), out + first, comp);
+}
+
+// one round of MergeRuns: run pairs (2p, 2p + 1) of src, a last run without a partner is copied
+template <typename T, typename ParallelFor, typename Compare>
+void MergeRound(const T *src, T *dst, const std::vector<size_t> &bounds, size_t parts, const ParallelFor &parallel_for,
+                const Compare &comp) {
+  const size_t n = bounds.back();
+  const size_t runs = bounds.size() - 1;
+  parallel_for(0, parts, [&](size_t begin, size_t end) {
+    for (size_t c = begin; c < end; c++) {
+      const size_t slice_first = n * c / parts;
+      const size_t slice_last = n * (c + 1) / parts;
+      // the first pair which ends after slice_first
+      const auto after = std::upper_bound(bounds.begin(), bounds.end(), slice_first);
+      size_t pair = (static_cast<size_t>(after - bounds.begin()) - 1) / 2;
+      for (; 2 * pair < runs && bounds[2 * pair] < slice_last; pair++) {
+        const size_t first = bounds[2 * pair];
+        const size_t middle = bounds[std::min(2 * pair + 1, runs)];
+        const size_t last = bounds[std::min(2 * pair + 2, runs)];
+        const size_t from = std::max(slice_first, first) - first;
+        const size_t to = std::min(slice_last, last) - first;
+        MergeSlice(src + first, middle - first, src + middle, last - middle, from, to, dst + first, comp);
+      }
+    }
+  });
+}
+
+// first key of every run among the first rank keys of the stable merge of runs (the merge order is by key, then by
+// run), found by a binary search in every run for the key of this rank
+template <typename T, typename Compare>
+std::vector<size_t> MultiwaySplit(std::span<const std::span<const T>> runs, size_t rank, const Compare &comp) {
+  const size_t k = runs.size();
+  std::vector<size_t> splits(k);
+  // keys of run i before the key x of run j in the merge
+  const auto before = [&](size_t i, size_t j, const T &x) {
+    const auto &run = runs[i];
+    const auto it = i < j ? std::upper_bound(run.begin(), run.end(), x, comp)
+                          : std::lower_bound(run.begin(), run.end(), x, comp);
+    return static_cast<size_t>(it - run.begin());
+  };
+  const auto rank_of = [&](size_t j, size_t q) {
+    size_t r = q;
+    for (size_t i = 0; i < k; i++) {
+      if (i != j) {
+        r += before(i, j, runs[j][q]);
+      }
+    }
+    return r;
+  };
+  for (size_t j = 0; j < k; j++) {
+    size_t lo = 0;
+    size_t hi = std::min(runs[j].size(), rank + 1);
+    while (lo < hi) {
+      const size_t mid = lo + ((hi - lo) / 2);
+      if (rank_of(j, mid) < rank) {
+        lo = mid + 1;
+      } else {
+        hi = mid;
+      }
+    }
+    if (lo < runs[j].size() && rank_of(j, lo) == rank) {
+      for (size_t i = 0; i < k; i++) {
+        splits[i] = i == j ? lo : before(i, j, runs[j][lo]);
+      }
+      return splits;
+    }
+  }
+  // rank is the size of the merge
+  for (size_t i = 0; i < k; i++) {
+    splits[i] = runs[i].size();
+  }
+  return splits;
+}
+
+// a run of LoserTreeMerge with a copy of its next key, so matches do not read through the heads of the runs
+template <typename T>
+struct LoserTreePlayer {
+  T key;
+  size_t run;
+};
+
+}  // namespace detail
+
+template <typename T, typename ParallelFor, typename Compare>
+void ParallelMerge(std::span<const std::type_identity_t<T>> a, std::span<const std::type_identity_t<T>> b,
+                   std::span<T> out, size_t num_chunks, const ParallelFor &parallel_for, Compare comp) {
+  const size_t n = a.size() + b.size();
+  if (out.size() < n) {
+    throw std::invalid_argument("ParallelMerge needs an output of at least the size of both runs");
+  }
+  const size_t parts = std::clamp<size_t>(num_chunks, 1, std::max<size_t>(n, 1));
+  parallel_for(0, parts, [&](size_t begin, size_t end) {
+    for (size_t c = begin; c < end; c++) {
+      detail::MergeSlice(a.data(), a.size(), b.data(), b.size(), n * c / parts, n * (c + 1) / parts, out.data(),
+                         comp);
+    }
+  });
+}
+
+template <typename T, typename ParallelFor, typename Compare>
+void MergeRuns(std::span<T> keys, std::span<const size_t> bounds, std::span<T> buffer, size_t num_chunks,
+               const ParallelFor &parallel_for, Compare comp) {
+  const size_t n = keys.size();
+  if (buffer.size() < n) {
+    throw std::invalid_argument("MergeRuns needs a buffer of at least the size of keys");
+  }
+  if (bounds.empty() || bounds.front() != 0 || bounds.back() != n) {
+    throw std::invalid_argument("MergeRuns needs run bounds from 0 to the size of keys");
+  }
+  const size_t parts = std::clamp<size_t>(num_chunks, 1, std::max<size_t>(n, 1));
+  std::vector<size_t> runs(bounds.begin(), bounds.end());
+  T *src = keys.data();
+  T *dst = buffer.data();
+  while (runs.size() > 2) {
+    detail::MergeRound(src, dst, runs, parts, parallel_for, comp);
+    std::vector<size_t> merged;
+    for (size_t i = 0; i < runs.size(); i += 2) {
+      merged.push_back(runs[i]);
+    }
+    if (merged.back() != n) {
+      merged.push_back(n);
+    }
+    runs = std::move(merged);
+    std::swap(src, dst);
+  }
+  if (src != keys.data()) {
+    parallel_for(0, parts, [&](size_t begin, size_t end) {
+      for (size_t c = begin; c < end; c++) {
+        std::copy(src + (n * c / parts), src + (n * (c + 1) / parts), keys.data() + (n * c / parts));
+      }
+    });
+  }
+}
+
+template <typename T, typename ParallelFor, typename Compare>
+void KWayMerge(std::span<const std::span<const std::type_identity_t<T>>> runs, std::span<T> out, size_t num_chunks,
+               const ParallelFor &parallel_for, Compare comp) {
+  size_t n = 0;
+  for (const auto &run : runs) {
+    n += run.size();
+  }
+  if (out.size() < n) {
+    throw std::invalid_argument("KWayMerge needs an output of at least the size of all runs");
+  }
+  const size_t parts = std::clamp<size_t>(num_chunks, 1, std::max<size_t>(n, 1));
+  // splits[c]: the keys of every run before the slice of chunk c
+  std::vector<std::vector<size_t>> splits(parts + 1);
+  parallel_for(0, parts + 1, [&](size_t begin, size_t end) {
+    for (size_t c = begin; c < end; c++) {
+      splits[c] = detail::MultiwaySplit(runs, n * c / parts, comp);
+    }
+  });
+  parallel_for(0, parts, [&](size_t begin, size_t end) {
+    std::vector<std::span<const T>> slices(runs.size());
+    for (size_t c = begin; c < end; c++) {
+      for (size_t i = 0; i < runs.size(); i++) {
+        slices[i] = runs[i].subspan(splits[c][i], splits[c + 1][i] - splits[c][i]);
+      }
+      LoserTreeMerge(std::span<const std::span<const T>>(slices), out.data() + (n * c / parts), comp);
+    }
+  });
+}
+
+template <typename T, typename Compare>
+void LoserTreeMerge(std::span<const std::span<const std::type_identity_t<T>>> runs, T *out, Compare comp) {
+  // heads and tails of the runs with keys left, in the order of runs
+  std::vector<const T *> heads;
+  std::vector<const T *> tails;
+  for (const auto &run : runs) {
+    if (!run.empty()) {
+      heads.push_back(run.data());
+      tails.push_back(run.data() + run.size());
+    }
+  }
+  using Player = detail::LoserTreePlayer<T>;
+  // the key of a goes before the one of b, evaluated without branches
+  const auto beats = [&](const Player &a, const Player &b) {
+    return static_cast<bool>(static_cast<int>(comp(a.key, b.key)) |
+                             (static_cast<int>(!comp(b.key, a.key)) & static_cast<int>(a.run < b.run)));
+  };
+  std::vector<Player> losers;
+  std::vector<Player> winners;
+  // the tree is built again without a run once it is exhausted, so matches never check for the end of a run
+  while (heads.size() > 1) {
+    // leaves k + i, inner nodes [1, k) with the children 2 * node and 2 * node + 1
+    const size_t k = heads.size();
+    losers.assign(k, Player{});
+    winners.assign(2 * k, Player{});
+    for (size_t i = 0; i < k; i++) {
+      winners[k + i] = {.key = *heads[i], .run = i};
+    }
+    for (size_t node = k - 1; node > 0; node--) {
+      const bool left_wins = beats(winners[2 * node], winners[(2 * node) + 1]);
+      winners[node] = winners[(2 * node) + static_cast<size_t>(!left_wins)];
+      losers[node] = winners[(2 * node) + static_cast<size_t>(left_wins)];
+    }
+    Player winner = winners[1];
+    while (true) {
+      *out++ = winner.key;
+      if (++heads[winner.run] == tails[winner.run]) {
+        break;
+      }
+      winner.key = *heads[winner.run];
+      for (size_t node = (k + winner.run) / 2; node > 0; node /= 2) {
+        // selects instead of a branch, the outcome of a match is unpredictable
+        const Player loser = losers[node];
+        const bool swap = beats(loser, winner);
+        losers[node] = swap ? winner : loser;
+        winner = swap ? loser : winner;
+      }
+    }
+    heads.erase(heads.begin() + static_cast<std::ptrdiff_t>(winner.run));
+    tails.erase(tails.begin() + static_cast<std::ptrdiff_t>(winner.run));
+  }
+  if (!heads.empty()) {
+    std::copy(heads[0], tails[0], out);
+  }
+}
+
+}  // namespace ppc::core::sort
@@ -0,0 +1,263 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace ppc::core::sort {
+
+// Sorts doubles in ascending order in place by MSD radix levels over the bytes of their IEEE bit patterns, the sign and
+// exponent first: -0.0 comes before 0.0 and NaNs go to the ends by their sign bit. A level counts the digits of a range
+// and moves its keys into their buckets by cycles of swaps (American flag sort), then the buckets are sorted by the
+// next byte. Levels in which all keys of a range have one digit are skipped and buckets of at most
+// detail::kInsertionSortKeys keys are sorted by insertion.
+// Ranges of more than max(n / num_chunks, 2^16) keys are split by all chunks together: every bucket is cut into one
+// stripe per chunk, each chunk permutes keys among its own stripes in parallel, and the few keys left out of place are
+// moved afterwards (PARADIS). Smaller buckets are sorted by parallel_for, one bucket per iteration and
+// largest first, so a dynamic schedule balances skewed buckets. parallel_for as in RadixSort.
+template <typename ParallelFor>
+void MsdRadixSort(std::span<double> keys, size_t num_chunks, const ParallelFor &parallel_for);
+
+// MsdRadixSort in the calling thread
+inline void MsdRadixSort(std::span<double> keys);
+
+namespace detail {
+
+constexpr size_t kMsdDigitBits = 8;
+constexpr size_t kMsdBuckets = size_t{1} << kMsdDigitBits;
+constexpr size_t kMsdTopShift = 64 - kMsdDigitBits;
+// buckets of at most this many keys are sorted by insertion
+constexpr size_t kInsertionSortKeys = 32;
+// smaller ranges are not split by several chunks
+constexpr size_t kMinParallelSplitKeys = size_t{1} << 16;
+
+using MsdCounts = std::array<size_t, kMsdBuckets>;
+
+// unsigned order of the result is the order of the doubles
+inline uint64_t MsdKey(double x) {
+  const auto bits = std::bit_cast<uint64_t>(x);
+  return (bits >> 63) != 0 ? ~bits : bits | (uint64_t{1} << 63);
+}
+
+inline size_t MsdDigit(double x, size_t shift) {
+  return static_cast<size_t>(MsdKey(x) >> shift) & (kMsdBuckets - 1);
+}
+
+inline void InsertionSortByKey(double *keys, size_t n) {
+  for (size_t i = 1; i < n; i++) {
+    const double x = keys[i];
+    const uint64_t key = MsdKey(x);
+    size_t j = i;
+    for (; j > 0 && MsdKey(keys[j - 1]) > key; j--) {
+      keys[j] = keys[j - 1];
+    }
+    keys[j] = x;
+  }
+}
+
+inline void CountMsdDigits(const double *keys, size_t n, size_t shift, MsdCounts &counts) {
+  for (size_t i = 0; i < n; i++) {
+    counts[MsdDigit(keys[i], shift)]++;
+  }
+}
+
+// moves the keys of the segments [heads[d], tails[d]) into the segments of their digits by cycles of swaps,
+// the segment of every digit has room for exactly the keys with this digit
+inline void AmericanFlagPermute(double *keys, size_t shift, MsdCounts &heads, const MsdCounts &tails) {
+  for (size_t d = 0; d < kMsdBuckets; d++) {
+    while (heads[d] < tails[d]) {
+      double x = keys[heads[d]];
+      size_t digit = MsdDigit(x, shift);
+      while (digit != d) {
+        std::swap(x, keys[heads[digit]++]);
+        digit = MsdDigit(x, shift);
+      }
+      keys[heads[d]++] = x;
+    }
+  }
+}
+
+// AmericanFlagPermute of a chunk among its own stripes [heads[d], tails[d]): a key whose stripe is full stays
+// behind at the end of the stripe it came from, which shrinks, so every stripe ends as [placed keys, keys left)
+inline void StripePermute(double *keys, size_t shift, MsdCounts &heads, MsdCounts &tails) {
+  for (size_t d = 0; d < kMsdBuckets; d++) {
+    while (heads[d] < tails[d]) {
+      double x = keys[heads[d]];
+      size_t digit = MsdDigit(x, shift);
+      while (digit != d && heads[digit] < tails[digit]) {
+        std::swap(x, keys[heads[digit]++]);
+        digit = MsdDigit(x, shift);
+      }
+      if (digit == d) {
+        keys[heads[d]++] = x;
+      } else {
+        tails[d]--;
+        keys[heads[d]] = keys[tails[d]];
+        keys[tails[d]] = x;
+      }
+    }
+  }
+}
+
+// first index of every bucket for the counts of its keys
+inline MsdCounts BucketStarts(const MsdCounts &counts) {
+  MsdCounts starts{};
+  size_t start = 0;
+  for (size_t d = 0; d < kMsdBuckets; d++) {
+    starts[d] = start;
+    start += counts[d];
+  }
+  return starts;
+}
+
+inline void MsdSortSequential(double *keys, size_t n, size_t shift) {
+  while (n > kInsertionSortKeys) {
+    MsdCounts counts{};
+    CountMsdDigits(keys, n, shift, counts);
+    if (counts[MsdDigit(keys[0], shift)] == n) {
+      if (shift == 0) {
+        return;
+      }
+      shift -= kMsdDigitBits;
+      continue;
+    }
+    const MsdCounts starts = BucketStarts(counts);
+    MsdCounts heads = starts;
+    MsdCounts tails{};
+    for (size_t d = 0; d < kMsdBuckets; d++) {
+      tails[d] = starts[d] + counts[d];
+    }
+    AmericanFlagPermute(keys, shift, heads, tails);
+    if (shift == 0) {
+      return;
+    }
+    for (size_t d = 0; d < kMsdBuckets; d++) {
+      if (counts[d] > 1) {
+        MsdSortSequential(keys + starts[d], counts[d], shift - kMsdDigitBits);
+      }
+    }
+    return;
+  }
+  InsertionSortByKey(keys, n);
+}
+
+// one level of keys[0, n) by the digit at shift in parts stripes per bucket, see MsdRadixSort. false if all keys
+// have one digit, then keys are not moved.
+template <typename ParallelFor>
+bool ParallelMsdSplit(double *keys, size_t n, size_t shift, size_t parts, const ParallelFor &parallel_for,
+                      MsdCounts &counts) {
+  const auto part_begin = [&](size_t count, size_t p) { return count * p / parts; };
+  std::vector<MsdCounts> part_counts(parts);
+  parallel_for(0, parts, [&](size_t begin, size_t end) {
+    for (size_t p = begin; p < end; p++) {
+      const size_t first = part_begin(n, p);
+      CountMsdDigits(keys + first, part_begin(n, p + 1) - first, shift, part_counts[p]);
+    }
+  });
+  counts = MsdCounts{};
+  for (const auto &part : part_counts) {
+    for (size_t d = 0; d < kMsdBuckets; d++) {
+      counts[d] += part[d];
+    }
+  }
+  if (counts[MsdDigit(keys[0], shift)] == n) {
+    return false;
+  }
+  const MsdCounts starts = BucketStarts(counts);
+
+  // heads[p][d] and tails[p][d] bound the stripe of chunk p in bucket d
+  std::vector<MsdCounts> heads(parts);
+  std::vector<MsdCounts> tails(parts);
+  parallel_for(0, parts, [&](size_t begin, size_t end) {
+    for (size_t p = begin; p < end; p++) {
+      for (size_t d = 0; d < kMsdBuckets; d++) {
+        heads[p][d] = starts[d] + part_begin(counts[d], p);
+        tails[p][d] = starts[d] + part_begin(counts[d], p + 1);
+      }
+      StripePermute(keys, shift, heads[p], tails[p]);
+    }
+  });
+
+  // placed keys of every bucket move to its front, the keys left behind gather at its back
+  MsdCounts left_heads{};
+  parallel_for(0, kMsdBuckets, [&](size_t begin, size_t end) {
+    for (size_t d = begin; d < end; d++) {
+      size_t placed_end = starts[d];
+      for (size_t p = 0; p < parts; p++) {
+        for (size_t i = starts[d] + part_begin(counts[d], p); i < heads[p][d]; i++) {
+          std::swap(keys[placed_end++], keys[i]);
+        }
+      }
+      left_heads[d] = placed_end;
+    }
+  });
+  MsdCounts ends{};
+  for (size_t d = 0; d < kMsdBuckets; d++) {
+    ends[d] = starts[d] + counts[d];
+  }
+  AmericanFlagPermute(keys, shift, left_heads, ends);
+  return true;
+}
+
+// keys of a range which are sorted from the digit at shift on
+struct MsdRange {
+  double *keys;
+  size_t size;
+  size_t shift;
+};
+
+}  // namespace detail
+
+template <typename ParallelFor>
+void MsdRadixSort(std::span<double> keys, size_t num_chunks, const ParallelFor &parallel_for) {
+  using detail::MsdRange;
+  const size_t parts = std::max<size_t>(num_chunks, 1);
+  const size_t grain = std::max(detail::kMinParallelSplitKeys, keys.size() / parts);
+  std::vector<MsdRange> pending{{.keys = keys.data(), .size = keys.size(), .shift = detail::kMsdTopShift}};
+  std::vector<MsdRange> buckets;
+  while (!pending.empty()) {
+    const MsdRange range = pending.back();
+    pending.pop_back();
+    if (range.size <= grain || parts == 1) {
+      buckets.push_back(range);
+      continue;
+    }
+    detail::MsdCounts counts{};
+    if (!detail::ParallelMsdSplit(range.keys, range.size, range.shift, parts, parallel_for, counts)) {
+      if (range.shift != 0) {
+        pending.push_back({.keys = range.keys, .size = range.size, .shift = range.shift - detail::kMsdDigitBits});
+      }
+      continue;
+    }
+    if (range.shift == 0) {
+      continue;
+    }
+    size_t start = 0;
+    for (const size_t count : counts) {
+      if (count > 1) {
+        pending.push_back(
+            {.keys = range.keys + start, .size = count, .shift = range.shift - detail::kMsdDigitBits});
+      }
+      start += count;
+    }
+  }
+
+  std::ranges::sort(buckets, std::greater{}, &MsdRange::size);
+  parallel_for(0, buckets.size(), [&](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; i++) {
+      detail::MsdSortSequential(buckets[i].keys, buckets[i].size, buckets[i].shift);
+    }
+  });
+}
+
+inline void MsdRadixSort(std::span<double> keys) {
+  detail::MsdSortSequential(keys.data(), keys.size(), detail::kMsdTopShift);
+}
+
+}  // namespace ppc::core::sort
@@ -0,0 +1,259 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <functional>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace ppc::core::sort {
+
+// Sorts keys by comp in place with introsort: Hoare partitions around the ninther of nine keys spread over the range
+// (median of three for small ranges), the smaller side first so the stack stays O(log n), heapsort once a range is
+// 2 * log2(n) partitions deep and insertion sort for ranges of at most detail::kQuickInsertionKeys keys. Both scans of
+// a partition stop at keys equal to the pivot, so runs of equal keys are split in halves instead of going quadratic.
+// Not stable.
+template <typename T, typename Compare = std::less<>>
+void QuickSort(std::span<T> keys, Compare comp = {});
+
+// QuickSort over parallel_for: ranges of more than max(n / num_chunks, detail::kMinParallelPartitionKeys) keys are
+// partitioned by all chunks together, each chunk partitions its own stripe around a common pivot and the keys left
+// on the wrong side of the global boundary are swapped back in parallel, so no level is split by one thread. The
+// smaller ranges are sorted by parallel_for, one range per iteration and largest first, so a dynamic schedule balances
+// uneven splits. parallel_for as in RadixSort.
+template <typename T, typename ParallelFor, typename Compare = std::less<>>
+void QuickSort(std::span<T> keys, size_t num_chunks, const ParallelFor &parallel_for, Compare comp = {});
+
+namespace detail {
+
+// ranges of at most this many keys are sorted by insertion
+constexpr size_t kQuickInsertionKeys = 24;
+// larger ranges take the ninther as their pivot
+constexpr size_t kNintherKeys = 128;
+// smaller ranges are not partitioned by several chunks
+constexpr size_t kMinParallelPartitionKeys = size_t{1} << 15;
+
+inline size_t QuickSortDepthLimit(size_t n) {
+  return 2 * static_cast<size_t>(std::bit_width(n));
+}
+
+template <typename T, typename Compare>
+void InsertionSort(T *first, T *last, const Compare &comp) {
+  if (first == last) {
+    return;
+  }
+  for (T *i = first + 1; i < last; i++) {
+    T x = std::move(*i);
+    T *j = i;
+    for (; j > first && comp(x, *(j - 1)); j--) {
+      *j = std::move(*(j - 1));
+    }
+    *j = std::move(x);
+  }
+}
+
+// orders *a, *b, *c so that the median is in *b
+template <typename T, typename Compare>
+void Sort3(T *a, T *b, T *c, const Compare &comp) {
+  if (comp(*b, *a)) {
+    std::swap(*a, *b);
+  }
+  if (comp(*c, *b)) {
+    std::swap(*b, *c);
+    if (comp(*b, *a)) {
+      std::swap(*a, *b);
+    }
+  }
+}
+
+// moves the pivot of [first, last), at least 3 keys, to *first
+template <typename T, typename Compare>
+void MovePivotToFront(T *first, T *last, const Compare &comp) {
+  const auto n = static_cast<size_t>(last - first);
+  T *mid = first + (n / 2);
+  if (n > kNintherKeys) {
+    const size_t step = n / 8;
+    Sort3(first, first + step, first + (2 * step), comp);
+    Sort3(mid - step, mid, mid + step, comp);
+    Sort3(last - 1 - (2 * step), last - 1 - step, last - 1, comp);
+    Sort3(first + step, mid, last - 1 - step, comp);
+  } else {
+    Sort3(first, mid, last - 1, comp);
+  }
+  std::swap(*first, *mid);
+}
+
+// Hoare partition of [first, last) around the pivot in *first: returns the final place of the pivot, no key before it
+// is greater and no key after it is less
+template <typename T, typename Compare>
+T *HoarePartition(T *first, T *last, const Compare &comp) {
+  T *i = first;
+  T *j = last;
+  while (true) {
+    while (++i != last && comp(*i, *first)) {
+    }
+    while (comp(*first, *--j)) {
+    }
+    if (i >= j) {
+      break;
+    }
+    std::swap(*i, *j);
+  }
+  std::swap(*first, *j);
+  return j;
+}
+
+template <typename T, typename Compare>
+void IntroSort(T *first, T *last, size_t depth_limit, const Compare &comp) {
+  while (static_cast<size_t>(last - first) > kQuickInsertionKeys) {
+    if (depth_limit == 0) {
+      std::make_heap(first, last, comp);
+      std::sort_heap(first, last, comp);
+      return;
+    }
+    depth_limit--;
+    MovePivotToFront(first, last, comp);
+    T *cut = HoarePartition(first, last, comp);
+    if (cut - first < last - cut) {
+      IntroSort(first, cut, depth_limit, comp);
+      first = cut + 1;
+    } else {
+      IntroSort(cut + 1, last, depth_limit, comp);
+      last = cut;
+    }
+  }
+  InsertionSort(first, last, comp);
+}
+
+// [begin, end) offsets of keys on the wrong side of a parallel partition
+using Stretch = std::pair<size_t, size_t>;
+
+// swaps the keys [k_begin, k_end) of the high stretches, in order, with the ones of the low stretches
+template <typename T>
+void SwapStretches(T *keys, const std::vector<Stretch> &high, const std::vector<Stretch> &low,
+                   const std::vector<size_t> &high_starts, const std::vector<size_t> &low_starts, size_t k_begin,
+                   size_t k_end) {
+  if (k_begin == k_end) {
+    return;
+  }
+  // stretch index and offset of the k-th key
+  const auto locate = [k_begin](const std::vector<Stretch> &stretches, const std::vector<size_t> &starts) {
+    const auto s = static_cast<size_t>(std::upper_bound(starts.begin(), starts.end(), k_begin) - starts.begin() - 1);
+    return std::pair{s, stretches[s].first + (k_begin - starts[s])};
+  };
+  auto [h, i] = locate(high, high_starts);
+  auto [l, j] = locate(low, low_starts);
+  for (size_t k = k_begin; k < k_end; k++) {
+    if (i == high[h].second) {
+      i = high[++h].first;
+    }
+    if (j == low[l].second) {
+      j = low[++l].first;
+    }
+    std::swap(keys[i++], keys[j++]);
+  }
+}
+
+// partitions keys[0, n) by parts chunks around the pivot of MovePivotToFront: returns the boundary, no key before it
+// is greater than the pivot and no key from it on is less. Even chunks keep keys equal to the pivot on the right and
+// odd ones on the left, so equal keys are split in halves.
+template <typename T, typename ParallelFor, typename Compare>
+size_t ParallelPartition(T *keys, size_t n, size_t parts, const ParallelFor &parallel_for, const Compare &comp) {
+  MovePivotToFront(keys, keys + n, comp);
+  const T pivot = keys[0];
+  const auto part_begin = [&](size_t p) { return n * p / parts; };
+  std::vector<size_t> middles(parts);
+  parallel_for(0, parts, [&](size_t begin, size_t end) {
+    for (size_t p = begin; p < end; p++) {
+      T *first = keys + part_begin(p);
+      T *last = keys + part_begin(p + 1);
+      T *middle = p % 2 == 0 ? std::partition(first, last, [&](const T &x) { return comp(x, pivot); })
+                             : std::partition(first, last, [&](const T &x) { return !comp(pivot, x); });
+      middles[p] = static_cast<size_t>(middle - keys);
+    }
+  });
+  size_t boundary = 0;
+  for (size_t p = 0; p < parts; p++) {
+    boundary += middles[p] - part_begin(p);
+  }
+
+  // high keys before the boundary and low keys after it, the two have equal counts
+  std::vector<Stretch> high;
+  std::vector<Stretch> low;
+  std::vector<size_t> high_starts{0};
+  std::vector<size_t> low_starts{0};
+  for (size_t p = 0; p < parts; p++) {
+    const size_t high_end = std::min(part_begin(p + 1), boundary);
+    if (middles[p] < high_end) {
+      high.emplace_back(middles[p], high_end);
+      high_starts.push_back(high_starts.back() + high_end - middles[p]);
+    }
+    const size_t low_begin = std::max(part_begin(p), boundary);
+    if (low_begin < middles[p]) {
+      low.emplace_back(low_begin, middles[p]);
+      low_starts.push_back(low_starts.back() + middles[p] - low_begin);
+    }
+  }
+  const size_t misplaced = high_starts.back();
+  if (misplaced != 0) {
+    parallel_for(0, parts, [&](size_t begin, size_t end) {
+      for (size_t p = begin; p < end; p++) {
+        SwapStretches(keys, high, low, high_starts, low_starts, misplaced * p / parts, misplaced * (p + 1) / parts);
+      }
+    });
+  }
+  return boundary;
+}
+
+// keys of a range with the partitions left before heapsort
+template <typename T>
+struct QuickRange {
+  T *keys;
+  size_t size;
+  size_t depth_limit;
+};
+
+}  // namespace detail
+
+template <typename T, typename Compare>
+void QuickSort(std::span<T> keys, Compare comp) {
+  detail::IntroSort(keys.data(), keys.data() + keys.size(), detail::QuickSortDepthLimit(keys.size()), comp);
+}
+
+template <typename T, typename ParallelFor, typename Compare>
+void QuickSort(std::span<T> keys, size_t num_chunks, const ParallelFor &parallel_for, Compare comp) {
+  using Range = detail::QuickRange<T>;
+  const size_t parts = std::max<size_t>(num_chunks, 1);
+  const size_t grain = std::max(detail::kMinParallelPartitionKeys, keys.size() / parts);
+  std::vector<Range> pending{
+      {.keys = keys.data(), .size = keys.size(), .depth_limit = detail::QuickSortDepthLimit(keys.size())}};
+  std::vector<Range> leaves;
+  while (!pending.empty()) {
+    const Range range = pending.back();
+    pending.pop_back();
+    if (range.size <= grain || parts == 1 || range.depth_limit == 0) {
+      leaves.push_back(range);
+      continue;
+    }
+    const size_t boundary = detail::ParallelPartition(range.keys, range.size, parts, parallel_for, comp);
+    if (boundary == 0 || boundary == range.size) {
+      // the pivot is an extreme key which only one kind of chunk kept on its side
+      leaves.push_back(range);
+      continue;
+    }
+    pending.push_back({.keys = range.keys, .size = boundary, .depth_limit = range.depth_limit - 1});
+    pending.push_back(
+        {.keys = range.keys + boundary, .size = range.size - boundary, .depth_limit = range.depth_limit - 1});
+  }
+
+  std::ranges::sort(leaves, std::greater{}, &Range::size);
+  parallel_for(0, leaves.size(), [&](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; i++) {
+      detail::IntroSort(leaves[i].keys, leaves[i].keys + leaves[i].size, leaves[i].depth_limit, comp);
+    }
+  });
+}
+
+}  // namespace ppc::core::sort
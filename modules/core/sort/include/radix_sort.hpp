@@ -0,0 +1,237 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include "core/util/include/aligned_allocator.hpp"
+
+namespace ppc::core::sort {
+
+// Bits of the digit of a pass for keys of key_bits bits: one 8-bit pass for bytes, two for 16-bit keys (one
+// 16-bit pass if there are enough keys to pay for its 65536 counters), 11-bit passes for wider keys, whose 2048
+// counters and write-combining lines per chunk stay in L2
+constexpr size_t RadixDigitBits(size_t key_bits, size_t n) {
+  if (key_bits <= 8) {
+    return 8;
+  }
+  if (key_bits <= 16) {
+    return n >= (size_t{1} << 20) ? 16 : 8;
+  }
+  return 11;
+}
+
+// Sorts integer keys in ascending order by LSD radix passes which move keys between keys and buffer (of the same
+// size), ending in keys. Signed keys are ordered by flipping their sign bit in the digits of the top pass.
+// Every pass counts digits by chunks of keys in parallel, turns the counts into offsets of every chunk in every
+// bucket and moves the chunks in parallel, so keys keep their order within a bucket. Passes in which all keys
+// have the same digit are skipped. parallel_for(begin, end, body) calls body(chunk_begin, chunk_end) over
+// [begin, end), possibly concurrently; at most num_chunks chunks are used.
+// Throws std::invalid_argument if buffer is smaller than keys.
+template <typename T, typename ParallelFor>
+void RadixSort(std::span<T> keys, std::span<T> buffer, size_t num_chunks, const ParallelFor &parallel_for);
+
+template <typename T, typename ParallelFor>
+void RadixSort(std::span<T> keys, size_t num_chunks, const ParallelFor &parallel_for);
+
+// RadixSort in the calling thread
+template <typename T>
+void RadixSort(std::span<T> keys);
+
+namespace detail {
+
+// keys below this count are sorted by comparisons, passes over the counters would cost more
+constexpr size_t kMinRadixKeys = 256;
+// bytes of the write-combining line of a bucket
+constexpr size_t kCombineBytes = 64;
+
+template <typename T>
+struct RadixTraits {
+  static_assert(std::is_integral_v<T> && !std::is_same_v<T, bool>, "RadixSort sorts integer keys");
+  using Unsigned = std::make_unsigned_t<T>;
+  static constexpr size_t kBits = std::numeric_limits<Unsigned>::digits;
+  // xor of a key which makes unsigned order of the result the order of keys
+  static constexpr Unsigned kFlip = std::is_signed_v<T> ? Unsigned(Unsigned{1} << (kBits - 1)) : Unsigned{0};
+};
+
+// digit of a pass: bits [shift, shift + bits) of the key with its sign bit flipped
+template <typename U>
+struct Digit {
+  U flip;
+  size_t shift;
+  size_t mask;
+
+  size_t operator()(U key) const { return static_cast<size_t>(static_cast<U>(key ^ flip) >> shift) & mask; }
+};
+
+template <typename U>
+void CountDigits(const U *keys, size_t begin, size_t end, const Digit<U> &digit, size_t *counts) {
+  for (size_t i = begin; i < end; i++) {
+    counts[digit(keys[i])]++;
+  }
+}
+
+// counts of the digits of all passes in one read of keys, those of pass p at counts[p << bits]
+template <typename U>
+void CountAllDigits(const U *keys, size_t n, U flip, size_t bits, size_t passes, size_t *counts) {
+  const size_t mask = (size_t{1} << bits) - 1;
+  for (size_t i = 0; i < n; i++) {
+    const auto key = static_cast<size_t>(static_cast<U>(keys[i] ^ flip));
+    for (size_t pass = 0; pass < passes; pass++) {
+      counts[(pass << bits) + ((key >> (pass * bits)) & mask)]++;
+    }
+  }
+}
+
+// moves src[i] for i in [begin, end) to dst[offsets[digit]++] directly
+template <typename U>
+void ScatterDirect(const U *src, size_t begin, size_t end, U *dst, const Digit<U> &digit, size_t *offsets) {
+  for (size_t i = begin; i < end; i++) {
+    const U key = src[i];
+    dst[offsets[digit(key)]++] = key;
+  }
+}
+
+// ScatterDirect through a line of kCombineBytes per bucket: keys of a bucket gather in its line, which is copied
+// out when it is full, so stores to dst come in whole lines instead of one key at a time into as many streams as
+// there are buckets
+template <typename U>
+void ScatterCombined(const U *src, size_t begin, size_t end, U *dst, const Digit<U> &digit, size_t *offsets,
+                     size_t buckets) {
+  constexpr size_t kLine = kCombineBytes / sizeof(U);
+  thread_local ppc::util::AlignedVector<U> lines;
+  thread_local std::vector<unsigned char> fill;
+  lines.resize(buckets * kLine);
+  fill.assign(buckets, 0);
+  for (size_t i = begin; i < end; i++) {
+    const U key = src[i];
+    const size_t d = digit(key);
+    U *line = lines.data() + (d * kLine);
+    line[fill[d]++] = key;
+    if (fill[d] == kLine) {
+      std::memcpy(dst + offsets[d], line, kCombineBytes);
+      offsets[d] += kLine;
+      fill[d] = 0;
+    }
+  }
+  for (size_t d = 0; d < buckets; d++) {
+    std::memcpy(dst + offsets[d], lines.data() + (d * kLine), fill[d] * sizeof(U));
+    offsets[d] += fill[d];
+  }
+}
+
+// counts of chunk c in bucket d at counts[c * buckets + d] become the offsets of the chunk in the bucket: all
+// keys of smaller buckets and of earlier chunks in the bucket come first. false if all keys have one digit.
+inline bool CountsToOffsets(std::span<size_t> counts, size_t num_chunks, size_t buckets, size_t n) {
+  size_t offset = 0;
+  for (size_t d = 0; d < buckets; d++) {
+    size_t total = 0;
+    for (size_t c = 0; c < num_chunks; c++) {
+      total += counts[(c * buckets) + d];
+    }
+    if (total == n) {
+      return false;
+    }
+    for (size_t c = 0; c < num_chunks; c++) {
+      const size_t count = counts[(c * buckets) + d];
+      counts[(c * buckets) + d] = offset;
+      offset += count;
+    }
+  }
+  return true;
+}
+
+}  // namespace detail
+
+template <typename T, typename ParallelFor>
+void RadixSort(std::span<T> keys, std::span<T> buffer, size_t num_chunks, const ParallelFor &parallel_for) {
+  using Traits = detail::RadixTraits<T>;
+  using U = typename Traits::Unsigned;
+  const size_t n = keys.size();
+  if (buffer.size() < n) {
+    throw std::invalid_argument("RadixSort needs a buffer of at least the size of keys");
+  }
+  if (n < detail::kMinRadixKeys) {
+    std::ranges::sort(keys);
+    return;
+  }
+  const size_t bits = RadixDigitBits(Traits::kBits, n);
+  const size_t buckets = size_t{1} << bits;
+  const size_t passes = (Traits::kBits + bits - 1) / bits;
+  // a chunk moves at least a few keys per counter
+  const size_t chunks = std::clamp<size_t>(n / (4 * buckets), 1, std::max<size_t>(num_chunks, 1));
+  const bool combine = bits <= 11;
+
+  // signed and unsigned variants of a type may alias each other
+  U *src = reinterpret_cast<U *>(keys.data());
+  U *dst = reinterpret_cast<U *>(buffer.data());
+  std::vector<size_t> bounds(chunks + 1);
+  for (size_t c = 0; c <= chunks; c++) {
+    bounds[c] = n * c / chunks;
+  }
+  std::vector<size_t> counts(chunks * buckets);
+  const auto for_each_chunk = [&](const auto &body) {
+    parallel_for(0, chunks, [&](size_t chunk_begin, size_t chunk_end) {
+      for (size_t c = chunk_begin; c < chunk_end; c++) {
+        body(c, counts.data() + (c * buckets));
+      }
+    });
+  };
+
+  const auto digit_of_pass = [&](size_t pass) {
+    return detail::Digit<U>{.flip = Traits::kFlip, .shift = pass * bits, .mask = buckets - 1};
+  };
+  // counts of a single chunk do not depend on the order of its keys, so one read counts the digits of all passes
+  std::vector<size_t> pass_counts;
+  if (chunks == 1) {
+    pass_counts.resize(passes * buckets);
+    detail::CountAllDigits(src, n, Traits::kFlip, bits, passes, pass_counts.data());
+  }
+
+  for (size_t pass = 0; pass < passes; pass++) {
+    const auto digit = digit_of_pass(pass);
+    if (chunks == 1) {
+      std::copy_n(pass_counts.begin() + static_cast<std::ptrdiff_t>(pass * buckets), buckets, counts.begin());
+    } else {
+      std::ranges::fill(counts, 0);
+      for_each_chunk([&](size_t c, size_t *chunk_counts) {
+        detail::CountDigits(src, bounds[c], bounds[c + 1], digit, chunk_counts);
+      });
+    }
+    if (!detail::CountsToOffsets(counts, chunks, buckets, n)) {
+      continue;
+    }
+    for_each_chunk([&](size_t c, size_t *offsets) {
+      if (combine) {
+        detail::ScatterCombined(src, bounds[c], bounds[c + 1], dst, digit, offsets, buckets);
+      } else {
+        detail::ScatterDirect(src, bounds[c], bounds[c + 1], dst, digit, offsets);
+      }
+    });
+    std::swap(src, dst);
+  }
+
+  if (src != reinterpret_cast<U *>(keys.data())) {
+    for_each_chunk([&](size_t c, size_t *) {
+      std::copy(src + bounds[c], src + bounds[c + 1], reinterpret_cast<U *>(keys.data()) + bounds[c]);
+    });
+  }
+}
+
+template <typename T, typename ParallelFor>
+void RadixSort(std::span<T> keys, size_t num_chunks, const ParallelFor &parallel_for) {
+  ppc::util::AlignedVector<T> buffer(keys.size());
+  RadixSort(keys, std::span<T>(buffer), num_chunks, parallel_for);
+}
+
+template <typename T>
+void RadixSort(std::span<T> keys) {
+  RadixSort(keys, 1, [](size_t begin, size_t end, const auto &body) { body(begin, end); });
+}
+
+}  // namespace ppc::core::sort
@@ -0,0 +1,130 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace ppc::core::sort {
+
+// Sorts keys by comp in place with Shell sort over the gaps of ShellGaps. A pass with a gap h of at least
+// detail::kMinChainGap insertion-sorts the h independent chains keys[c], keys[c + h], ... of the whole range, row by
+// row so that the loads of neighbouring chains share cache lines; the chains are split between num_chunks chunks
+// in slices of whole cache lines. The smaller gaps run on blocks of detail::kShellBlockBytes, each block sorted by
+// one chunk while it stays in cache, and a final insertion across the block boundaries joins the sorted blocks. The
+// large gaps leave every key a bounded distance from its place, so that join moves few keys. Not stable.
+// parallel_for as in RadixSort.
+template <typename T, typename ParallelFor, typename Compare = std::less<>>
+void ShellSort(std::span<T> keys, size_t num_chunks, const ParallelFor &parallel_for, Compare comp = {});
+
+// ShellSort in the calling thread
+template <typename T, typename Compare = std::less<>>
+void ShellSort(std::span<T> keys, Compare comp = {});
+
+// Gaps of ShellSort for n keys in decreasing order down to 1: Ciura's 1, 4, 10, 23, 57, 132, 301, 701, 1750,
+// extended by Tokuda's ratio 9 / 4, all below n but 1
+inline std::vector<size_t> ShellGaps(size_t n);
+
+namespace detail {
+
+// gaps from this one on sort the chains of the whole range, smaller ones sort blocks
+constexpr size_t kMinChainGap = 57;
+// bytes of a block of the small gaps
+constexpr size_t kShellBlockBytes = size_t{1} << 18;
+// chains of one chunk start in at least this many bytes of a row, so chunks do not store into shared lines
+constexpr size_t kShellLineBytes = 64;
+
+// insertion sort of keys[0, n) with gap h, of the chains starting in [c_begin, c_end), one row of h keys at a time
+template <typename T, typename Compare>
+void HSortChains(T *keys, size_t n, size_t h, size_t c_begin, size_t c_end, const Compare &comp) {
+  for (size_t row = h; row + c_begin < n; row += h) {
+    const size_t end = std::min(row + c_end, n);
+    for (size_t i = row + c_begin; i < end; i++) {
+      T x = std::move(keys[i]);
+      size_t j = i;
+      for (; j >= h && comp(x, keys[j - h]); j -= h) {
+        keys[j] = std::move(keys[j - h]);
+      }
+      keys[j] = std::move(x);
+    }
+  }
+}
+
+// keys[0, boundary) and keys[boundary, n) are sorted: inserts the keys after the boundary which are less than the
+// key before them, so that keys[0, n) is sorted
+template <typename T, typename Compare>
+void JoinSorted(T *keys, size_t boundary, size_t n, const Compare &comp) {
+  for (size_t i = boundary; i < n && comp(keys[i], keys[i - 1]); i++) {
+    T x = std::move(keys[i]);
+    size_t j = i;
+    for (; j > 0 && comp(x, keys[j - 1]); j--) {
+      keys[j] = std::move(keys[j - 1]);
+    }
+    keys[j] = std::move(x);
+  }
+}
+
+}  // namespace detail
+
+inline std::vector<size_t> ShellGaps(size_t n) {
+  std::vector<size_t> gaps;
+  for (const size_t gap : {1, 4, 10, 23, 57, 132, 301, 701, 1750}) {
+    if (gap < n || gap == 1) {
+      gaps.push_back(gap);
+    }
+  }
+  if (gaps.size() == 9) {
+    for (size_t gap = gaps.back() * 9 / 4; gap < n; gap = gap * 9 / 4) {
+      gaps.push_back(gap);
+    }
+  }
+  std::ranges::reverse(gaps);
+  return gaps;
+}
+
+template <typename T, typename ParallelFor, typename Compare>
+void ShellSort(std::span<T> keys, size_t num_chunks, const ParallelFor &parallel_for, Compare comp) {
+  const size_t n = keys.size();
+  if (n < 2) {
+    return;
+  }
+  T *data = keys.data();
+  const size_t parts = std::max<size_t>(num_chunks, 1);
+  const std::vector<size_t> gaps = ShellGaps(n);
+
+  const size_t line_keys = std::max<size_t>(detail::kShellLineBytes / sizeof(T), 1);
+  auto gap = gaps.begin();
+  for (; gap != gaps.end() && *gap >= detail::kMinChainGap; ++gap) {
+    const size_t h = *gap;
+    const size_t slices = std::clamp<size_t>(h / line_keys, 1, parts);
+    parallel_for(0, slices, [&](size_t begin, size_t end) {
+      for (size_t s = begin; s < end; s++) {
+        detail::HSortChains(data, n, h, h * s / slices, h * (s + 1) / slices, comp);
+      }
+    });
+  }
+
+  const size_t block = std::max<size_t>(detail::kShellBlockBytes / sizeof(T), detail::kMinChainGap);
+  const size_t blocks = (n + block - 1) / block;
+  parallel_for(0, blocks, [&](size_t begin, size_t end) {
+    for (size_t b = begin; b < end; b++) {
+      const size_t first = b * block;
+      const size_t size = std::min(block, n - first);
+      for (auto small = gap; small != gaps.end(); ++small) {
+        detail::HSortChains(data + first, size, *small, 0, *small, comp);
+      }
+    }
+  });
+  for (size_t b = 1; b < blocks; b++) {
+    detail::JoinSorted(data, b * block, n, comp);
+  }
+}
+
+template <typename T, typename Compare>
+void ShellSort(std::span<T> keys, Compare comp) {
+  ShellSort(keys, 1, [](size_t begin, size_t end, const auto &body) { body(begin, end); }, comp);
+}
+
+}  // namespace ppc::core::sort
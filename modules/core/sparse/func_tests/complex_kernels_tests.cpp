@@ -0,0 +1,203 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "core/sparse/include/complex_kernels.hpp"
+
+namespace {
+
+std::vector<std::complex<double>> RandomValues(size_t n, std::mt19937 &gen) {
+  std::uniform_real_distribution<double> part(-1.0, 1.0);
+  std::vector<std::complex<double>> values(n);
+  for (auto &x : values) {
+    x = {part(gen), part(gen)};
+  }
+  return values;
+}
+
+// distinct indices below size in random order
+template <typename Index>
+std::vector<Index> RandomIndices(size_t n, size_t size, std::mt19937 &gen) {
+  std::vector<Index> indices(size);
+  for (size_t i = 0; i < size; i++) {
+    indices[i] = static_cast<Index>(i);
+  }
+  std::ranges::shuffle(indices, gen);
+  indices.resize(n);
+  return indices;
+}
+
+template <typename Index>
+void CheckScatterMultiplyAdd() {
+  std::mt19937 gen(21);
+  const size_t size = 61;
+  std::vector<std::complex<double>> expected(size);
+  ppc::core::sparse::ComplexAccumulator acc(size);
+  // column lengths cover full SIMD blocks and tails
+  for (const size_t n : {0, 1, 3, 4, 8, 13, 37, 61}) {
+    const auto indices = RandomIndices<Index>(n, size, gen);
+    const auto values = RandomValues(n + 2, gen);
+    const std::complex<double> scale = RandomValues(1, gen)[0];
+    for (size_t e = 0; e < n; e++) {
+      expected[static_cast<size_t>(indices[e])] += scale * values[e + 2];
+    }
+    ppc::core::sparse::ScatterMultiplyAdd(std::span<const Index>(indices), ppc::core::sparse::SplitComplex(values), 2,
+                                          scale, acc);
+  }
+  for (size_t i = 0; i < size; i++) {
+    EXPECT_NEAR(acc[i].real(), expected[i].real(), 1e-14);
+    EXPECT_NEAR(acc[i].imag(), expected[i].imag(), 1e-14);
+  }
+  // every written entry is found by the drain
+  size_t drained = 0;
+  ppc::core::sparse::DrainNonZero(acc, 0.0, [&](size_t i, std::complex<double> value) {
+    EXPECT_EQ(value, expected[i]);
+    drained++;
+  });
+  EXPECT_EQ(drained, static_cast<size_t>(std::ranges::count_if(
+                         expected, [](std::complex<double> value) { return value != std::complex<double>(); })));
+}
+
+}  // namespace
+
+TEST(sparse_tests, check_split_complex_round_trip) {
+  std::mt19937 gen(19);
+  const auto values = RandomValues(11, gen);
+  const ppc::core::sparse::SplitComplex split(values);
+  ASSERT_EQ(split.Size(), values.size());
+  for (size_t i = 0; i < values.size(); i++) {
+    EXPECT_EQ(split[i], values[i]);
+  }
+}
+
+TEST(sparse_tests, check_scatter_multiply_add_int32) { CheckScatterMultiplyAdd<int>(); }
+
+TEST(sparse_tests, check_scatter_multiply_add_uint32) { CheckScatterMultiplyAdd<uint32_t>(); }
+
+TEST(sparse_tests, check_scatter_multiply_add_int64) { CheckScatterMultiplyAdd<int64_t>(); }
+
+TEST(sparse_tests, check_drain_non_zero) {
+  const size_t size = 27;
+  ppc::core::sparse::ComplexAccumulator acc(size);
+  std::vector<std::pair<size_t, std::complex<double>>> expected;
+  for (size_t i = 0; i < size; i++) {
+    // zeros, values below the threshold and values above it in every SIMD block
+    switch (i % 3) {
+      case 0:
+        break;
+      case 1:
+        acc.im[i] = 1e-12;
+        acc.Touch(i);
+        break;
+      default:
+        acc.re[i] = static_cast<double>(i);
+        acc.im[i] = -1.0;
+        acc.Touch(i);
+        expected.emplace_back(i, std::complex<double>(static_cast<double>(i), -1.0));
+    }
+  }
+  std::vector<std::pair<size_t, std::complex<double>>> kept;
+  auto emit = [&](size_t i, std::complex<double> value) { kept.emplace_back(i, value); };
+  ppc::core::sparse::DrainNonZero(acc, 1e-20, emit);
+  EXPECT_EQ(kept, expected);
+  EXPECT_TRUE(std::ranges::all_of(acc.re, [](double x) { return x == 0.0; }));
+  EXPECT_TRUE(std::ranges::all_of(acc.im, [](double x) { return x == 0.0; }));
+  EXPECT_TRUE(std::ranges::all_of(acc.touched, [](uint64_t x) { return x == 0; }));
+
+  // only exact zeros are dropped without a threshold
+  acc.im[4] = 1e-12;
+  acc.Touch(4);
+  acc.re[20] = -0.0;
+  acc.Touch(20);
+  kept.clear();
+  ppc::core::sparse::DrainNonZero(acc, 0.0, emit);
+  EXPECT_EQ(kept, (std::vector<std::pair<size_t, std::complex<double>>>{{4, {0.0, 1e-12}}}));
+}
+
+TEST(sparse_tests, check_drain_wide_accumulator) {
+  // a few entries far apart in an accumulator of several bitmap words, the last block is partial
+  const size_t size = 2003;
+  ppc::core::sparse::ComplexAccumulator acc(size);
+  const std::vector<size_t> entries = {0, 7, 8, 511, 512, 1300, 1999, 2002};
+  for (const size_t i : entries) {
+    acc.re[i] = 1.0;
+    acc.im[i] = static_cast<double>(i);
+    acc.Touch(i);
+  }
+  std::vector<size_t> kept;
+  ppc::core::sparse::DrainNonZero(acc, 0.0, [&](size_t i, std::complex<double> value) {
+    EXPECT_EQ(value, std::complex<double>(1.0, static_cast<double>(i)));
+    kept.push_back(i);
+  });
+  EXPECT_EQ(kept, entries);
+  EXPECT_TRUE(std::ranges::all_of(acc.re, [](double x) { return x == 0.0; }));
+  EXPECT_TRUE(std::ranges::all_of(acc.touched, [](uint64_t x) { return x == 0; }));
+}
+
+TEST(sparse_tests, check_kept_mask_kernels) {
+  std::mt19937 gen(22);
+  std::uniform_int_distribution<int> kind(0, 3);
+  ppc::core::sparse::SplitComplex block(ppc::core::sparse::detail::kDrainBlock);
+  std::vector<ppc::core::sparse::detail::KeptMaskFn> kernels = {ppc::core::sparse::detail::SelectKeptMask()};
+#ifdef PPC_X86_64
+  kernels.push_back(ppc::core::sparse::detail::KeptMaskSse2);
+  if (ppc::util::GetCpuFeatures().avx2) {
+    kernels.push_back(ppc::core::sparse::detail::KeptMaskAvx2);
+  }
+  if (ppc::util::GetCpuFeatures().avx512f) {
+    kernels.push_back(ppc::core::sparse::detail::KeptMaskAvx512);
+  }
+#endif
+  // zeros, negative zeros, values below the threshold and values above it
+  const std::array<double, 4> parts = {0.0, -0.0, 1e-12, 1.0};
+  for (int round = 0; round < 100; round++) {
+    for (size_t lane = 0; lane < block.Size(); lane++) {
+      block.re[lane] = parts[kind(gen)];
+      block.im[lane] = parts[kind(gen)];
+    }
+    const uint32_t expected = ppc::core::sparse::detail::KeptMaskGeneric(block.re.data(), block.im.data(), 1e-20);
+    for (const auto kernel : kernels) {
+      EXPECT_EQ(kernel(block.re.data(), block.im.data(), 1e-20), expected);
+    }
+  }
+}
+
+#ifdef PPC_X86_64
+TEST(sparse_tests, check_scatter_multiply_add_kernels) {
+  std::mt19937 gen(23);
+  const size_t size = 64;
+  const auto indices = RandomIndices<int32_t>(size, size, gen);
+  const ppc::core::sparse::SplitComplex values(RandomValues(size, gen));
+  const std::complex<double> scale = RandomValues(1, gen)[0];
+  ppc::core::sparse::SplitComplex expected(size);
+  for (size_t e = 0; e < size; e++) {
+    const auto i = static_cast<size_t>(indices[e]);
+    expected.re[i] += (scale.real() * values.re[e]) - (scale.imag() * values.im[e]);
+    expected.im[i] += (scale.real() * values.im[e]) + (scale.imag() * values.re[e]);
+  }
+  const auto check = [&](auto kernel) {
+    ppc::core::sparse::SplitComplex acc(size);
+    EXPECT_EQ(kernel(indices.data(), size, values.re.data(), values.im.data(), scale.real(), scale.imag(),
+                     acc.re.data(), acc.im.data()),
+              size);
+    for (size_t i = 0; i < size; i++) {
+      EXPECT_NEAR(acc.re[i], expected.re[i], 1e-14);
+      EXPECT_NEAR(acc.im[i], expected.im[i], 1e-14);
+    }
+  };
+  if (ppc::util::GetCpuFeatures().avx2) {
+    check(ppc::core::sparse::detail::ScatterMultiplyAddAvx2);
+  }
+  if (ppc::util::GetCpuFeatures().avx512f) {
+    check(ppc::core::sparse::detail::ScatterMultiplyAddAvx512);
+  }
+}
+#endif
@@ -0,0 +1,170 @@
+#include <gtest/gtest.h>
+
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include "core/sparse/include/matrix.hpp"
+#include "core/sparse/include/spgemm.hpp"
+#include "core/thread_pool/include/thread_pool.hpp"
+
+namespace {
+
+void SerialFor(size_t begin, size_t end, const std::function<void(size_t, size_t)> &body) { body(begin, end); }
+
+void PoolFor(size_t begin, size_t end, const std::function<void(size_t, size_t)> &body) {
+  ppc::core::ParallelFor(begin, end, body);
+}
+
+template <typename Value>
+std::vector<Value> RandomDense(size_t rows, size_t cols, double density, std::mt19937 &gen) {
+  std::uniform_real_distribution<double> value(-1.0, 1.0);
+  std::bernoulli_distribution present(density);
+  std::vector<Value> m(rows * cols);
+  for (auto &x : m) {
+    if (present(gen)) {
+      x = Value(value(gen));
+    }
+  }
+  return m;
+}
+
+template <typename Index, typename Value>
+std::vector<Value> ToDense(const ppc::core::sparse::CsrMatrix<Index, Value> &m) {
+  std::vector<Value> dense(m.num_rows * m.num_cols);
+  for (size_t i = 0; i < m.num_rows; i++) {
+    for (auto e = static_cast<size_t>(m.offsets[i]); e < static_cast<size_t>(m.offsets[i + 1]); e++) {
+      dense[(i * m.num_cols) + static_cast<size_t>(m.indices[e])] += m.values[e];
+    }
+  }
+  return dense;
+}
+
+template <typename Index, typename Value>
+bool IsSorted(const ppc::core::sparse::CsrView<Index, Value> &m) {
+  for (size_t i = 0; i < m.NumRows(); i++) {
+    for (size_t e = m.RowBegin(i) + 1; e < m.RowEnd(i); e++) {
+      if (m.indices[e - 1] >= m.indices[e]) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
+TEST(sparse_tests, check_csr_from_dense_and_back) {
+  std::mt19937 gen(3);
+  const auto dense = RandomDense<double>(29, 17, 0.3, gen);
+  for (const size_t num_chunks : {1, 4, 64}) {
+    const auto m = ppc::core::sparse::CsrFromDense<uint32_t>(std::span<const double>(dense), 29, 17, num_chunks,
+                                                            PoolFor);
+    EXPECT_EQ(m.offsets.size(), 30U);
+    EXPECT_TRUE(IsSorted(m.View()));
+    EXPECT_EQ(ToDense(m), dense);
+  }
+}
+
+TEST(sparse_tests, check_transpose_round_trip) {
+  std::mt19937 gen(9);
+  const size_t rows = 41;
+  const size_t cols = 23;
+  const auto dense = RandomDense<std::complex<double>>(rows, cols, 0.2, gen);
+  for (const size_t num_chunks : {1, 3, 16}) {
+    const auto csr = ppc::core::sparse::CsrFromDense<int64_t>(std::span<const std::complex<double>>(dense), rows,
+                                                             cols, num_chunks, PoolFor);
+    const auto ccs = ppc::core::sparse::ToCcs(csr, num_chunks, PoolFor);
+    EXPECT_EQ(ccs.offsets.size(), cols + 1);
+    EXPECT_TRUE(IsSorted(ccs.TransposedView()));
+    for (size_t j = 0; j < cols; j++) {
+      for (auto e = static_cast<size_t>(ccs.offsets[j]); e < static_cast<size_t>(ccs.offsets[j + 1]); e++) {
+        EXPECT_EQ(ccs.values[e], dense[(static_cast<size_t>(ccs.indices[e]) * cols) + j]);
+      }
+    }
+    const auto back = ppc::core::sparse::ToCsr(ccs, num_chunks, PoolFor);
+    EXPECT_EQ(back.offsets, csr.offsets);
+    EXPECT_EQ(back.indices, csr.indices);
+    EXPECT_EQ(back.values, csr.values);
+  }
+}
+
+TEST(sparse_tests, check_ccs_from_dense_multiplies_by_swapped_operands) {
+  std::mt19937 gen(13);
+  const auto a = RandomDense<double>(8, 12, 0.4, gen);
+  const auto b = RandomDense<double>(12, 5, 0.4, gen);
+  const auto a_ccs = ppc::core::sparse::CcsFromDense<int>(std::span<const double>(a), 8, 12, 2, PoolFor);
+  const auto b_ccs = ppc::core::sparse::CcsFromDense<int>(std::span<const double>(b), 12, 5, 2, PoolFor);
+
+  ppc::core::sparse::CcsMatrix<int, double> c;
+  c.num_rows = 8;
+  c.num_cols = 5;
+  ppc::core::sparse::Multiply(b_ccs.TransposedView(), a_ccs.TransposedView(), c, ppc::core::sparse::KeepAll{}, 2,
+                              PoolFor);
+  const auto c_dense = ToDense(ppc::core::sparse::ToCsr(c, 2, PoolFor));
+  for (size_t i = 0; i < 8; i++) {
+    for (size_t j = 0; j < 5; j++) {
+      double expected = 0.0;
+      for (size_t k = 0; k < 12; k++) {
+        expected += a[(i * 12) + k] * b[(k * 5) + j];
+      }
+      EXPECT_NEAR(c_dense[(i * 5) + j], expected, 1e-12);
+    }
+  }
+}
+
+TEST(sparse_tests, check_csr_from_coo_sums_repeated_entries) {
+  ppc::core::sparse::CooMatrix<uint32_t, double> coo;
+  coo.num_rows = 3;
+  coo.num_cols = 4;
+  coo.rows = {2, 0, 2, 0, 2, 0};
+  coo.cols = {3, 1, 0, 1, 3, 2};
+  coo.values = {1.0, 2.0, 3.0, -2.0, 4.0, 5.0};
+  for (const size_t num_chunks : {1, 2, 8}) {
+    const auto m = ppc::core::sparse::CsrFromCoo(coo, num_chunks, PoolFor);
+    EXPECT_EQ(m.offsets, (ppc::util::AlignedVector<uint32_t>{0, 2, 2, 4}));
+    EXPECT_EQ(m.indices, (ppc::util::AlignedVector<uint32_t>{1, 2, 0, 3}));
+    EXPECT_EQ(m.values, (ppc::util::AlignedVector<double>{0.0, 5.0, 3.0, 5.0}));
+  }
+}
+
+TEST(sparse_tests, check_sparse_arrays_are_aligned) {
+  std::mt19937 gen(17);
+  const auto dense = RandomDense<double>(10, 10, 0.5, gen);
+  const auto m = ppc::core::sparse::CsrFromDense<uint32_t>(std::span<const double>(dense), 10, 10, 1, SerialFor);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(m.offsets.data()) % 64, 0U);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(m.indices.data()) % 64, 0U);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(m.values.data()) % 64, 0U);
+}
+
+TEST(sparse_tests, check_sparse_conversions_validate_sizes) {
+  const std::vector<double> dense(5);
+  EXPECT_THROW(ppc::core::sparse::CsrFromDense<int>(std::span<const double>(dense), 2, 3, 1, SerialFor),
+               std::invalid_argument);
+
+  ppc::core::sparse::CooMatrix<int, double> coo;
+  coo.num_rows = 2;
+  coo.num_cols = 2;
+  coo.rows = {0, 1};
+  coo.cols = {1};
+  coo.values = {1.0, 2.0};
+  EXPECT_THROW(ppc::core::sparse::CsrFromCoo(coo, 1, SerialFor), std::invalid_argument);
+  coo.cols = {1, 2};
+  EXPECT_THROW(ppc::core::sparse::CsrFromCoo(coo, 1, SerialFor), std::invalid_argument);
+
+  const std::vector<int> offsets = {0, 1};
+  const std::vector<int> indices = {0};
+  const std::vector<double> values = {1.0};
+  const ppc::core::sparse::CsrView<int, double> m{offsets, indices, values, 1};
+  std::vector<int> t_offsets(1);
+  std::vector<int> t_indices(1);
+  std::vector<double> t_values(1);
+  EXPECT_THROW(ppc::core::sparse::Transpose(m, std::span(t_offsets), std::span(t_indices), std::span(t_values), 1,
+                                            SerialFor),
+               std::invalid_argument);
+}
@@ -0,0 +1,209 @@
+#include <gtest/gtest.h>
+
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include "core/sparse/include/spgemm.hpp"
+#include "core/thread_pool/include/thread_pool.hpp"
+
+namespace {
+
+template <typename Value>
+struct Dense {
+  size_t rows;
+  size_t cols;
+  std::vector<Value> data;
+};
+
+template <typename Index, typename Value>
+ppc::core::sparse::CsrArrays<Index, Value> ToCsr(const Dense<Value> &m) {
+  ppc::core::sparse::CsrArrays<Index, Value> res;
+  res.offsets.push_back(0);
+  for (size_t i = 0; i < m.rows; i++) {
+    for (size_t j = 0; j < m.cols; j++) {
+      if (m.data[(i * m.cols) + j] != Value{}) {
+        res.indices.push_back(static_cast<Index>(j));
+        res.values.push_back(m.data[(i * m.cols) + j]);
+      }
+    }
+    res.offsets.push_back(static_cast<Index>(res.indices.size()));
+  }
+  return res;
+}
+
+template <typename Index, typename Value>
+ppc::core::sparse::CsrView<Index, Value> View(const ppc::core::sparse::CsrArrays<Index, Value> &m, size_t num_cols) {
+  return {.offsets = m.offsets, .indices = m.indices, .values = m.values, .num_cols = num_cols};
+}
+
+template <typename Value>
+Dense<Value> DenseProduct(const Dense<Value> &a, const Dense<Value> &b) {
+  Dense<Value> c{.rows = a.rows, .cols = b.cols, .data = std::vector<Value>(a.rows * b.cols)};
+  for (size_t i = 0; i < a.rows; i++) {
+    for (size_t k = 0; k < a.cols; k++) {
+      for (size_t j = 0; j < b.cols; j++) {
+        c.data[(i * b.cols) + j] += a.data[(i * a.cols) + k] * b.data[(k * b.cols) + j];
+      }
+    }
+  }
+  return c;
+}
+
+Dense<double> RandomDense(size_t rows, size_t cols, double density, std::mt19937 &gen) {
+  std::uniform_real_distribution<double> value(-1.0, 1.0);
+  std::bernoulli_distribution present(density);
+  Dense<double> m{.rows = rows, .cols = cols, .data = std::vector<double>(rows * cols)};
+  for (auto &x : m.data) {
+    x = present(gen) ? value(gen) : 0.0;
+  }
+  return m;
+}
+
+void SerialFor(size_t begin, size_t end, const std::function<void(size_t, size_t)> &body) { body(begin, end); }
+
+void PoolFor(size_t begin, size_t end, const std::function<void(size_t, size_t)> &body) {
+  ppc::core::ParallelFor(begin, end, body);
+}
+
+}  // namespace
+
+TEST(sparse_tests, check_spgemm_matches_dense_product) {
+  std::mt19937 gen(7);
+  const auto a = RandomDense(37, 23, 0.2, gen);
+  const auto b = RandomDense(23, 41, 0.15, gen);
+  const auto a_csr = ToCsr<uint32_t>(a);
+  const auto b_csr = ToCsr<uint32_t>(b);
+  const auto expected = ToCsr<uint32_t>(DenseProduct(a, b));
+
+  for (const size_t num_chunks : {1, 3, 16}) {
+    ppc::core::sparse::CsrArrays<uint32_t, double> c;
+    ppc::core::sparse::Multiply(View(a_csr, a.cols), View(b_csr, b.cols), c, ppc::core::sparse::KeepNonZero{},
+                                num_chunks, PoolFor);
+    EXPECT_EQ(c.offsets, expected.offsets);
+    EXPECT_EQ(c.indices, expected.indices);
+    ASSERT_EQ(c.values.size(), expected.values.size());
+    for (size_t i = 0; i < c.values.size(); i++) {
+      EXPECT_NEAR(c.values[i], expected.values[i], 1e-12);
+    }
+  }
+}
+
+TEST(sparse_tests, check_spgemm_dense_rows) {
+  // rows of the product get every column long before their last term
+  std::mt19937 gen(5);
+  const auto a = RandomDense(12, 30, 1.0, gen);
+  const auto b = RandomDense(30, 9, 0.8, gen);
+  const auto a_csr = ToCsr<int>(a);
+  const auto b_csr = ToCsr<int>(b);
+  const auto expected = ToCsr<int>(DenseProduct(a, b));
+
+  ppc::core::sparse::CsrArrays<int, double> c;
+  ppc::core::sparse::Multiply(View(a_csr, a.cols), View(b_csr, b.cols), c, ppc::core::sparse::KeepAll{}, 3, PoolFor);
+  EXPECT_EQ(c.offsets, expected.offsets);
+  EXPECT_EQ(c.indices, expected.indices);
+  ASSERT_EQ(c.values.size(), expected.values.size());
+  for (size_t i = 0; i < c.values.size(); i++) {
+    EXPECT_NEAR(c.values[i], expected.values[i], 1e-12);
+  }
+}
+
+TEST(sparse_tests, check_spgemm_keeps_cancelled_entries_on_request) {
+  // row 0 of a * b is {1 - 1, 2}: structurally two entries, one of them is zero
+  const std::vector<int> a_offsets = {0, 2};
+  const std::vector<int> a_indices = {0, 1};
+  const std::vector<double> a_values = {1.0, -1.0};
+  const std::vector<int> b_offsets = {0, 2, 3};
+  const std::vector<int> b_indices = {0, 1, 0};
+  const std::vector<double> b_values = {1.0, 2.0, 1.0};
+  const ppc::core::sparse::CsrView<int, double> a{a_offsets, a_indices, a_values, 2};
+  const ppc::core::sparse::CsrView<int, double> b{b_offsets, b_indices, b_values, 2};
+
+  ppc::core::sparse::CsrArrays<int, double> all;
+  ppc::core::sparse::Multiply(a, b, all, ppc::core::sparse::KeepAll{}, 1, SerialFor);
+  EXPECT_EQ(all.offsets, (std::vector<int>{0, 2}));
+  EXPECT_EQ(all.indices, (std::vector<int>{0, 1}));
+  EXPECT_EQ(all.values, (std::vector<double>{0.0, 2.0}));
+
+  ppc::core::sparse::CsrArrays<int, double> non_zero;
+  ppc::core::sparse::Multiply(a, b, non_zero, ppc::core::sparse::KeepNonZero{}, 1, SerialFor);
+  EXPECT_EQ(non_zero.offsets, (std::vector<int>{0, 1}));
+  EXPECT_EQ(non_zero.indices, (std::vector<int>{1}));
+  EXPECT_EQ(non_zero.values, (std::vector<double>{2.0}));
+}
+
+TEST(sparse_tests, check_spgemm_hash_accumulator_for_wide_rows) {
+  // b has far more columns than the dense accumulator limit, so short rows go to the hash table
+  const size_t num_cols = (ppc::core::sparse::kDenseAccumulatorColumns * 4) + 5;
+  const std::vector<uint32_t> a_offsets = {0, 2, 2, 3};
+  const std::vector<uint32_t> a_indices = {0, 1, 1};
+  const std::vector<std::complex<double>> a_values = {{1, 1}, {2, 0}, {0, 1}};
+  const std::vector<uint32_t> b_offsets = {0, 3, 5};
+  const std::vector<uint32_t> b_indices = {static_cast<uint32_t>(num_cols - 1), 7, 100000, 7,
+                                           static_cast<uint32_t>(num_cols - 2)};
+  const std::vector<std::complex<double>> b_values = {{1, 0}, {0, 1}, {2, 2}, {3, 0}, {1, -1}};
+  const ppc::core::sparse::CsrView<uint32_t, std::complex<double>> a{a_offsets, a_indices, a_values, 2};
+  const ppc::core::sparse::CsrView<uint32_t, std::complex<double>> b{b_offsets, b_indices, b_values, num_cols};
+
+  ppc::core::sparse::CsrArrays<uint32_t, std::complex<double>> c;
+  ppc::core::sparse::Multiply(a, b, c, ppc::core::sparse::KeepNonZero{}, 2, PoolFor);
+  EXPECT_EQ(c.offsets, (std::vector<uint32_t>{0, 4, 4, 6}));
+  EXPECT_EQ(c.indices, (std::vector<uint32_t>{7, 100000, static_cast<uint32_t>(num_cols - 2),
+                                              static_cast<uint32_t>(num_cols - 1), 7,
+                                              static_cast<uint32_t>(num_cols - 2)}));
+  const std::vector<std::complex<double>> expected = {
+      (std::complex<double>{1, 1} * std::complex<double>{0, 1}) + std::complex<double>{6, 0},
+      std::complex<double>{1, 1} * std::complex<double>{2, 2},
+      std::complex<double>{2, -2},
+      std::complex<double>{1, 1},
+      std::complex<double>{0, 3},
+      std::complex<double>{0, 1} * std::complex<double>{1, -1}};
+  EXPECT_EQ(c.values, expected);
+}
+
+TEST(sparse_tests, check_spgemm_ccs_by_swapped_operands) {
+  std::mt19937 gen(11);
+  const auto a = RandomDense(19, 30, 0.25, gen);
+  const auto b = RandomDense(30, 13, 0.25, gen);
+  auto transpose = [](const Dense<double> &m) {
+    Dense<double> t{.rows = m.cols, .cols = m.rows, .data = std::vector<double>(m.data.size())};
+    for (size_t i = 0; i < m.rows; i++) {
+      for (size_t j = 0; j < m.cols; j++) {
+        t.data[(j * m.rows) + i] = m.data[(i * m.cols) + j];
+      }
+    }
+    return t;
+  };
+  // CCS arrays of a matrix are the CSR arrays of its transpose
+  const auto a_ccs = ToCsr<int>(transpose(a));
+  const auto b_ccs = ToCsr<int>(transpose(b));
+  const auto expected = ToCsr<int>(transpose(DenseProduct(a, b)));
+
+  ppc::core::sparse::CsrArrays<int, double> c;
+  ppc::core::sparse::Multiply(View(b_ccs, b.rows), View(a_ccs, a.rows), c, ppc::core::sparse::KeepNonZero{}, 4,
+                              PoolFor);
+  EXPECT_EQ(c.offsets, expected.offsets);
+  EXPECT_EQ(c.indices, expected.indices);
+  ASSERT_EQ(c.values.size(), expected.values.size());
+  for (size_t i = 0; i < c.values.size(); i++) {
+    EXPECT_NEAR(c.values[i], expected.values[i], 1e-12);
+  }
+}
+
+TEST(sparse_tests, check_spgemm_empty_and_mismatched) {
+  const std::vector<int> offsets = {0};
+  const ppc::core::sparse::CsrView<int, double> empty{offsets, {}, {}, 0};
+  ppc::core::sparse::CsrArrays<int, double> c;
+  ppc::core::sparse::Multiply(empty, empty, c, ppc::core::sparse::KeepAll{}, 8, PoolFor);
+  EXPECT_EQ(c.offsets, offsets);
+  EXPECT_TRUE(c.indices.empty());
+
+  const ppc::core::sparse::CsrView<int, double> wide{offsets, {}, {}, 3};
+  EXPECT_THROW(ppc::core::sparse::Multiply(wide, empty, c, ppc::core::sparse::KeepAll{}, 1, SerialFor),
+               std::invalid_argument);
+}
@@ -0,0 +1,296 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "core/util/include/aligned_allocator.hpp"
+#include "core/util/include/cpu_features.hpp"
+
+#ifdef PPC_X86_64
+#include <immintrin.h>
+#endif
+
+namespace ppc::core::sparse {
+
+// Complex values as separate arrays of real and imaginary parts, so that kernels load several values of one part
+// into a SIMD register. Products scale * value are formed as optimizing compilers form std::complex ones, with the
+// same fused multiply-adds on targets with FMA, so results match std::complex code; only its recovery of infinite
+// parts from NaN results is left out, which keeps std::complex multiplications out of vectorized loops.
+// The kernels use AVX-512 or AVX2 if the processor supports them, chosen at run time by ppc::util::GetCpuFeatures;
+// otherwise DrainNonZero uses SSE2 of every x86-64 processor and ScatterMultiplyAdd is a scalar loop.
+struct SplitComplex {
+  ppc::util::AlignedVector<double> re;
+  ppc::util::AlignedVector<double> im;
+
+  SplitComplex() = default;
+  explicit SplitComplex(size_t size) : re(size), im(size) {}
+  explicit SplitComplex(std::span<const std::complex<double>> values) : re(values.size()), im(values.size()) {
+    for (size_t i = 0; i < values.size(); i++) {
+      re[i] = values[i].real();
+      im[i] = values[i].imag();
+    }
+  }
+
+  [[nodiscard]] size_t Size() const { return re.size(); }
+  [[nodiscard]] std::complex<double> operator[](size_t i) const { return {re[i], im[i]}; }
+};
+
+namespace detail {
+
+constexpr size_t kDrainBlock = 8;
+constexpr size_t kBlocksPerWord = 64;
+
+#ifdef PPC_X86_64
+
+// acc[idx[e]] += scale * values[e] for the entries e of whole vectors of 8, returns their count; the indices are
+// distinct, which makes the scatter of 8 sums exact
+PPC_TARGET("avx512f")
+inline size_t ScatterMultiplyAddAvx512(const int32_t *idx, size_t n, const double *v_re, const double *v_im,
+                                       double s_re, double s_im, double *a_re, double *a_im) {
+  const __m512d vs_re = _mm512_set1_pd(s_re);
+  const __m512d vs_im = _mm512_set1_pd(s_im);
+  const __m512d zero = _mm512_setzero_pd();
+  size_t e = 0;
+  for (; e + 8 <= n; e += 8) {
+    const __m256i vi = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(idx + e));
+    const __m512d x_re = _mm512_loadu_pd(v_re + e);
+    const __m512d x_im = _mm512_loadu_pd(v_im + e);
+#if defined(__FMA__)
+    const __m512d p_re = _mm512_fmsub_pd(vs_re, x_re, _mm512_mul_pd(vs_im, x_im));
+    const __m512d p_im = _mm512_fmadd_pd(vs_re, x_im, _mm512_mul_pd(vs_im, x_re));
+#else
+    // AVX-512 has fused multiply-adds which compilers may form from a product and a sum; masked sums are left
+    // alone, as the std::complex products of a build without FMA are
+    const __m512d p_re = _mm512_maskz_sub_pd(0xFF, _mm512_mul_pd(vs_re, x_re), _mm512_mul_pd(vs_im, x_im));
+    const __m512d p_im = _mm512_maskz_add_pd(0xFF, _mm512_mul_pd(vs_re, x_im), _mm512_mul_pd(vs_im, x_re));
+#endif
+    // masked gathers of all lanes, unmasked ones leave their source undefined to the compiler
+    const __m512d y_re = _mm512_mask_i32gather_pd(zero, 0xFF, vi, a_re, 8);
+    const __m512d y_im = _mm512_mask_i32gather_pd(zero, 0xFF, vi, a_im, 8);
+    _mm512_i32scatter_pd(a_re, vi, _mm512_add_pd(y_re, p_re), 8);
+    _mm512_i32scatter_pd(a_im, vi, _mm512_add_pd(y_im, p_im), 8);
+  }
+  return e;
+}
+
+// ScatterMultiplyAddAvx512 for vectors of 4: AVX2 has no scatter, sums of 4 entries are computed together and
+// stored one by one
+PPC_TARGET("avx2")
+inline size_t ScatterMultiplyAddAvx2(const int32_t *idx, size_t n, const double *v_re, const double *v_im,
+                                     double s_re, double s_im, double *a_re, double *a_im) {
+  const __m256d vs_re = _mm256_set1_pd(s_re);
+  const __m256d vs_im = _mm256_set1_pd(s_im);
+  const __m256d zero = _mm256_setzero_pd();
+  const __m256d all = _mm256_castsi256_pd(_mm256_set1_epi64x(-1));
+  alignas(32) double sum_re[4];
+  alignas(32) double sum_im[4];
+  size_t e = 0;
+  for (; e + 4 <= n; e += 4) {
+    const __m128i vi = _mm_loadu_si128(reinterpret_cast<const __m128i *>(idx + e));
+    const __m256d x_re = _mm256_loadu_pd(v_re + e);
+    const __m256d x_im = _mm256_loadu_pd(v_im + e);
+#if defined(__FMA__)
+    const __m256d p_re = _mm256_fmsub_pd(vs_re, x_re, _mm256_mul_pd(vs_im, x_im));
+    const __m256d p_im = _mm256_fmadd_pd(vs_re, x_im, _mm256_mul_pd(vs_im, x_re));
+#else
+    const __m256d p_re = _mm256_sub_pd(_mm256_mul_pd(vs_re, x_re), _mm256_mul_pd(vs_im, x_im));
+    const __m256d p_im = _mm256_add_pd(_mm256_mul_pd(vs_re, x_im), _mm256_mul_pd(vs_im, x_re));
+#endif
+    const __m256d y_re = _mm256_mask_i32gather_pd(zero, a_re, vi, all, 8);
+    const __m256d y_im = _mm256_mask_i32gather_pd(zero, a_im, vi, all, 8);
+    _mm256_store_pd(sum_re, _mm256_add_pd(y_re, p_re));
+    _mm256_store_pd(sum_im, _mm256_add_pd(y_im, p_im));
+    for (size_t lane = 0; lane < 4; lane++) {
+      a_re[idx[e + lane]] = sum_re[lane];
+      a_im[idx[e + lane]] = sum_im[lane];
+    }
+  }
+  return e;
+}
+
+#endif
+
+inline bool Kept(double re, double im, double min_norm) {
+  return !(((re * re) + (im * im)) < min_norm) && (re != 0.0 || im != 0.0);
+}
+
+// kernel of DrainNonZero on a block of kDrainBlock entries: bit l of the result is set if entry l is kept
+using KeptMaskFn = uint32_t (*)(const double *re, const double *im, double min_norm);
+
+inline uint32_t KeptMaskGeneric(const double *re, const double *im, double min_norm) {
+  uint32_t mask = 0;
+  for (size_t lane = 0; lane < kDrainBlock; lane++) {
+    const double norm = (re[lane] * re[lane]) + (im[lane] * im[lane]);
+    const bool below = norm < min_norm;
+    const bool non_zero = (re[lane] != 0.0) | (im[lane] != 0.0);
+    mask |= static_cast<uint32_t>(non_zero && !below) << lane;
+  }
+  return mask;
+}
+
+#ifdef PPC_X86_64
+
+inline uint32_t KeptMaskSse2(const double *re, const double *im, double min_norm) {
+  const __m128d zero = _mm_setzero_pd();
+  const __m128d v_min = _mm_set1_pd(min_norm);
+  uint32_t mask = 0;
+  for (size_t pair = 0; pair < 4; pair++) {
+    const __m128d x_re = _mm_load_pd(re + (2 * pair));
+    const __m128d x_im = _mm_load_pd(im + (2 * pair));
+    const __m128d norm = _mm_add_pd(_mm_mul_pd(x_re, x_re), _mm_mul_pd(x_im, x_im));
+    const __m128d non_zero = _mm_or_pd(_mm_cmpneq_pd(x_re, zero), _mm_cmpneq_pd(x_im, zero));
+    const __m128d kept = _mm_and_pd(_mm_cmpnlt_pd(norm, v_min), non_zero);
+    mask |= static_cast<uint32_t>(_mm_movemask_pd(kept)) << (2 * pair);
+  }
+  return mask;
+}
+
+PPC_TARGET("avx2")
+inline uint32_t KeptMaskAvx2(const double *re, const double *im, double min_norm) {
+  const __m256d zero = _mm256_setzero_pd();
+  const __m256d v_min = _mm256_set1_pd(min_norm);
+  uint32_t mask = 0;
+  for (size_t half = 0; half < 2; half++) {
+    const __m256d x_re = _mm256_load_pd(re + (4 * half));
+    const __m256d x_im = _mm256_load_pd(im + (4 * half));
+    const __m256d norm = _mm256_add_pd(_mm256_mul_pd(x_re, x_re), _mm256_mul_pd(x_im, x_im));
+    const __m256d non_zero =
+        _mm256_or_pd(_mm256_cmp_pd(x_re, zero, _CMP_NEQ_UQ), _mm256_cmp_pd(x_im, zero, _CMP_NEQ_UQ));
+    const __m256d kept = _mm256_and_pd(_mm256_cmp_pd(norm, v_min, _CMP_NLT_UQ), non_zero);
+    mask |= static_cast<uint32_t>(_mm256_movemask_pd(kept)) << (4 * half);
+  }
+  return mask;
+}
+
+PPC_TARGET("avx512f")
+inline uint32_t KeptMaskAvx512(const double *re, const double *im, double min_norm) {
+  const __m512d zero = _mm512_setzero_pd();
+  const __m512d x_re = _mm512_load_pd(re);
+  const __m512d x_im = _mm512_load_pd(im);
+  // not fused, as in ScatterMultiplyAddAvx512
+  const __m512d norm = _mm512_maskz_add_pd(0xFF, _mm512_mul_pd(x_re, x_re), _mm512_mul_pd(x_im, x_im));
+  return _mm512_cmp_pd_mask(norm, _mm512_set1_pd(min_norm), _CMP_NLT_UQ) &
+         (_mm512_cmp_pd_mask(x_re, zero, _CMP_NEQ_UQ) | _mm512_cmp_pd_mask(x_im, zero, _CMP_NEQ_UQ));
+}
+
+#endif
+
+// the widest KeptMask which this processor supports
+inline KeptMaskFn SelectKeptMask() {
+#ifdef PPC_X86_64
+  const auto &cpu = ppc::util::GetCpuFeatures();
+  if (cpu.avx512f) {
+    return KeptMaskAvx512;
+  }
+  if (cpu.avx2) {
+    return KeptMaskAvx2;
+  }
+  return KeptMaskSse2;
+#else
+  return KeptMaskGeneric;
+#endif
+}
+
+}  // namespace detail
+
+// Dense accumulator of a row (column) of a sparse product with a bitmap of its blocks of detail::kDrainBlock
+// entries that may be non-zero, so that draining it visits the touched blocks and not the whole width
+struct ComplexAccumulator : SplitComplex {
+  std::vector<uint64_t> touched;
+
+  ComplexAccumulator() = default;
+  explicit ComplexAccumulator(size_t size)
+      : SplitComplex(size),
+        touched((((size + detail::kDrainBlock - 1) / detail::kDrainBlock) + detail::kBlocksPerWord - 1) /
+                detail::kBlocksPerWord) {}
+
+  // mark the block of entry i, entries of unmarked blocks must stay zero
+  void Touch(size_t i) {
+    const size_t block = i / detail::kDrainBlock;
+    touched[block / detail::kBlocksPerWord] |= uint64_t{1} << (block % detail::kBlocksPerWord);
+  }
+};
+
+// acc[indices[e]] += scale * values[first + e] for every e: a column of a sparse matrix scaled into a dense
+// accumulator. indices are distinct, as in a column of a sparse matrix.
+template <typename Index>
+void ScatterMultiplyAdd(std::span<const Index> indices, const SplitComplex &values, size_t first,
+                        std::complex<double> scale, ComplexAccumulator &acc) {
+  const size_t n = indices.size();
+  const Index *idx = indices.data();
+  const double *v_re = values.re.data() + first;
+  const double *v_im = values.im.data() + first;
+  double *a_re = acc.re.data();
+  double *a_im = acc.im.data();
+  const double s_re = scale.real();
+  const double s_im = scale.imag();
+  for (size_t e = 0; e < n; e++) {
+    acc.Touch(static_cast<size_t>(idx[e]));
+  }
+  size_t e = 0;
+#ifdef PPC_X86_64
+  if constexpr (sizeof(Index) == 4) {
+    // the gathers take signed 32-bit indices, which the indices of a dense accumulator fit
+    const auto *idx32 = reinterpret_cast<const int32_t *>(idx);
+    const auto &cpu = ppc::util::GetCpuFeatures();
+    if (cpu.avx512f) {
+      e = detail::ScatterMultiplyAddAvx512(idx32, n, v_re, v_im, s_re, s_im, a_re, a_im);
+    } else if (cpu.avx2) {
+      e = detail::ScatterMultiplyAddAvx2(idx32, n, v_re, v_im, s_re, s_im, a_re, a_im);
+    }
+  }
+#endif
+  for (; e < n; e++) {
+    const auto i = static_cast<size_t>(idx[e]);
+#if defined(__FMA__)
+    a_re[i] += std::fma(s_re, v_re[e], -(s_im * v_im[e]));
+    a_im[i] += std::fma(s_re, v_im[e], s_im * v_re[e]);
+#else
+    a_re[i] += (s_re * v_re[e]) - (s_im * v_im[e]);
+    a_im[i] += (s_re * v_im[e]) + (s_im * v_re[e]);
+#endif
+  }
+}
+
+// Calls emit(i, acc[i]) in increasing i for the entries of acc which are not zero and whose squared magnitude is
+// not below min_norm, then sets all of acc to zero. With min_norm = 0 only exact zeros are dropped.
+// Only the touched blocks are tested, a block by about one vector comparison, so a sparse result costs its
+// touched blocks and a pass over the bitmap rather than a pass over the whole accumulator.
+template <typename Emit>
+void DrainNonZero(ComplexAccumulator &acc, double min_norm, const Emit &emit) {
+  const size_t n = acc.Size();
+  double *a_re = acc.re.data();
+  double *a_im = acc.im.data();
+  const detail::KeptMaskFn kept_mask = detail::SelectKeptMask();
+  for (size_t word = 0; word < acc.touched.size(); word++) {
+    for (uint64_t blocks = acc.touched[word]; blocks != 0; blocks &= blocks - 1) {
+      const size_t block = (word * detail::kBlocksPerWord) + static_cast<size_t>(std::countr_zero(blocks));
+      const size_t i = block * detail::kDrainBlock;
+      if (i + detail::kDrainBlock <= n) {
+        for (uint32_t mask = kept_mask(a_re + i, a_im + i, min_norm); mask != 0; mask &= mask - 1) {
+          const size_t j = i + static_cast<size_t>(std::countr_zero(mask));
+          emit(j, std::complex<double>(a_re[j], a_im[j]));
+        }
+        std::fill_n(a_re + i, detail::kDrainBlock, 0.0);
+        std::fill_n(a_im + i, detail::kDrainBlock, 0.0);
+        continue;
+      }
+      for (size_t j = i; j < n; j++) {
+        if (detail::Kept(a_re[j], a_im[j], min_norm)) {
+          emit(j, std::complex<double>(a_re[j], a_im[j]));
+        }
+        a_re[j] = 0.0;
+        a_im[j] = 0.0;
+      }
+    }
+    acc.touched[word] = 0;
+  }
+}
+
+}  // namespace ppc::core::sparse
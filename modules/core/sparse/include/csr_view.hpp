@@ -0,0 +1,69 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace ppc::core::sparse {
+
+// CSR arrays of a matrix read in place. The CCS arrays of a matrix are the CSR arrays of its transpose.
+template <typename Index, typename Value>
+struct CsrView {
+  std::span<const Index> offsets;  // num_rows + 1 entries starting with 0
+  std::span<const Index> indices;  // column of every entry
+  std::span<const Value> values;
+  size_t num_cols = 0;
+
+  [[nodiscard]] size_t NumRows() const { return offsets.empty() ? 0 : offsets.size() - 1; }
+  [[nodiscard]] size_t NumEntries() const { return offsets.empty() ? 0 : static_cast<size_t>(offsets.back()); }
+  // entries [RowBegin(i), RowEnd(i)) form row i
+  [[nodiscard]] size_t RowBegin(size_t i) const { return static_cast<size_t>(offsets[i]); }
+  [[nodiscard]] size_t RowEnd(size_t i) const { return static_cast<size_t>(offsets[i + 1]); }
+};
+
+template <typename Index, typename Value>
+struct CsrArrays {
+  std::vector<Index> offsets;
+  std::vector<Index> indices;
+  std::vector<Value> values;
+};
+
+namespace detail {
+
+// body(chunk) for every chunk of [0, num_chunks) through parallel_for(begin, end, body(chunk_begin, chunk_end))
+template <typename ParallelFor, typename Body>
+void ForEachChunk(size_t num_chunks, const ParallelFor &parallel_for, const Body &body) {
+  parallel_for(0, num_chunks, [&](size_t chunk_begin, size_t chunk_end) {
+    for (size_t chunk = chunk_begin; chunk < chunk_end; chunk++) {
+      body(chunk);
+    }
+  });
+}
+
+// chunk c of [0, n) is [bounds[c], bounds[c + 1]), chunks differ in size by at most one
+inline std::vector<size_t> EvenBounds(size_t n, size_t num_chunks) {
+  std::vector<size_t> bounds(num_chunks + 1);
+  for (size_t chunk = 0; chunk <= num_chunks; chunk++) {
+    bounds[chunk] = n * chunk / num_chunks;
+  }
+  return bounds;
+}
+
+// chunks of [0, n) with about equal weights: prefix holds n + 1 increasing sums of weights starting with 0
+template <typename T>
+std::vector<size_t> BalancedBounds(std::span<const T> prefix, size_t num_chunks) {
+  const size_t n = prefix.size() - 1;
+  const auto total = static_cast<size_t>(prefix.back());
+  std::vector<size_t> bounds(num_chunks + 1, n);
+  for (size_t chunk = 0; chunk < num_chunks; chunk++) {
+    const size_t target = total / num_chunks * chunk + total % num_chunks * chunk / num_chunks;
+    const auto first = std::ranges::lower_bound(prefix, target, {}, [](T x) { return static_cast<size_t>(x); });
+    bounds[chunk] = std::min(static_cast<size_t>(first - prefix.begin()), n);
+  }
+  return bounds;
+}
+
+}  // namespace detail
+
+}  // namespace ppc::core::sparse
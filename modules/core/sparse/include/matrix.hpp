@@ -0,0 +1,303 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <numeric>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "core/sparse/include/csr_view.hpp"
+#include "core/util/include/aligned_allocator.hpp"
+
+namespace ppc::core::sparse {
+
+// Sparse matrices own their arrays (structure of arrays, every array aligned to a cache line). Index is the
+// integer type of offsets and indices, e.g. uint32_t or int64_t, Value is real or std::complex.
+// Algorithms split their work into num_chunks ranges, which run as parallel_for(0, num_chunks, body) calls
+// body(chunk_begin, chunk_end) for chunks covering the range.
+
+// CSR: offsets has num_rows + 1 entries, indices are columns, increasing in every row
+template <typename Index, typename Value>
+struct CsrMatrix {
+  size_t num_rows = 0;
+  size_t num_cols = 0;
+  ppc::util::AlignedVector<Index> offsets;
+  ppc::util::AlignedVector<Index> indices;
+  ppc::util::AlignedVector<Value> values;
+
+  [[nodiscard]] CsrView<Index, Value> View() const {
+    return {.offsets = offsets, .indices = indices, .values = values, .num_cols = num_cols};
+  }
+};
+
+// CCS: offsets has num_cols + 1 entries, indices are rows, increasing in every column
+template <typename Index, typename Value>
+struct CcsMatrix {
+  size_t num_rows = 0;
+  size_t num_cols = 0;
+  ppc::util::AlignedVector<Index> offsets;
+  ppc::util::AlignedVector<Index> indices;
+  ppc::util::AlignedVector<Value> values;
+
+  // CSR view of the transpose, which has the same arrays
+  [[nodiscard]] CsrView<Index, Value> TransposedView() const {
+    return {.offsets = offsets, .indices = indices, .values = values, .num_cols = num_rows};
+  }
+};
+
+// COO: entry e is at (rows[e], cols[e]) with any order of entries; entries at the same position are summed
+template <typename Index, typename Value>
+struct CooMatrix {
+  size_t num_rows = 0;
+  size_t num_cols = 0;
+  ppc::util::AlignedVector<Index> rows;
+  ppc::util::AlignedVector<Index> cols;
+  ppc::util::AlignedVector<Value> values;
+};
+
+// t = transpose of m, which turns CSR arrays into CCS arrays of the same matrix and back. t_offsets has
+// m.num_cols + 1 entries, t_indices and t_values have an entry per entry of m; rows of t are sorted.
+// Every chunk of rows of m counts its entries per column first, so the entries are moved to their places
+// without synchronization; chunks are limited to keep these counters within the count of entries.
+// Throws std::invalid_argument if sizes of the output do not match m.
+template <typename Index, typename Value, typename ParallelFor>
+void Transpose(const CsrView<Index, Value> &m, std::span<Index> t_offsets, std::span<Index> t_indices,
+               std::span<Value> t_values, size_t num_chunks, const ParallelFor &parallel_for);
+
+template <typename Index, typename Value, typename ParallelFor>
+CcsMatrix<Index, Value> ToCcs(const CsrMatrix<Index, Value> &m, size_t num_chunks, const ParallelFor &parallel_for);
+
+template <typename Index, typename Value, typename ParallelFor>
+CsrMatrix<Index, Value> ToCsr(const CcsMatrix<Index, Value> &m, size_t num_chunks, const ParallelFor &parallel_for);
+
+// Entries of a row-major dense matrix which are not zero.
+// Throws std::invalid_argument if dense does not have num_rows * num_cols elements, std::overflow_error if
+// Index does not hold the count of entries.
+template <typename Index, typename Value, typename ParallelFor>
+CsrMatrix<Index, Value> CsrFromDense(std::span<const Value> dense, size_t num_rows, size_t num_cols,
+                                     size_t num_chunks, const ParallelFor &parallel_for);
+
+template <typename Index, typename Value, typename ParallelFor>
+CcsMatrix<Index, Value> CcsFromDense(std::span<const Value> dense, size_t num_rows, size_t num_cols,
+                                     size_t num_chunks, const ParallelFor &parallel_for);
+
+// Entries at the same position are summed in their order in m, the sum is kept even if it is zero.
+// Throws std::invalid_argument if arrays of m differ in size or an entry is out of the matrix.
+template <typename Index, typename Value, typename ParallelFor>
+CsrMatrix<Index, Value> CsrFromCoo(const CooMatrix<Index, Value> &m, size_t num_chunks,
+                                   const ParallelFor &parallel_for);
+
+template <typename Index, typename Value, typename ParallelFor>
+void Transpose(const CsrView<Index, Value> &m, std::span<Index> t_offsets, std::span<Index> t_indices,
+               std::span<Value> t_values, size_t num_chunks, const ParallelFor &parallel_for) {
+  const size_t num_cols = m.num_cols;
+  const size_t num_entries = m.NumEntries();
+  if (t_offsets.size() != num_cols + 1 || t_indices.size() != num_entries || t_values.size() != num_entries) {
+    throw std::invalid_argument("Transpose needs num_cols + 1 offsets and an index and a value per entry");
+  }
+  num_chunks = std::clamp<size_t>(num_chunks, 1, std::max<size_t>(num_entries / std::max<size_t>(num_cols, 1), 1));
+  const std::vector<size_t> bounds = detail::BalancedBounds(m.offsets, num_chunks);
+
+  // positions[chunk * num_cols + col]: entries of the chunk in the column, then the place of the next one
+  std::vector<size_t> positions(num_chunks * num_cols, 0);
+  detail::ForEachChunk(num_chunks, parallel_for, [&](size_t chunk) {
+    size_t *counts = positions.data() + (chunk * num_cols);
+    for (size_t e = m.RowBegin(bounds[chunk]); e < m.RowBegin(bounds[chunk + 1]); e++) {
+      counts[static_cast<size_t>(m.indices[e])]++;
+    }
+  });
+  std::vector<size_t> col_sizes(num_cols + 1, 0);
+  const std::vector<size_t> col_bounds = detail::EvenBounds(num_cols, num_chunks);
+  detail::ForEachChunk(num_chunks, parallel_for, [&](size_t col_chunk) {
+    for (size_t col = col_bounds[col_chunk]; col < col_bounds[col_chunk + 1]; col++) {
+      for (size_t chunk = 0; chunk < num_chunks; chunk++) {
+        col_sizes[col + 1] += positions[(chunk * num_cols) + col];
+      }
+    }
+  });
+  std::inclusive_scan(col_sizes.begin(), col_sizes.end(), col_sizes.begin());
+  detail::ForEachChunk(num_chunks, parallel_for, [&](size_t col_chunk) {
+    for (size_t col = col_bounds[col_chunk]; col < col_bounds[col_chunk + 1]; col++) {
+      size_t position = col_sizes[col];
+      for (size_t chunk = 0; chunk < num_chunks; chunk++) {
+        position += std::exchange(positions[(chunk * num_cols) + col], position);
+      }
+    }
+  });
+  std::ranges::transform(col_sizes, t_offsets.begin(), [](size_t offset) { return static_cast<Index>(offset); });
+
+  detail::ForEachChunk(num_chunks, parallel_for, [&](size_t chunk) {
+    size_t *next = positions.data() + (chunk * num_cols);
+    for (size_t i = bounds[chunk]; i < bounds[chunk + 1]; i++) {
+      for (size_t e = m.RowBegin(i); e < m.RowEnd(i); e++) {
+        const size_t position = next[static_cast<size_t>(m.indices[e])]++;
+        t_indices[position] = static_cast<Index>(i);
+        t_values[position] = m.values[e];
+      }
+    }
+  });
+}
+
+namespace detail {
+
+// t gets the arrays of the transpose of m, num_rows and num_cols of t are kept
+template <typename Index, typename Value, typename Matrix, typename ParallelFor>
+void TransposeInto(const CsrView<Index, Value> &m, Matrix &t, size_t num_chunks, const ParallelFor &parallel_for) {
+  t.offsets.resize(m.num_cols + 1);
+  t.indices.resize(m.NumEntries());
+  t.values.resize(m.NumEntries());
+  Transpose(m, std::span(t.offsets), std::span(t.indices), std::span(t.values), num_chunks, parallel_for);
+}
+
+}  // namespace detail
+
+template <typename Index, typename Value, typename ParallelFor>
+CcsMatrix<Index, Value> ToCcs(const CsrMatrix<Index, Value> &m, size_t num_chunks, const ParallelFor &parallel_for) {
+  CcsMatrix<Index, Value> res;
+  res.num_rows = m.num_rows;
+  res.num_cols = m.num_cols;
+  detail::TransposeInto(m.View(), res, num_chunks, parallel_for);
+  return res;
+}
+
+template <typename Index, typename Value, typename ParallelFor>
+CsrMatrix<Index, Value> ToCsr(const CcsMatrix<Index, Value> &m, size_t num_chunks, const ParallelFor &parallel_for) {
+  CsrMatrix<Index, Value> res;
+  res.num_rows = m.num_rows;
+  res.num_cols = m.num_cols;
+  detail::TransposeInto(m.TransposedView(), res, num_chunks, parallel_for);
+  return res;
+}
+
+template <typename Index, typename Value, typename ParallelFor>
+CsrMatrix<Index, Value> CsrFromDense(std::span<const Value> dense, size_t num_rows, size_t num_cols,
+                                     size_t num_chunks, const ParallelFor &parallel_for) {
+  if (dense.size() != num_rows * num_cols) {
+    throw std::invalid_argument("Dense matrix needs num_rows * num_cols elements");
+  }
+  num_chunks = std::max<size_t>(num_chunks, 1);
+  const std::vector<size_t> bounds = detail::EvenBounds(num_rows, num_chunks);
+  auto row_of = [&](size_t i) { return dense.subspan(i * num_cols, num_cols); };
+
+  std::vector<size_t> offsets(num_rows + 1, 0);
+  detail::ForEachChunk(num_chunks, parallel_for, [&](size_t chunk) {
+    for (size_t i = bounds[chunk]; i < bounds[chunk + 1]; i++) {
+      const auto non_zero = std::ranges::count_if(row_of(i), [](const Value &x) { return x != Value{}; });
+      offsets[i + 1] = static_cast<size_t>(non_zero);
+    }
+  });
+  std::inclusive_scan(offsets.begin(), offsets.end(), offsets.begin());
+  if (offsets.back() > static_cast<size_t>(std::numeric_limits<Index>::max())) {
+    throw std::overflow_error("Sparse matrix has more entries than its index type can address");
+  }
+
+  CsrMatrix<Index, Value> res;
+  res.num_rows = num_rows;
+  res.num_cols = num_cols;
+  res.offsets.resize(num_rows + 1);
+  res.indices.resize(offsets.back());
+  res.values.resize(offsets.back());
+  std::ranges::transform(offsets, res.offsets.begin(), [](size_t offset) { return static_cast<Index>(offset); });
+  detail::ForEachChunk(num_chunks, parallel_for, [&](size_t chunk) {
+    for (size_t i = bounds[chunk]; i < bounds[chunk + 1]; i++) {
+      size_t position = offsets[i];
+      const auto row = row_of(i);
+      for (size_t j = 0; j < num_cols; j++) {
+        if (row[j] != Value{}) {
+          res.indices[position] = static_cast<Index>(j);
+          res.values[position] = row[j];
+          position++;
+        }
+      }
+    }
+  });
+  return res;
+}
+
+template <typename Index, typename Value, typename ParallelFor>
+CcsMatrix<Index, Value> CcsFromDense(std::span<const Value> dense, size_t num_rows, size_t num_cols,
+                                     size_t num_chunks, const ParallelFor &parallel_for) {
+  return ToCcs(CsrFromDense<Index>(dense, num_rows, num_cols, num_chunks, parallel_for), num_chunks, parallel_for);
+}
+
+template <typename Index, typename Value, typename ParallelFor>
+CsrMatrix<Index, Value> CsrFromCoo(const CooMatrix<Index, Value> &m, size_t num_chunks,
+                                   const ParallelFor &parallel_for) {
+  const size_t num_entries = m.values.size();
+  if (m.rows.size() != num_entries || m.cols.size() != num_entries) {
+    throw std::invalid_argument("COO matrix needs a row and a column per value");
+  }
+  auto outside = [&](size_t e) {
+    return static_cast<size_t>(m.rows[e]) >= m.num_rows || static_cast<size_t>(m.cols[e]) >= m.num_cols;
+  };
+  if (std::ranges::any_of(std::views::iota(size_t{0}, num_entries), outside)) {
+    throw std::invalid_argument("COO matrix has an entry outside of it");
+  }
+  if (num_entries > static_cast<size_t>(std::numeric_limits<Index>::max())) {
+    throw std::overflow_error("Sparse matrix has more entries than its index type can address");
+  }
+  num_chunks = std::max<size_t>(num_chunks, 1);
+
+  // entries are bucketed by rows as the transpose of the matrix with entry e at (e, rows[e]):
+  // row i of the transpose lists the entries of row i in their order
+  std::vector<Index> single(num_entries + 1);
+  std::iota(single.begin(), single.end(), Index{0});
+  std::vector<Index> row_offsets(m.num_rows + 1);
+  std::vector<Index> entries(num_entries);
+  std::vector<Value> values(num_entries);
+  const CsrView<Index, Value> by_entry{
+      .offsets = single, .indices = m.rows, .values = m.values, .num_cols = m.num_rows};
+  Transpose(by_entry, std::span(row_offsets), std::span(entries), std::span(values), num_chunks, parallel_for);
+
+  // rows are sorted by columns in place, then entries at the same column are summed
+  const std::vector<size_t> bounds = detail::BalancedBounds(std::span<const Index>(row_offsets), num_chunks);
+  std::vector<size_t> offsets(m.num_rows + 1, 0);
+  detail::ForEachChunk(num_chunks, parallel_for, [&](size_t chunk) {
+    std::vector<std::pair<Index, Value>> row;
+    for (size_t i = bounds[chunk]; i < bounds[chunk + 1]; i++) {
+      const auto begin = static_cast<size_t>(row_offsets[i]);
+      const auto end = static_cast<size_t>(row_offsets[i + 1]);
+      row.clear();
+      for (size_t k = begin; k < end; k++) {
+        row.emplace_back(m.cols[static_cast<size_t>(entries[k])], values[k]);
+      }
+      std::ranges::stable_sort(row, {}, &std::pair<Index, Value>::first);
+      size_t size = 0;
+      for (size_t k = 0; k < row.size(); k++) {
+        if (size > 0 && entries[begin + size - 1] == row[k].first) {
+          values[begin + size - 1] += row[k].second;
+        } else {
+          entries[begin + size] = row[k].first;
+          values[begin + size] = row[k].second;
+          size++;
+        }
+      }
+      offsets[i + 1] = size;
+    }
+  });
+  std::inclusive_scan(offsets.begin(), offsets.end(), offsets.begin());
+
+  CsrMatrix<Index, Value> res;
+  res.num_rows = m.num_rows;
+  res.num_cols = m.num_cols;
+  res.offsets.resize(m.num_rows + 1);
+  res.indices.resize(offsets.back());
+  res.values.resize(offsets.back());
+  std::ranges::transform(offsets, res.offsets.begin(), [](size_t offset) { return static_cast<Index>(offset); });
+  detail::ForEachChunk(num_chunks, parallel_for, [&](size_t chunk) {
+    for (size_t i = bounds[chunk]; i < bounds[chunk + 1]; i++) {
+      const auto from = static_cast<std::ptrdiff_t>(row_offsets[i]);
+      const auto count = static_cast<std::ptrdiff_t>(offsets[i + 1] - offsets[i]);
+      const auto to = static_cast<std::ptrdiff_t>(offsets[i]);
+      std::copy_n(entries.begin() + from, count, res.indices.begin() + to);
+      std::copy_n(values.begin() + from, count, res.values.begin() + to);
+    }
+  });
+  return res;
+}
+
+}  // namespace ppc::core::sparse
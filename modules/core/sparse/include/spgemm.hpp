@@ -0,0 +1,265 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include "core/sparse/include/csr_view.hpp"
+
+namespace ppc::core::sparse {
+
+// Entries of a product to store: every entry which has a term, or only entries which are not exactly zero
+struct KeepAll {
+  template <typename Value>
+  bool operator()(const Value & /*value*/) const {
+    return true;
+  }
+};
+struct KeepNonZero {
+  template <typename Value>
+  bool operator()(const Value &value) const {
+    return value != Value{};
+  }
+};
+
+// Accumulators of rows narrower than this are dense arrays, wider rows use a hash table unless they are dense
+constexpr size_t kDenseAccumulatorColumns = size_t{1} << 18;
+
+// c = a * b by rows (Gustavson): row i of c sums the rows k of b scaled by a(i, k) in a sparse accumulator.
+// Every product is computed once: the entries kept by keep(value) are written to a buffer of the chunk of
+// rows, then the buffers are copied to c one after another. Columns in rows of c are increasing, a row of a
+// with increasing columns sums its terms in the order of k.
+// Rows are split into num_chunks ranges with equal counts of multiplications, which run as
+// parallel_for(0, num_chunks, body) calls body(chunk_begin, chunk_end) for chunks covering the range;
+// a chunk allocates one accumulator.
+// c has offsets, indices and values vectors (CsrArrays, CsrMatrix of matrix.hpp) which are overwritten.
+// For CCS matrices, the CCS arrays of a * b are the result of Multiply(b, a) with their CCS arrays.
+// Throws std::invalid_argument if a.num_cols differs from the count of rows of b, std::overflow_error if
+// the count of entries of c does not fit Index.
+template <typename Index, typename Value, typename Arrays, typename Keep, typename ParallelFor>
+void Multiply(const CsrView<Index, Value> &a, const CsrView<Index, Value> &b, Arrays &c, const Keep &keep,
+              size_t num_chunks, const ParallelFor &parallel_for);
+
+namespace detail {
+
+// a slot per column, the touched columns are sorted when the row is written. Slots are zero between rows,
+// so adding a term does not branch on whether its column is new.
+template <typename Index, typename Value>
+class DenseAccumulator {
+ public:
+  explicit DenseAccumulator(size_t num_cols)
+      : values_(num_cols), used_(num_cols, 0), touched_(std::make_unique_for_overwrite<Index[]>(num_cols + 1)) {}
+
+  // adds scale * row to the row being summed; members are read into locals since stores to used_ may alias them
+  void AddScaled(std::span<const Index> cols, std::span<const Value> row, const Value &scale) {
+    Value *values = values_.data();
+    if (size_ == values_.size()) {
+      // every column is touched already, which is common when c is dense
+      for (size_t j = 0; j < cols.size(); j++) {
+        values[cols[j]] += scale * row[j];
+      }
+      return;
+    }
+    uint8_t *used = used_.data();
+    Index *touched = touched_.get();
+    size_t size = size_;
+    for (size_t j = 0; j < cols.size(); j++) {
+      const Index col = cols[j];
+      touched[size] = col;
+      size += used[col] ^ 1U;
+      used[col] = 1;
+      values[col] += scale * row[j];
+    }
+    size_ = size;
+  }
+
+  // kept entries in increasing columns, their count; the accumulator is empty after that
+  template <typename Keep>
+  size_t Flush(Index *cols, Value *values, const Keep &keep) {
+    if (size_ < values_.size()) {
+      std::sort(touched_.get(), touched_.get() + size_);
+    } else {
+      std::iota(touched_.get(), touched_.get() + size_, Index{0});
+    }
+    size_t count = 0;
+    for (size_t t = 0; t < size_; t++) {
+      const Index col = touched_[t];
+      used_[col] = 0;
+      if (keep(values_[col])) {
+        cols[count] = col;
+        values[count] = values_[col];
+        count++;
+      }
+      values_[col] = Value{};
+    }
+    size_ = 0;
+    return count;
+  }
+
+ private:
+  std::vector<Value> values_;
+  std::vector<uint8_t> used_;
+  std::unique_ptr<Index[]> touched_;  // a spare slot takes the unconditional store of a full row
+  size_t size_ = 0;
+};
+
+// open addressing with linear probing, at most half full for rows of up to max_row_terms terms
+template <typename Index, typename Value>
+class HashAccumulator {
+ public:
+  explicit HashAccumulator(size_t max_row_terms)
+      : shift_(64 - std::countr_zero(std::bit_ceil(std::max<size_t>(2 * max_row_terms, 16)))),
+        keys_(size_t{1} << (64 - shift_), kEmpty),
+        values_(keys_.size()) {}
+
+  void AddScaled(std::span<const Index> cols, std::span<const Value> row, const Value &scale) {
+    for (size_t j = 0; j < cols.size(); j++) {
+      const size_t slot = Find(cols[j]);
+      if (keys_[slot] == kEmpty) {
+        keys_[slot] = cols[j];
+        touched_.push_back(slot);
+        values_[slot] = scale * row[j];
+      } else {
+        values_[slot] += scale * row[j];
+      }
+    }
+  }
+
+  template <typename Keep>
+  size_t Flush(Index *cols, Value *values, const Keep &keep) {
+    std::ranges::sort(touched_, {}, [this](size_t slot) { return keys_[slot]; });
+    size_t count = 0;
+    for (const size_t slot : touched_) {
+      if (keep(values_[slot])) {
+        cols[count] = keys_[slot];
+        values[count] = values_[slot];
+        count++;
+      }
+      keys_[slot] = kEmpty;
+    }
+    touched_.clear();
+    return count;
+  }
+
+ private:
+  static constexpr Index kEmpty = std::numeric_limits<Index>::max();
+
+  [[nodiscard]] size_t Find(Index col) const {
+    const size_t mask = keys_.size() - 1;
+    // Fibonacci hashing spreads consecutive columns over the table
+    size_t slot = static_cast<size_t>((static_cast<uint64_t>(col) * 0x9E3779B97F4A7C15ULL) >> shift_);
+    while (keys_[slot] != kEmpty && keys_[slot] != col) {
+      slot = (slot + 1) & mask;
+    }
+    return slot;
+  }
+
+  int shift_;
+  std::vector<Index> keys_;
+  std::vector<Value> values_;
+  std::vector<size_t> touched_;
+};
+
+// calls fn(accumulator) with the accumulator suited for rows of b.num_cols columns and up to max_row_terms terms
+template <typename Index, typename Value, typename Fn>
+void WithAccumulator(size_t num_cols, size_t max_row_terms, const Fn &fn) {
+  if (num_cols <= kDenseAccumulatorColumns || num_cols <= 8 * max_row_terms) {
+    DenseAccumulator<Index, Value> accumulator(num_cols);
+    fn(accumulator);
+  } else {
+    HashAccumulator<Index, Value> accumulator(max_row_terms);
+    fn(accumulator);
+  }
+}
+
+}  // namespace detail
+
+template <typename Index, typename Value, typename Arrays, typename Keep, typename ParallelFor>
+void Multiply(const CsrView<Index, Value> &a, const CsrView<Index, Value> &b, Arrays &c, const Keep &keep,
+              size_t num_chunks, const ParallelFor &parallel_for) {
+  if (a.num_cols != b.NumRows()) {
+    throw std::invalid_argument("Sparse product needs as many columns of the left matrix as rows of the right one");
+  }
+  const size_t num_rows = a.NumRows();
+  num_chunks = std::max<size_t>(num_chunks, 1);
+
+  // multiplications of every row, rows are split by them since row lengths of real matrices vary a lot
+  const std::vector<size_t> even_bounds = detail::EvenBounds(num_rows, num_chunks);
+  std::vector<size_t> terms(num_rows + 1, 0);
+  detail::ForEachChunk(num_chunks, parallel_for, [&](size_t chunk) {
+    for (size_t i = even_bounds[chunk]; i < even_bounds[chunk + 1]; i++) {
+      size_t count = 0;
+      for (size_t e = a.RowBegin(i); e < a.RowEnd(i); e++) {
+        count += b.RowEnd(a.indices[e]) - b.RowBegin(a.indices[e]);
+      }
+      terms[i + 1] = count;
+    }
+  });
+  std::inclusive_scan(terms.begin(), terms.end(), terms.begin());
+  const std::vector<size_t> bounds = detail::BalancedBounds(std::span<const size_t>(terms), num_chunks);
+  std::vector<size_t> max_terms(num_chunks, 0);
+  for (size_t chunk = 0; chunk < num_chunks; chunk++) {
+    for (size_t i = bounds[chunk]; i < bounds[chunk + 1]; i++) {
+      max_terms[chunk] = std::max(max_terms[chunk], terms[i + 1] - terms[i]);
+    }
+  }
+
+  // numeric phase: a chunk has room for all terms of its rows, but at most b.num_cols per row
+  struct ChunkBuffer {
+    std::unique_ptr<Index[]> indices;
+    std::unique_ptr<Value[]> values;
+  };
+  std::vector<ChunkBuffer> buffers(num_chunks);
+  std::vector<size_t> offsets(num_rows + 1, 0);
+  detail::ForEachChunk(num_chunks, parallel_for, [&](size_t chunk) {
+    if (bounds[chunk] == bounds[chunk + 1]) {
+      return;
+    }
+    size_t capacity = 0;
+    for (size_t i = bounds[chunk]; i < bounds[chunk + 1]; i++) {
+      capacity += std::min(terms[i + 1] - terms[i], b.num_cols);
+    }
+    auto &buffer = buffers[chunk];
+    buffer.indices = std::make_unique_for_overwrite<Index[]>(capacity);
+    buffer.values = std::make_unique_for_overwrite<Value[]>(capacity);
+    detail::WithAccumulator<Index, Value>(b.num_cols, max_terms[chunk], [&](auto &accumulator) {
+      size_t size = 0;
+      for (size_t i = bounds[chunk]; i < bounds[chunk + 1]; i++) {
+        for (size_t e = a.RowBegin(i); e < a.RowEnd(i); e++) {
+          const Index k = a.indices[e];
+          const size_t row_begin = b.RowBegin(k);
+          const size_t row_size = b.RowEnd(k) - row_begin;
+          accumulator.AddScaled(b.indices.subspan(row_begin, row_size), b.values.subspan(row_begin, row_size),
+                                a.values[e]);
+        }
+        offsets[i + 1] = accumulator.Flush(buffer.indices.get() + size, buffer.values.get() + size, keep);
+        size += offsets[i + 1];
+      }
+    });
+  });
+  std::inclusive_scan(offsets.begin(), offsets.end(), offsets.begin());
+  if (offsets.back() > static_cast<size_t>(std::numeric_limits<Index>::max())) {
+    throw std::overflow_error("Sparse product has more entries than its index type can address");
+  }
+
+  c.indices.resize(offsets.back());
+  c.values.resize(offsets.back());
+  detail::ForEachChunk(num_chunks, parallel_for, [&](size_t chunk) {
+    const size_t begin = offsets[bounds[chunk]];
+    const size_t count = offsets[bounds[chunk + 1]] - begin;
+    std::copy_n(buffers[chunk].indices.get(), count, c.indices.begin() + static_cast<std::ptrdiff_t>(begin));
+    std::copy_n(buffers[chunk].values.get(), count, c.values.begin() + static_cast<std::ptrdiff_t>(begin));
+    buffers[chunk] = {};
+  });
+  c.offsets.resize(num_rows + 1);
+  std::ranges::transform(offsets, c.offsets.begin(), [](size_t offset) { return static_cast<Index>(offset); });
+}
+
+}  // namespace ppc::core::sparse
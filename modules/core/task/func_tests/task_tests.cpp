@@ -1,8 +1,13 @@
 #include <gtest/gtest.h>
 
+#include <array>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <limits>
 #include <memory>
+#include <stdexcept>
+#include <utility>
 #include <vector>
 
 #include "core/task/func_tests/test_task.hpp"
@@ -182,3 +187,283 @@ int main(int argc, char **argv) {
   testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
 }
+
+TEST(task_tests, check_task_data_spans) {
+  std::vector<int32_t> in(20, 1);
+  std::vector<int32_t> out(1, 0);
+
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  task_data->inputs_count.emplace_back(in.size());
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  task_data->outputs_count.emplace_back(out.size());
+
+  auto input = task_data->GetInput<const int32_t>(0);
+  ASSERT_EQ(input.size(), in.size());
+  EXPECT_EQ(input.data(), in.data());
+
+  auto output = task_data->GetOutput<int32_t>(0);
+  output[0] = 5;
+  EXPECT_EQ(out[0], 5);
+
+  EXPECT_THROW((void)task_data->GetInput<int32_t>(1), std::out_of_range);
+  EXPECT_THROW((void)task_data->GetOutput<int32_t>(3), std::out_of_range);
+
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()) + 1);
+  task_data->inputs_count.emplace_back(1);
+  EXPECT_THROW((void)task_data->GetInput<int32_t>(1), std::invalid_argument);
+}
+
+TEST(task_tests, check_task_data_move_in_move_out) {
+  std::vector<int32_t> in(20, 1);
+  const auto *in_ptr = in.data();
+
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->EmplaceInput(std::move(in));
+  task_data->EmplaceOutput(std::vector<int32_t>(1, 0));
+  ASSERT_EQ(task_data->inputs_count[0], 20U);
+  EXPECT_EQ(reinterpret_cast<const int32_t *>(task_data->inputs[0]), in_ptr);
+
+  ppc::test::task::TestTask<int32_t> test_task(task_data);
+  ASSERT_TRUE(test_task.Validation());
+  test_task.PreProcessing();
+  test_task.Run();
+  test_task.PostProcessing();
+
+  EXPECT_THROW((void)task_data->TakeOutput<double>(0), std::invalid_argument);
+  auto out = task_data->TakeOutput<int32_t>(0);
+  ASSERT_EQ(out.size(), 1U);
+  EXPECT_EQ(out[0], 20);
+  EXPECT_EQ(task_data->outputs[0], nullptr);
+  EXPECT_EQ(task_data->outputs_count[0], 0U);
+}
+
+TEST(task_tests, check_task_data_typed_views) {
+  std::vector<double> in(12, 1.0);
+  std::vector<double> out(4, 0.0);
+
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->AddInput(in.data(), std::array<uint64_t, 2>{3, 4});
+  task_data->AddOutput(out.data(), std::array<uint64_t, 1>{4});
+  ASSERT_TRUE(task_data->HasInputInfo(0));
+  EXPECT_EQ(task_data->inputs_count[0], 12U);
+  EXPECT_EQ(task_data->inputs_info[0].dtype, ppc::core::DataType::kDouble);
+
+  auto input = task_data->GetInputView<const double, 2>(0);
+  EXPECT_EQ(input.Extent(0), 3U);
+  EXPECT_EQ(input.Extent(1), 4U);
+  EXPECT_EQ(input.Stride(0), 4);
+  EXPECT_TRUE(input.IsContiguous());
+  EXPECT_TRUE(input.IsAligned<alignof(double)>());
+  EXPECT_EQ(&input(2, 1), &in[9]);
+  EXPECT_EQ(input.Flat().size(), in.size());
+
+  auto output = task_data->GetOutputView<double, 1>(0);
+  output(3) = 2.0;
+  EXPECT_EQ(out[3], 2.0);
+
+  EXPECT_THROW((void)(task_data->GetInputView<float, 2>(0)), std::invalid_argument);
+  EXPECT_THROW((void)(task_data->GetInputView<double, 1>(0)), std::invalid_argument);
+}
+
+TEST(task_tests, check_task_data_views_without_info) {
+  std::vector<int32_t> in(20, 1);
+
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  task_data->inputs_count.emplace_back(in.size());
+  EXPECT_FALSE(task_data->HasInputInfo(0));
+
+  auto input = task_data->GetInputView<int32_t, 1>(0);
+  EXPECT_EQ(input.Size(), in.size());
+  EXPECT_THROW((void)(task_data->GetInputView<int32_t, 2>(0)), std::invalid_argument);
+}
+
+TEST(task_tests, check_task_data_large_extents) {
+  // only the shape is recorded, the buffer is never accessed
+  std::vector<uint8_t> in(1);
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->AddInput(in.data(), std::array<uint64_t, 2>{1ULL << 20, 1ULL << 13});
+  EXPECT_EQ(task_data->inputs_count[0], std::numeric_limits<uint32_t>::max());
+  EXPECT_EQ((task_data->GetInputView<uint8_t, 2>(0).Size()), 1ULL << 33);
+}
+
+TEST(task_tests, check_batch_run) {
+  constexpr size_t kItems = 10;
+  std::vector<std::vector<int32_t>> in(kItems);
+  std::vector<std::vector<int32_t>> out(kItems, std::vector<int32_t>(1, 0));
+  std::vector<ppc::core::BatchItem> items(kItems);
+  for (size_t i = 0; i < kItems; i++) {
+    in[i].assign(20, static_cast<int32_t>(i));
+    items[i].inputs = {reinterpret_cast<uint8_t *>(in[i].data())};
+    items[i].outputs = {reinterpret_cast<uint8_t *>(out[i].data())};
+  }
+
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(in[0].data()));
+  task_data->inputs_count.emplace_back(in[0].size());
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(out[0].data()));
+  task_data->outputs_count.emplace_back(out[0].size());
+
+  ppc::test::task::TestTask<int32_t> test_task(task_data);
+  ASSERT_TRUE(test_task.RunBatch(items));
+  for (size_t i = 0; i < kItems; i++) {
+    EXPECT_EQ(out[i][0], static_cast<int32_t>(20 * i));
+  }
+  EXPECT_EQ(task_data->inputs[0], reinterpret_cast<uint8_t *>(in[0].data()));
+
+  // the usual pipeline is still available after the batch
+  ASSERT_TRUE(test_task.Validation());
+  test_task.PreProcessing();
+  test_task.Run();
+  test_task.PostProcessing();
+  EXPECT_EQ(out[0][0], 0);
+}
+
+TEST(task_tests, check_batch_run_overlapped) {
+  constexpr size_t kItems = 9;
+  std::vector<std::vector<double>> in(kItems);
+  std::vector<std::vector<double>> out(kItems, std::vector<double>(1, 0.0));
+  std::vector<ppc::core::BatchItem> items(kItems);
+  for (size_t i = 0; i < kItems; i++) {
+    in[i].assign(16, static_cast<double>(i) + 0.5);
+    items[i].inputs = {reinterpret_cast<uint8_t *>(in[i].data())};
+    items[i].outputs = {reinterpret_cast<uint8_t *>(out[i].data())};
+  }
+
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(in[0].data()));
+  task_data->inputs_count.emplace_back(in[0].size());
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(out[0].data()));
+  task_data->outputs_count.emplace_back(out[0].size());
+
+  ppc::test::task::TestBatchTask<double> test_task(task_data);
+  ASSERT_TRUE(test_task.RunBatch(items, true));
+  for (size_t i = 0; i < kItems; i++) {
+    EXPECT_NEAR(out[i][0], 16 * (static_cast<double>(i) + 0.5), 1e-9);
+  }
+}
+
+TEST(task_tests, check_batch_run_preprocesses_every_item_once) {
+  constexpr size_t kItems = 4;
+  std::vector<std::vector<int32_t>> in(kItems, std::vector<int32_t>(10, 1));
+  std::vector<std::vector<int32_t>> out(kItems, std::vector<int32_t>(1, 0));
+  std::vector<ppc::core::BatchItem> items(kItems);
+  for (size_t i = 0; i < kItems; i++) {
+    items[i].inputs = {reinterpret_cast<uint8_t *>(in[i].data())};
+    items[i].outputs = {reinterpret_cast<uint8_t *>(out[i].data())};
+  }
+
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(in[0].data()));
+  task_data->inputs_count.emplace_back(in[0].size());
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(out[0].data()));
+  task_data->outputs_count.emplace_back(out[0].size());
+
+  ppc::test::task::CountingTask<int32_t> test_task(task_data, 0);
+  ASSERT_TRUE(test_task.RunBatch(items));
+  EXPECT_EQ(test_task.Preprocessings(), kItems);
+}
+
+TEST(task_tests, check_batch_run_restores_task_data_on_exception) {
+  constexpr size_t kItems = 4;
+  std::vector<std::vector<int32_t>> in(kItems, std::vector<int32_t>(10, 1));
+  std::vector<std::vector<int32_t>> out(kItems, std::vector<int32_t>(1, 0));
+  std::vector<ppc::core::BatchItem> items(kItems);
+  for (size_t i = 0; i < kItems; i++) {
+    items[i].inputs = {reinterpret_cast<uint8_t *>(in[i].data())};
+    items[i].outputs = {reinterpret_cast<uint8_t *>(out[i].data())};
+  }
+  std::vector<int32_t> own_in(10, 2);
+  std::vector<int32_t> own_out(1, 0);
+
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(own_in.data()));
+  task_data->inputs_count.emplace_back(own_in.size());
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(own_out.data()));
+  task_data->outputs_count.emplace_back(own_out.size());
+
+  ppc::test::task::CountingTask<int32_t> test_task(task_data, 3);
+  EXPECT_THROW(test_task.RunBatch(items), std::runtime_error);
+  EXPECT_EQ(task_data->inputs[0], reinterpret_cast<uint8_t *>(own_in.data()));
+  EXPECT_EQ(task_data->outputs[0], reinterpret_cast<uint8_t *>(own_out.data()));
+
+  // the pipeline starts over after the failed batch
+  ASSERT_TRUE(test_task.Validation());
+  test_task.PreProcessing();
+  test_task.Run();
+  test_task.PostProcessing();
+  EXPECT_EQ(own_out[0], 20);
+
+  // the default copy-in binds task data, so it refuses to overlap RunImpl()
+  ppc::test::task::TwoSlotTask<int32_t> two_slots(task_data);
+  EXPECT_THROW(two_slots.RunBatch(items, true), std::logic_error);
+  EXPECT_EQ(task_data->inputs[0], reinterpret_cast<uint8_t *>(own_in.data()));
+}
+
+TEST(task_tests, check_batch_run_time_limit_per_item) {
+  constexpr size_t kItems = 6;
+  std::vector<std::vector<int32_t>> in(kItems, std::vector<int32_t>(10, 1));
+  std::vector<std::vector<int32_t>> out(kItems, std::vector<int32_t>(1, 0));
+  std::vector<ppc::core::BatchItem> items(kItems);
+  for (size_t i = 0; i < kItems; i++) {
+    items[i].inputs = {reinterpret_cast<uint8_t *>(in[i].data())};
+    items[i].outputs = {reinterpret_cast<uint8_t *>(out[i].data())};
+  }
+
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(in[0].data()));
+  task_data->inputs_count.emplace_back(in[0].size());
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(out[0].data()));
+  task_data->outputs_count.emplace_back(out[0].size());
+
+  // the batch takes longer than the limit, every item is within it
+  ppc::test::task::PacedTask<int32_t> paced_task(task_data, std::chrono::milliseconds(250));
+  ASSERT_TRUE(paced_task.RunBatch(items));
+  for (size_t i = 0; i < kItems; i++) {
+    EXPECT_EQ(out[i][0], 10);
+  }
+
+  // a single slow item still fails the test
+  ppc::test::task::FakeSlowTask<int32_t> slow_task(task_data);
+  EXPECT_THROW(slow_task.RunBatch({items[0]}), std::runtime_error);
+}
+
+TEST(task_tests, check_batch_run_wrong_item) {
+  std::vector<float> in(20, 1);
+  std::vector<float> out(1, 0);
+
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  task_data->inputs_count.emplace_back(in.size());
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  task_data->outputs_count.emplace_back(out.size());
+
+  std::vector<ppc::core::BatchItem> items(1);
+  items[0].inputs = {reinterpret_cast<uint8_t *>(in.data())};
+
+  ppc::test::task::TestTask<float> test_task(task_data);
+  EXPECT_THROW(test_task.RunBatch(items), std::invalid_argument);
+}
+
+TEST(task_tests, check_repeated_run_and_cycles) {
+  std::vector<int32_t> in(20, 1);
+  std::vector<int32_t> out(1, 0);
+
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  task_data->inputs_count.emplace_back(in.size());
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  task_data->outputs_count.emplace_back(out.size());
+
+  ppc::test::task::TestTask<int32_t> test_task(task_data);
+  for (int cycle = 0; cycle < 3; cycle++) {
+    ASSERT_TRUE(test_task.Validation());
+    test_task.PreProcessing();
+    test_task.Run();
+    test_task.Run();
+    test_task.PostProcessing();
+    EXPECT_EQ(out[0], 40);
+  }
+  EXPECT_ANY_THROW(test_task.Run());
+}
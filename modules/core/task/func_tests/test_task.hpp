@@ -1,6 +1,9 @@
 #pragma once
 
+#include <array>
 #include <chrono>
+#include <cstddef>
+#include <stdexcept>
 #include <thread>
 #include <vector>
 
@@ -46,4 +49,94 @@ class FakeSlowTask : public TestTask<T> {
   }
 };
 
+// TestTask whose every run takes the given time
+template <class T>
+class PacedTask : public TestTask<T> {
+ public:
+  PacedTask(const ppc::core::TaskDataPtr &task_data, std::chrono::milliseconds run_time)
+      : TestTask<T>(task_data), run_time_(run_time) {}
+
+  bool RunImpl() override {
+    std::this_thread::sleep_for(run_time_);
+    return TestTask<T>::RunImpl();
+  }
+
+ private:
+  std::chrono::milliseconds run_time_;
+};
+
+// TestTask that counts its preprocessings and throws from the run number throw_at (counted from 1)
+template <class T>
+class CountingTask : public TestTask<T> {
+ public:
+  CountingTask(const ppc::core::TaskDataPtr &task_data, size_t throw_at)
+      : TestTask<T>(task_data), throw_at_(throw_at) {}
+
+  bool PreProcessingImpl() override {
+    preprocessings_++;
+    return TestTask<T>::PreProcessingImpl();
+  }
+
+  bool RunImpl() override {
+    if (++runs_ == throw_at_) {
+      throw std::runtime_error("run failed");
+    }
+    return TestTask<T>::RunImpl();
+  }
+
+  [[nodiscard]] size_t Preprocessings() const { return preprocessings_; }
+
+ private:
+  size_t throw_at_;
+  size_t preprocessings_ = 0;
+  size_t runs_ = 0;
+};
+
+// TestTask with two batch slots but the default copy-in, which can't overlap RunImpl()
+template <class T>
+class TwoSlotTask : public TestTask<T> {
+ public:
+  explicit TwoSlotTask(const ppc::core::TaskDataPtr &task_data) : TestTask<T>(task_data) {}
+  [[nodiscard]] size_t BatchSlotsCount() const override { return 2; }
+};
+
+template <class T>
+class TestBatchTask : public ppc::core::Task {
+ public:
+  explicit TestBatchTask(const ppc::core::TaskDataPtr &task_data) : Task(task_data) {}
+  bool ValidationImpl() override { return task_data->outputs_count[0] == 1; }
+  bool PreProcessingImpl() override { return true; }
+
+  bool RunImpl() override {
+    auto &slot = slots_[CurrentBatchSlot()];
+    slot.result = 0;
+    for (const auto &value : slot.input) {
+      slot.result += value;
+    }
+    return true;
+  }
+
+  bool PostProcessingImpl() override { return true; }
+
+  bool LoadBatchItemImpl(const ppc::core::BatchItem &item, size_t slot) override {
+    const auto *input = reinterpret_cast<T *>(item.inputs[0]);
+    slots_[slot].input.assign(input, input + task_data->inputs_count[0]);
+    return true;
+  }
+
+  bool StoreBatchItemImpl(const ppc::core::BatchItem &item, size_t slot) override {
+    reinterpret_cast<T *>(item.outputs[0])[0] = slots_[slot].result;
+    return true;
+  }
+
+  [[nodiscard]] size_t BatchSlotsCount() const override { return slots_.size(); }
+
+ private:
+  struct Slot {
+    std::vector<T> input;
+    T result{};
+  };
+  std::array<Slot, 2> slots_;
+};
+
 }  // namespace ppc::test::task
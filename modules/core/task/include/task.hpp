@@ -1,11 +1,22 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <chrono>
+#include <cstddef>
 #include <cstdint>
+#include <limits>
 #include <memory>
-#include <string>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <typeindex>
+#include <typeinfo>
+#include <utility>
 #include <vector>
 
+#include "core/task/include/tensor_view.hpp"
+
 namespace ppc::core {
 
 struct TaskData {
@@ -14,10 +25,175 @@ struct TaskData {
   std::vector<uint8_t *> outputs;
   std::vector<std::uint32_t> outputs_count;
   enum StateOfTesting : uint8_t { kFunc, kPerf } state_of_testing;
+
+  // Vector moved into task data, it is alive while task data lives or until it is taken back
+  struct OwnedBuffer {
+    std::shared_ptr<void> holder;
+    std::type_index type;
+    uint8_t *data;
+  };
+  std::vector<OwnedBuffer> owned_buffers{};
+
+  // Optional element type and 64-bit shape of inputs (outputs), index-aligned with inputs (outputs).
+  // Counts of described buffers saturate at 2^32 - 1, the real size is kept in the info.
+  std::vector<BufferInfo> inputs_info{};
+  std::vector<BufferInfo> outputs_info{};
+
+  // Append buffer described by its row-major extents, e.g. AddInput(a.data(), std::array<uint64_t, 2>{rows, cols})
+  template <typename T, size_t Rank>
+  void AddInput(T *data, const std::array<uint64_t, Rank> &extents) {
+    AddBuffer(inputs, inputs_count, inputs_info, data, extents);
+  }
+  template <typename T, size_t Rank>
+  void AddOutput(T *data, const std::array<uint64_t, Rank> &extents) {
+    AddBuffer(outputs, outputs_count, outputs_info, data, extents);
+  }
+
+  [[nodiscard]] bool HasInputInfo(size_t i) const { return i < inputs_info.size() && !inputs_info[i].extents.empty(); }
+  [[nodiscard]] bool HasOutputInfo(size_t i) const {
+    return i < outputs_info.size() && !outputs_info[i].extents.empty();
+  }
+
+  // Typed view of i-th input (output) with type, rank and alignment checks.
+  // Buffers without info can be viewed only as one-dimensional arrays of inputs_count (outputs_count) elements.
+  template <typename T, size_t Rank>
+  [[nodiscard]] TensorView<T, Rank> GetInputView(size_t i) const {
+    return MakeView<T, Rank>(inputs, inputs_count, inputs_info, i);
+  }
+  template <typename T, size_t Rank>
+  [[nodiscard]] TensorView<T, Rank> GetOutputView(size_t i) const {
+    return MakeView<T, Rank>(outputs, outputs_count, outputs_info, i);
+  }
+
+  // Bounds-checked view of i-th input (output) without copying, count is the number of elements of T.
+  // Tasks can read inputs and write results directly to caller memory instead of private copies.
+  template <typename T>
+  [[nodiscard]] std::span<T> GetInput(size_t i) const {
+    return MakeSpan<T>(inputs, inputs_count, inputs_info, i);
+  }
+  template <typename T>
+  [[nodiscard]] std::span<T> GetOutput(size_t i) const {
+    return MakeSpan<T>(outputs, outputs_count, outputs_info, i);
+  }
+
+  // Move vector into task data and append it as the next input (output)
+  template <typename T>
+  void EmplaceInput(std::vector<T> &&data) {
+    const auto count = static_cast<std::uint32_t>(data.size());
+    inputs.push_back(Own(std::move(data)));
+    inputs_count.push_back(count);
+  }
+  template <typename T>
+  void EmplaceOutput(std::vector<T> &&data) {
+    const auto count = static_cast<std::uint32_t>(data.size());
+    outputs.push_back(Own(std::move(data)));
+    outputs_count.push_back(count);
+  }
+
+  // Move i-th output added by EmplaceOutput out of task data, the output slot becomes empty
+  template <typename T>
+  [[nodiscard]] std::vector<T> TakeOutput(size_t i) {
+    if (i >= outputs.size()) {
+      throw std::out_of_range("TaskData: output index " + std::to_string(i) + " is out of range");
+    }
+    auto it = std::ranges::find_if(owned_buffers, [&](const auto &buffer) { return buffer.data == outputs[i]; });
+    if (it == owned_buffers.end() || it->type != std::type_index(typeid(std::vector<T>))) {
+      throw std::invalid_argument("TaskData: output " + std::to_string(i) + " is not an owned vector of this type");
+    }
+    std::vector<T> res = std::move(*static_cast<std::vector<T> *>(it->holder.get()));
+    owned_buffers.erase(it);
+    outputs[i] = nullptr;
+    outputs_count[i] = 0;
+    return res;
+  }
+
+ private:
+  template <typename T>
+  static std::span<T> MakeSpan(const std::vector<uint8_t *> &buffers, const std::vector<std::uint32_t> &counts,
+                               const std::vector<BufferInfo> &infos, size_t i) {
+    if (i >= buffers.size() || i >= counts.size()) {
+      throw std::out_of_range("TaskData: buffer index " + std::to_string(i) + " is out of range");
+    }
+    const bool has_info = i < infos.size() && !infos[i].extents.empty();
+    const uint64_t count = has_info ? infos[i].Size() : counts[i];
+    if (count == 0) {
+      return {};
+    }
+    if (buffers[i] == nullptr) {
+      throw std::invalid_argument("TaskData: buffer " + std::to_string(i) + " is null");
+    }
+    if (reinterpret_cast<std::uintptr_t>(buffers[i]) % alignof(T) != 0) {
+      throw std::invalid_argument("TaskData: buffer " + std::to_string(i) + " is misaligned for the element type");
+    }
+    return {reinterpret_cast<T *>(buffers[i]), static_cast<size_t>(count)};
+  }
+
+  template <typename T, size_t Rank>
+  static TensorView<T, Rank> MakeView(const std::vector<uint8_t *> &buffers, const std::vector<std::uint32_t> &counts,
+                                      const std::vector<BufferInfo> &infos, size_t i) {
+    if (i >= buffers.size() || i >= counts.size()) {
+      throw std::out_of_range("TaskData: buffer index " + std::to_string(i) + " is out of range");
+    }
+    if (i >= infos.size() || infos[i].extents.empty()) {
+      if constexpr (Rank == 1) {
+        auto data = MakeSpan<T>(buffers, counts, infos, i);
+        const auto info = BufferInfo::Make(data.data(), std::array<uint64_t, 1>{data.size()});
+        return {data.data(), {data.size()}, {1}, info.alignment};
+      } else {
+        throw std::invalid_argument("TaskData: buffer " + std::to_string(i) + " has no shape info");
+      }
+    }
+
+    const auto &info = infos[i];
+    constexpr DataType kType = GetDataType<T>();
+    if ((kType != DataType::kUnknown || info.dtype != DataType::kUnknown) && kType != info.dtype) {
+      throw std::invalid_argument("TaskData: element type of buffer " + std::to_string(i) + " does not match");
+    }
+    if (info.element_size != sizeof(T) || info.extents.size() != Rank) {
+      throw std::invalid_argument("TaskData: element size or rank of buffer " + std::to_string(i) + " does not match");
+    }
+    if (info.alignment < alignof(T)) {
+      throw std::invalid_argument("TaskData: buffer " + std::to_string(i) + " is misaligned for the element type");
+    }
+    std::array<uint64_t, Rank> extents{};
+    std::array<int64_t, Rank> strides{};
+    std::ranges::copy(info.extents, extents.begin());
+    std::ranges::copy(info.strides, strides.begin());
+    return {reinterpret_cast<T *>(buffers[i]), extents, strides, info.alignment};
+  }
+
+  template <typename T, size_t Rank>
+  static void AddBuffer(std::vector<uint8_t *> &buffers, std::vector<std::uint32_t> &counts,
+                        std::vector<BufferInfo> &infos, T *data, const std::array<uint64_t, Rank> &extents) {
+    auto info = BufferInfo::Make<std::remove_const_t<T>, Rank>(data, extents);
+    const uint64_t size = info.Size();
+    buffers.push_back(reinterpret_cast<uint8_t *>(const_cast<std::remove_const_t<T> *>(data)));
+    counts.push_back(static_cast<std::uint32_t>(std::min<uint64_t>(size, std::numeric_limits<std::uint32_t>::max())));
+    infos.resize(buffers.size() - 1);
+    infos.push_back(std::move(info));
+  }
+
+  template <typename T>
+  uint8_t *Own(std::vector<T> &&data) {
+    auto holder = std::make_shared<std::vector<T>>(std::move(data));
+    // every owned buffer needs a distinct address to be found again
+    if (holder->capacity() == 0) {
+      holder->reserve(1);
+    }
+    auto *ptr = reinterpret_cast<uint8_t *>(holder->data());
+    owned_buffers.push_back({.holder = holder, .type = std::type_index(typeid(std::vector<T>)), .data = ptr});
+    return ptr;
+  }
 };
 
 using TaskDataPtr = std::shared_ptr<ppc::core::TaskData>;
 
+// Buffers of one item of a batch, they have the same counts as inputs and outputs of the task data
+struct BatchItem {
+  std::vector<uint8_t *> inputs;
+  std::vector<uint8_t *> outputs;
+};
+
 // Memory of inputs and outputs need to be initialized before create object of
 // Task class
 class Task {
@@ -42,10 +218,21 @@ class Task {
   // get input and output data
   [[nodiscard]] TaskDataPtr GetData() const;
 
+  // batch (streaming) mode: Validation() is called once for the current task data,
+  // then every item goes through LoadBatchItemImpl() -> RunImpl() -> StoreBatchItemImpl();
+  // with overlap_copy_in loading of the next item runs on the core thread pool in parallel with RunImpl()
+  // of the current one (only for tasks with at least 2 batch slots that override LoadBatchItemImpl());
+  // the time limit of functional tests applies to every RunImpl() of the batch and not to the whole batch
+  bool RunBatch(const std::vector<BatchItem> &items, bool overlap_copy_in = false);
+
   virtual ~Task();
 
  protected:
-  void InternalOrderTest(const std::string &str = __builtin_FUNCTION());
+  // stages of the task's pipeline in the required order
+  enum class Stage : uint8_t { kValidation, kPreProcessing, kRun, kPostProcessing };
+  // constant-time check of the order of stages, Run() may be repeated
+  void InternalOrderTest(Stage stage);
+  static const char *GetStageName(Stage stage);
   TaskDataPtr task_data;
 
   // implementation of "validation" function
@@ -60,9 +247,31 @@ class Task {
   // implementation of "post_processing" function
   virtual bool PostProcessingImpl() = 0;
 
+  // copy-in of the item inputs to the scratch of the slot, reading the buffers of the item and not task data;
+  // by default the item is bound to task data and PreProcessingImpl() is called, which can't overlap RunImpl()
+  // and allocates the scratch of every item again; tasks amortize the preprocessing over the batch only by
+  // overriding it (and StoreBatchItemImpl()) to reuse the buffers of the slot
+  virtual bool LoadBatchItemImpl(const BatchItem &item, size_t slot);
+
+  // copy-out of the slot results to the item outputs,
+  // by default the item is bound to task data and PostProcessingImpl() is called
+  virtual bool StoreBatchItemImpl(const BatchItem &item, size_t slot);
+
+  // count of independent scratch slots, RunImpl() processes the slot CurrentBatchSlot()
+  [[nodiscard]] virtual size_t BatchSlotsCount() const { return 1; }
+  [[nodiscard]] size_t CurrentBatchSlot() const { return batch_slot_; }
+
  private:
-  std::vector<std::string> functions_order_;
-  std::vector<std::string> right_functions_order_ = {"Validation", "PreProcessing", "Run", "PostProcessing"};
+  void BindBatchItem(const BatchItem &item);
+  // throws if the functional test runs longer than max_test_time_ seconds
+  void CheckTestTime(double current_time) const;
+  size_t batch_slot_ = 0;
+  bool loading_in_parallel_ = false;
+  bool in_batch_ = false;
+  // stage expected next, count of passed stages (for the error message) and whether the last stage is Run()
+  Stage next_stage_ = Stage::kValidation;
+  uint64_t stages_count_ = 0;
+  bool after_run_ = false;
   const double max_test_time_ = 1.0;
   std::chrono::high_resolution_clock::time_point tmp_time_point_;
 };
@@ -0,0 +1,167 @@
+#pragma once
+
+#include <array>
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace ppc::core {
+
+enum class DataType : uint8_t {
+  kUnknown,
+  kInt8,
+  kUInt8,
+  kInt16,
+  kUInt16,
+  kInt32,
+  kUInt32,
+  kInt64,
+  kUInt64,
+  kFloat,
+  kDouble,
+  kComplexFloat,
+  kComplexDouble
+};
+
+template <typename T>
+constexpr DataType GetDataType() {
+  using U = std::remove_cv_t<T>;
+  if constexpr (std::is_same_v<U, int8_t>) {
+    return DataType::kInt8;
+  } else if constexpr (std::is_same_v<U, uint8_t>) {
+    return DataType::kUInt8;
+  } else if constexpr (std::is_same_v<U, int16_t>) {
+    return DataType::kInt16;
+  } else if constexpr (std::is_same_v<U, uint16_t>) {
+    return DataType::kUInt16;
+  } else if constexpr (std::is_same_v<U, int32_t>) {
+    return DataType::kInt32;
+  } else if constexpr (std::is_same_v<U, uint32_t>) {
+    return DataType::kUInt32;
+  } else if constexpr (std::is_same_v<U, int64_t>) {
+    return DataType::kInt64;
+  } else if constexpr (std::is_same_v<U, uint64_t>) {
+    return DataType::kUInt64;
+  } else if constexpr (std::is_same_v<U, float>) {
+    return DataType::kFloat;
+  } else if constexpr (std::is_same_v<U, double>) {
+    return DataType::kDouble;
+  } else if constexpr (std::is_same_v<U, std::complex<float>>) {
+    return DataType::kComplexFloat;
+  } else if constexpr (std::is_same_v<U, std::complex<double>>) {
+    return DataType::kComplexDouble;
+  } else {
+    return DataType::kUnknown;
+  }
+}
+
+// Element type, 64-bit shape and alignment of one input or output buffer
+struct BufferInfo {
+  DataType dtype = DataType::kUnknown;
+  size_t element_size = 0;
+  // extents and strides (in elements) from the outermost to the innermost dimension
+  std::vector<uint64_t> extents;
+  std::vector<int64_t> strides;
+  // largest power of two (up to 4096) dividing the buffer address
+  size_t alignment = 0;
+
+  [[nodiscard]] uint64_t Size() const {
+    uint64_t size = 1;
+    for (const auto extent : extents) {
+      size *= extent;
+    }
+    return size;
+  }
+
+  template <typename T, size_t Rank>
+  static BufferInfo Make(const T *data, const std::array<uint64_t, Rank> &extents) {
+    BufferInfo info;
+    info.dtype = GetDataType<T>();
+    info.element_size = sizeof(T);
+    info.extents.assign(extents.begin(), extents.end());
+    info.strides.assign(Rank, 1);
+    for (size_t d = Rank; d-- > 1;) {
+      info.strides[d - 1] = info.strides[d] * static_cast<int64_t>(extents[d]);
+    }
+    const auto address = reinterpret_cast<std::uintptr_t>(data);
+    info.alignment = address == 0 ? 4096 : static_cast<size_t>(address & (~address + 1));
+    if (info.alignment > 4096) {
+      info.alignment = 4096;
+    }
+    return info;
+  }
+};
+
+// Typed strided view of a buffer, the element type and rank are known at compile time
+template <typename T, size_t Rank>
+class TensorView {
+ public:
+  using ElementType = T;
+  static constexpr size_t kRank = Rank;
+
+  TensorView() = default;
+  TensorView(T *data, const std::array<uint64_t, Rank> &extents, const std::array<int64_t, Rank> &strides,
+             size_t alignment)
+      : data_(data), extents_(extents), strides_(strides), alignment_(alignment) {}
+
+  [[nodiscard]] T *Data() const { return data_; }
+  [[nodiscard]] uint64_t Extent(size_t d) const { return extents_[d]; }
+  [[nodiscard]] int64_t Stride(size_t d) const { return strides_[d]; }
+  [[nodiscard]] size_t Alignment() const { return alignment_; }
+
+  [[nodiscard]] uint64_t Size() const {
+    uint64_t size = 1;
+    for (const auto extent : extents_) {
+      size *= extent;
+    }
+    return size;
+  }
+
+  // row-major without gaps, i.e. can be processed as one flat array
+  [[nodiscard]] bool IsContiguous() const {
+    int64_t expected = 1;
+    for (size_t d = Rank; d-- > 0;) {
+      if (extents_[d] > 1 && strides_[d] != expected) {
+        return false;
+      }
+      expected *= static_cast<int64_t>(extents_[d]);
+    }
+    return true;
+  }
+
+  // selects aligned (e.g. SIMD) code paths: IsAligned<32>() for AVX loads
+  template <size_t Align>
+  [[nodiscard]] bool IsAligned() const {
+    return alignment_ >= Align;
+  }
+
+  template <typename... Idx>
+  T &operator()(Idx... idx) const {
+    static_assert(sizeof...(Idx) == Rank, "number of indices must be equal to the rank of the view");
+    const std::array<uint64_t, Rank> index{static_cast<uint64_t>(idx)...};
+    int64_t offset = 0;
+    for (size_t d = 0; d < Rank; d++) {
+      offset += static_cast<int64_t>(index[d]) * strides_[d];
+    }
+    return data_[offset];
+  }
+
+  [[nodiscard]] std::span<T> Flat() const {
+    if (!IsContiguous()) {
+      throw std::logic_error("TensorView: flat access to a non-contiguous view");
+    }
+    return {data_, static_cast<size_t>(Size())};
+  }
+
+ private:
+  T *data_ = nullptr;
+  std::array<uint64_t, Rank> extents_{};
+  std::array<int64_t, Rank> strides_{};
+  size_t alignment_ = 0;
+};
+
+}  // namespace ppc::core
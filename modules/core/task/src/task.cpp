@@ -1,15 +1,40 @@
 #include "core/task/include/task.hpp"
 
+#include <algorithm>
+#include <chrono>
 #include <cstddef>
 #include <iomanip>
 #include <iostream>
+#include <optional>
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <utility>
+
+#include "core/thread_pool/include/thread_pool.hpp"
+
+namespace {
+
+// calls the function when the scope is left, also by an exception
+template <typename F>
+class ScopeExit {
+ public:
+  explicit ScopeExit(F f) : f_(std::move(f)) {}
+  ScopeExit(const ScopeExit&) = delete;
+  ScopeExit& operator=(const ScopeExit&) = delete;
+  ~ScopeExit() { f_(); }
+
+ private:
+  F f_;
+};
+
+}  // namespace
 
 void ppc::core::Task::SetData(TaskDataPtr task_data_ptr) {
   task_data_ptr->state_of_testing = TaskData::StateOfTesting::kFunc;
-  functions_order_.clear();
+  next_stage_ = Stage::kValidation;
+  stages_count_ = 0;
+  after_run_ = false;
   this->task_data = std::move(task_data_ptr);
 }
 
@@ -18,58 +43,166 @@ ppc::core::TaskDataPtr ppc::core::Task::GetData() const { return task_data; }
 ppc::core::Task::Task(TaskDataPtr task_data) { SetData(std::move(task_data)); }
 
 bool ppc::core::Task::Validation() {
-  InternalOrderTest();
+  InternalOrderTest(Stage::kValidation);
   return ValidationImpl();
 }
 
 bool ppc::core::Task::PreProcessing() {
-  InternalOrderTest();
+  InternalOrderTest(Stage::kPreProcessing);
   return PreProcessingImpl();
 }
 
 bool ppc::core::Task::Run() {
-  InternalOrderTest();
+  InternalOrderTest(Stage::kRun);
   return RunImpl();
 }
 
 bool ppc::core::Task::PostProcessing() {
-  InternalOrderTest();
+  InternalOrderTest(Stage::kPostProcessing);
   return PostProcessingImpl();
 }
 
-void ppc::core::Task::InternalOrderTest(const std::string& str) {
-  if (!functions_order_.empty() && str == functions_order_.back() && str == "Run") {
-    return;
+bool ppc::core::Task::RunBatch(const std::vector<BatchItem>& items, bool overlap_copy_in) {
+  for (const auto& item : items) {
+    if (item.inputs.size() != task_data->inputs.size() || item.outputs.size() != task_data->outputs.size()) {
+      throw std::invalid_argument("Batch item must have the same count of buffers as task data");
+    }
+  }
+  if (!Validation()) {
+    return false;
   }
+  // every item is preprocessed by its own LoadBatchItemImpl(), so PreProcessingImpl() is not called for task data
+  InternalOrderTest(Stage::kPreProcessing);
+  InternalOrderTest(Stage::kRun);
 
-  functions_order_.push_back(str);
+  const size_t slots = BatchSlotsCount();
+  const bool overlap = overlap_copy_in && slots >= 2;
+  // buffers of task data and the stage order are restored even if an implementation throws
+  const ScopeExit restore([this, inputs = task_data->inputs, outputs = task_data->outputs] {
+    task_data->inputs = inputs;
+    task_data->outputs = outputs;
+    batch_slot_ = 0;
+    loading_in_parallel_ = false;
+    in_batch_ = false;
+    if (next_stage_ != Stage::kValidation) {
+      next_stage_ = Stage::kValidation;
+      after_run_ = false;
+    }
+  });
+  loading_in_parallel_ = overlap;
+  in_batch_ = true;
+  // items are timed one by one, a long batch of fast items passes the time limit
+  const bool timed = task_data->state_of_testing == TaskData::StateOfTesting::kFunc;
+  double longest_time = 0.0;
+  // the copy-in of the next item runs on the core pool, it is finished before restore
+  std::optional<TaskGroup> copy_in;
+  if (overlap) {
+    copy_in.emplace();
+  }
 
-  for (size_t i = 0; i < functions_order_.size(); i++) {
-    if (functions_order_[i] != right_functions_order_[i % right_functions_order_.size()]) {
-      throw std::invalid_argument("ORDER OF FUCTIONS IS NOT RIGHT: \n" + std::string("Serial number: ") +
-                                  std::to_string(i + 1) + "\n" + std::string("Yours function: ") + functions_order_[i] +
-                                  "\n" + std::string("Expected function: ") + right_functions_order_[i]);
+  bool ok = items.empty() || LoadBatchItemImpl(items[0], 0);
+  for (size_t i = 0; ok && i < items.size(); i++) {
+    const size_t slot = i % slots;
+    const bool has_next = i + 1 < items.size();
+    bool next_loaded = true;
+    if (overlap && has_next) {
+      copy_in->Run([&, i] { next_loaded = LoadBatchItemImpl(items[i + 1], (i + 1) % slots); });
+    }
+    batch_slot_ = slot;
+    const auto start = std::chrono::high_resolution_clock::now();
+    ok = RunImpl();
+    if (timed) {
+      const std::chrono::duration<double> duration = std::chrono::high_resolution_clock::now() - start;
+      CheckTestTime(duration.count());
+      longest_time = std::max(longest_time, duration.count());
+    }
+    if (copy_in) {
+      copy_in->Wait();
+    }
+    ok = next_loaded && ok;
+    ok = ok && StoreBatchItemImpl(items[i], slot);
+    if (ok && !overlap && has_next) {
+      ok = LoadBatchItemImpl(items[i + 1], (i + 1) % slots);
     }
   }
 
-  if (str == "PreProcessing" && task_data->state_of_testing == TaskData::StateOfTesting::kFunc) {
+  InternalOrderTest(Stage::kPostProcessing);
+  if (timed) {
+    std::cout << "Test time:" << std::fixed << std::setprecision(10) << longest_time;
+  }
+  return ok;
+}
+
+bool ppc::core::Task::LoadBatchItemImpl(const BatchItem& item, size_t /*slot*/) {
+  if (loading_in_parallel_) {
+    throw std::logic_error("LoadBatchItemImpl() must be overridden to load batch items in parallel with RunImpl()");
+  }
+  BindBatchItem(item);
+  return PreProcessingImpl();
+}
+
+bool ppc::core::Task::StoreBatchItemImpl(const BatchItem& item, size_t /*slot*/) {
+  BindBatchItem(item);
+  return PostProcessingImpl();
+}
+
+void ppc::core::Task::BindBatchItem(const BatchItem& item) {
+  task_data->inputs = item.inputs;
+  task_data->outputs = item.outputs;
+}
+
+const char* ppc::core::Task::GetStageName(Stage stage) {
+  switch (stage) {
+    case Stage::kValidation:
+      return "Validation";
+    case Stage::kPreProcessing:
+      return "PreProcessing";
+    case Stage::kRun:
+      return "Run";
+    case Stage::kPostProcessing:
+      return "PostProcessing";
+  }
+  return "Unknown";
+}
+
+void ppc::core::Task::InternalOrderTest(Stage stage) {
+  if (after_run_ && stage == Stage::kRun) {
+    return;
+  }
+
+  stages_count_++;
+  if (stage != next_stage_) {
+    throw std::invalid_argument("ORDER OF FUCTIONS IS NOT RIGHT: \n" + std::string("Serial number: ") +
+                                std::to_string(stages_count_) + "\n" + std::string("Yours function: ") +
+                                GetStageName(stage) + "\n" + std::string("Expected function: ") +
+                                GetStageName(next_stage_));
+  }
+  after_run_ = stage == Stage::kRun;
+  next_stage_ =
+      stage == Stage::kPostProcessing ? Stage::kValidation : static_cast<Stage>(static_cast<uint8_t>(stage) + 1);
+
+  if (stage == Stage::kPreProcessing && task_data->state_of_testing == TaskData::StateOfTesting::kFunc) {
     tmp_time_point_ = std::chrono::high_resolution_clock::now();
   }
 
-  if (str == "PostProcessing" && task_data->state_of_testing == TaskData::StateOfTesting::kFunc) {
+  if (stage == Stage::kPostProcessing && task_data->state_of_testing == TaskData::StateOfTesting::kFunc &&
+      !in_batch_) {
     auto end = std::chrono::high_resolution_clock::now();
     auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(end - tmp_time_point_).count();
     auto current_time = static_cast<double>(duration) * 1e-9;
-    if (current_time < max_test_time_) {
-      std::cout << "Test time:" << std::fixed << std::setprecision(10) << current_time;
-    } else {
-      std::stringstream err_msg;
-      err_msg << "\nTask execute time need to be: ";
-      err_msg << "time < " << max_test_time_ << " secs.\n";
-      err_msg << "Original time in secs: " << current_time << '\n';
-      throw std::runtime_error(err_msg.str().c_str());
-    }
+    CheckTestTime(current_time);
+    std::cout << "Test time:" << std::fixed << std::setprecision(10) << current_time;
+  }
+}
+
+void ppc::core::Task::CheckTestTime(double current_time) const {
+  if (current_time >= max_test_time_) {
+    std::stringstream err_msg;
+    err_msg << "\nTask execute time need to be: ";
+    err_msg << "time < " << max_test_time_ << " secs.\n";
+    err_msg << "Original time in secs: " << current_time << '\n';
+    throw std::runtime_error(err_msg.str().c_str());
   }
 }
 
-ppc::core::Task::~Task() { functions_order_.clear(); }
+ppc::core::Task::~Task() = default;
@@ -0,0 +1,145 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <functional>
+#include <mutex>
+#include <numeric>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "core/thread_pool/include/thread_pool.hpp"
+#include "core/util/include/util.hpp"
+
+TEST(thread_pool_tests, check_parallel_for_covers_range) {
+  for (const int num_threads : {1, 2, 4}) {
+    ppc::core::ThreadPool pool(num_threads);
+    std::vector<int> visits(1003, 0);
+    ppc::core::ParallelFor(
+        3, visits.size(),
+        [&](size_t begin, size_t end) {
+          for (size_t i = begin; i < end; i++) {
+            visits[i]++;
+          }
+        },
+        1, pool);
+    EXPECT_EQ(std::accumulate(visits.begin(), visits.begin() + 3, 0), 0);
+    EXPECT_EQ(std::accumulate(visits.begin() + 3, visits.end(), 0), 1000);
+  }
+}
+
+TEST(thread_pool_tests, check_parallel_reduce) {
+  ppc::core::ThreadPool pool(3);
+  const auto sum = ppc::core::ParallelReduce(
+      0, 100001, int64_t{0},
+      [](size_t begin, size_t end) {
+        int64_t partial = 0;
+        for (size_t i = begin; i < end; i++) {
+          partial += static_cast<int64_t>(i);
+        }
+        return partial;
+      },
+      std::plus<>(), 16, pool);
+  EXPECT_EQ(sum, int64_t{100000} * 100001 / 2);
+
+  // chunk results are combined in order, so non-commutative reductions are deterministic
+  const auto concat = ppc::core::ParallelReduce(
+      0, 50, std::vector<size_t>{},
+      [](size_t begin, size_t end) {
+        std::vector<size_t> part(end - begin);
+        std::iota(part.begin(), part.end(), begin);
+        return part;
+      },
+      [](std::vector<size_t> a, const std::vector<size_t> &b) {
+        a.insert(a.end(), b.begin(), b.end());
+        return a;
+      },
+      1, pool);
+  std::vector<size_t> expected(50);
+  std::iota(expected.begin(), expected.end(), 0);
+  EXPECT_EQ(concat, expected);
+}
+
+TEST(thread_pool_tests, check_task_group_nested) {
+  ppc::core::ThreadPool pool(4);
+  std::atomic<int> counter{0};
+  ppc::core::TaskGroup group(pool);
+  for (int i = 0; i < 8; i++) {
+    group.Run([&] {
+      ppc::core::TaskGroup inner(pool);
+      for (int j = 0; j < 8; j++) {
+        inner.Run([&] { counter++; });
+      }
+      inner.Wait();
+    });
+  }
+  group.Wait();
+  EXPECT_EQ(counter, 64);
+}
+
+TEST(thread_pool_tests, check_task_group_exception) {
+  ppc::core::ThreadPool pool(2);
+  ppc::core::TaskGroup group(pool);
+  std::atomic<int> counter{0};
+  for (int i = 0; i < 10; i++) {
+    group.Run([&, i] {
+      counter++;
+      if (i == 5) {
+        throw std::runtime_error("task failed");
+      }
+    });
+  }
+  EXPECT_THROW(group.Wait(), std::runtime_error);
+  EXPECT_EQ(counter, 10);
+}
+
+TEST(thread_pool_tests, check_workers_are_reused) {
+  ppc::core::ThreadPool pool(4);
+  std::mutex mutex;
+  std::set<std::thread::id> ids;
+  for (int run = 0; run < 20; run++) {
+    ppc::core::ParallelFor(
+        0, 64,
+        [&](size_t, size_t) {
+          std::lock_guard<std::mutex> lock(mutex);
+          ids.insert(std::this_thread::get_id());
+        },
+        1, pool);
+  }
+  // the caller plus at most three persistent workers
+  EXPECT_LE(ids.size(), 4U);
+}
+
+TEST(thread_pool_tests, check_task_group_sleeps_while_waiting) {
+  ppc::core::ThreadPool pool(2);
+  ppc::core::TaskGroup group(pool);
+  std::atomic<bool> done{false};
+  group.Run([&] {
+    std::this_thread::sleep_for(std::chrono::milliseconds(300));
+    done = true;
+  });
+  // let the worker take the task, so the waiter has nothing to help with
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  const std::clock_t start = std::clock();
+  group.Wait();
+  const double cpu_time = static_cast<double>(std::clock() - start) / CLOCKS_PER_SEC;
+  EXPECT_TRUE(done);
+  // the waiter blocks after a short spin instead of yielding for the whole task
+  EXPECT_LT(cpu_time, 0.15);
+}
+
+TEST(thread_pool_tests, check_instance_reset) {
+  auto &pool = ppc::core::ThreadPool::Instance();
+  EXPECT_EQ(&pool, &ppc::core::ThreadPool::Instance());
+  ppc::core::ThreadPool::Reset(3);
+  EXPECT_EQ(ppc::core::ThreadPool::Instance().NumThreads(), 3);
+  std::atomic<int> counter{0};
+  ppc::core::ParallelFor(0, 100, [&](size_t begin, size_t end) { counter += static_cast<int>(end - begin); });
+  EXPECT_EQ(counter, 100);
+  ppc::core::ThreadPool::Reset(ppc::util::GetPPCNumThreads());
+}
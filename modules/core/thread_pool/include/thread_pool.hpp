@@ -0,0 +1,143 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace ppc::core {
+
+// Persistent pool of worker threads with one task deque per worker.
+// A worker takes its own newest task first and steals the oldest tasks of other workers, nearest workers first
+// (with PPC_POOL_PIN=1 workers are pinned to consecutive CPUs, so the nearest ones share a NUMA node).
+// The thread that waits for a task group executes tasks too, so the pool of N threads has N - 1 workers
+// and a pool of one thread runs everything in the calling thread.
+class ThreadPool {
+ public:
+  explicit ThreadPool(int num_threads);
+  ThreadPool(const ThreadPool &) = delete;
+  ThreadPool &operator=(const ThreadPool &) = delete;
+  ~ThreadPool();
+
+  // shared pool of ppc::util::GetPPCNumThreads() threads created by the first call,
+  // the reference stays valid until the next Reset()
+  static ThreadPool &Instance();
+  // recreate the shared pool with num_threads threads; the pool must have no unfinished tasks and references to it
+  // must not be used after (the thread sweep calls it between repetitions of the tests)
+  static void Reset(int num_threads);
+
+  [[nodiscard]] int NumThreads() const { return num_threads_; }
+
+  // queue the task: to the deque of the current worker or, from other threads, round-robin
+  void Submit(std::function<void()> task);
+  // execute one queued task in the calling thread, false if there is no task
+  bool TryRunOne();
+
+ private:
+  // waiting task groups sleep with idle workers
+  friend class TaskGroup;
+
+  struct Queue {
+    std::mutex mutex;
+    std::deque<std::function<void()>> tasks;
+  };
+
+  void WorkerLoop(size_t index);
+  bool Pop(size_t index, std::function<void()> &task);
+  bool Steal(size_t thief, std::function<void()> &task);
+
+  int num_threads_;
+  std::vector<std::unique_ptr<Queue>> queues_;
+  std::vector<std::thread> workers_;
+  std::atomic<size_t> next_queue_{0};
+  std::atomic<int64_t> queued_{0};
+  std::atomic<int> sleeping_{0};
+  std::atomic<bool> stop_{false};
+  std::mutex sleep_mutex_;
+  std::condition_variable sleep_cv_;
+};
+
+// Set of tasks with a common wait, the first exception thrown by a task is rethrown by Wait()
+class TaskGroup {
+ public:
+  explicit TaskGroup(ThreadPool &pool = ThreadPool::Instance()) : pool_(pool) {}
+  TaskGroup(const TaskGroup &) = delete;
+  TaskGroup &operator=(const TaskGroup &) = delete;
+  ~TaskGroup();
+
+  void Run(std::function<void()> task);
+  // help executing queued tasks until all tasks of the group are finished
+  void Wait();
+
+ private:
+  void Execute(const std::function<void()> &task);
+  // help executing queued tasks, then sleep until all tasks of the group are finished or a task is queued
+  void WaitPending();
+
+  ThreadPool &pool_;
+  std::atomic<int64_t> pending_{0};
+  std::mutex exception_mutex_;
+  std::exception_ptr exception_;
+};
+
+// body(chunk_begin, chunk_end) over [begin, end) split into chunks of at least grain indices
+template <typename Body>
+void ParallelFor(size_t begin, size_t end, const Body &body, size_t grain = 1,
+                 ThreadPool &pool = ThreadPool::Instance()) {
+  if (begin >= end) {
+    return;
+  }
+  const size_t size = end - begin;
+  // a few chunks per thread, so stealing can balance uneven chunks
+  const size_t max_chunks = static_cast<size_t>(pool.NumThreads()) * 4;
+  const size_t num_chunks = std::min(max_chunks, std::max<size_t>(1, size / std::max<size_t>(grain, 1)));
+  if (num_chunks == 1 || pool.NumThreads() == 1) {
+    body(begin, end);
+    return;
+  }
+  TaskGroup group(pool);
+  for (size_t chunk = 1; chunk < num_chunks; chunk++) {
+    group.Run([&body, begin, size, num_chunks, chunk] {
+      body(begin + (size * chunk / num_chunks), begin + (size * (chunk + 1) / num_chunks));
+    });
+  }
+  body(begin, begin + (size / num_chunks));
+  group.Wait();
+}
+
+// reduce(map(chunk_begin, chunk_end)...) over [begin, end), chunk results are combined in the order of chunks
+template <typename T, typename Map, typename Reduce>
+T ParallelReduce(size_t begin, size_t end, T identity, const Map &map, const Reduce &reduce, size_t grain = 1,
+                 ThreadPool &pool = ThreadPool::Instance()) {
+  if (begin >= end) {
+    return identity;
+  }
+  const size_t size = end - begin;
+  const size_t max_chunks = static_cast<size_t>(pool.NumThreads()) * 4;
+  const size_t num_chunks = std::min(max_chunks, std::max<size_t>(1, size / std::max<size_t>(grain, 1)));
+  std::vector<T> partial(num_chunks, identity);
+  ParallelFor(
+      0, num_chunks,
+      [&](size_t first_chunk, size_t last_chunk) {
+        for (size_t chunk = first_chunk; chunk < last_chunk; chunk++) {
+          partial[chunk] = map(begin + (size * chunk / num_chunks), begin + (size * (chunk + 1) / num_chunks));
+        }
+      },
+      1, pool);
+  T result = std::move(identity);
+  for (auto &value : partial) {
+    result = reduce(std::move(result), std::move(value));
+  }
+  return result;
+}
+
+}  // namespace ppc::core
@@ -0,0 +1,258 @@
+#include "core/thread_pool/include/thread_pool.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#include "core/util/include/util.hpp"
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace {
+
+// pool and index of the worker run by the current thread
+thread_local const ppc::core::ThreadPool *current_pool = nullptr;
+thread_local size_t current_worker = 0;
+
+// shared pool, the pointer is read without locking once the pool exists
+std::mutex instance_mutex;
+std::unique_ptr<ppc::core::ThreadPool> instance;
+std::atomic<ppc::core::ThreadPool *> instance_ptr{nullptr};
+
+// yields of a waiting task group before it sleeps
+constexpr int kWaitSpins = 64;
+
+// Pin the worker to the index-th CPU allowed for the process
+void PinToCpu([[maybe_unused]] std::thread &thread, [[maybe_unused]] size_t index) {
+#ifdef __linux__
+  cpu_set_t allowed;
+  CPU_ZERO(&allowed);
+  if (sched_getaffinity(0, sizeof(allowed), &allowed) != 0 || CPU_COUNT(&allowed) == 0) {
+    return;
+  }
+  const size_t cpu_index = index % static_cast<size_t>(CPU_COUNT(&allowed));
+  size_t seen = 0;
+  for (int cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+    if (CPU_ISSET(cpu, &allowed) && seen++ == cpu_index) {
+      cpu_set_t target;
+      CPU_ZERO(&target);
+      CPU_SET(cpu, &target);
+      pthread_setaffinity_np(thread.native_handle(), sizeof(target), &target);
+      return;
+    }
+  }
+#endif
+}
+
+}  // namespace
+
+ppc::core::ThreadPool::ThreadPool(int num_threads) : num_threads_(std::max(num_threads, 1)) {
+  const auto num_workers = static_cast<size_t>(num_threads_ - 1);
+  for (size_t i = 0; i < num_workers; i++) {
+    queues_.push_back(std::make_unique<Queue>());
+  }
+  const bool pin = ppc::util::GetEnvVariable("PPC_POOL_PIN") == "1";
+  for (size_t i = 0; i < num_workers; i++) {
+    workers_.emplace_back([this, i] { WorkerLoop(i); });
+    if (pin) {
+      // the calling thread keeps the first CPU
+      PinToCpu(workers_.back(), i + 1);
+    }
+  }
+}
+
+ppc::core::ThreadPool::~ThreadPool() {
+  {
+    std::lock_guard<std::mutex> lock(sleep_mutex_);
+    stop_ = true;
+  }
+  sleep_cv_.notify_all();
+  for (auto &worker : workers_) {
+    worker.join();
+  }
+}
+
+ppc::core::ThreadPool &ppc::core::ThreadPool::Instance() {
+  auto *pool = instance_ptr.load(std::memory_order_acquire);
+  if (pool != nullptr) {
+    return *pool;
+  }
+  std::lock_guard<std::mutex> lock(instance_mutex);
+  if (!instance) {
+    instance = std::make_unique<ThreadPool>(ppc::util::GetPPCNumThreads());
+    instance_ptr.store(instance.get(), std::memory_order_release);
+  }
+  return *instance;
+}
+
+void ppc::core::ThreadPool::Reset(int num_threads) {
+  std::lock_guard<std::mutex> lock(instance_mutex);
+  instance_ptr.store(nullptr, std::memory_order_release);
+  instance.reset();
+  instance = std::make_unique<ThreadPool>(num_threads);
+  instance_ptr.store(instance.get(), std::memory_order_release);
+}
+
+void ppc::core::ThreadPool::Submit(std::function<void()> task) {
+  if (workers_.empty()) {
+    task();
+    return;
+  }
+  const size_t index = current_pool == this ? current_worker : next_queue_++ % queues_.size();
+  {
+    std::lock_guard<std::mutex> lock(queues_[index]->mutex);
+    queues_[index]->tasks.push_back(std::move(task));
+  }
+  queued_++;
+  if (sleeping_ > 0) {
+    { std::lock_guard<std::mutex> lock(sleep_mutex_); }
+    sleep_cv_.notify_one();
+  }
+}
+
+bool ppc::core::ThreadPool::TryRunOne() {
+  if (queued_ <= 0) {
+    return false;
+  }
+  std::function<void()> task;
+  const bool found = current_pool == this ? (Pop(current_worker, task) || Steal(current_worker, task))
+                                          : Steal(next_queue_ % queues_.size(), task);
+  if (!found) {
+    return false;
+  }
+  task();
+  return true;
+}
+
+bool ppc::core::ThreadPool::Pop(size_t index, std::function<void()> &task) {
+  auto &queue = *queues_[index];
+  std::lock_guard<std::mutex> lock(queue.mutex);
+  if (queue.tasks.empty()) {
+    return false;
+  }
+  task = std::move(queue.tasks.back());
+  queue.tasks.pop_back();
+  queued_--;
+  return true;
+}
+
+bool ppc::core::ThreadPool::Steal(size_t thief, std::function<void()> &task) {
+  // victims in order of distance, the thief's own deque (if any) is checked last
+  for (size_t shift = 1; shift <= queues_.size(); shift++) {
+    auto &queue = *queues_[(thief + shift) % queues_.size()];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (!queue.tasks.empty()) {
+      task = std::move(queue.tasks.front());
+      queue.tasks.pop_front();
+      queued_--;
+      return true;
+    }
+  }
+  return false;
+}
+
+void ppc::core::ThreadPool::WorkerLoop(size_t index) {
+  current_pool = this;
+  current_worker = index;
+  while (true) {
+    std::function<void()> task;
+    if (Pop(index, task) || Steal(index, task)) {
+      task();
+      continue;
+    }
+    // a short spin before sleeping keeps latency low for fork-join loops
+    bool found = false;
+    for (int spin = 0; spin < 64 && !found; spin++) {
+      std::this_thread::yield();
+      found = queued_ > 0;
+    }
+    if (found) {
+      continue;
+    }
+    std::unique_lock<std::mutex> lock(sleep_mutex_);
+    sleeping_++;
+    sleep_cv_.wait(lock, [this] { return stop_ || queued_ > 0; });
+    sleeping_--;
+    if (stop_) {
+      return;
+    }
+  }
+}
+
+void ppc::core::TaskGroup::Run(std::function<void()> task) {
+  pending_++;
+  pool_.Submit([this, task = std::move(task)] { Execute(task); });
+}
+
+void ppc::core::TaskGroup::Execute(const std::function<void()> &task) {
+  try {
+    task();
+  } catch (...) {
+    std::lock_guard<std::mutex> lock(exception_mutex_);
+    if (!exception_) {
+      exception_ = std::current_exception();
+    }
+  }
+  // the group may be destroyed as soon as pending_ is 0, so only the pool is used after it
+  int64_t pending = pending_.load();
+  while (pending > 1 && !pending_.compare_exchange_weak(pending, pending - 1)) {
+  }
+  if (pending > 1) {
+    return;
+  }
+  auto &pool = pool_;
+  {
+    // a waiter checks pending_ under the mutex before sleeping, so the wake-up is not lost
+    std::lock_guard<std::mutex> lock(pool.sleep_mutex_);
+    pending_--;
+  }
+  if (pool.sleeping_ > 0) {
+    pool.sleep_cv_.notify_all();
+  }
+}
+
+void ppc::core::TaskGroup::WaitPending() {
+  int spins = 0;
+  while (pending_ > 0) {
+    if (pool_.TryRunOne()) {
+      spins = 0;
+      continue;
+    }
+    if (++spins < kWaitSpins) {
+      std::this_thread::yield();
+      continue;
+    }
+    std::unique_lock<std::mutex> lock(pool_.sleep_mutex_);
+    pool_.sleeping_++;
+    pool_.sleep_cv_.wait(lock, [this] { return pending_ == 0 || pool_.queued_ > 0; });
+    pool_.sleeping_--;
+    spins = 0;
+  }
+}
+
+void ppc::core::TaskGroup::Wait() {
+  WaitPending();
+  std::exception_ptr exception;
+  {
+    std::lock_guard<std::mutex> lock(exception_mutex_);
+    std::swap(exception, exception_);
+  }
+  if (exception) {
+    std::rethrow_exception(exception);
+  }
+}
+
+ppc::core::TaskGroup::~TaskGroup() {
+  // tasks refer to the group, so they must be finished before it is destroyed
+  WaitPending();
+}
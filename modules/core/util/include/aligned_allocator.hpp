@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstddef>
+#include <limits>
+#include <new>
+#include <vector>
+
+namespace ppc::util {
+
+// Allocator of storage aligned to Alignment bytes, a cache line by default: arrays of different threads
+// do not share lines and SIMD code may use aligned loads from the start of the array
+template <typename T, size_t Alignment = 64>
+class AlignedAllocator {
+ public:
+  static_assert(Alignment >= alignof(T) && (Alignment & (Alignment - 1)) == 0,
+                "Alignment is a power of two not below the alignment of T");
+
+  using value_type = T;  // NOLINT(readability-identifier-naming)
+  template <typename U>
+  struct rebind {  // NOLINT(readability-identifier-naming)
+    using other = AlignedAllocator<U, Alignment>;  // NOLINT(readability-identifier-naming)
+  };
+
+  AlignedAllocator() = default;
+  template <typename U>
+  AlignedAllocator(const AlignedAllocator<U, Alignment> & /*other*/) noexcept {}
+
+  T *allocate(size_t n) {  // NOLINT(readability-identifier-naming)
+    if (n > std::numeric_limits<size_t>::max() / sizeof(T)) {
+      throw std::bad_array_new_length();
+    }
+    return static_cast<T *>(::operator new(n * sizeof(T), std::align_val_t{Alignment}));
+  }
+  void deallocate(T *p, size_t /*n*/) noexcept {  // NOLINT(readability-identifier-naming)
+    ::operator delete(p, std::align_val_t{Alignment});
+  }
+
+  template <typename U>
+  bool operator==(const AlignedAllocator<U, Alignment> & /*other*/) const noexcept {
+    return true;
+  }
+};
+
+template <typename T, size_t Alignment = 64>
+using AlignedVector = std::vector<T, AlignedAllocator<T, Alignment>>;
+
+}  // namespace ppc::util
@@ -0,0 +1,28 @@
+#pragma once
+
+#if defined(__x86_64__) || defined(_M_X64)
+// x86-64 kernels are compiled for their instruction set with PPC_TARGET and chosen at run time by GetCpuFeatures,
+// so builds without -march use them too
+#define PPC_X86_64
+#if defined(_MSC_VER) && !defined(__clang__)
+// MSVC compiles intrinsics of every instruction set without target options
+#define PPC_TARGET(features)
+#else
+#define PPC_TARGET(features) __attribute__((target(features)))
+#endif
+#endif
+
+namespace ppc::util {
+
+// instruction sets supported by the processor and the operating system, which saves their registers on context
+// switches; all false off x86-64
+struct CpuFeatures {
+  bool avx2 = false;
+  bool fma = false;
+  bool avx512f = false;
+};
+
+// features of this processor, detected on the first call
+const CpuFeatures &GetCpuFeatures();
+
+}  // namespace ppc::util
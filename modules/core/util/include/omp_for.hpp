@@ -0,0 +1,31 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <span>
+
+namespace ppc::util {
+
+// parallel_for of the ppc::core sort, sparse and graph algorithms on OpenMP: one chunk per iteration, dynamic
+// schedule so uneven chunks balance
+struct OmpFor {
+  template <typename Body>
+  void operator()(size_t begin, size_t end, const Body &body) const {
+#pragma omp parallel for schedule(dynamic)
+    for (int64_t chunk = static_cast<int64_t>(begin); chunk < static_cast<int64_t>(end); ++chunk) {
+      body(static_cast<size_t>(chunk), static_cast<size_t>(chunk) + 1);
+    }
+  }
+};
+
+// ppc::core::gemm::ParallelInvoke on OpenMP: a parallel for over the tasks rather than omp task, which MSVC
+// does not implement
+inline void OmpInvoke(std::span<const std::function<void()>> tasks) {
+#pragma omp parallel for schedule(dynamic, 1)
+  for (int i = 0; i < static_cast<int>(tasks.size()); ++i) {
+    tasks[i]();
+  }
+}
+
+}  // namespace ppc::util
@@ -0,0 +1,17 @@
+#pragma once
+
+#include <cstddef>
+
+#include "core/thread_pool/include/thread_pool.hpp"
+
+namespace ppc::util {
+
+// parallel_for of the ppc::core sort, sparse and graph algorithms on the shared ppc::core::ThreadPool
+struct PoolFor {
+  template <typename Body>
+  void operator()(size_t begin, size_t end, const Body &body) const {
+    ppc::core::ParallelFor(begin, end, body);
+  }
+};
+
+}  // namespace ppc::util
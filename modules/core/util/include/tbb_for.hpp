@@ -0,0 +1,30 @@
+#pragma once
+
+#include <oneapi/tbb/blocked_range.h>
+#include <oneapi/tbb/parallel_for.h>
+#include <oneapi/tbb/task_arena.h>
+
+#include <cstddef>
+
+namespace ppc::util {
+
+// parallel_for of the ppc::core sort, sparse and graph algorithms on TBB. With an arena every call runs in it, so
+// all levels of a recursive algorithm share its threads; without one they run in the default arena.
+struct TbbFor {
+  oneapi::tbb::task_arena *arena = nullptr;
+
+  template <typename Body>
+  void operator()(size_t begin, size_t end, const Body &body) const {
+    auto run = [&] {
+      oneapi::tbb::parallel_for(oneapi::tbb::blocked_range<size_t>(begin, end),
+                                [&](const oneapi::tbb::blocked_range<size_t> &r) { body(r.begin(), r.end()); });
+    };
+    if (arena != nullptr) {
+      arena->execute(run);
+    } else {
+      run();
+    }
+  }
+};
+
+}  // namespace ppc::util
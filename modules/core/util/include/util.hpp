@@ -1,9 +1,17 @@
 #pragma once
+#include <cstddef>
 #include <string>
 
 namespace ppc::util {
 
 std::string GetAbsolutePath(const std::string &relative_path);
 int GetPPCNumThreads();
+// set number of threads returned by GetPPCNumThreads (OMP_NUM_THREADS) for this process
+void SetPPCNumThreads(int num_threads);
+// chunks for the parallel_for of the ppc::core algorithms: a few per thread of GetPPCNumThreads, so uneven chunks
+// balance
+size_t GetPPCNumChunks();
+// value of the environment variable or empty string if it is not set
+std::string GetEnvVariable(const std::string &name);
 
 }  // namespace ppc::util
@@ -0,0 +1,46 @@
+#include "core/util/include/cpu_features.hpp"
+
+#if defined(_MSC_VER) && !defined(__clang__) && defined(PPC_X86_64)
+#include <intrin.h>
+#include <immintrin.h>
+#endif
+
+namespace {
+
+ppc::util::CpuFeatures DetectCpuFeatures() {
+  ppc::util::CpuFeatures features;
+#if defined(_MSC_VER) && !defined(__clang__) && defined(PPC_X86_64)
+  int info[4];
+  __cpuid(info, 0);
+  if (info[0] < 7) {
+    return features;
+  }
+  __cpuidex(info, 1, 0);
+  const bool fma = (info[2] & (1 << 12)) != 0;
+  const bool os_xsave = (info[2] & (1 << 27)) != 0;
+  if (!os_xsave) {
+    return features;
+  }
+  // the operating system saves ymm (bits 1, 2) and zmm (bits 5-7) registers on context switches
+  const unsigned long long xcr0 = _xgetbv(0);
+  const bool ymm = (xcr0 & 0x6) == 0x6;
+  __cpuidex(info, 7, 0);
+  features.avx2 = ymm && (info[1] & (1 << 5)) != 0;
+  features.fma = ymm && fma;
+  features.avx512f = (info[1] & (1 << 16)) != 0 && (xcr0 & 0xE6) == 0xE6;
+#elif defined(PPC_X86_64)
+  // the checks include the support of the operating system
+  __builtin_cpu_init();
+  features.avx2 = __builtin_cpu_supports("avx2") != 0;
+  features.fma = __builtin_cpu_supports("fma") != 0;
+  features.avx512f = __builtin_cpu_supports("avx512f") != 0;
+#endif
+  return features;
+}
+
+}  // namespace
+
+const ppc::util::CpuFeatures &ppc::util::GetCpuFeatures() {
+  static const CpuFeatures kFeatures = DetectCpuFeatures();
+  return kFeatures;
+}
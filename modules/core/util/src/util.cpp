@@ -8,6 +8,8 @@
 #include <vector>
 #endif
 
+#include <algorithm>
+#include <cstddef>
 #include <filesystem>
 #include <string>
 
@@ -30,3 +32,29 @@ int ppc::util::GetPPCNumThreads() {
   int num_threads = (omp_env != nullptr) ? std::atoi(omp_env) : 1;
   return num_threads;
 }
+
+void ppc::util::SetPPCNumThreads(int num_threads) {
+  const std::string value = std::to_string(num_threads);
+#ifdef _WIN32
+  _putenv_s("OMP_NUM_THREADS", value.c_str());
+#else
+  setenv("OMP_NUM_THREADS", value.c_str(), 1);
+#endif
+}
+
+size_t ppc::util::GetPPCNumChunks() { return static_cast<size_t>(std::max(GetPPCNumThreads(), 1)) * 4; }
+
+std::string ppc::util::GetEnvVariable(const std::string &name) {
+#ifdef _WIN32
+  size_t len;
+  char value[1024];
+  errno_t err = getenv_s(&len, value, sizeof(value), name.c_str());
+  if (err != 0 || len == 0) {
+    return {};
+  }
+  return std::string(value);
+#else
+  const char *value = std::getenv(name.c_str());
+  return (value != nullptr) ? std::string(value) : std::string();
+#endif
+}
@@ -1,10 +1,12 @@
 import argparse
+import json
 import os
 import re
 import xlsxwriter
 
 parser = argparse.ArgumentParser()
-parser.add_argument('-i', '--input', help='Input file path (logs of perf tests, .txt)', required=True)
+parser.add_argument('-i', '--input', help='Input file path (logs of perf tests .txt or perf results .jsonl)',
+                    required=True)
 parser.add_argument('-o', '--output', help='Output file path (path to .xlsx table)', required=True)
 args = parser.parse_args()
 logs_path = os.path.abspath(args.input)
@@ -15,32 +17,50 @@ list_of_type_of_tasks = ["all", "mpi", "omp", "seq", "stl", "tbb"]
 result_tables = {"pipeline": {}, "task_run": {}}
 set_of_task_name = []
 
+
+def parse_log_records(lines):
+    # legacy format of stdout: tasks/<type>/<name>:<perf_type>:<time>
+    records = []
+    for line in lines:
+        pattern = r'tasks[\/|\\](\w*)[\/|\\](\w*):(\w*):(-*\d*\.\d*)'
+        result = re.findall(pattern, line)
+        if len(result):
+            records.append((result[0][0], result[0][1], result[0][2], float(result[0][3])))
+    return records
+
+
+def parse_jsonl_records(lines):
+    # structured format written by ppc::core::Perf when PPC_PERF_OUTPUT is set
+    records = []
+    for line in lines:
+        if not line.strip():
+            continue
+        result = json.loads(line)
+        if result["type_of_running"] not in result_tables:
+            continue
+        records.append((result["backend"], result["task_id"], result["type_of_running"], float(result["time_sec"])))
+    return records
+
+
 logs_file = open(logs_path, "r")
 logs_lines = logs_file.readlines()
-for line in logs_lines:
-    pattern = r'tasks[\/|\\](\w*)[\/|\\](\w*):(\w*):(-*\d*\.\d*)'
-    result = re.findall(pattern, line)
-    if len(result):
-        task_name = result[0][1]
-        perf_type = result[0][2]
-        set_of_task_name.append(task_name)
-        result_tables[perf_type][task_name] = {}
-
-        for ttype in list_of_type_of_tasks:
-            result_tables[perf_type][task_name][ttype] = -1.0
-
-for line in logs_lines:
-    pattern = r'tasks[\/|\\](\w*)[\/|\\](\w*):(\w*):(-*\d*\.\d*)'
-    result = re.findall(pattern, line)
-    if len(result):
-        task_type = result[0][0]
-        task_name = result[0][1]
-        perf_type = result[0][2]
-        perf_time = float(result[0][3])
-        if perf_time < 0.05:
-            msg = f"Performance time = {perf_time} < 0.05 second : for {task_type} - {task_name} - {perf_type} \n"
-            raise Exception(msg)
-        result_tables[perf_type][task_name][task_type] = perf_time
+if logs_path.endswith(".jsonl") or logs_path.endswith(".json"):
+    perf_records = parse_jsonl_records(logs_lines)
+else:
+    perf_records = parse_log_records(logs_lines)
+
+for task_type, task_name, perf_type, perf_time in perf_records:
+    set_of_task_name.append(task_name)
+    result_tables[perf_type][task_name] = {}
+
+    for ttype in list_of_type_of_tasks:
+        result_tables[perf_type][task_name][ttype] = -1.0
+
+for task_type, task_name, perf_type, perf_time in perf_records:
+    if perf_time < 0.05:
+        msg = f"Performance time = {perf_time} < 0.05 second : for {task_type} - {task_name} - {perf_type} \n"
+        raise Exception(msg)
+    result_tables[perf_type][task_name][task_type] = perf_time
 
 
 for table_name in result_tables:
@@ -11,7 +11,7 @@ def init_cmd_args():
     parser.add_argument(
         "--running-type",
         required=True,
-        choices=["threads", "processes", "performance", "performance-list"],
+        choices=["threads", "processes", "performance", "performance-list", "performance-scaling"],
         help="Specify the execution mode. Choose 'threads' for multithreading or 'processes' for multiprocessing."
     )
     parser.add_argument(
@@ -159,6 +159,9 @@ class PPCRunner:
                                 f"{self.__get_gtest_settings(10)}")
 
     def run_performance(self):
+        # timed runs stop once the 95% confidence interval of their mean is within 2% of it
+        if not os.environ.get("PPC_PERF_TARGET_REL_CI"):
+            os.environ["PPC_PERF_TARGET_REL_CI"] = "0.02"
         if not os.environ.get("ASAN_RUN"):
             proc_count = os.environ.get("PROC_COUNT")
             if proc_count is None:
@@ -172,6 +175,13 @@ class PPCRunner:
         self.__run_exec(f"{self.work_dir / 'stl_perf_tests'} {self.__get_gtest_settings(1)}")
         self.__run_exec(f"{self.work_dir / 'tbb_perf_tests'} {self.__get_gtest_settings(1)}")
 
+    def run_performance_scaling(self):
+        # every perf test is repeated for each thread count of PPC_THREAD_SWEEP in one process
+        if not os.environ.get("PPC_THREAD_SWEEP"):
+            os.environ["PPC_THREAD_SWEEP"] = "max"
+        for task_type in ["omp", "stl", "tbb"]:
+            self.__run_exec(f"{self.work_dir / f'{task_type}_perf_tests'} --gtest_color=0")
+
     def run_performance_list(self):
         for task_type in ["all", "mpi", "omp", "seq", "stl", "tbb"]:
             self.__run_exec(f"{self.work_dir / f'{task_type}_perf_tests'} --gtest_list_tests")
@@ -194,5 +204,7 @@ if __name__ == "__main__":
         ppc_runner.run_performance()
     elif args_dict["running_type"] == "performance-list":
         ppc_runner.run_performance_list()
+    elif args_dict["running_type"] == "performance-scaling":
+        ppc_runner.run_performance_scaling()
     else:
         raise Exception("running-type is wrong!")
@@ -8,21 +8,14 @@
 #include <vector>
 
 #include "boost/mpi/collectives/broadcast.hpp"
+#include "core/gemm/include/gemm.hpp"
 
 namespace borisov_s_strassen_all {
 namespace {
 
-std::vector<double> MultiplyNaive(const std::vector<double>& a, const std::vector<double>& b, int n) {
-  std::vector<double> c(n * n, 0.0);
-  for (int i = 0; i < n; ++i) {
-    for (int j = 0; j < n; ++j) {
-      double s = 0.0;
-      for (int k = 0; k < n; ++k) {
-        s += a[(i * n) + k] * b[(k * n) + j];
-      }
-      c[(i * n) + j] = s;
-    }
-  }
+std::vector<double> MultiplyBase(const std::vector<double>& a, const std::vector<double>& b, int n) {
+  std::vector<double> c(n * n);
+  ppc::core::gemm::Multiply(a, b, c, n, n, n);
   return c;
 }
 
@@ -68,7 +61,7 @@ std::vector<double> StrassenRecursive(const std::vector<double>& a, const std::v
                                       int depth = 0) {
   const int parallel_depth = 2;
   if (n <= 128) {
-    return MultiplyNaive(a, b, n);
+    return MultiplyBase(a, b, n);
   }
 
   int k = n / 2;
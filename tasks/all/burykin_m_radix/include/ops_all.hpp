@@ -22,16 +22,6 @@ class RadixALL : public ppc::core::Task {
   std::vector<int> local_data_;
   boost::mpi::communicator world_;
 
-  // Core radix sort functions
-  static void RadixSortLocal(std::vector<int>& arr);
-  static void CountingSortByDigit(std::vector<int>& arr, int exp);
-  static void RadixSortPositive(std::vector<int>& arr);
-
-  // Helper functions for signed integers
-  static void SplitBySign(const std::vector<int>& arr, std::vector<int>& negatives, std::vector<int>& positives);
-  static void MergeResults(std::vector<int>& result, const std::vector<int>& negatives,
-                           const std::vector<int>& positives);
-
   // MPI distribution and merging functions
   std::vector<int> DistributeData(const std::vector<int>& data, int rank, int size);
   std::vector<int> GatherAndMerge(const std::vector<int>& local_sorted, int rank, int size);
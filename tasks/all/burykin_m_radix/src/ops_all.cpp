@@ -1,19 +1,19 @@
 #include "all/burykin_m_radix/include/ops_all.hpp"
 
-#include <omp.h>
-
-#include <algorithm>
 #include <boost/mpi/collectives.hpp>
 #include <boost/mpi/collectives/broadcast.hpp>
 #include <boost/mpi/communicator.hpp>
 #include <boost/serialization/vector.hpp>  // NOLINT(misc-include-cleaner) - needed for MPI serialization
-#include <cmath>
 #include <cstddef>
 #include <cstring>
-#include <numeric>
+#include <span>
 #include <utility>
 #include <vector>
 
+#include "core/sort/include/radix_sort.hpp"
+#include "core/util/include/omp_for.hpp"
+#include "core/util/include/util.hpp"
+
 bool burykin_m_radix_all::RadixALL::ValidationImpl() {
   if (world_.rank() == 0) {
     return task_data->inputs_count[0] == task_data->outputs_count[0];
@@ -47,53 +47,12 @@ bool burykin_m_radix_all::RadixALL::RunImpl() {
     return true;
   }
 
-  // Split data on rank 0 and distribute directly
-  std::vector<int> negatives;
-  std::vector<int> positives;
-  if (rank == 0) {
-    SplitBySign(input_, negatives, positives);
-  }
-
-  // Distribute negatives and positives separately to all processes
-  local_data_ = DistributeData(negatives, rank, size);
-  std::vector<int> local_positives = DistributeData(positives, rank, size);
-
-  // Sort local data
-  std::vector<int> sorted_local_negatives;
-  std::vector<int> sorted_local_positives;
-
-  if (!local_data_.empty()) {
-    RadixSortPositive(local_data_);
-    sorted_local_negatives = local_data_;
-  }
-
-  if (!local_positives.empty()) {
-    RadixSortPositive(local_positives);
-    sorted_local_positives = local_positives;
-  }
-
-  // Gather results
-  std::vector<int> sorted_negatives;
-  std::vector<int> sorted_positives;
-
+  // Sort the chunk of every process by all its threads and merge the sorted chunks on rank 0
+  local_data_ = DistributeData(input_, rank, size);
+  ppc::core::sort::RadixSort(std::span<int>(local_data_), ppc::util::GetPPCNumChunks(), ppc::util::OmpFor{});
+  std::vector<int> sorted = GatherAndMerge(local_data_, rank, size);
   if (rank == 0) {
-    sorted_negatives = GatherAndMerge(sorted_local_negatives, rank, size);
-    sorted_positives = GatherAndMerge(sorted_local_positives, rank, size);
-
-    // Process negatives (reverse and negate)
-    if (!sorted_negatives.empty()) {
-      std::ranges::reverse(sorted_negatives);
-      std::ranges::transform(sorted_negatives, sorted_negatives.begin(), [](int x) { return -x; });
-    }
-
-    // Combine results
-    output_.clear();
-    output_.reserve(sorted_negatives.size() + sorted_positives.size());
-    output_.insert(output_.end(), sorted_negatives.begin(), sorted_negatives.end());
-    output_.insert(output_.end(), sorted_positives.begin(), sorted_positives.end());
-  } else {
-    GatherAndMerge(sorted_local_negatives, rank, size);
-    GatherAndMerge(sorted_local_positives, rank, size);
+    output_ = std::move(sorted);
   }
 
   return true;
@@ -107,74 +66,6 @@ bool burykin_m_radix_all::RadixALL::PostProcessingImpl() {
   return true;
 }
 
-void burykin_m_radix_all::RadixALL::RadixSortLocal(std::vector<int>& arr) { RadixSortPositive(arr); }
-
-void burykin_m_radix_all::RadixALL::RadixSortPositive(std::vector<int>& arr) {
-  if (arr.empty()) {
-    return;
-  }
-
-  int max_val = *std::ranges::max_element(arr);
-  for (int exp = 1; max_val / exp > 0; exp *= 10) {
-    CountingSortByDigit(arr, exp);
-  }
-}
-
-void burykin_m_radix_all::RadixALL::CountingSortByDigit(std::vector<int>& arr, int exp) {
-  const int n = static_cast<int>(arr.size());
-  std::vector<int> output(n);
-  std::vector<int> count(10, 0);
-
-#pragma omp parallel
-  {
-    std::vector<int> local_count(10, 0);
-
-#pragma omp for
-    for (int i = 0; i < n; i++) {
-      local_count[(arr[i] / exp) % 10]++;
-    }
-
-#pragma omp critical
-    {
-      for (int i = 0; i < 10; i++) {
-        count[i] += local_count[i];
-      }
-    }
-  }
-
-  std::partial_sum(count.begin(), count.end(), count.begin());
-
-  for (int i = n - 1; i >= 0; i--) {
-    int digit = (arr[i] / exp) % 10;
-    output[--count[digit]] = arr[i];
-  }
-
-  arr = std::move(output);
-}
-
-void burykin_m_radix_all::RadixALL::SplitBySign(const std::vector<int>& arr, std::vector<int>& negatives,
-                                                std::vector<int>& positives) {
-  negatives.clear();
-  positives.clear();
-
-  for (int num : arr) {
-    if (num < 0) {
-      negatives.push_back(-num);  // Store as positive for radix sort
-    } else {
-      positives.push_back(num);
-    }
-  }
-}
-
-void burykin_m_radix_all::RadixALL::MergeResults(std::vector<int>& result, const std::vector<int>& negatives,
-                                                 const std::vector<int>& positives) {
-  result.clear();
-  result.reserve(negatives.size() + positives.size());
-
-  result.insert(result.end(), negatives.begin(), negatives.end());
-  result.insert(result.end(), positives.begin(), positives.end());
-}
-
 std::vector<int> burykin_m_radix_all::RadixALL::DistributeData(const std::vector<int>& data, int rank, int size) {
   std::vector<int> local_data;
 
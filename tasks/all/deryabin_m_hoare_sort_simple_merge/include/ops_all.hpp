@@ -9,8 +9,6 @@
 #include "core/task/include/task.hpp"
 
 namespace deryabin_m_hoare_sort_simple_merge_mpi {
-double PivotCalculation(std::vector<double>::iterator first, std::vector<double>::iterator last);
-void SeqHoaraSort(std::vector<double>::iterator first, std::vector<double>::iterator last);
 void HoaraSort(std::vector<double>::iterator first, std::vector<double>::iterator last);
 void MergeUnequalTwoParts(std::vector<double>::iterator first, std::vector<double>::iterator mid,
                           std::vector<double>::iterator last);
@@ -1,7 +1,7 @@
 #include "all/deryabin_m_hoare_sort_simple_merge/include/ops_all.hpp"
 
+#include <oneapi/tbb/blocked_range.h>
 #include <oneapi/tbb/parallel_for.h>
-#include <oneapi/tbb/parallel_invoke.h>
 
 #include <algorithm>
 #include <bit>
@@ -9,91 +9,20 @@
 #include <cmath>
 #include <cstddef>
 #include <iterator>
+#include <span>
 #include <vector>
 
-double deryabin_m_hoare_sort_simple_merge_mpi::PivotCalculation(std::vector<double>::iterator first,
-                                                                std::vector<double>::iterator last) {
-  const auto mid = first + ((last - first) >> 1);
-  double pivot_value = NAN;
-  if (last - first < 199) {
-    pivot_value = *mid;
-  } else {
-    if (*first < *mid) {
-      if (*mid < *last) {
-        pivot_value = *mid;
-      } else {
-        pivot_value = std::max(*first, *last);
-      }
-    } else {
-      if (*first < *last) {
-        pivot_value = *first;
-      } else {
-        pivot_value = std::max(*mid, *last);
-      }
-    }
-  }
-  return pivot_value;
-}
-
-void deryabin_m_hoare_sort_simple_merge_mpi::SeqHoaraSort(std::vector<double>::iterator first,
-                                                          std::vector<double>::iterator last) {
-  if (first >= last) {
-    return;
-  }
-  const double pivot_value = PivotCalculation(first, last);
-  auto left = first;
-  auto right = last;
-  do {
-    while (left < last && *left < pivot_value) {
-      left++;
-    }
-    while (right > first && *right > pivot_value) {
-      right--;
-    }
-    if (*left == *right && left != right) {
-      if (*left < *(left + 1)) {
-        left++;
-      } else {
-        right--;
-      }
-    }
-    std::iter_swap(left, right);
-  } while (left != right);
-  SeqHoaraSort(first, right);
-  SeqHoaraSort(left + 1, last);
-}
+#include "core/sort/include/quick_sort.hpp"
+#include "core/util/include/tbb_for.hpp"
+#include "core/util/include/util.hpp"
 
 void deryabin_m_hoare_sort_simple_merge_mpi::HoaraSort(std::vector<double>::iterator first,
                                                        std::vector<double>::iterator last) {
   if (first >= last) {
     return;
   }
-  const double pivot_value = PivotCalculation(first, last);
-  auto left = first;
-  auto right = last;
-  do {
-    while (left < last && *left < pivot_value) {
-      left++;
-    }
-    while (right > first && *right > pivot_value) {
-      right--;
-    }
-    if (*left == *right && left != right) {
-      if (*left < *(left + 1)) {
-        left++;
-      } else {
-        right--;
-      }
-    }
-    std::iter_swap(left, right);
-  } while (left != right);
-  if (last - first < 199) {
-    HoaraSort(first, right);
-    HoaraSort(left + 1, last);
-  } else {
-    oneapi::tbb::parallel_invoke([&first, &right]() { HoaraSort(first, right); },
-                                 [&left, &last]() { HoaraSort(left + 1, last); });
-  }
+  ppc::core::sort::QuickSort(std::span<double>(first, last + 1),
+                             4 * static_cast<size_t>(ppc::util::GetPPCNumThreads()), ppc::util::TbbFor{});
 }
 
 void deryabin_m_hoare_sort_simple_merge_mpi::MergeUnequalTwoParts(std::vector<double>::iterator first,
@@ -1,8 +1,7 @@
 #include "all/example/include/ops_all.hpp"
 
 #include <cmath>
-#include <cstddef>
-#include <functional>
+#include <span>
 #include <thread>
 #include <vector>
 
@@ -11,7 +10,7 @@
 #include "oneapi/tbb/task_group.h"
 
 namespace {
-void MatMul(const std::vector<int> &in_vec, int rc_size, std::vector<int> &out_vec) {
+void MatMul(std::span<const int> in_vec, int rc_size, std::span<int> out_vec) {
   for (int i = 0; i < rc_size; ++i) {
     for (int j = 0; j < rc_size; ++j) {
       out_vec[(i * rc_size) + j] = 0;
@@ -24,15 +23,11 @@ void MatMul(const std::vector<int> &in_vec, int rc_size, std::vector<int> &out_v
 }  // namespace
 
 bool nesterov_a_test_task_all::TestTaskALL::PreProcessingImpl() {
-  // Init value for input and output
-  unsigned int input_size = task_data->inputs_count[0];
-  auto *in_ptr = reinterpret_cast<int *>(task_data->inputs[0]);
-  input_ = std::vector<int>(in_ptr, in_ptr + input_size);
+  // Init views of input and output, the task works directly on caller memory
+  input_ = task_data->GetInput<const int>(0);
+  output_ = task_data->GetOutput<int>(0);
 
-  unsigned int output_size = task_data->outputs_count[0];
-  output_ = std::vector<int>(output_size, 0);
-
-  rc_size_ = static_cast<int>(std::sqrt(input_size));
+  rc_size_ = static_cast<int>(std::sqrt(input_.size()));
   return true;
 }
 
@@ -62,7 +57,7 @@ bool nesterov_a_test_task_all::TestTaskALL::RunImpl() {
   const int num_threads = ppc::util::GetPPCNumThreads();
   std::vector<std::thread> threads(num_threads);
   for (int i = 0; i < num_threads; i++) {
-    threads[i] = std::thread(MatMul, std::cref(input_), rc_size_, std::ref(output_));
+    threads[i] = std::thread(MatMul, input_, rc_size_, output_);
     threads[i].join();
   }
 
@@ -70,9 +65,4 @@ bool nesterov_a_test_task_all::TestTaskALL::RunImpl() {
   return true;
 }
 
-bool nesterov_a_test_task_all::TestTaskALL::PostProcessingImpl() {
-  for (size_t i = 0; i < output_.size(); i++) {
-    reinterpret_cast<int *>(task_data->outputs[0])[i] = output_[i];
-  }
-  return true;
-}
+bool nesterov_a_test_task_all::TestTaskALL::PostProcessingImpl() { return true; }
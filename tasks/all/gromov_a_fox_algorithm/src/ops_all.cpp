@@ -9,6 +9,8 @@
 #include <algorithm>
 #include <boost/mpi/collectives.hpp>
 #include <boost/mpi/communicator.hpp>
+#include <boost/mpi/nonblocking.hpp>
+#include <boost/mpi/request.hpp>
 #include <cmath>
 #include <cstddef>
 #include <cstring>
@@ -22,6 +24,29 @@
 
 namespace gromov_a_fox_algorithm_all {
 
+namespace {
+
+// posts the broadcast of the A blocks of a Fox step along the process row: the process in column
+// (row + step) % grid sends its block to the other processes of the row, all of them get it in block
+void PostRowBroadcast(const boost::mpi::communicator& mpi_comm, int process_row, int process_col, int grid_size,
+                      int step, const std::vector<double>& local_matrix_a, std::vector<double>& block,
+                      std::vector<boost::mpi::request>& requests) {
+  int root_col = (process_row + step) % grid_size;
+  int count = static_cast<int>(block.size());
+  if (process_col != root_col) {
+    requests.push_back(mpi_comm.irecv((process_row * grid_size) + root_col, 0, block.data(), count));
+    return;
+  }
+  for (int target_col_idx = 0; target_col_idx < grid_size; ++target_col_idx) {
+    if (target_col_idx != process_col) {
+      requests.push_back(mpi_comm.isend((process_row * grid_size) + target_col_idx, 0, local_matrix_a.data(), count));
+    }
+  }
+  std::ranges::copy(local_matrix_a, block.begin());
+}
+
+}  // namespace
+
 bool TestTaskAll::PreProcessingImpl() {
   if (mpiCommunicator_.rank() == 0) {
     auto* input_data_ptr = reinterpret_cast<double*>(task_data->inputs[0]);
@@ -193,38 +218,37 @@ void FoxStep(boost::mpi::communicator& mpi_comm, int process_rank, int active_pr
     return;
   }
 
-  std::vector<double> temp_matrix_a(block_size * block_size);
-  std::vector<double> temp_matrix_b(block_size * block_size);
-
   int process_row = process_rank / active_process_count;
   int process_col = process_rank % active_process_count;
+  int send_to_process =
+      (((process_row - 1 + active_process_count) % active_process_count) * active_process_count) + process_col;
+  int recv_from_process = (((process_row + 1) % active_process_count) * active_process_count) + process_col;
+
+  // the broadcast A block and the B block of the next step arrive into second buffers while the current ones
+  // are multiplied
+  std::vector<double> temp_matrix_a(block_size * block_size);
+  std::vector<double> next_matrix_a(block_size * block_size);
+  std::vector<double> next_matrix_b(block_size * block_size);
+  std::vector<boost::mpi::request> requests;
+  PostRowBroadcast(mpi_comm, process_row, process_col, active_process_count, 0, local_matrix_a, temp_matrix_a,
+                   requests);
+  boost::mpi::wait_all(requests.begin(), requests.end());
 
   for (int step_idx = 0; step_idx < active_process_count; ++step_idx) {
-    if (process_col == (process_row + step_idx) % active_process_count) {
-      for (int target_col_idx = 0; target_col_idx < active_process_count; ++target_col_idx) {
-        if (target_col_idx == process_col) {
-          continue;
-        }
-        int target_process = (process_row * active_process_count) + target_col_idx;
-        mpi_comm.send(target_process, 0, local_matrix_a.data(), block_size * block_size);
-      }
-      temp_matrix_a = local_matrix_a;
-    } else {
-      int sender_process = (process_row * active_process_count) + ((process_row + step_idx) % active_process_count);
-      mpi_comm.recv(sender_process, 0, temp_matrix_a.data(), block_size * block_size);
+    requests.clear();
+    bool has_next = step_idx + 1 < active_process_count;
+    if (has_next) {
+      PostRowBroadcast(mpi_comm, process_row, process_col, active_process_count, step_idx + 1, local_matrix_a,
+                       next_matrix_a, requests);
+      requests.push_back(mpi_comm.irecv(recv_from_process, 1, next_matrix_b.data(), block_size * block_size));
+      requests.push_back(mpi_comm.isend(send_to_process, 1, local_matrix_b.data(), block_size * block_size));
     }
-    mpi_comm.barrier();
     MultBlocks(temp_matrix_a.data(), local_matrix_b.data(), local_matrix_c.data(), block_size);
-    int send_to_process =
-        (((process_row - 1 + active_process_count) % active_process_count) * active_process_count) + process_col;
-    int recv_from_process = (((process_row + 1) % active_process_count) * active_process_count) + process_col;
-
-    mpi_comm.send(send_to_process, 0, local_matrix_b.data(), block_size * block_size);
-    mpi_comm.recv(recv_from_process, 0, temp_matrix_b.data(), block_size * block_size);
-
-    mpi_comm.barrier();
-
-    local_matrix_b.swap(temp_matrix_b);
+    if (has_next) {
+      boost::mpi::wait_all(requests.begin(), requests.end());
+      temp_matrix_a.swap(next_matrix_a);
+      local_matrix_b.swap(next_matrix_b);
+    }
   }
 }
 
@@ -14,9 +14,11 @@
 #include <iterator>
 #include <limits>
 #include <ranges>
-#include <thread>
+#include <span>
 #include <vector>
 
+#include "core/sort/include/msd_radix_sort.hpp"
+#include "core/util/include/pool_for.hpp"
 #include "core/util/include/util.hpp"
 
 namespace khovansky_d_double_radix_batcher_all {
@@ -44,54 +46,6 @@ double DecodeUint64ToDouble(uint64_t transformed_data) {
   return result;
 }
 
-void RadixSort(std::vector<uint64_t>& array, int thread_count) {
-  const int bits_in_byte = 8;
-  const int total_bits = 64;
-  const int bucket_count = 256;
-
-  std::vector<uint64_t> buffer(array.size(), 0);
-  std::vector<std::vector<int>> local_frequencies(thread_count, std::vector<int>(bucket_count, 0));
-
-  for (int shift = 0; shift < total_bits; shift += bits_in_byte) {
-    std::vector<std::thread> threads;
-    size_t n = array.size();
-    size_t block_size = (n + thread_count - 1) / thread_count;
-
-    for (int t = 0; t < thread_count; ++t) {
-      size_t begin = t * block_size;
-      size_t end = std::min(begin + block_size, n);
-
-      threads.emplace_back([&, begin, end, t]() {
-        for (size_t i = begin; i < end; ++i) {
-          auto bucket = static_cast<uint8_t>((array[i] >> shift) & 0xFF);
-          local_frequencies[t][bucket]++;
-        }
-      });
-    }
-    for (auto& th : threads) {
-      th.join();
-    }
-
-    std::vector<int> frequency(bucket_count, 0);
-    for (int b = 0; b < bucket_count; ++b) {
-      for (int t = 0; t < thread_count; ++t) {
-        frequency[b] += local_frequencies[t][b];
-        local_frequencies[t][b] = 0;
-      }
-    }
-
-    for (int i = 1; i < bucket_count; i++) {
-      frequency[i] += frequency[i - 1];
-    }
-
-    for (int i = static_cast<int>(array.size()) - 1; i >= 0; i--) {
-      auto bucket = static_cast<uint8_t>((array[i] >> shift) & 0xFF);
-      buffer[--frequency[bucket]] = array[i];
-    }
-
-    array.swap(buffer);
-  }
-}
 }  // namespace
 }  // namespace khovansky_d_double_radix_batcher_all
 
@@ -148,14 +102,13 @@ bool khovansky_d_double_radix_batcher_all::RadixAll::RunImpl() {
   int rank = world_.rank();
   int size = world_.size();
 
+  std::vector<double> sorted = input_;
+  ppc::core::sort::MsdRadixSort(std::span<double>(sorted), ppc::util::GetPPCNumChunks(), ppc::util::PoolFor{});
   std::vector<uint64_t> local;
-  local.reserve(input_.size());
-  for (auto d : input_) {
+  local.reserve(sorted.size());
+  for (auto d : sorted) {
     local.push_back(EncodeDoubleToUint64(d));
   }
-  size_t n = local.size();
-  const int thread_count = std::max(1, std::min(static_cast<int>(n), ppc::util::GetPPCNumThreads()));
-  RadixSort(local, thread_count);
 
   int stages = static_cast<int>(std::ceil(std::log2(size)));
   for (int stage = 0; stage < stages; ++stage) {
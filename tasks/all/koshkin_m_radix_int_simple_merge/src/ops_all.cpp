@@ -5,71 +5,23 @@
 #include <tbb/tbb.h>
 
 #include <algorithm>
-#include <climits>
 #include <cmath>
 #include <cstddef>
 #include <cstdio>
-#include <numeric>
-#include <ranges>
 #include <span>
 #include <string>
-#include <type_traits>
 #include <utility>
 #include <vector>
 
 #include "boost/mpi/collectives/broadcast.hpp"
 #include "boost/mpi/communicator.hpp"
+#include "core/sort/include/radix_sort.hpp"
 #include "core/util/include/util.hpp"
 
 namespace {
-void RadixIntegerSortHomogenous(std::span<int> arr) {
-  using TInt = std::decay_t<decltype(arr)>::value_type;
-
-  const auto convert = [](TInt num, std::size_t i) {
-    constexpr TInt kMask = 1 << ((sizeof(TInt) * CHAR_BIT) - 1);
-    num = ((num & kMask) == 0U) ? (num | kMask) : (~num);
-    return (num >> (i * 8)) & 0xFF;
-  };
-
-  std::vector<TInt> bufbuf(arr.size());
-  std::span<TInt> buf{bufbuf};
-  std::size_t counts[1 << 8];
-
-  for (std::size_t pp = 0; pp < sizeof(TInt); ++pp) {
-    std::ranges::fill(counts, 0);
-    for (auto &num : arr) {
-      ++counts[convert(num, pp)];
-    }
-    std::partial_sum(std::begin(counts), std::end(counts), std::begin(counts));
-    for (auto &num : std::views::reverse(arr)) {
-      buf[--counts[convert(num, pp)]] = num;
-    }
-    std::swap(arr, buf);
-  }
-}
-
 std::vector<int> RadixIntegerSort(std::span<int> arr) {
-  std::vector<int> res(arr.size());
-
-  std::size_t left = 0;
-  std::size_t right = arr.size();
-  for (auto num : arr) {
-    if (num < 0) {
-      res[left++] = num;
-    } else {
-      res[--right] = num;
-    }
-  }
-
-  // NOLINTBEGIN(bugprone-narrowing-conversions) :: std::size_t -> std::vector<T>::difference_type
-  std::span<int> neg(res.begin(), res.begin() + left);
-  std::span<int> pos(res.begin() + right, res.end());
-  // NOLINTEND(bugprone-narrowing-conversions)
-
-  RadixIntegerSortHomogenous(neg);
-  RadixIntegerSortHomogenous(pos);
-
-  std::ranges::reverse(neg);
+  std::vector<int> res(arr.begin(), arr.end());
+  ppc::core::sort::RadixSort(std::span<int>(res));
   return res;
 }
 }  // namespace
@@ -13,11 +13,17 @@
 #include <boost/mpi/operations.hpp>
 #include <climits>
 #include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <iterator>
 #include <utility>
 #include <vector>
 
+#include "core/graph/include/adjacency_stream.hpp"
+#include "core/graph/include/csr_graph.hpp"
+#include "core/util/include/tbb_for.hpp"
+#include "core/util/include/util.hpp"
+
 namespace {
 bool ProcessLocalQueue(oneapi::tbb::concurrent_priority_queue<std::pair<int, int>, std::greater<>>& pq,
                        int& local_distance, int& local_vertex) {
@@ -41,15 +47,15 @@ std::pair<int, int> SynchronizeMinDistance(boost::mpi::communicator& world, int
   return global_min;
 }
 
-void ProcessNeighbors(size_t u, const std::vector<std::vector<std::pair<size_t, int>>>& adj_list,
-                      std::vector<int>& local_distances,
+void ProcessNeighbors(size_t u, const ppc::core::graph::CsrGraphView& graph, std::vector<int>& local_distances,
                       oneapi::tbb::concurrent_priority_queue<std::pair<int, int>, std::greater<>>& pq,
                       oneapi::tbb::spin_mutex& mutex) {
   oneapi::tbb::parallel_for(
-      oneapi::tbb::blocked_range<size_t>(0, adj_list[u].size()), [&](const oneapi::tbb::blocked_range<size_t>& r) {
-        for (size_t i = r.begin(); i != r.end(); ++i) {
-          const size_t v = adj_list[u][i].first;
-          const int weight = adj_list[u][i].second;
+      oneapi::tbb::blocked_range<uint64_t>(graph.EdgesBegin(u), graph.EdgesEnd(u)),
+      [&](const oneapi::tbb::blocked_range<uint64_t>& r) {
+        for (uint64_t e = r.begin(); e != r.end(); ++e) {
+          const size_t v = graph.Target(e);
+          const int weight = graph.Weight(e);
           const int new_dist =
               (local_distances[u] == INT_MAX || weight == INT_MAX) ? INT_MAX : local_distances[u] + weight;
 
@@ -71,7 +77,7 @@ void SynchronizeDistances(boost::mpi::communicator& world, std::vector<int>& loc
   std::ranges::copy(global_distances.begin(), global_distances.end(), local_distances.begin());
 }
 
-void RunDijkstraAlgorithm(const std::vector<std::vector<std::pair<size_t, int>>>& adj_list, std::vector<int>& distances,
+void RunDijkstraAlgorithm(const ppc::core::graph::CsrGraphView& graph, std::vector<int>& distances,
                           size_t start_vertex, boost::mpi::communicator& world, size_t num_vertices) {
   oneapi::tbb::concurrent_priority_queue<std::pair<int, int>, std::greater<>> pq;
   oneapi::tbb::spin_mutex mutex;
@@ -100,18 +106,17 @@ void RunDijkstraAlgorithm(const std::vector<std::vector<std::pair<size_t, int>>>
       continue;
     }
 
-    ProcessNeighbors(u, adj_list, local_distances, pq, mutex);
+    ProcessNeighbors(u, graph, local_distances, pq, mutex);
     SynchronizeDistances(world, local_distances, global_distances, num_vertices);
   }
 
   distances = local_distances;
 }
-}  // namespace
 
-const int muhina_m_dijkstra_all::TestTaskALL::kEndOfVertexList = -1;
+}  // namespace
 
 bool muhina_m_dijkstra_all::TestTaskALL::PreProcessingImpl() {
-  graph_data_.clear();
+  std::vector<int> graph_data;
   distances_.clear();
 
   if (!task_data) {
@@ -124,13 +129,13 @@ bool muhina_m_dijkstra_all::TestTaskALL::PreProcessingImpl() {
     if (in_ptr == nullptr) {
       return false;
     }
-    graph_data_.reserve(input_size);
-    std::ranges::copy(in_ptr, in_ptr + input_size, std::back_inserter(graph_data_));
+    graph_data.reserve(input_size);
+    std::ranges::copy(in_ptr, in_ptr + input_size, std::back_inserter(graph_data));
     for (int proc = 1; proc < world_.size(); proc++) {
-      world_.send(proc, 0, graph_data_);
+      world_.send(proc, 0, graph_data);
     }
   } else {
-    world_.recv(0, 0, graph_data_);
+    world_.recv(0, 0, graph_data);
   }
 
   if (task_data->outputs_count.empty()) {
@@ -156,7 +161,12 @@ bool muhina_m_dijkstra_all::TestTaskALL::PreProcessingImpl() {
     start_vertex_ = 0;
   }
 
-  return true;
+  // the graph is parsed once here, so the run only computes distances
+  graph_valid_ = ppc::core::graph::BuildFromAdjacencyStream(graph_data, num_vertices_,
+                                                            ppc::core::graph::StreamCheck::kLenient, graph_,
+                                                            static_cast<size_t>(ppc::util::GetPPCNumThreads()) * 4,
+                                                            ppc::util::TbbFor{});
+  return graph_valid_;
 }
 
 bool muhina_m_dijkstra_all::TestTaskALL::ValidationImpl() {
@@ -168,36 +178,11 @@ bool muhina_m_dijkstra_all::TestTaskALL::ValidationImpl() {
 }
 
 bool muhina_m_dijkstra_all::TestTaskALL::RunImpl() {
-  std::vector<std::vector<std::pair<size_t, int>>> adj_list(num_vertices_);
-  size_t current_vertex = 0;
-  size_t i = 0;
-
-  while (i < graph_data_.size() && current_vertex < num_vertices_) {
-    if (i >= graph_data_.size()) {
-      return false;
-    }
-    if (graph_data_[i] == kEndOfVertexList) {
-      current_vertex++;
-      i++;
-      continue;
-    }
-    if (i + 1 >= graph_data_.size()) {
-      break;
-    }
-
-    const auto dest = static_cast<size_t>(graph_data_[i]);
-    const int weight = graph_data_[i + 1];
-    if (weight < 0) {
-      return false;
-    }
-
-    if (dest < num_vertices_) {
-      adj_list[current_vertex].emplace_back(dest, weight);
-    }
-    i += 2;
+  if (!graph_valid_) {
+    return false;
   }
 
-  RunDijkstraAlgorithm(adj_list, distances_, start_vertex_, world_, num_vertices_);
+  RunDijkstraAlgorithm(graph_, distances_, start_vertex_, world_, num_vertices_);
   return true;
 }
 
@@ -1,6 +1,5 @@
 #include "../include/ops_all.hpp"
 
-#include <algorithm>
 #include <boost/mpi/collectives/broadcast.hpp>
 #include <boost/mpi/collectives/gather.hpp>
 #include <boost/mpi/collectives/scatterv.hpp>
@@ -8,14 +7,15 @@
 #include <cstddef>
 #include <functional>
 #include <queue>
-#include <random>
+#include <span>
 #include <tuple>
 #include <utility>
 #include <vector>
 
+#include "core/sort/include/quick_sort.hpp"
+#include "core/util/include/tbb_for.hpp"
 #include "core/util/include/util.hpp"
 #include "oneapi/tbb/task_arena.h"
-#include "oneapi/tbb/task_group.h"
 
 bool nikolaev_r_hoare_sort_simple_merge_all::HoareSortSimpleMergeALL::PreProcessingImpl() {
   if (world_.rank() == 0) {
@@ -60,27 +60,7 @@ void nikolaev_r_hoare_sort_simple_merge_all::HoareSortSimpleMergeALL::QuickSort(
   if (low >= high) {
     return;
   }
-
-  std::random_device rd;
-  std::mt19937 gen(rd());
-  std::uniform_int_distribution<int> dist(static_cast<int>(low), static_cast<int>(high));
-  size_t random_pivot_index = dist(gen);
-  double pivot = vec[random_pivot_index];
-  std::swap(vec[random_pivot_index], vec[low]);
-
-  size_t i = low + 1;
-  for (size_t j = low + 1; j <= high; ++j) {
-    if (vec[j] < pivot) {
-      std::swap(vec[i], vec[j]);
-      ++i;
-    }
-  }
-  std::swap(vec[low], vec[i - 1]);
-  size_t pivot_pos = i - 1;
-  if (pivot_pos > low) {
-    QuickSort(vec, low, pivot_pos - 1);
-  }
-  QuickSort(vec, pivot_pos + 1, high);
+  ppc::core::sort::QuickSort(std::span<double>(vec).subspan(low, high - low + 1));
 }
 
 size_t nikolaev_r_hoare_sort_simple_merge_all::HoareSortSimpleMergeALL::BroadcastTotalSize() {
@@ -112,39 +92,9 @@ std::vector<double> nikolaev_r_hoare_sort_simple_merge_all::HoareSortSimpleMerge
 }
 
 void nikolaev_r_hoare_sort_simple_merge_all::HoareSortSimpleMergeALL::LocalSort(std::vector<double> &local_vect) {
-  size_t num_threads = ppc::util::GetPPCNumThreads();
-  num_threads = std::min(num_threads, local_vect.size());
-
-  size_t seg_size = !local_vect.empty() ? local_vect.size() / num_threads : 0;
-  size_t seg_remainder = !local_vect.empty() ? local_vect.size() % num_threads : 0;
-  std::vector<std::pair<size_t, size_t>> segments;
-
-  size_t start = 0;
-  for (size_t i = 0; i < num_threads; ++i) {
-    size_t curr_size = seg_size + (i < seg_remainder ? 1 : 0);
-    if (curr_size > 0) {
-      segments.emplace_back(start, start + curr_size - 1);
-    }
-    start += curr_size;
-  }
-
+  const auto num_threads = static_cast<size_t>(ppc::util::GetPPCNumThreads());
   oneapi::tbb::task_arena arena(static_cast<int>(num_threads));
-  arena.execute([&]() {
-    oneapi::tbb::task_group tg;
-    for (const auto &seg : segments) {
-      tg.run([&, seg]() { QuickSort(local_vect, seg.first, seg.second); });
-    }
-    tg.wait();
-  });
-
-  if (!segments.empty()) {
-    size_t merged_end = segments[0].second;
-    for (size_t i = 1; i < segments.size(); ++i) {
-      std::inplace_merge(local_vect.begin(), local_vect.begin() + static_cast<std::ptrdiff_t>(merged_end + 1),
-                         local_vect.begin() + static_cast<std::ptrdiff_t>(segments[i].second + 1));
-      merged_end = segments[i].second;
-    }
-  }
+  ppc::core::sort::QuickSort(std::span<double>(local_vect), 4 * num_threads, ppc::util::TbbFor{&arena});
 }
 
 void nikolaev_r_hoare_sort_simple_merge_all::HoareSortSimpleMergeALL::GlobalMerge(
@@ -196,3 +196,26 @@ TEST(odintsov_m_mulmatrix_cannon_all, test_block_sz_1) {
     }
   }
 }
+
+TEST(odintsov_m_mulmatrix_cannon_all, test_empty_matrix) {
+  boost::mpi::communicator com;
+  std::vector<double> matrix_a;
+  std::vector<double> matrix_b;
+  std::vector<double> out_all;
+
+  auto task_data_all = std::make_shared<ppc::core::TaskData>();
+  if (com.rank() == 0) {
+    task_data_all->inputs.emplace_back(reinterpret_cast<uint8_t *>(matrix_a.data()));
+    task_data_all->inputs.emplace_back(reinterpret_cast<uint8_t *>(matrix_b.data()));
+    task_data_all->inputs_count.emplace_back(matrix_a.size());
+    task_data_all->inputs_count.emplace_back(matrix_b.size());
+    task_data_all->outputs.emplace_back(reinterpret_cast<uint8_t *>(out_all.data()));
+  }
+  odintsov_m_mulmatrix_cannon_all::MulMatrixCannonALL test_task_all(task_data_all);
+
+  ASSERT_EQ(test_task_all.Validation(), true);
+
+  test_task_all.PreProcessing();
+  test_task_all.Run();
+  test_task_all.PostProcessing();
+}
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <array>
 #include <boost/mpi/communicator.hpp>
+#include <boost/mpi/request.hpp>
 #include <utility>
 #include <vector>
 
@@ -18,22 +20,23 @@ class MulMatrixCannonALL : public ppc::core::Task {
   bool PostProcessingImpl() override;
 
  private:
-  static void ShiftRow(std::vector<double>& matrix, int root, int row, int shift);
-  static void ShiftColumn(std::vector<double>& matrix, int root, int col, int shift);
-  void ShiftBlocksUp(std::vector<double>& matrix, int root, int block_sz) const;
-  void ShiftBlocksLeft(std::vector<double>& matrix, int root, int block_sz) const;
+  static int GetGridSize(int proc_count, int n);
   static bool IsSquere(unsigned int num);
-  static int GetBlockSize(int n);
-  static void InitializeShift(std::vector<double>& matrix, int root, int grid_size, int block_sz, bool is_row_shift);
-  static void ProcessBlockMul(int bi, int bj_start, int bj_end, int root, int block_sz,
-                              const std::vector<double>& matrix_a, const std::vector<double>& matrix_b,
-                              std::vector<double>& local_c);
-  static void ProcessBlockSTL(int bi, int num_blocks, int root, int block_sz, const std::vector<double>& matrix_a,
-                              const std::vector<double>& matrix_b, std::vector<double>& local_c);
+  // матрица root × root <-> блоки решётки grid × grid, записанные подряд по строкам решётки
+  static void PackBlocks(const std::vector<double>& matrix, std::vector<double>& blocks, int root, int grid);
+  static void UnpackBlocks(const std::vector<double>& blocks, std::vector<double>& matrix, int root, int grid);
+  static void InitialShift(const boost::mpi::communicator& com, int grid, std::vector<double>& block_a,
+                           std::vector<double>& block_b);
+  // неблокирующий сдвиг A на блок влево и B на блок вверх в буферы next_a и next_b
+  static std::array<boost::mpi::request, 4> StartShift(const boost::mpi::communicator& com, int grid,
+                                                       const std::vector<double>& block_a,
+                                                       const std::vector<double>& block_b,
+                                                       std::vector<double>& next_a, std::vector<double>& next_b);
+  static void MultiplyBlock(const std::vector<double>& block_a, const std::vector<double>& block_b,
+                            std::vector<double>& block_c, int block_sz);
 
   std::vector<double> matrixA_, matrixB_;
   unsigned int szA_ = 0, szB_ = 0;
-  int block_sz_ = 0;
   std::vector<double> matrixC_;
   boost::mpi::communicator com_;
 };
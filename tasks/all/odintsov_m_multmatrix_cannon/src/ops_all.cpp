@@ -1,185 +1,125 @@
 #include "all/odintsov_m_multmatrix_cannon/include/ops_all.hpp"
 
+#include <mpi.h>
+
 #include <algorithm>
+#include <array>
 #include <boost/mpi/collectives.hpp>
 #include <boost/mpi/collectives/broadcast.hpp>  // для boost::mpi::broadcast
-#include <boost/mpi/collectives/reduce.hpp>
+#include <boost/mpi/collectives/gather.hpp>
+#include <boost/mpi/collectives/scatter.hpp>
 #include <boost/mpi/communicator.hpp>
+#include <boost/mpi/nonblocking.hpp>
+#include <boost/mpi/request.hpp>
 #include <cmath>
 #include <core/util/include/util.hpp>
 #include <cstddef>
-#include <functional>
 #include <thread>
 #include <vector>
 
-using namespace std;
-void odintsov_m_mulmatrix_cannon_all::MulMatrixCannonALL::ShiftRow(std::vector<double>& matrix, int root, int row,
-                                                                   int shift) {
-  shift = shift % root;
-  std::vector<double> tmp(root);
-  for (int j = 0; j < root; j++) {
-    tmp[j] = matrix[(row * root) + ((j + shift) % root)];
-  }
-  for (int j = 0; j < root; j++) {
-    matrix[(row * root) + j] = tmp[j];
-  }
-}
-
-void odintsov_m_mulmatrix_cannon_all::MulMatrixCannonALL::ShiftColumn(std::vector<double>& matrix, int root, int col,
-                                                                      int shift) {
-  shift = shift % root;
-  std::vector<double> tmp(root);
+#include "core/gemm/include/gemm.hpp"
 
-  for (int i = 0; i < root; i++) {
-    tmp[i] = matrix[(((i + shift) % root) * root) + col];
-  }
-  for (int i = 0; i < root; i++) {
-    matrix[(i * root) + col] = tmp[i];
+using namespace std;
+int odintsov_m_mulmatrix_cannon_all::MulMatrixCannonALL::GetGridSize(int proc_count, int n) {
+  int grid = static_cast<int>(std::sqrt(proc_count));
+  while (grid > 1 && (n % grid) != 0) {
+    grid--;
   }
+  return std::max(grid, 1);
 }
-void odintsov_m_mulmatrix_cannon_all::MulMatrixCannonALL::ShiftBlocksUp(std::vector<double>& matrix, int root,
-                                                                        int sz) const {
-  int p = root / block_sz_;
-  for (int bj = 0; bj < p; bj++) {
-    std::vector<double> first_block(block_sz_ * block_sz_);
 
-    for (int i = 0; i < block_sz_; i++) {
-      for (int j = 0; j < block_sz_; j++) {
-        first_block[(i * block_sz_) + j] = matrix[(i * root) + ((bj * block_sz_) + j)];
-      }
-    }
-
-    for (int bi = 0; bi < (p - 1); bi++) {
-      for (int i = 0; i < block_sz_; i++) {
-        for (int j = 0; j < block_sz_; j++) {
-          matrix[((bi * block_sz_ + i) * root) + (bj * block_sz_) + j] =
-              matrix[(((bi + 1) * block_sz_) * root) + (i * root) + ((bj * block_sz_) + j)];
-        }
-      }
-    }
-
-    for (int i = 0; i < block_sz_; i++) {
-      for (int j = 0; j < block_sz_; j++) {
-        matrix[((((p - 1) * block_sz_) * root) + (i * root) + ((bj * block_sz_) + j))] =
-            first_block[(i * block_sz_) + j];
+void odintsov_m_mulmatrix_cannon_all::MulMatrixCannonALL::PackBlocks(const std::vector<double>& matrix,
+                                                                     std::vector<double>& blocks, int root,
+                                                                     int grid) {
+  int block_sz = root / grid;
+  blocks.resize(matrix.size());
+  auto dst = blocks.begin();
+  for (int bi = 0; bi < grid; bi++) {
+    for (int bj = 0; bj < grid; bj++) {
+      for (int i = 0; i < block_sz; i++) {
+        auto src = matrix.begin() + ((((bi * block_sz) + i) * root) + (bj * block_sz));
+        dst = std::copy(src, src + block_sz, dst);
       }
     }
   }
 }
 
-void odintsov_m_mulmatrix_cannon_all::MulMatrixCannonALL::ShiftBlocksLeft(std::vector<double>& matrix, int root,
-                                                                          int sz) const {
-  int p = root / block_sz_;
-  for (int bi = 0; bi < p; bi++) {
-    std::vector<double> first_block(block_sz_ * block_sz_);
-
-    for (int i = 0; i < block_sz_; i++) {
-      for (int j = 0; j < block_sz_; j++) {
-        first_block[(i * block_sz_) + j] = matrix[((bi * block_sz_ + i) * root) + j];
-      }
-    }
-
-    for (int bj = 0; bj < (p - 1); bj++) {
-      for (int i = 0; i < block_sz_; i++) {
-        for (int j = 0; j < block_sz_; j++) {
-          matrix[((bi * block_sz_ + i) * root) + (bj * block_sz_) + j] =
-              matrix[((bi * block_sz_ + i) * root) + (((bj + 1) * block_sz_) + j)];
-        }
-      }
-    }
-
-    for (int i = 0; i < block_sz_; i++) {
-      for (int j = 0; j < block_sz_; j++) {
-        matrix[((bi * block_sz_ + i) * root) + (((p - 1) * block_sz_) + j)] = first_block[(i * block_sz_) + j];
+void odintsov_m_mulmatrix_cannon_all::MulMatrixCannonALL::UnpackBlocks(const std::vector<double>& blocks,
+                                                                       std::vector<double>& matrix, int root,
+                                                                       int grid) {
+  int block_sz = root / grid;
+  auto src = blocks.begin();
+  for (int bi = 0; bi < grid; bi++) {
+    for (int bj = 0; bj < grid; bj++) {
+      for (int i = 0; i < block_sz; i++) {
+        std::copy(src, src + block_sz, matrix.begin() + ((((bi * block_sz) + i) * root) + (bj * block_sz)));
+        src += block_sz;
       }
     }
   }
 }
 
-bool odintsov_m_mulmatrix_cannon_all::MulMatrixCannonALL::IsSquere(unsigned int num) {
-  auto root = static_cast<unsigned int>(std::sqrt(num));
-  return (root * root) == num;
-}
-
-int odintsov_m_mulmatrix_cannon_all::MulMatrixCannonALL::GetBlockSize(int n) {
-  for (int k = (n / 2); k >= 2; k--) {
-    if ((n % k) == 0) {
-      return k;
-    }
+void odintsov_m_mulmatrix_cannon_all::MulMatrixCannonALL::InitialShift(const boost::mpi::communicator& com, int grid,
+                                                                       std::vector<double>& block_a,
+                                                                       std::vector<double>& block_b) {
+  int row = com.rank() / grid;
+  int col = com.rank() % grid;
+  int count = static_cast<int>(block_a.size());
+  // блочная строка i матрицы A сдвигается на i блоков влево, блочный столбец j матрицы B - на j блоков вверх,
+  // каждый блок пересылается один раз
+  if (row != 0) {
+    MPI_Sendrecv_replace(block_a.data(), count, MPI_DOUBLE, (row * grid) + ((col + grid - row) % grid), 0,
+                         (row * grid) + ((col + row) % grid), 0, com, MPI_STATUS_IGNORE);
+  }
+  if (col != 0) {
+    MPI_Sendrecv_replace(block_b.data(), count, MPI_DOUBLE, (((row + grid - col) % grid) * grid) + col, 1,
+                         (((row + col) % grid) * grid) + col, 1, com, MPI_STATUS_IGNORE);
   }
-  return 1;
 }
 
-void odintsov_m_mulmatrix_cannon_all::MulMatrixCannonALL::InitializeShift(std::vector<double>& matrix, int root,
-                                                                          int grid_size, int block_sz,
-                                                                          bool is_row_shift) {
-  for (int b = 0; b < grid_size; ++b) {
-    for (int index = b * block_sz; index < (b + 1) * block_sz; ++index) {
-      for (int shift = 0; shift < b; ++shift) {
-        if (is_row_shift) {
-          ShiftRow(matrix, root, index, block_sz);
-        } else {
-          ShiftColumn(matrix, root, index, block_sz);
-        }
-      }
-    }
-  }
+std::array<boost::mpi::request, 4> odintsov_m_mulmatrix_cannon_all::MulMatrixCannonALL::StartShift(
+    const boost::mpi::communicator& com, int grid, const std::vector<double>& block_a,
+    const std::vector<double>& block_b, std::vector<double>& next_a, std::vector<double>& next_b) {
+  int row = com.rank() / grid;
+  int col = com.rank() % grid;
+  int count = static_cast<int>(block_a.size());
+  int left = (row * grid) + ((col + grid - 1) % grid);
+  int right = (row * grid) + ((col + 1) % grid);
+  int up = (((row + grid - 1) % grid) * grid) + col;
+  int down = (((row + 1) % grid) * grid) + col;
+  return {com.irecv(right, 2, next_a.data(), count), com.irecv(down, 3, next_b.data(), count),
+          com.isend(left, 2, block_a.data(), count), com.isend(up, 3, block_b.data(), count)};
 }
 
-void odintsov_m_mulmatrix_cannon_all::MulMatrixCannonALL::ProcessBlockMul(int bi, int bj_start, int bj_end, int root,
-                                                                          int block_sz,
-                                                                          const std::vector<double>& matrix_a,
-                                                                          const std::vector<double>& matrix_b,
-                                                                          std::vector<double>& local_c) {
-  std::vector<double> a_block(block_sz * block_sz);
-  std::vector<double> b_block(block_sz * block_sz);
-
-  for (int bj = bj_start; bj < bj_end; ++bj) {
-    // Копирование подблока
-    for (int i = 0; i < block_sz; ++i) {
-      for (int j = 0; j < block_sz; ++j) {
-        int row = (bi * block_sz) + i;
-        int col = (bj * block_sz) + j;
-        a_block[(i * block_sz) + j] = matrix_a[(row * root) + col];
-        b_block[(i * block_sz) + j] = matrix_b[(row * root) + col];
-      }
-    }
-
-    // Перемножение и накопление
-    for (int i = 0; i < block_sz; ++i) {
-      for (int k = 0; k < block_sz; ++k) {
-        double a_ik = a_block[(i * block_sz) + k];
-        int base = (((bi * block_sz) + i) * root) + (bj * block_sz);
-        for (int j = 0; j < block_sz; ++j) {
-          local_c[base + j] += a_ik * b_block[(k * block_sz) + j];
-        }
-      }
-    }
-  }
-}
-
-void odintsov_m_mulmatrix_cannon_all::MulMatrixCannonALL::ProcessBlockSTL(int bi, int num_blocks, int root,
-                                                                          int block_sz,
-                                                                          const std::vector<double>& matrix_a,
-                                                                          const std::vector<double>& matrix_b,
-                                                                          std::vector<double>& local_c) {
-  int max_threads = ppc::util::GetPPCNumThreads();
-  int tcount = std::min(max_threads, num_blocks);
+void odintsov_m_mulmatrix_cannon_all::MulMatrixCannonALL::MultiplyBlock(const std::vector<double>& block_a,
+                                                                        const std::vector<double>& block_b,
+                                                                        std::vector<double>& block_c, int block_sz) {
+  if (block_sz == 0) {
+    return;
+  }
+  int tcount = std::min(std::max(ppc::util::GetPPCNumThreads(), 1), block_sz);
+  auto rows = [&](int t) { return (block_sz * t) / tcount; };
+  auto multiply = [&](int t) {
+    auto offset = static_cast<std::size_t>(rows(t)) * block_sz;
+    ppc::core::gemm::Gemm(rows(t + 1) - rows(t), block_sz, block_sz, block_a.data() + offset, block_sz,
+                          block_b.data(), block_sz, block_c.data() + offset, block_sz);
+  };
   std::vector<thread> threads;
   threads.reserve(tcount);
-
-  for (int t = 0; t < tcount; ++t) {
-    int bj_start = (num_blocks * t) / tcount;
-    int bj_end = (num_blocks * (t + 1)) / tcount;
-    threads.emplace_back(&MulMatrixCannonALL::ProcessBlockMul, bi, bj_start, bj_end, root, block_sz,
-                         std::cref(matrix_a), std::cref(matrix_b), std::ref(local_c));
+  for (int t = 1; t < tcount; ++t) {
+    threads.emplace_back(multiply, t);
   }
-
+  multiply(0);
   for (auto& th : threads) {
     th.join();
   }
 }
 
+bool odintsov_m_mulmatrix_cannon_all::MulMatrixCannonALL::IsSquere(unsigned int num) {
+  auto root = static_cast<unsigned int>(std::sqrt(num));
+  return (root * root) == num;
+}
+
 bool odintsov_m_mulmatrix_cannon_all::MulMatrixCannonALL::PreProcessingImpl() {
   if (com_.rank() == 0) {
     szA_ = task_data->inputs_count[0];
@@ -189,8 +129,6 @@ bool odintsov_m_mulmatrix_cannon_all::MulMatrixCannonALL::PreProcessingImpl() {
     matrixB_.assign(reinterpret_cast<double*>(task_data->inputs[1]),
                     reinterpret_cast<double*>(task_data->inputs[1]) + szB_);
     matrixC_.assign(szA_, 0);
-
-    block_sz_ = GetBlockSize(static_cast<int>(sqrt(szA_)));
   }
   return true;
 }
@@ -210,69 +148,59 @@ bool odintsov_m_mulmatrix_cannon_all::MulMatrixCannonALL::ValidationImpl() {
 
 bool odintsov_m_mulmatrix_cannon_all::MulMatrixCannonALL::RunImpl() {
   int rank = com_.rank();
-  int size = com_.size();
 
   // Считываем параметры на всех рангах
   boost::mpi::broadcast(com_, szA_, /*root=*/0);
-  boost::mpi::broadcast(com_, block_sz_, /*root=*/0);
 
-  int count = static_cast<int>(szA_);
-  if (rank != 0) {
-    matrixA_.resize(count);
-    matrixB_.resize(count);
-    matrixC_.resize(count);
-  }
-  // Вычисляем размер матрицы (root × root) и параметры блоков
+  // Решётка процессов grid × grid, каждый процесс хранит по одному блоку A, B и C
   int root = static_cast<int>(std::round(std::sqrt(szA_)));
-  int num_blocks = std::max(1, root / block_sz_);
-  int steps = num_blocks;
-
-  // 1) Начальная инициализация сдвигов на rank 0
+  int grid = GetGridSize(com_.size(), root);
+  int block_sz = root / grid;
+  int block_count = block_sz * block_sz;
+  int active = grid * grid;
+  boost::mpi::communicator grid_com = com_.split(rank < active ? 0 : MPI_UNDEFINED);
+  if (rank >= active) {
+    return true;
+  }
+
+  // 1) Рассылка блоков
+  std::vector<double> blocks_a;
+  std::vector<double> blocks_b;
   if (rank == 0) {
-    InitializeShift(matrixA_, root, steps, block_sz_, /*is_row_shift=*/true);
-    InitializeShift(matrixB_, root, steps, block_sz_, /*is_row_shift=*/false);
-  }
-
-  // 2) Рассылка первоначально сдвинутых A и B всем процессам
-  boost::mpi::broadcast(com_, matrixA_.data(), count, /*root=*/0);
-  boost::mpi::broadcast(com_, matrixB_.data(), count, /*root=*/0);
-
-  // 3) Локальный накопитель результата за все шаги
-  std::vector<double> local_c_acc(root * root, 0.0);
-
-  for (int step = 0; step < steps; ++step) {
-    // 3.1) Локальный вектор для этого шага
-    std::vector<double> local_c(root * root, 0.0);
-
-    // 3.2) Каждый процесс обрабатывает блоки bi = rank, rank+size, …
-    for (int bi = rank; bi < num_blocks; bi += size) {
-      ProcessBlockSTL(bi, num_blocks, root, block_sz_, matrixA_, matrixB_, local_c);
-    }
-
-    // 3.3) Аккумулируем во внешний local_c_acc
-    for (int i = 0; i < root * root; ++i) {
-      local_c_acc[i] += local_c[i];
-    }
-
-    // 3.4) Сдвиги перед следующим шагом — только на rank 0
-    if (rank == 0) {
-      ShiftBlocksLeft(matrixA_, root, block_sz_);
-      ShiftBlocksUp(matrixB_, root, block_sz_);
-    }
-
-    // 3.5) Рассылка обновлённых A и B
-    boost::mpi::broadcast(com_, matrixA_.data(), count, /*root=*/0);
-    boost::mpi::broadcast(com_, matrixB_.data(), count, /*root=*/0);
+    PackBlocks(matrixA_, blocks_a, root, grid);
+    PackBlocks(matrixB_, blocks_b, root, grid);
+  }
+  std::vector<double> block_a(block_count);
+  std::vector<double> block_b(block_count);
+  std::vector<double> block_c(block_count, 0.0);
+  boost::mpi::scatter(grid_com, blocks_a.data(), block_a.data(), block_count, 0);
+  boost::mpi::scatter(grid_com, blocks_b.data(), block_b.data(), block_count, 0);
+
+  // 2) Начальный сдвиг блоков
+  InitialShift(grid_com, grid, block_a, block_b);
+
+  // 3) Блоки следующего шага принимаются во вторую пару буферов, пока потоки умножают текущие
+  std::vector<double> next_a(block_count);
+  std::vector<double> next_b(block_count);
+  for (int step = 0; step < grid - 1; ++step) {
+    auto requests = StartShift(grid_com, grid, block_a, block_b, next_a, next_b);
+    MultiplyBlock(block_a, block_b, block_c, block_sz);
+    boost::mpi::wait_all(requests.begin(), requests.end());
+    block_a.swap(next_a);
+    block_b.swap(next_b);
+  }
+  MultiplyBlock(block_a, block_b, block_c, block_sz);
+
+  // 4) Сборка блоков C на rank 0
+  std::vector<double> blocks_c;
+  if (rank == 0) {
+    blocks_c.resize(szA_);
   }
-
-  // 4) Подготавливаем matrixC_ только на rank 0
+  boost::mpi::gather(grid_com, block_c.data(), block_count, blocks_c.data(), 0);
   if (rank == 0) {
-    matrixC_.assign(root * root, 0.0);
+    UnpackBlocks(blocks_c, matrixC_, root, grid);
   }
 
-  // 5) Сводим накопленные данные в matrixC_ на rank 0
-  boost::mpi::reduce(com_, local_c_acc.data(), root * root, matrixC_.data(), std::plus<>(), 0);
-
   return true;
 }
 
@@ -5,6 +5,7 @@
 #include <utility>
 #include <vector>
 
+#include "core/graph/include/csr_graph.hpp"
 #include "core/task/include/task.hpp"
 
 namespace plekhanov_d_dijkstra_all {
@@ -20,11 +21,11 @@ class TestTaskALL : public ppc::core::Task {
 
  private:
   boost::mpi::communicator world_;
-  std::vector<int> graph_data_;
+  ppc::core::graph::CsrGraph graph_;
+  bool graph_valid_ = false;
   std::vector<int> distances_;
   size_t start_vertex_;
   size_t num_vertices_;
-  static const int kEndOfVertexList;
 };
 
 }  // namespace plekhanov_d_dijkstra_all
\ No newline at end of file
@@ -10,42 +10,21 @@
 #include <boost/serialization/vector.hpp>  // NOLINT(misc-include-cleaner)
 #include <climits>
 #include <cstddef>
+#include <cstdint>
 #include <cstdlib>
 #include <functional>
-#include <utility>
+#include <span>
 #include <vector>
 
-namespace {
+#include "core/graph/include/adjacency_stream.hpp"
+#include "core/graph/include/csr_graph.hpp"
+#include "core/util/include/omp_for.hpp"
+#include "core/util/include/util.hpp"
 
-bool ConvertGraphToAdjacencyList(const std::vector<int>& graph_data, size_t num_vertices,
-                                 std::vector<std::vector<std::pair<int, int>>>& graph) {
-  graph.assign(num_vertices, {});
-  size_t current_vertex = 0;
-  size_t i = 0;
-  while (i < graph_data.size() && current_vertex < num_vertices) {
-    if (graph_data[i] == -1) {
-      current_vertex++;
-      i++;
-      continue;
-    }
-    if (i + 1 >= graph_data.size()) {
-      break;
-    }
-    size_t dest = graph_data[i];
-    int weight = graph_data[i + 1];
-    if (weight < 0) {
-      return false;
-    }
-    if (dest < num_vertices) {
-      graph[current_vertex].emplace_back(static_cast<int>(dest), weight);
-    }
-    i += 2;
-  }
-  return true;
-}
+namespace {
 
-void ProcessLocalChunk(const std::vector<std::vector<std::pair<int, int>>>& adj_list, std::vector<int>& local_dist,
-                       size_t start, size_t end, bool& updated) {
+void ProcessLocalChunk(const ppc::core::graph::CsrGraphView& graph, std::vector<int>& local_dist, size_t start,
+                       size_t end, bool& updated) {
   const int inf = INT_MAX;
   bool local_updated = false;
   std::vector<int> new_distances = local_dist;
@@ -58,7 +37,9 @@ void ProcessLocalChunk(const std::vector<std::vector<std::pair<int, int>>>& adj_
     for (int u = static_cast<int>(start); u < static_cast<int>(end); ++u) {
       if (local_dist[u] == inf) continue;
 
-      for (const auto& [neighbor, weight] : adj_list[u]) {
+      for (uint64_t e = graph.EdgesBegin(u); e < graph.EdgesEnd(u); e++) {
+        const auto neighbor = graph.Target(e);
+        const int weight = graph.Weight(e);
         int new_dist = local_dist[u] + weight;
         if (new_dist < new_distances[neighbor]) {
 #pragma omp critical
@@ -120,12 +101,8 @@ void UpdateFinalDistances(const boost::mpi::communicator& world, const std::vect
 
 }  // namespace
 
-const int plekhanov_d_dijkstra_all::TestTaskALL::kEndOfVertexList = -1;
-
 bool plekhanov_d_dijkstra_all::TestTaskALL::PreProcessingImpl() {
-  unsigned int input_size = task_data->inputs_count[0];
-  auto* in_ptr = reinterpret_cast<int*>(task_data->inputs[0]);
-  graph_data_.assign(in_ptr, in_ptr + input_size);
+  const std::span<const int> graph_data(reinterpret_cast<int*>(task_data->inputs[0]), task_data->inputs_count[0]);
   num_vertices_ = task_data->outputs_count[0];
   distances_.assign(num_vertices_, INT_MAX);
 
@@ -135,7 +112,12 @@ bool plekhanov_d_dijkstra_all::TestTaskALL::PreProcessingImpl() {
     start_vertex_ = 0;
   }
   distances_[start_vertex_] = 0;
-  return true;
+
+  // the graph is parsed once here, so the run only computes distances
+  graph_valid_ = ppc::core::graph::BuildFromAdjacencyStream(
+      graph_data, num_vertices_, ppc::core::graph::StreamCheck::kLenient, graph_, ppc::util::GetPPCNumChunks(),
+      ppc::util::OmpFor{});
+  return graph_valid_;
 }
 
 bool plekhanov_d_dijkstra_all::TestTaskALL::ValidationImpl() {
@@ -147,8 +129,7 @@ bool plekhanov_d_dijkstra_all::TestTaskALL::ValidationImpl() {
 }
 
 bool plekhanov_d_dijkstra_all::TestTaskALL::RunImpl() {
-  std::vector<std::vector<std::pair<int, int>>> adj_list(num_vertices_);
-  if (!ConvertGraphToAdjacencyList(graph_data_, num_vertices_, adj_list)) {
+  if (!graph_valid_) {
     return false;
   }
 
@@ -168,7 +149,7 @@ bool plekhanov_d_dijkstra_all::TestTaskALL::RunImpl() {
     updated = false;
     iteration++;
 
-    ProcessLocalChunk(adj_list, local_dist, start, end, updated);
+    ProcessLocalChunk(graph_, local_dist, start, end, updated);
 
     std::vector<int> global_dist(num_vertices_);
     boost::mpi::all_reduce(world_, local_dist.data(), static_cast<int>(num_vertices_), global_dist.data(),
@@ -1,4 +1,5 @@
 #include <gtest/gtest.h>
+#include <omp.h>
 #include <tbb/global_control.h>
 
 #include <boost/mpi/communicator.hpp>
@@ -9,6 +10,7 @@
 #include <string>
 #include <utility>
 
+#include "core/perf/include/thread_sweep.hpp"
 #include "core/util/include/util.hpp"
 #include "oneapi/tbb/global_control.h"
 
@@ -65,9 +67,16 @@ int main(int argc, char** argv) {
   boost::mpi::communicator world;
 
   // Limit the number of threads in TBB
-  tbb::global_control control(tbb::global_control::max_allowed_parallelism, ppc::util::GetPPCNumThreads());
+  auto control = std::make_unique<tbb::global_control>(tbb::global_control::max_allowed_parallelism,
+                                                       ppc::util::GetPPCNumThreads());
 
   ::testing::InitGoogleTest(&argc, argv);
+  ppc::core::ThreadSweep::Enable([&control](int num_threads) {
+    omp_set_num_threads(num_threads);
+    // the most restrictive active control wins, so the previous one has to be released first
+    control.reset();
+    control = std::make_unique<tbb::global_control>(tbb::global_control::max_allowed_parallelism, num_threads);
+  });
 
   auto& listeners = ::testing::UnitTest::GetInstance()->listeners();
   if (world.rank() != 0 && (argc < 2 || argv[1] != std::string("--print-workers"))) {
@@ -6,46 +6,18 @@
 #include <algorithm>
 #include <cstddef>
 #include <memory>
+#include <span>
 #include <utility>
 #include <vector>
 
+#include "core/sort/include/quick_sort.hpp"
 #include "core/task/include/task.hpp"
+#include "core/util/include/omp_for.hpp"
 
 namespace shuravina_o_hoare_simple_merger {
 
 TestTaskALL::TestTaskALL(std::shared_ptr<ppc::core::TaskData> task_data) : Task(std::move(task_data)) {}
 
-void TestTaskALL::QuickSort(std::vector<int>& arr, int low, int high) {
-  if (low >= high) {
-    return;
-  }
-
-  int pivot = arr[high];
-  int i = low - 1;
-
-  for (int j = low; j < high; ++j) {
-    if (arr[j] <= pivot) {
-      std::swap(arr[++i], arr[j]);
-    }
-  }
-  std::swap(arr[i + 1], arr[high]);
-
-  const int pi = i + 1;
-
-  if (high - low > 1000) {
-#pragma omp parallel sections
-    {
-#pragma omp section
-      { QuickSort(arr, low, pi - 1); }
-#pragma omp section
-      { QuickSort(arr, pi + 1, high); }
-    }
-  } else {
-    QuickSort(arr, low, pi - 1);
-    QuickSort(arr, pi + 1, high);
-  }
-}
-
 void TestTaskALL::Merge(std::vector<int>& arr, int low, int mid, int high) {
   std::vector<int> temp(high - low + 1);
   int i = low;
@@ -73,9 +45,8 @@ void TestTaskALL::Merge(std::vector<int>& arr, int low, int mid, int high) {
 }
 
 void TestTaskALL::ParallelQuickSort(std::vector<int>& arr) {
-  if (!arr.empty()) {
-    QuickSort(arr, 0, static_cast<int>(arr.size()) - 1);
-  }
+  const auto num_threads = static_cast<size_t>(omp_get_max_threads());
+  ppc::core::sort::QuickSort(std::span<int>(arr), 4 * num_threads, ppc::util::OmpFor{});
 }
 
 void TestTaskALL::DistributeData() {
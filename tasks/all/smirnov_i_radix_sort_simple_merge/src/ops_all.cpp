@@ -3,17 +3,17 @@
 #include <algorithm>
 #include <boost/mpi/collectives.hpp>
 #include <boost/mpi/communicator.hpp>
-#include <cmath>
 #include <cstddef>
 #include <deque>
 #include <functional>
 #include <future>
 #include <mutex>
-#include <numeric>
+#include <span>
 #include <thread>
 #include <utility>
 #include <vector>
 
+#include "core/sort/include/radix_sort.hpp"
 #include "core/util/include/util.hpp"
 #include "mpi.h"
 
@@ -108,26 +108,7 @@ std::vector<int> smirnov_i_radix_sort_simple_merge_all::TestTaskALL::Merge(std::
   return res;
 }
 void smirnov_i_radix_sort_simple_merge_all::TestTaskALL::RadixSort(std::vector<int> &mas) {
-  if (mas.empty()) {
-    return;
-  }
-  int longest = *std::ranges::max_element(mas.begin(), mas.end());
-  int len = std::ceil(std::log10(longest + 1));
-  std::vector<int> sorting(mas.size());
-  int base = 1;
-  for (int j = 0; j < len; j++, base *= 10) {
-    std::vector<int> counting(10, 0);
-    for (size_t i = 0; i < mas.size(); i++) {
-      counting[mas[i] / base % 10]++;
-    }
-    std::partial_sum(counting.begin(), counting.end(), counting.begin());
-    for (int i = static_cast<int>(mas.size() - 1); i >= 0; i--) {
-      int pos = counting[mas[i] / base % 10] - 1;
-      sorting[pos] = mas[i];
-      counting[mas[i] / base % 10]--;
-    }
-    std::swap(mas, sorting);
-  }
+  ppc::core::sort::RadixSort(std::span<int>(mas));
 }
 std::vector<int> smirnov_i_radix_sort_simple_merge_all::TestTaskALL::Sorting(int id, std::vector<int> &mas,
                                                                              int max_th) {
@@ -10,11 +10,15 @@
 #include <boost/mpi/communicator.hpp>
 #include <boost/mpi/operations.hpp>
 #include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <limits>
+#include <span>
 #include <stdexcept>
 #include <vector>
 
+#include "core/graph/include/adjacency_stream.hpp"
+#include "core/util/include/tbb_for.hpp"
 #include "core/util/include/util.hpp"
 
 bool trubin_a_algorithm_dijkstra_all::TestTaskALL::PreProcessingImpl() {
@@ -22,20 +26,20 @@ bool trubin_a_algorithm_dijkstra_all::TestTaskALL::PreProcessingImpl() {
     return false;
   }
 
-  unsigned int input_size = task_data->inputs_count[0];
-  auto* in_ptr = reinterpret_cast<int*>(task_data->inputs[0]);
-  std::vector<int> graph_data(in_ptr, in_ptr + input_size);
+  const std::span<const int> graph_data(reinterpret_cast<int*>(task_data->inputs[0]), task_data->inputs_count[0]);
 
   num_vertices_ = task_data->outputs_count[0];
 
-  if (num_vertices_ == 0 || input_size == 0) {
+  if (num_vertices_ == 0 || graph_data.empty()) {
     return true;
   }
 
-  adjacency_list_.assign(num_vertices_, {});
   distances_.assign(num_vertices_, std::numeric_limits<int>::max());
 
-  if (!BuildAdjacencyList(graph_data)) {
+  // the graph is parsed once here, so the run only computes distances
+  const auto num_chunks = static_cast<size_t>(ppc::util::GetPPCNumThreads()) * 4;
+  if (!ppc::core::graph::BuildFromAdjacencyStream(graph_data, num_vertices_, ppc::core::graph::StreamCheck::kStrict,
+                                                  graph_, num_chunks, ppc::util::TbbFor{})) {
     return false;
   }
 
@@ -137,11 +141,12 @@ void trubin_a_algorithm_dijkstra_all::TestTaskALL::ProcessBlock(const tbb::block
       continue;
     }
 
-    for (const auto& edge : adjacency_list_[u]) {
-      const int new_dist = u_dist + edge.weight;
-      int old_dist = distances_atomic[edge.to].load();
+    for (uint64_t e = graph_.EdgesBegin(u); e < graph_.EdgesEnd(u); e++) {
+      const int new_dist = u_dist + graph_.Weight(e);
+      auto& to_dist = distances_atomic[graph_.Target(e)];
+      int old_dist = to_dist.load();
       while (new_dist < old_dist) {
-        if (distances_atomic[edge.to].compare_exchange_strong(old_dist, new_dist)) {
+        if (to_dist.compare_exchange_strong(old_dist, new_dist)) {
           local_changed.store(true, std::memory_order_relaxed);
           break;
         }
@@ -195,35 +200,3 @@ bool trubin_a_algorithm_dijkstra_all::TestTaskALL::PostProcessingImpl() {
   }
   return true;
 }
-
-bool trubin_a_algorithm_dijkstra_all::TestTaskALL::BuildAdjacencyList(const std::vector<int>& graph_data) {
-  size_t current_vertex = 0;
-  size_t i = 0;
-
-  while (i < graph_data.size()) {
-    if (graph_data[i] == kEndOfVertexList) {
-      if (current_vertex >= num_vertices_) {
-        return false;
-      }
-      current_vertex++;
-      i++;
-      continue;
-    }
-
-    if (i + 1 >= graph_data.size()) {
-      return false;
-    }
-
-    auto to = static_cast<size_t>(graph_data[i]);
-    int weight = graph_data[i + 1];
-
-    if (to >= num_vertices_ || weight < 0) {
-      return false;
-    }
-
-    adjacency_list_[current_vertex].emplace_back(to, weight);
-    i += 2;
-  }
-
-  return true;
-}
@@ -1,6 +1,5 @@
 #pragma once
 
-#include <oneapi/tbb/parallel_for.h>
 #include <oneapi/tbb/task_arena.h>
 #include <tbb/tbb.h>
 
@@ -13,7 +12,9 @@
 #include <utility>
 #include <vector>
 
+#include "core/sort/include/quick_sort.hpp"
 #include "core/task/include/task.hpp"
+#include "core/util/include/tbb_for.hpp"
 #include "core/util/include/util.hpp"
 
 namespace tyshkevich_a_hoare_simple_merge_all {
@@ -77,59 +78,9 @@ class HoareSortTask : public ppc::core::Task {
   }
 
   void ParallelSort(std::span<T> arr) {
-    const std::size_t concurrency = std::min(arr.size(), std::size_t(ppc::util::GetPPCNumThreads()));
-    if (concurrency == 0) {
-      return;
-    }
-    tbb::task_arena arena(concurrency);
-
-    auto pieces = ArrayPiece<T>::Partition(arr, concurrency);
-
-    arena.execute([&] {
-      oneapi::tbb::parallel_for(oneapi::tbb::blocked_range<std::size_t>(0, concurrency, 1), [&](const auto& r) {
-        for (std::size_t tnum = r.begin(); tnum < r.end(); tnum++) {
-          auto& piece = pieces[tnum];
-          HoareSort(piece, 0, piece.Size() - 1);
-        }
-      });
-    });
-
-    std::size_t leap = 1;
-    for (std::size_t reduc = concurrency; reduc > 1; reduc /= 2) {
-      const auto dl = 2 * leap;
-      const auto nextreduc = reduc / 2;
-
-      arena.execute([&] {
-        oneapi::tbb::parallel_for(
-            oneapi::tbb::blocked_range<std::size_t>(0, nextreduc,
-                                                    (pieces[0].Size() > kParallelizeThreshold)
-                                                        ? nextreduc / tbb::this_task_arena::max_concurrency()
-                                                        : nextreduc),
-            [&](const tbb::blocked_range<std::size_t>& r) {
-              for (std::size_t g = r.begin(); g < r.end(); ++g) {
-                auto& head = pieces[dl * g];
-                auto& tail = pieces[(dl * g) + leap];
-                std::inplace_merge(head.first, tail.first, tail.last, cmp_);
-                head.Concat(tail);
-              }
-            });
-      });
-      if (nextreduc % 2 != 0) {
-        ArrayPiece<T>* head = nullptr;
-        ArrayPiece<T>* tail = nullptr;
-        if (nextreduc == 1) {
-          head = &pieces.front();
-          tail = &pieces.back();
-        } else {
-          head = &pieces[dl * (nextreduc - 2)];
-          tail = &pieces[dl * (nextreduc - 1)];
-        }
-        std::inplace_merge(head->first, tail->first, tail->last, cmp_);
-        head->Concat(*tail);
-      }
-
-      leap *= 2;
-    }
+    const auto concurrency = static_cast<std::size_t>(ppc::util::GetPPCNumThreads());
+    oneapi::tbb::task_arena arena(static_cast<int>(concurrency));
+    ppc::core::sort::QuickSort(arr, 4 * concurrency, ppc::util::TbbFor{&arena}, cmp_);
   }
 
   bool RunImpl() override {
@@ -200,26 +151,6 @@ class HoareSortTask : public ppc::core::Task {
   }
 
  private:
-  void HoareSort(std::span<T> arr, int64_t low, int64_t high) {
-    const auto partition = [&cmp = this->cmp_](std::span<T> region, int64_t plo, int64_t phi) -> int64_t {
-      const auto& pivot = region[phi];
-      int64_t e = plo - 1;
-      for (int64_t j = plo; j <= phi - 1; j++) {
-        if (cmp(region[j], pivot)) {
-          std::swap(region[++e], region[j]);
-        }
-      }
-      std::swap(region[e + 1], region[phi]);
-      return e + 1;
-    };
-
-    if (low < high) {
-      int64_t p = partition(arr, low, high);
-      HoareSort(arr, low, p - 1);
-      HoareSort(arr, p + 1, high);
-    }
-  };
-
   Comparator cmp_;
 
   std::span<const T> input_;
@@ -227,8 +158,6 @@ class HoareSortTask : public ppc::core::Task {
   std::vector<T> piece_;
 
   boost::mpi::communicator world_;
-
-  static constexpr std::size_t kParallelizeThreshold = 32;
 };
 
 template <typename T, typename Comparator>
@@ -1,7 +1,9 @@
 #pragma once
 
+#include <array>
 #include <boost/mpi/collectives.hpp>
 #include <boost/mpi/communicator.hpp>
+#include <boost/mpi/request.hpp>
 #include <cmath>
 #include <memory>
 #include <utility>
@@ -28,10 +30,13 @@ class CannonALL : public ppc::core::Task {
   std::vector<double> C_;
   boost::mpi::communicator world_;
 
-  void InitialShift(std::vector<double>& local_a, std::vector<double>& local_b);
+  void InitialShift(const boost::mpi::communicator& comm, std::vector<double>& local_a,
+                    std::vector<double>& local_b) const;
   void BlockMultiply(const std::vector<double>& local_a, const std::vector<double>& local_b,
                      std::vector<double>& local_c);
-  void ShiftBlocks(std::vector<double>& local_a, std::vector<double>& local_b);
+  std::array<boost::mpi::request, 4> StartShift(const boost::mpi::communicator& comm,
+                                                const std::vector<double>& local_a, const std::vector<double>& local_b,
+                                                std::vector<double>& next_a, std::vector<double>& next_b) const;
   static int FindOptimalGridSize(int size, int n);
   static void TakeBlock(const std::vector<double>& matrix, double* block, int n, int k, int block_row, int block_col);
   void GatherResults(std::vector<double>& tmp_c, int block_size_sq);
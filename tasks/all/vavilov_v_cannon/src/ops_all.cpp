@@ -3,14 +3,19 @@
 #include <mpi.h>
 
 #include <algorithm>
+#include <array>
 #include <boost/mpi/collectives/broadcast.hpp>
 #include <boost/mpi/collectives/gather.hpp>
 #include <boost/mpi/collectives/scatter.hpp>
 #include <boost/mpi/communicator.hpp>
+#include <boost/mpi/nonblocking.hpp>
 #include <boost/mpi/request.hpp>
 #include <cmath>
+#include <cstddef>
 #include <vector>
 
+#include "core/gemm/include/gemm.hpp"
+
 namespace mpi = boost::mpi;
 
 int vavilov_v_cannon_all::CannonALL::FindOptimalGridSize(int size, int n) {
@@ -58,38 +63,35 @@ bool vavilov_v_cannon_all::CannonALL::ValidationImpl() {
   return true;
 }
 
-void vavilov_v_cannon_all::CannonALL::InitialShift(std::vector<double>& local_a, std::vector<double>& local_b) {
-  int rank = world_.rank();
+void vavilov_v_cannon_all::CannonALL::InitialShift(const mpi::communicator& comm, std::vector<double>& local_a,
+                                                   std::vector<double>& local_b) const {
   int grid_size = num_blocks_;
-  int row = rank / grid_size;
-  int col = rank % grid_size;
-
-  int send_rank_a = (row * grid_size) + ((col + grid_size - 1) % grid_size);
-  int recv_rank_a = (row * grid_size) + ((col + 1) % grid_size);
-
-  int send_rank_b = col + (grid_size * ((row + grid_size - 1) % grid_size));
-  int recv_rank_b = col + (grid_size * ((row + 1) % grid_size));
-
-  std::vector<double> tmp_a(block_size_ * block_size_);
-  std::vector<double> tmp_b(block_size_ * block_size_);
-  for (int i = 0; i < row; ++i) {
-    world_.send(send_rank_a, 0, local_a.data(), block_size_ * block_size_);
-    world_.recv(recv_rank_a, 0, tmp_a.data(), block_size_ * block_size_);
-    std::swap(local_a, tmp_a);
+  int row = comm.rank() / grid_size;
+  int col = comm.rank() % grid_size;
+  int count = block_size_ * block_size_;
+
+  // one exchange per matrix: the block row i of A moves i blocks left, the block column j of B moves j blocks up
+  if (row != 0) {
+    int send_rank_a = (row * grid_size) + ((col + grid_size - row) % grid_size);
+    int recv_rank_a = (row * grid_size) + ((col + row) % grid_size);
+    MPI_Sendrecv_replace(local_a.data(), count, MPI_DOUBLE, send_rank_a, 0, recv_rank_a, 0, comm, MPI_STATUS_IGNORE);
   }
-
-  for (int i = 0; i < col; ++i) {
-    world_.send(send_rank_b, 1, local_b.data(), block_size_ * block_size_);
-    world_.recv(recv_rank_b, 1, tmp_b.data(), block_size_ * block_size_);
-    std::swap(local_b, tmp_b);
+  if (col != 0) {
+    int send_rank_b = col + (grid_size * ((row + grid_size - col) % grid_size));
+    int recv_rank_b = col + (grid_size * ((row + col) % grid_size));
+    MPI_Sendrecv_replace(local_b.data(), count, MPI_DOUBLE, send_rank_b, 1, recv_rank_b, 1, comm, MPI_STATUS_IGNORE);
   }
 }
 
-void vavilov_v_cannon_all::CannonALL::ShiftBlocks(std::vector<double>& local_a, std::vector<double>& local_b) {
-  int rank = world_.rank();
+std::array<mpi::request, 4> vavilov_v_cannon_all::CannonALL::StartShift(const mpi::communicator& comm,
+                                                                        const std::vector<double>& local_a,
+                                                                        const std::vector<double>& local_b,
+                                                                        std::vector<double>& next_a,
+                                                                        std::vector<double>& next_b) const {
   int grid_size = num_blocks_;
-  int row = rank / grid_size;
-  int col = rank % grid_size;
+  int row = comm.rank() / grid_size;
+  int col = comm.rank() % grid_size;
+  int count = block_size_ * block_size_;
 
   int send_rank_a = (row * grid_size) + ((col + grid_size - 1) % grid_size);
   int recv_rank_a = (row * grid_size) + ((col + 1) % grid_size);
@@ -97,29 +99,20 @@ void vavilov_v_cannon_all::CannonALL::ShiftBlocks(std::vector<double>& local_a,
   int send_rank_b = col + (grid_size * ((row + grid_size - 1) % grid_size));
   int recv_rank_b = col + (grid_size * ((row + 1) % grid_size));
 
-  std::vector<double> tmp_a(block_size_ * block_size_);
-  std::vector<double> tmp_b(block_size_ * block_size_);
-
-  world_.send(send_rank_a, 2, local_a.data(), block_size_ * block_size_);
-  world_.recv(recv_rank_a, 2, tmp_a.data(), block_size_ * block_size_);
-  std::swap(local_a, tmp_a);
-
-  world_.send(send_rank_b, 3, local_b.data(), block_size_ * block_size_);
-  world_.recv(recv_rank_b, 3, tmp_b.data(), block_size_ * block_size_);
-  std::swap(local_b, tmp_b);
+  return {comm.irecv(recv_rank_a, 2, next_a.data(), count), comm.irecv(recv_rank_b, 3, next_b.data(), count),
+          comm.isend(send_rank_a, 2, local_a.data(), count), comm.isend(send_rank_b, 3, local_b.data(), count)};
 }
 
 void vavilov_v_cannon_all::CannonALL::BlockMultiply(const std::vector<double>& local_a,
                                                     const std::vector<double>& local_b, std::vector<double>& local_c) {
+  // threads of the process multiply strips of rows of the block
+  const int strip = 64;
 #pragma omp parallel for
-  for (int i = 0; i < block_size_; ++i) {
-    for (int j = 0; j < block_size_; ++j) {
-      double temp = 0.0;
-      for (int k = 0; k < block_size_; ++k) {
-        temp += local_a[(i * block_size_) + k] * local_b[(k * block_size_) + j];
-      }
-      local_c[(i * block_size_) + j] += temp;
-    }
+  for (int i = 0; i < block_size_; i += strip) {
+    const int rows = std::min(strip, block_size_ - i);
+    const size_t offset = static_cast<size_t>(i) * block_size_;
+    ppc::core::gemm::Gemm(rows, block_size_, block_size_, local_a.data() + offset, block_size_, local_b.data(),
+                          block_size_, local_c.data() + offset, block_size_);
   }
 }
 
@@ -185,13 +178,19 @@ bool vavilov_v_cannon_all::CannonALL::RunImpl() {
   mpi::scatter(active_world, scatter_a.data(), local_a.data(), block_size_sq, 0);
   mpi::scatter(active_world, scatter_b.data(), local_b.data(), block_size_sq, 0);
 
-  InitialShift(local_a, local_b);
+  InitialShift(active_world, local_a, local_b);
 
-  BlockMultiply(local_a, local_b, local_c);
+  // blocks of the next step arrive into the second pair of buffers while the threads multiply the current ones
+  std::vector<double> next_a(block_size_sq);
+  std::vector<double> next_b(block_size_sq);
   for (int iter = 0; iter < num_blocks_ - 1; ++iter) {
-    ShiftBlocks(local_a, local_b);
+    auto requests = StartShift(active_world, local_a, local_b, next_a, next_b);
     BlockMultiply(local_a, local_b, local_c);
+    mpi::wait_all(requests.begin(), requests.end());
+    local_a.swap(next_a);
+    local_b.swap(next_b);
   }
+  BlockMultiply(local_a, local_b, local_c);
 
   std::vector<double> tmp_c;
   if (rank == 0) {
@@ -4,69 +4,17 @@
 
 #include <algorithm>
 #include <cmath>
-#include <utility>
+#include <cstddef>
+#include <span>
 #include <vector>
 
+#include "core/sort/include/batcher_sort.hpp"
+#include "core/sort/include/quick_sort.hpp"
+#include "core/util/include/tbb_for.hpp"
 #include "core/util/include/util.hpp"
 #include "mpi.h"
-#include "oneapi/tbb/blocked_range.h"
-#include "oneapi/tbb/parallel_for.h"
 #include "oneapi/tbb/task_arena.h"
 
-namespace {
-int Partition(int* s_vec, int first, int last) {
-  int i = first - 1;
-  int value = s_vec[last];
-
-  for (int j = first; j <= last - 1; j++) {
-    if (s_vec[j] <= value) {
-      i++;
-      std::swap(s_vec[i], s_vec[j]);
-    }
-  }
-  std::swap(s_vec[i + 1], s_vec[last]);
-  return i + 1;
-}
-
-void HoareSort(int* s_vec, int first, int last) {
-  if (first < last) {
-    int iter = Partition(s_vec, first, last);
-    HoareSort(s_vec, first, iter - 1);
-    HoareSort(s_vec, iter + 1, last);
-  }
-}
-
-void BatcherMergeBlocksStep(int* left_pointer, int& left_size, int* right_pointer, int& right_size) {
-  std::inplace_merge(left_pointer, right_pointer, right_pointer + right_size);
-  left_size += right_size;
-}
-
-void BatcherMerge(int thread_input_size, std::vector<int*>& pointers, std::vector<int>& sizes, int par_if_greater) {
-  const int batcherthreads = ppc::util::GetPPCNumThreads();
-  for (int batcher_iter = 1, batcher_pack = int(pointers.size()); batcher_pack > 1;
-       batcher_iter *= 2, batcher_pack /= 2) {
-    tbb::task_arena arena(((thread_input_size / batcher_iter) > par_if_greater) ? batcherthreads : 1);
-    arena.execute([&] {
-      tbb::parallel_for(tbb::blocked_range<int>(0, batcher_pack / 2), [&](const auto& r) {
-        for (int off = r.begin(); off < r.end(); off++) {
-          BatcherMergeBlocksStep(pointers[2 * batcher_iter * off], sizes[2 * batcher_iter * off],
-                                 pointers[(2 * batcher_iter * off) + batcher_iter],
-                                 sizes[(2 * batcher_iter * off) + batcher_iter]);
-        }
-      });
-    });
-    if ((batcher_pack / 2) - 1 == 0) {
-      BatcherMergeBlocksStep(pointers[0], sizes[sizes.size() - 1], pointers[pointers.size() - 1],
-                             sizes[sizes.size() - 1]);
-    } else if ((batcher_pack / 2) % 2 != 0) {
-      BatcherMergeBlocksStep(
-          pointers[2 * batcher_iter * ((batcher_pack / 2) - 2)], sizes[2 * batcher_iter * ((batcher_pack / 2) - 2)],
-          pointers[2 * batcher_iter * ((batcher_pack / 2) - 1)], sizes[2 * batcher_iter * ((batcher_pack / 2) - 1)]);
-    }
-  }
-}
-}  // namespace
-
 bool vershinina_a_hoare_sort_mpi::TestTaskALL::PreProcessingImpl() {
   if (rank_ != 0) {
     return true;
@@ -126,25 +74,11 @@ bool vershinina_a_hoare_sort_mpi::TestTaskALL::RunImpl() {
 
   const auto local_processing_size = int(res_.size());
   const auto numthreads = std::min(local_processing_size, ppc::util::GetPPCNumThreads());
-  int thread_input_size = local_processing_size / numthreads;
-  int thread_input_remainder_size = local_processing_size % numthreads;
-
-  std::vector<int*> pointers(numthreads);
-  std::vector<int> sizes(numthreads);
-  for (int i = 0; i < numthreads; i++) {
-    pointers[i] = res_.data() + (i * thread_input_size);
-    sizes[i] = thread_input_size;
-  }
-  sizes[sizes.size() - 1] += thread_input_remainder_size;
   tbb::task_arena arena(numthreads);
-  arena.execute([&] {
-    tbb::parallel_for(tbb::blocked_range<int>(0, numthreads, 1), [&pointers, &sizes](const auto& r) {
-      for (int i = r.begin(); i < r.end(); i++) {
-        HoareSort(pointers[i], 0, sizes[i] - 1);
-      }
-    });
-  });
-  BatcherMerge(thread_input_size, pointers, sizes, 32);
+  // Batcher's network merges the blocks, which are sorted by the sequential QuickSort
+  ppc::core::sort::BatcherSort(
+      std::span<int>(res_), 2 * static_cast<size_t>(numthreads),
+      [](std::span<int> block) { ppc::core::sort::QuickSort(block); }, ppc::util::TbbFor{&arena});
 
   for (int i = 1; i < active_procs_num; i *= 2) {
     const auto kk = 2 * i;
@@ -1,8 +1,11 @@
 #pragma once
 
+#include <cstddef>
+#include <optional>
 #include <utility>
 #include <vector>
 
+#include "core/gemm/include/strassen.hpp"
 #include "core/task/include/task.hpp"
 
 namespace borisov_s_strassen_omp {
@@ -25,6 +28,12 @@ class ParallelStrassenOMP : public ppc::core::Task {
   int colsA_ = 0;
   int rowsB_ = 0;
   int colsB_ = 0;
+
+  size_t dim_ = 0;
+  std::optional<ppc::core::gemm::StrassenPlan> plan_;
+  std::vector<double> a_;
+  std::vector<double> b_;
+  std::vector<double> c_;
 };
 
 }  // namespace borisov_s_strassen_omp
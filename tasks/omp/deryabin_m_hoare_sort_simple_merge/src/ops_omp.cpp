@@ -4,35 +4,18 @@
 #include <cmath>
 #include <cstddef>
 #include <numbers>
+#include <span>
 #include <vector>
 
+#include "core/sort/include/quick_sort.hpp"
+#include "core/util/include/omp_for.hpp"
+#include "core/util/include/util.hpp"
+
 void deryabin_m_hoare_sort_simple_merge_omp::HoaraSort(std::vector<double>& a, size_t first, size_t last) {
-  size_t i = first;
-  size_t j = last;
-  double tmp = 0;
-  double x =
-      std::max(std::min(a[first], a[(first + last) / 2]),
-               std::min(std::max(a[first], a[(first + last) / 2]),
-                        a[last]));  // выбор опорного элемента как медианы первого, среднего и последнего элементов
-  do {
-    while (a[i] < x) {
-      i++;
-    }
-    while (a[j] > x) {
-      j--;
-    }
-    if (i < j && a[i] > a[j]) {
-      tmp = a[i];
-      a[i] = a[j];
-      a[j] = tmp;
-    }
-  } while (i < j);
-  if (i < last) {
-    HoaraSort(a, i + 1, last);
-  }
-  if (first < j) {
-    HoaraSort(a, first, j);
+  if (first >= last) {
+    return;
   }
+  ppc::core::sort::QuickSort(std::span<double>(a).subspan(first, last - first + 1));
 }
 
 void deryabin_m_hoare_sort_simple_merge_omp::MergeTwoParts(std::vector<double>& a, size_t left, size_t right,
@@ -114,24 +97,8 @@ bool deryabin_m_hoare_sort_simple_merge_omp::HoareSortTaskOpenMP::ValidationImpl
 }
 
 bool deryabin_m_hoare_sort_simple_merge_omp::HoareSortTaskOpenMP::RunImpl() {
-  auto chunk_count = (short)chunk_count_;
-#pragma omp parallel for
-  for (short count = 0; count < chunk_count; count++) {
-    HoaraSort(input_array_A_, count * (short)min_chunk_size_, ((count + 1) * (short)min_chunk_size_) - 1);
-  }
-#pragma omp barrier
-#pragma omp parallel for ordered
-  for (short i = 0; i < (short)(log((double)chunk_count_) / std::numbers::ln2); i++) {
-#pragma omp ordered
-    {
-      for (short j = 0; j < chunk_count; j++) {
-        MergeTwoParts(input_array_A_, j * (short)min_chunk_size_ << (i + 1),
-                      ((j + 1) * (short)min_chunk_size_ << (i + 1)) - 1, dimension_);
-        chunk_count--;
-      }
-    }
-  }
-#pragma omp barrier
+  ppc::core::sort::QuickSort(std::span<double>(input_array_A_),
+                             4 * static_cast<size_t>(ppc::util::GetPPCNumThreads()), ppc::util::OmpFor{});
   return true;
 }
 
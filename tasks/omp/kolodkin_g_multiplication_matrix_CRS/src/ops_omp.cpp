@@ -9,6 +9,10 @@
 #include <utility>
 #include <vector>
 
+#include "core/sparse/include/spgemm.hpp"
+#include "core/util/include/omp_for.hpp"
+#include "core/util/include/util.hpp"
+
 void kolodkin_g_multiplication_matrix_omp::SparseMatrixCRS::AddValue(int row, Complex value, int col) {
   bool found = false;
   for (int j = rowPtr[row]; j < rowPtr[row + 1]; j++) {
@@ -144,33 +148,19 @@ bool kolodkin_g_multiplication_matrix_omp::TestTaskOpenMP::ValidationImpl() {
 }
 
 bool kolodkin_g_multiplication_matrix_omp::TestTaskOpenMP::RunImpl() {
-  SparseMatrixCRS c(A_.numRows, B_.numCols);
-  std::vector<std::vector<std::pair<unsigned int, Complex>>> local_results(A_.numRows);
-
-#pragma omp parallel for
-  for (int i = 0; i < A_.numRows; i++) {
-    std::vector<std::pair<unsigned int, Complex>> temp_results;
-
-    for (int j = A_.rowPtr[i]; j < A_.rowPtr[i + 1]; j++) {
-      unsigned int col_a = A_.colIndices[j];
-      Complex value_a = A_.values[j];
-
-      for (int k = B_.rowPtr[col_a]; k < B_.rowPtr[col_a + 1]; k++) {
-        unsigned int col_b = B_.colIndices[k];
-        Complex value_b = B_.values[k];
-
-        temp_results.emplace_back(col_b, value_a * value_b);
-      }
-    }
-    local_results[i] = std::move(temp_results);
-  }
-
-  for (int i = 0; i < A_.numRows; i++) {
-    for (const auto& result : local_results[i]) {
-      c.AddValue(i, result.second, (int)result.first);
-    }
-  }
+  // Gustavson product by rows, entries with terms are kept even if they sum to zero
+  const ppc::core::sparse::CsrView<int, Complex> a{A_.rowPtr, A_.colIndices, A_.values,
+                                                   static_cast<size_t>(A_.numCols)};
+  const ppc::core::sparse::CsrView<int, Complex> b{B_.rowPtr, B_.colIndices, B_.values,
+                                                   static_cast<size_t>(B_.numCols)};
+  ppc::core::sparse::CsrArrays<int, Complex> product;
+  ppc::core::sparse::Multiply(a, b, product, ppc::core::sparse::KeepAll{}, ppc::util::GetPPCNumChunks(),
+                              ppc::util::OmpFor{});
 
+  SparseMatrixCRS c(A_.numRows, B_.numCols);
+  c.values = std::move(product.values);
+  c.colIndices = std::move(product.indices);
+  c.rowPtr = std::move(product.offsets);
   output_ = ParseMatrixIntoVec(c);
   return true;
 }
@@ -2,12 +2,15 @@
 
 #include <omp.h>
 
-#include <algorithm>
 #include <cmath>
 #include <complex>
+#include <cstddef>
+#include <span>
 #include <utility>
 #include <vector>
 
+#include "core/sparse/include/complex_kernels.hpp"
+
 bool kondratev_ya_ccs_complex_multiplication_omp::IsZero(const std::complex<double> &value) {
   return std::norm(value) < kEpsilonForZero;
 }
@@ -17,18 +20,83 @@ bool kondratev_ya_ccs_complex_multiplication_omp::IsEqual(const std::complex<dou
   return std::norm(a - b) <= kEpsilonForZero;
 }
 
+namespace kondratev_ya_ccs_complex_multiplication_omp {
+namespace {
+
+Matrix ToMatrix(const CCSMatrix &m) {
+  Matrix res;
+  res.num_rows = static_cast<size_t>(m.rows);
+  res.num_cols = static_cast<size_t>(m.cols);
+  res.offsets.assign(m.col_ptrs.begin(), m.col_ptrs.end());
+  res.indices.assign(m.row_index.begin(), m.row_index.end());
+  res.values.assign(m.values.begin(), m.values.end());
+  return res;
+}
+
+CCSMatrix ToCCSMatrix(const Matrix &m) {
+  CCSMatrix res({static_cast<int>(m.num_rows), static_cast<int>(m.num_cols)});
+  res.col_ptrs.assign(m.offsets.begin(), m.offsets.end());
+  res.row_index.assign(m.indices.begin(), m.indices.end());
+  res.values.assign(m.values.begin(), m.values.end());
+  return res;
+}
+
+using Column = std::vector<std::pair<int, std::complex<double>>>;
+
+// column j of a * b sums the columns k of a scaled by b(k, j), entries below the zero threshold are dropped
+void ComputeColumn(const Matrix &a, const ppc::core::sparse::SplitComplex &a_values, const Matrix &b, int j,
+                   ppc::core::sparse::ComplexAccumulator &acc, Column &column) {
+  for (int k = b.offsets[j]; k < b.offsets[j + 1]; k++) {
+    const int row_b = b.indices[k];
+    const int begin = a.offsets[row_b];
+    const std::span<const int> rows_a(a.indices.data() + begin, a.offsets[row_b + 1] - begin);
+    ppc::core::sparse::ScatterMultiplyAdd(rows_a, a_values, begin, b.values[k], acc);
+  }
+  ppc::core::sparse::DrainNonZero(acc, kEpsilonForZero, [&](size_t i, std::complex<double> value) {
+    column.emplace_back(static_cast<int>(i), value);
+  });
+}
+
+// offsets of the matrix with the given columns, its indices and values are sized but not filled
+Matrix AllocateColumns(size_t num_rows, const std::vector<Column> &columns) {
+  Matrix res;
+  res.num_rows = num_rows;
+  res.num_cols = columns.size();
+  res.offsets.resize(columns.size() + 1, 0);
+  for (size_t j = 0; j < columns.size(); j++) {
+    res.offsets[j + 1] = res.offsets[j] + static_cast<int>(columns[j].size());
+  }
+  res.indices.resize(static_cast<size_t>(res.offsets.back()));
+  res.values.resize(static_cast<size_t>(res.offsets.back()));
+  return res;
+}
+
+void FillColumn(Matrix &res, const std::vector<Column> &columns, size_t j) {
+  auto offset = static_cast<size_t>(res.offsets[j]);
+  for (const auto &[row, value] : columns[j]) {
+    res.indices[offset] = row;
+    res.values[offset] = value;
+    offset++;
+  }
+}
+
+}  // namespace
+}  // namespace kondratev_ya_ccs_complex_multiplication_omp
+
 bool kondratev_ya_ccs_complex_multiplication_omp::TestTaskOMP::PreProcessingImpl() {
-  a_ = *reinterpret_cast<CCSMatrix *>(task_data->inputs[0]);
-  b_ = *reinterpret_cast<CCSMatrix *>(task_data->inputs[1]);
+  const auto &a = *reinterpret_cast<CCSMatrix *>(task_data->inputs[0]);
+  const auto &b = *reinterpret_cast<CCSMatrix *>(task_data->inputs[1]);
 
-  if (a_.rows == 0 || a_.cols == 0 || b_.rows == 0 || b_.cols == 0) {
+  if (a.rows == 0 || a.cols == 0 || b.rows == 0 || b.cols == 0) {
     return false;
   }
 
-  if (a_.cols != b_.rows) {
+  if (a.cols != b.rows) {
     return false;
   }
 
+  a_ = ToMatrix(a);
+  b_ = ToMatrix(b);
   return true;
 }
 
@@ -38,56 +106,34 @@ bool kondratev_ya_ccs_complex_multiplication_omp::TestTaskOMP::ValidationImpl()
 }
 
 bool kondratev_ya_ccs_complex_multiplication_omp::TestTaskOMP::RunImpl() {
-  c_ = a_ * b_;
+  c_ = Multiply(a_, b_);
   return true;
 }
 
 bool kondratev_ya_ccs_complex_multiplication_omp::TestTaskOMP::PostProcessingImpl() {
-  *reinterpret_cast<CCSMatrix *>(task_data->outputs[0]) = c_;
+  *reinterpret_cast<CCSMatrix *>(task_data->outputs[0]) = ToCCSMatrix(c_);
   return true;
 }
 
-kondratev_ya_ccs_complex_multiplication_omp::CCSMatrix
-kondratev_ya_ccs_complex_multiplication_omp::CCSMatrix::operator*(const CCSMatrix &other) const {
-  CCSMatrix result({rows, other.cols});
-  result.values.reserve(std::min(rows * other.cols, static_cast<int>(values.size() * other.values.size())));
-  result.row_index.reserve(result.values.capacity());
-  result.col_ptrs.resize(other.cols + 1, 0);
-
-  std::vector<std::vector<std::pair<int, std::complex<double>>>> temp_cols(other.cols);
-
-#pragma omp parallel for
-  for (int result_col = 0; result_col < other.cols; result_col++) {
-    std::vector<std::complex<double>> local_temp_col(rows, std::complex<double>(0.0, 0.0));
+kondratev_ya_ccs_complex_multiplication_omp::Matrix
+kondratev_ya_ccs_complex_multiplication_omp::TestTaskOMP::Multiply(const Matrix &a, const Matrix &b) {
+  const int cols = static_cast<int>(b.num_cols);
+  std::vector<Column> temp_cols(cols);
+  const ppc::core::sparse::SplitComplex split_values(a.values);
 
-    for (int k = other.col_ptrs[result_col]; k < other.col_ptrs[result_col + 1]; k++) {
-      int row_other = other.row_index[k];
-      std::complex<double> val_other = other.values[k];
+#pragma omp parallel
+  {
+    ppc::core::sparse::ComplexAccumulator local_temp_col(a.num_rows);
 
-      for (int i = col_ptrs[row_other]; i < col_ptrs[row_other + 1]; i++) {
-        int row_this = row_index[i];
-        local_temp_col[row_this] += values[i] * val_other;
-      }
-    }
-
-    for (int i = 0; i < rows; i++) {
-      if (!IsZero(local_temp_col[i])) {
-        temp_cols[result_col].emplace_back(i, local_temp_col[i]);
-      }
+#pragma omp for
+    for (int result_col = 0; result_col < cols; result_col++) {
+      ComputeColumn(a, split_values, b, result_col, local_temp_col, temp_cols[result_col]);
     }
   }
 
-  int nonzero_elements_processed = 0;
-  for (int col = 0; col < other.cols; col++) {
-    result.col_ptrs[col] = nonzero_elements_processed;
-
-    for (const auto &[row, value] : temp_cols[col]) {
-      result.row_index.emplace_back(row);
-      result.values.emplace_back(value);
-      nonzero_elements_processed++;
-    }
+  Matrix result = AllocateColumns(a.num_rows, temp_cols);
+  for (size_t col = 0; col < temp_cols.size(); col++) {
+    FillColumn(result, temp_cols, col);
   }
-  result.col_ptrs[other.cols] = nonzero_elements_processed;
-
   return result;
-}
\ No newline at end of file
+}
@@ -2,13 +2,13 @@
 
 #include <omp.h>
 
-#include <algorithm>
 #include <cstddef>
-#include <unordered_map>
 #include <utility>
-#include <vector>
 
+#include "core/sparse/include/spgemm.hpp"
 #include "core/task/include/task.hpp"
+#include "core/util/include/omp_for.hpp"
+#include "core/util/include/util.hpp"
 
 namespace konkov_i_sparse_matmul_ccs_omp {
 
@@ -32,52 +32,15 @@ bool SparseMatmulTask::PreProcessingImpl() {
 }
 
 bool SparseMatmulTask::RunImpl() {
-  std::vector<std::unordered_map<int, double>> column_map(colsB);
-
-#pragma omp parallel for
-  for (int col_b = 0; col_b < colsB; ++col_b) {
-    for (int j = B_col_ptr[col_b]; j < B_col_ptr[col_b + 1]; ++j) {
-      int row_b = B_row_indices[j];
-      double val_b = B_values[j];
-
-      if (row_b >= colsA) {
-        continue;
-      }
-
-      for (int k = A_col_ptr[row_b]; k < A_col_ptr[row_b + 1]; ++k) {
-        if (static_cast<size_t>(k) >= A_row_indices.size()) {
-          continue;
-        }
-
-        int row_a = A_row_indices[k];
-        double val_a = A_values[k];
-
-#pragma omp critical
-        column_map[col_b][row_a] += val_a * val_b;
-      }
-    }
-  }
-
-  C_col_ptr.resize(colsB + 1, 0);
-  int count = 0;
-
-  for (int col = 0; col < colsB; ++col) {
-    std::vector<int> rows;
-    for (const auto& pair : column_map[col]) {
-      if (pair.second != 0) {
-        rows.push_back(pair.first);
-      }
-    }
-    std::ranges::sort(rows);
-
-    for (int row : rows) {
-      C_values.push_back(column_map[col][row]);
-      C_row_indices.push_back(row);
-      count++;
-    }
-    C_col_ptr[col + 1] = count;
-  }
-
+  // CCS arrays of a matrix are the CSR arrays of its transpose, and (A * B)^T = B^T * A^T
+  const ppc::core::sparse::CsrView<int, double> b{B_col_ptr, B_row_indices, B_values, static_cast<size_t>(rowsB)};
+  const ppc::core::sparse::CsrView<int, double> a{A_col_ptr, A_row_indices, A_values, static_cast<size_t>(rowsA)};
+  ppc::core::sparse::CsrArrays<int, double> c;
+  ppc::core::sparse::Multiply(b, a, c, ppc::core::sparse::KeepNonZero{}, ppc::util::GetPPCNumChunks(),
+                              ppc::util::OmpFor{});
+  C_values = std::move(c.values);
+  C_row_indices = std::move(c.indices);
+  C_col_ptr = std::move(c.offsets);
   return true;
 }
 
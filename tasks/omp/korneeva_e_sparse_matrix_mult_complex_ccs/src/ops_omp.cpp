@@ -3,9 +3,13 @@
 #include <omp.h>
 
 #include <cmath>
+#include <cstddef>
+#include <span>
 #include <utility>
 #include <vector>
 
+#include "core/sparse/include/complex_kernels.hpp"
+
 namespace korneeva_e_sparse_matrix_mult_complex_ccs_omp {
 
 bool SparseMatrixMultComplexCCS::PreProcessingImpl() {
@@ -26,9 +30,16 @@ bool SparseMatrixMultComplexCCS::RunImpl() {
   std::vector<std::vector<int>> local_row_indices(matrix2_->cols);
   std::vector<int> temp_col_offsets(matrix2_->cols + 1, 0);
 
-#pragma omp parallel for
-  for (int j = 0; j < matrix2_->cols; j++) {
-    ComputeColumn(j, local_values[j], local_row_indices[j], temp_col_offsets);
+  const ppc::core::sparse::SplitComplex values1(matrix1_->values);
+
+#pragma omp parallel
+  {
+    ppc::core::sparse::ComplexAccumulator column(matrix1_->rows);
+
+#pragma omp for
+    for (int j = 0; j < matrix2_->cols; j++) {
+      ComputeColumn(j, values1, column, local_values[j], local_row_indices[j]);
+    }
   }
 
   std::vector<Complex> final_values;
@@ -48,43 +59,20 @@ bool SparseMatrixMultComplexCCS::RunImpl() {
   return true;
 }
 
-void SparseMatrixMultComplexCCS::ComputeColumn(int col_idx, std::vector<Complex>& values, std::vector<int>& row_indices,
-                                               std::vector<int>& col_offsets) {
-  int col_start2 = matrix2_->col_offsets[col_idx];
-  int col_end2 = matrix2_->col_offsets[col_idx + 1];
-
-  for (int i = 0; i < matrix1_->rows; i++) {
-    Complex sum = ComputeElement(i, col_start2, col_end2);
-    if (sum != Complex(0.0, 0.0)) {
-      values.push_back(sum);
-      row_indices.push_back(i);
-    }
-  }
-}
-
-Complex SparseMatrixMultComplexCCS::ComputeElement(int row_idx, int col_start2, int col_end2) {
-  Complex sum(0.0, 0.0);
-  for (int k = 0; k < matrix1_->cols; k++) {
+void SparseMatrixMultComplexCCS::ComputeColumn(int col_idx, const ppc::core::sparse::SplitComplex& values1,
+                                               ppc::core::sparse::ComplexAccumulator& column,
+                                               std::vector<Complex>& values, std::vector<int>& row_indices) {
+  // column col_idx of the product sums the columns k of matrix1 scaled by matrix2(k, col_idx)
+  for (int q = matrix2_->col_offsets[col_idx]; q < matrix2_->col_offsets[col_idx + 1]; q++) {
+    int k = matrix2_->row_indices[q];
     int col_start1 = matrix1_->col_offsets[k];
-    int col_end1 = matrix1_->col_offsets[k + 1];
-    sum += ComputeContribution(row_idx, k, col_start1, col_end1, col_start2, col_end2);
-  }
-  return sum;
-}
-
-Complex SparseMatrixMultComplexCCS::ComputeContribution(int row_idx, int k, int col_start1, int col_end1,
-                                                        int col_start2, int col_end2) {
-  Complex contribution(0.0, 0.0);
-  for (int p = col_start1; p < col_end1; p++) {
-    if (matrix1_->row_indices[p] == row_idx) {
-      for (int q = col_start2; q < col_end2; q++) {
-        if (matrix2_->row_indices[q] == k) {
-          contribution += matrix1_->values[p] * matrix2_->values[q];
-        }
-      }
-    }
+    std::span<const int> rows1(matrix1_->row_indices.data() + col_start1, matrix1_->col_offsets[k + 1] - col_start1);
+    ppc::core::sparse::ScatterMultiplyAdd(rows1, values1, col_start1, matrix2_->values[q], column);
   }
-  return contribution;
+  ppc::core::sparse::DrainNonZero(column, 0.0, [&](size_t i, Complex sum) {
+    values.push_back(sum);
+    row_indices.push_back(static_cast<int>(i));
+  });
 }
 
 bool SparseMatrixMultComplexCCS::PostProcessingImpl() {
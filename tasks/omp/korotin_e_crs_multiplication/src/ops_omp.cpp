@@ -1,12 +1,15 @@
 #include "omp/korotin_e_crs_multiplication/include/ops_omp.hpp"
 
-#include <omp.h>
-
 #include <algorithm>
 #include <cmath>
 #include <cstddef>
+#include <utility>
 #include <vector>
 
+#include "core/sparse/include/spgemm.hpp"
+#include "core/util/include/omp_for.hpp"
+#include "core/util/include/util.hpp"
+
 bool korotin_e_crs_multiplication_omp::CrsMultiplicationOMP::PreProcessingImpl() {
   A_N_ = task_data->inputs_count[0];
   auto *in_ptr = reinterpret_cast<unsigned int *>(task_data->inputs[0]);
@@ -46,74 +49,16 @@ bool korotin_e_crs_multiplication_omp::CrsMultiplicationOMP::ValidationImpl() {
 }
 
 bool korotin_e_crs_multiplication_omp::CrsMultiplicationOMP::RunImpl() {
-  std::vector<unsigned int> tr_i(*std::ranges::max_element(B_col_.begin(), B_col_.end()) + 2, 0);
-  unsigned int i = 0;
-  unsigned int j = 0;
-  for (i = 0; i < B_Nz_; i++) {
-    tr_i[B_col_[i] + 1]++;
-  }
-  for (i = 1; i < tr_i.size(); i++) {
-    tr_i[i] += tr_i[i - 1];
-  }
-
-  std::vector<unsigned int> tcol(B_Nz_, 0);
-  std::vector<double> tval(B_Nz_, 0);
-  for (i = 0; i < B_N_ - 1; i++) {
-    for (j = B_rI_[i]; j < B_rI_[i + 1]; j++) {
-      tval[tr_i[B_col_[j]]] = B_val_[j];
-      tcol[tr_i[B_col_[j]]] = i;
-      tr_i[B_col_[j]]++;
-    }
-  }
-  for (i = tr_i.size() - 1; i > 0; i--) {
-    tr_i[i] = tr_i[i - 1];
-  }
-  tr_i[0] = 0;
-
-  unsigned int ai = 0;
-  unsigned int bt = 0;
-  double sum = 0;
-  std::ranges::fill(output_rI_.begin(), output_rI_.end(), 0);
-  output_col_.clear();
-  output_val_.clear();
-  std::vector<std::vector<double>> local_val(omp_get_max_threads());
-  std::vector<std::vector<unsigned int>> local_col(omp_get_max_threads());
-  std::vector<int> temp_r_i(A_N_, 0);
-
-#pragma omp parallel for private(j, sum, ai, bt)
-  for (int k = 0; k < static_cast<int>(A_N_ - 1); k++) {
-    int thread_id = omp_get_thread_num();
-    for (j = 0; j < tr_i.size() - 1; j++) {
-      sum = 0;
-      ai = A_rI_[k];
-      bt = tr_i[j];
-      while (ai < A_rI_[k + 1] && bt < tr_i[j + 1]) {
-        if (A_col_[ai] == tcol[bt]) {
-          sum += A_val_[ai] * tval[bt];
-          ai++;
-          bt++;
-        } else if (A_col_[ai] < tcol[bt]) {
-          ai++;
-        } else {
-          bt++;
-        }
-      }
-      if (sum != 0) {
-        local_val[thread_id].push_back(sum);
-        local_col[thread_id].push_back(j);
-        temp_r_i[k + 1]++;
-      }
-    }
-  }
-
-  for (int t = 0; t < omp_get_max_threads(); t++) {
-    output_val_.insert(output_val_.end(), local_val[t].begin(), local_val[t].end());
-    output_col_.insert(output_col_.end(), local_col[t].begin(), local_col[t].end());
-  }
-
-  for (i = 1; i < A_N_; i++) {
-    output_rI_[i] += output_rI_[i - 1] + temp_r_i[i];
-  }
+  // Gustavson product by rows: only products of matching entries are computed, rows are split by their work
+  const size_t b_cols = B_Nz_ == 0 ? 0 : *std::ranges::max_element(B_col_) + 1;
+  const ppc::core::sparse::CsrView<unsigned int, double> a{A_rI_, A_col_, A_val_, B_N_ - 1};
+  const ppc::core::sparse::CsrView<unsigned int, double> b{B_rI_, B_col_, B_val_, b_cols};
+  ppc::core::sparse::CsrArrays<unsigned int, double> c;
+  ppc::core::sparse::Multiply(a, b, c, ppc::core::sparse::KeepNonZero{}, ppc::util::GetPPCNumChunks(),
+                              ppc::util::OmpFor{});
+  std::ranges::copy(c.offsets, output_rI_.begin());
+  output_col_ = std::move(c.indices);
+  output_val_ = std::move(c.values);
   return true;
 }
 
@@ -15,7 +15,6 @@ class ShellSortOMP : public ppc::core::Task {
 
  private:
   std::vector<int> input_;
-  void ShellSort();
 };
 
 }  // namespace kovalchuk_a_shell_sort_omp
\ No newline at end of file
@@ -1,12 +1,15 @@
 #include "omp/kovalchuk_a_shell_sort/include/ops_omp.hpp"
 
-#include <omp.h>
-
 #include <algorithm>
+#include <cstddef>
+#include <span>
 #include <utility>
 #include <vector>
 
+#include "core/sort/include/shell_sort.hpp"
 #include "core/task/include/task.hpp"
+#include "core/util/include/omp_for.hpp"
+#include "core/util/include/util.hpp"
 
 namespace kovalchuk_a_shell_sort_omp {
 
@@ -24,35 +27,11 @@ bool ShellSortOMP::ValidationImpl() {
 }
 
 bool ShellSortOMP::RunImpl() {
-  ShellSort();
+  const auto num_chunks = static_cast<std::size_t>(ppc::util::GetPPCNumThreads()) * 4;
+  ppc::core::sort::ShellSort(std::span<int>(input_), num_chunks, ppc::util::OmpFor{});
   return true;
 }
 
-void ShellSortOMP::ShellSort() {
-  if (input_.empty()) {
-    return;
-  }
-
-  std::vector<int>& arr = input_;
-  auto n = static_cast<int>(arr.size());
-
-  for (int gap = n / 2; gap > 0; gap /= 2) {
-#pragma omp parallel for
-    for (int group = 0; group < gap; ++group) {
-      for (int i = group + gap; i < n; i += gap) {
-        int temp = arr[i];
-        int j = i;
-
-        while (j >= gap && arr[j - gap] > temp) {
-          arr[j] = arr[j - gap];
-          j -= gap;
-        }
-        arr[j] = temp;
-      }
-    }
-  }
-}
-
 bool ShellSortOMP::PostProcessingImpl() {
   auto* output_ptr = reinterpret_cast<int*>(task_data->outputs[0]);
   std::ranges::copy(input_, output_ptr);
@@ -1,11 +1,12 @@
 #include "omp/nasedkin_e_strassen_algorithm/include/ops_omp.hpp"
 
-#include <omp.h>
-
-#include <algorithm>
 #include <cmath>
+#include <cstddef>
 #include <vector>
 
+#include "core/gemm/include/strassen.hpp"
+#include "core/util/include/omp_for.hpp"
+
 namespace nasedkin_e_strassen_algorithm_omp {
 
 bool StrassenOmp::PreProcessingImpl() {
@@ -23,15 +24,8 @@ bool StrassenOmp::PreProcessingImpl() {
     input_matrix_b_[i] = in_ptr_b[i];
   }
 
-  if ((matrix_size_ & (matrix_size_ - 1)) != 0) {
-    original_size_ = matrix_size_;
-    input_matrix_a_ = PadMatrixToPowerOfTwo(input_matrix_a_, matrix_size_);
-    input_matrix_b_ = PadMatrixToPowerOfTwo(input_matrix_b_, matrix_size_);
-    matrix_size_ = static_cast<int>(std::sqrt(input_matrix_a_.size()));
-  } else {
-    original_size_ = matrix_size_;
-  }
-
+  // sizes which do not halve down to the cutoff are padded inside the workspace of the plan
+  plan_.emplace(static_cast<size_t>(matrix_size_), ppc::core::gemm::StrassenCutoff(), 1);
   output_matrix_.resize(matrix_size_ * matrix_size_, 0.0);
   return true;
 }
@@ -49,15 +43,13 @@ bool StrassenOmp::ValidationImpl() {
 }
 
 bool StrassenOmp::RunImpl() {
-  output_matrix_ = StrassenMultiply(input_matrix_a_, input_matrix_b_, matrix_size_);
+  const auto n = static_cast<size_t>(matrix_size_);
+  plan_->Multiply(input_matrix_a_.data(), n, input_matrix_b_.data(), n, output_matrix_.data(), n,
+                  ppc::util::OmpInvoke);
   return true;
 }
 
 bool StrassenOmp::PostProcessingImpl() {
-  if (original_size_ != matrix_size_) {
-    output_matrix_ = TrimMatrixToOriginalSize(output_matrix_, original_size_, matrix_size_);
-  }
-
   auto* out_ptr = reinterpret_cast<double*>(task_data->outputs[0]);
 #pragma omp parallel for
   for (int i = 0; i < static_cast<int>(output_matrix_.size()); i++) {
@@ -66,24 +58,6 @@ bool StrassenOmp::PostProcessingImpl() {
   return true;
 }
 
-std::vector<double> StrassenOmp::AddMatrices(const std::vector<double>& a, const std::vector<double>& b, int size) {
-  std::vector<double> result(size * size);
-#pragma omp parallel for
-  for (int i = 0; i < size * size; i++) {
-    result[i] = a[i] + b[i];
-  }
-  return result;
-}
-
-std::vector<double> StrassenOmp::SubtractMatrices(const std::vector<double>& a, const std::vector<double>& b,
-                                                  int size) {
-  std::vector<double> result(size * size);
-#pragma omp parallel for
-  for (int i = 0; i < size * size; i++) {
-    result[i] = a[i] - b[i];
-  }
-  return result;
-}
 std::vector<double> StandardMultiply(const std::vector<double>& a, const std::vector<double>& b, int size) {
   std::vector<double> result(size * size, 0.0);
 #pragma omp parallel for
@@ -99,131 +73,4 @@ std::vector<double> StandardMultiply(const std::vector<double>& a, const std::ve
   return result;
 }
 
-std::vector<double> StrassenOmp::StrassenMultiply(const std::vector<double>& a, const std::vector<double>& b,
-                                                  int size) {
-  if (size <= 32) {
-    return StandardMultiply(a, b, size);
-  }
-
-  int half_size = size / 2;
-  std::vector<double> a11(half_size * half_size);
-  std::vector<double> a12(half_size * half_size);
-  std::vector<double> a21(half_size * half_size);
-  std::vector<double> a22(half_size * half_size);
-
-  std::vector<double> b11(half_size * half_size);
-  std::vector<double> b12(half_size * half_size);
-  std::vector<double> b21(half_size * half_size);
-  std::vector<double> b22(half_size * half_size);
-
-#pragma omp parallel sections
-  {
-#pragma omp section
-    SplitMatrix(a, a11, 0, 0, size);
-#pragma omp section
-    SplitMatrix(a, a12, 0, half_size, size);
-#pragma omp section
-    SplitMatrix(a, a21, half_size, 0, size);
-#pragma omp section
-    SplitMatrix(a, a22, half_size, half_size, size);
-#pragma omp section
-    SplitMatrix(b, b11, 0, 0, size);
-#pragma omp section
-    SplitMatrix(b, b12, 0, half_size, size);
-#pragma omp section
-    SplitMatrix(b, b21, half_size, 0, size);
-#pragma omp section
-    SplitMatrix(b, b22, half_size, half_size, size);
-  }
-
-  std::vector<double> p1;
-  std::vector<double> p2;
-  std::vector<double> p3;
-  std::vector<double> p4;
-  std::vector<double> p5;
-  std::vector<double> p6;
-  std::vector<double> p7;
-
-#pragma omp parallel sections
-  {
-#pragma omp section
-    p1 = StrassenMultiply(AddMatrices(a11, a22, half_size), AddMatrices(b11, b22, half_size), half_size);
-#pragma omp section
-    p2 = StrassenMultiply(AddMatrices(a21, a22, half_size), b11, half_size);
-#pragma omp section
-    p3 = StrassenMultiply(a11, SubtractMatrices(b12, b22, half_size), half_size);
-#pragma omp section
-    p4 = StrassenMultiply(a22, SubtractMatrices(b21, b11, half_size), half_size);
-#pragma omp section
-    p5 = StrassenMultiply(AddMatrices(a11, a12, half_size), b22, half_size);
-#pragma omp section
-    p6 = StrassenMultiply(SubtractMatrices(a21, a11, half_size), AddMatrices(b11, b12, half_size), half_size);
-#pragma omp section
-    p7 = StrassenMultiply(SubtractMatrices(a12, a22, half_size), AddMatrices(b21, b22, half_size), half_size);
-  }
-
-  std::vector<double> c11 = AddMatrices(SubtractMatrices(AddMatrices(p1, p4, half_size), p5, half_size), p7, half_size);
-  std::vector<double> c12 = AddMatrices(p3, p5, half_size);
-  std::vector<double> c21 = AddMatrices(p2, p4, half_size);
-  std::vector<double> c22 = AddMatrices(SubtractMatrices(AddMatrices(p1, p3, half_size), p2, half_size), p6, half_size);
-
-  std::vector<double> result(size * size);
-#pragma omp parallel sections
-  {
-#pragma omp section
-    MergeMatrix(result, c11, 0, 0, size);
-#pragma omp section
-    MergeMatrix(result, c12, 0, half_size, size);
-#pragma omp section
-    MergeMatrix(result, c21, half_size, 0, size);
-#pragma omp section
-    MergeMatrix(result, c22, half_size, half_size, size);
-  }
-
-  return result;
-}
-
-void StrassenOmp::SplitMatrix(const std::vector<double>& parent, std::vector<double>& child, int row_start,
-                              int col_start, int parent_size) {
-  int child_size = static_cast<int>(std::sqrt(child.size()));
-  for (int i = 0; i < child_size; ++i) {
-    std::ranges::copy(parent.begin() + (row_start + i) * parent_size + col_start,
-                      parent.begin() + (row_start + i) * parent_size + col_start + child_size,
-                      child.begin() + i * child_size);
-  }
-}
-
-void StrassenOmp::MergeMatrix(std::vector<double>& parent, const std::vector<double>& child, int row_start,
-                              int col_start, int parent_size) {
-  int child_size = static_cast<int>(std::sqrt(child.size()));
-  for (int i = 0; i < child_size; ++i) {
-    std::ranges::copy(child.begin() + i * child_size, child.begin() + (i + 1) * child_size,
-                      parent.begin() + (row_start + i) * parent_size + col_start);
-  }
-}
-
-std::vector<double> StrassenOmp::PadMatrixToPowerOfTwo(const std::vector<double>& matrix, int original_size) {
-  int new_size = 1;
-  while (new_size < original_size) {
-    new_size *= 2;
-  }
-
-  std::vector<double> padded_matrix(new_size * new_size, 0);
-  for (int i = 0; i < original_size; ++i) {
-    std::ranges::copy(matrix.begin() + i * original_size, matrix.begin() + (i + 1) * original_size,
-                      padded_matrix.begin() + i * new_size);
-  }
-  return padded_matrix;
-}
-
-std::vector<double> StrassenOmp::TrimMatrixToOriginalSize(const std::vector<double>& matrix, int original_size,
-                                                          int padded_size) {
-  std::vector<double> trimmed_matrix(original_size * original_size);
-  for (int i = 0; i < original_size; ++i) {
-    std::ranges::copy(matrix.begin() + i * padded_size, matrix.begin() + i * padded_size + original_size,
-                      trimmed_matrix.begin() + i * original_size);
-  }
-  return trimmed_matrix;
-}
-
 }  // namespace nasedkin_e_strassen_algorithm_omp
\ No newline at end of file
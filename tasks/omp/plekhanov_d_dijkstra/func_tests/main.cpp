@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 
+#include <array>
 #include <climits>
 #include <cstddef>
 #include <cstdint>
@@ -242,4 +243,32 @@ TEST(plekhanov_d_dijkstra_omp, test_dijkstra_EqualOptimalPaths) {
   std::vector<std::vector<std::pair<size_t, int>>> adj_list = {{{1, 5}, {2, 5}}, {{3, 5}}, {{3, 5}}, {}};
   std::vector<int> expected = {0, 5, 5, 10};
   plekhanov_d_dijkstra_omp::RunTest(adj_list, 0, expected);
+}
+TEST(plekhanov_d_dijkstra_omp, test_dijkstra_Batched_Sources) {
+  const size_t num_vertices = 150;
+  std::vector<std::vector<std::pair<size_t, int>>> adj_list =
+      plekhanov_d_dijkstra_omp::GenerateRandomGraph(num_vertices);
+  std::vector<int> graph_data = plekhanov_d_dijkstra_omp::ConvertToGraphData(adj_list);
+  std::vector<int> sources = {0, 149, 7, 7, 42, 13, 99, 1, 64, 120, 5, 77};
+  std::vector<int> distances(sources.size() * num_vertices);
+
+  auto task_data_omp = std::make_shared<ppc::core::TaskData>();
+  task_data_omp->inputs.emplace_back(reinterpret_cast<uint8_t *>(graph_data.data()));
+  task_data_omp->inputs_count.emplace_back(graph_data.size());
+  task_data_omp->inputs.emplace_back(reinterpret_cast<uint8_t *>(sources.data()));
+  task_data_omp->inputs_count.emplace_back(sources.size());
+  task_data_omp->AddOutput(distances.data(), std::array<uint64_t, 2>{sources.size(), num_vertices});
+
+  plekhanov_d_dijkstra_omp::TestTaskOpenMP test_task(task_data_omp);
+  ASSERT_TRUE(test_task.Validation());
+  ASSERT_TRUE(test_task.PreProcessing());
+  ASSERT_TRUE(test_task.Run());
+  ASSERT_TRUE(test_task.PostProcessing());
+  for (size_t k = 0; k < sources.size(); ++k) {
+    std::vector<int> expected =
+        plekhanov_d_dijkstra_omp::CalculateExpectedResult(adj_list, static_cast<size_t>(sources[k]));
+    std::vector<int> row(distances.begin() + static_cast<std::ptrdiff_t>(k * num_vertices),
+                         distances.begin() + static_cast<std::ptrdiff_t>((k + 1) * num_vertices));
+    EXPECT_EQ(row, expected);
+  }
 }
\ No newline at end of file
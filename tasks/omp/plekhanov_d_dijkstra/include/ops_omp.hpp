@@ -1,9 +1,12 @@
 #pragma once
 
 #include <cstddef>
+#include <optional>
 #include <utility>
 #include <vector>
 
+#include "core/graph/include/csr_graph.hpp"
+#include "core/graph/include/multi_source.hpp"
 #include "core/task/include/task.hpp"
 
 namespace plekhanov_d_dijkstra_omp {
@@ -17,13 +20,12 @@ class TestTaskOpenMP : public ppc::core::Task {
   bool PostProcessingImpl() override;
 
  private:
-  static bool ConvertGraphToAdjacencyList(const std::vector<int>& graph_data, size_t num_vertices,
-                                          std::vector<std::vector<std::pair<int, int>>>& graph);
-  std::vector<int> graph_data_;
+  ppc::core::graph::CsrGraph graph_;
+  std::optional<ppc::core::graph::BatchedQuery> batch_;
+  bool graph_valid_ = false;
   std::vector<int> distances_;
   size_t start_vertex_;
   size_t num_vertices_;
-  static const int kEndOfVertexList;
 };
 
 }  // namespace plekhanov_d_dijkstra_omp
\ No newline at end of file
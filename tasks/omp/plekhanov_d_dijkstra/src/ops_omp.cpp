@@ -1,51 +1,27 @@
 #include "omp/plekhanov_d_dijkstra/include/ops_omp.hpp"
 
-#include <omp.h>
-
 #include <climits>
 #include <cstddef>
-#include <functional>
-#include <queue>
-#include <utility>
-#include <vector>
+#include <span>
 
-namespace plekhanov_d_dijkstra_omp {
+#include "core/graph/include/adjacency_stream.hpp"
+#include "core/graph/include/delta_stepping.hpp"
+#include "core/graph/include/multi_source.hpp"
+#include "core/util/include/omp_for.hpp"
+#include "core/util/include/util.hpp"
 
-bool TestTaskOpenMP::ConvertGraphToAdjacencyList(const std::vector<int>& graph_data, size_t num_vertices,
-                                                 std::vector<std::vector<std::pair<int, int>>>& graph) {
-  graph.assign(num_vertices, {});
-  size_t current_vertex = 0;
-  size_t i = 0;
-  while (i < graph_data.size() && current_vertex < num_vertices) {
-    if (graph_data[i] == -1) {
-      current_vertex++;
-      i++;
-      continue;
-    }
-    if (i + 1 >= graph_data.size()) {
-      break;
-    }
-    size_t dest = graph_data[i];
-    int weight = graph_data[i + 1];
-    if (weight < 0) {
-      return false;
-    }
-    if (dest < num_vertices) {
-      graph[current_vertex].emplace_back(static_cast<int>(dest), weight);
-    }
-    i += 2;
+bool plekhanov_d_dijkstra_omp::TestTaskOpenMP::PreProcessingImpl() {
+  const std::span<const int> graph_data(reinterpret_cast<int*>(task_data->inputs[0]), task_data->inputs_count[0]);
+  batch_ = ppc::core::graph::GetBatchedQuery(*task_data);
+  if (batch_) {
+    // the run writes row k of the K x V output for source k
+    num_vertices_ = batch_->num_vertices;
+    graph_valid_ = ppc::core::graph::BuildFromAdjacencyStream(graph_data, num_vertices_,
+                                                              ppc::core::graph::StreamCheck::kLenient, graph_,
+                                                              ppc::util::GetPPCNumChunks(), ppc::util::OmpFor{});
+    return graph_valid_;
   }
-  return true;
-}
 
-}  // namespace plekhanov_d_dijkstra_omp
-
-const int plekhanov_d_dijkstra_omp::TestTaskOpenMP::kEndOfVertexList = -1;
-
-bool plekhanov_d_dijkstra_omp::TestTaskOpenMP::PreProcessingImpl() {
-  unsigned int input_size = task_data->inputs_count[0];
-  auto* in_ptr = reinterpret_cast<int*>(task_data->inputs[0]);
-  graph_data_.assign(in_ptr, in_ptr + input_size);
   num_vertices_ = task_data->outputs_count[0];
   distances_.assign(num_vertices_, INT_MAX);
 
@@ -59,7 +35,11 @@ bool plekhanov_d_dijkstra_omp::TestTaskOpenMP::PreProcessingImpl() {
     distances_[start_vertex_] = 0;
   }
 
-  return true;
+  // the graph is parsed once here, so the run only computes distances
+  graph_valid_ = ppc::core::graph::BuildFromAdjacencyStream(
+      graph_data, num_vertices_, ppc::core::graph::StreamCheck::kLenient, graph_, ppc::util::GetPPCNumChunks(),
+      ppc::util::OmpFor{});
+  return graph_valid_;
 }
 
 bool plekhanov_d_dijkstra_omp::TestTaskOpenMP::ValidationImpl() {
@@ -68,45 +48,25 @@ bool plekhanov_d_dijkstra_omp::TestTaskOpenMP::ValidationImpl() {
 }
 
 bool plekhanov_d_dijkstra_omp::TestTaskOpenMP::RunImpl() {
-  std::vector<std::vector<std::pair<int, int>>> adj_list;
-  if (!ConvertGraphToAdjacencyList(graph_data_, num_vertices_, adj_list)) {
+  if (!graph_valid_) {
     return false;
   }
 
-  std::priority_queue<std::pair<int, size_t>, std::vector<std::pair<int, size_t>>, std::greater<>> pq;
-
-  pq.emplace(0, start_vertex_);
-
-  while (!pq.empty()) {
-    size_t u = pq.top().second;
-    int dist_u = pq.top().first;
-    pq.pop();
-
-    if (dist_u > distances_[u]) {
-      continue;
-    }
-
-#pragma omp parallel for
-    for (int idx = 0; idx < static_cast<int>(adj_list[u].size()); ++idx) {
-      size_t v = adj_list[u][idx].first;
-      int weight = adj_list[u][idx].second;
-
-      if (distances_[u] != INT_MAX && distances_[u] + weight < distances_[v]) {
-#pragma omp critical
-        {
-          if (distances_[u] + weight < distances_[v]) {
-            distances_[v] = distances_[u] + weight;
-            pq.emplace(distances_[v], v);
-          }
-        }
-      }
-    }
+  if (batch_) {
+    ppc::core::graph::MultiSourceShortestPaths(graph_, batch_->sources, batch_->distances, ppc::util::OmpFor{});
+    return true;
   }
 
+  // delta-stepping: every round relaxes the edges of a whole bucket of vertices in one parallel loop
+  ppc::core::graph::DeltaStepping(graph_, start_vertex_, ppc::core::graph::ChooseDelta(graph_), distances_,
+                                  ppc::util::GetPPCNumChunks(), ppc::util::OmpFor{});
   return true;
 }
 
 bool plekhanov_d_dijkstra_omp::TestTaskOpenMP::PostProcessingImpl() {
+  if (batch_) {
+    return true;
+  }
   auto* output = reinterpret_cast<int*>(task_data->outputs[0]);
   for (size_t i = 0; i < distances_.size(); ++i) {
     output[i] = distances_[i];
@@ -1,6 +1,10 @@
 #include <gtest/gtest.h>
+#include <omp.h>
+
+#include "core/perf/include/thread_sweep.hpp"
 
 int main(int argc, char **argv) {
   ::testing::InitGoogleTest(&argc, argv);
+  ppc::core::ThreadSweep::Enable([](int num_threads) { omp_set_num_threads(num_threads); });
   return RUN_ALL_TESTS();
 }
@@ -22,7 +22,6 @@ class TestTaskOMP : public ppc::core::Task {
   std::vector<int> input_;
   std::vector<int> output_;
 
-  void QuickSort(std::vector<int>& arr, int low, int high);
   static void Merge(std::vector<int>& arr, int low, int mid, int high);
 };
 
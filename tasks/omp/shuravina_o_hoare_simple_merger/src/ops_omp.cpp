@@ -2,47 +2,14 @@
 
 #include <omp.h>
 
-#include <algorithm>
 #include <cstddef>
+#include <span>
 #include <vector>
 
-namespace shuravina_o_hoare_simple_merger {
-
-void TestTaskOMP::QuickSort(std::vector<int>& arr, int low, int high) {
-  if (low < high) {
-    bool is_sorted = true;
-    for (int i = low + 1; i <= high; ++i) {
-      if (arr[i - 1] > arr[i]) {
-        is_sorted = false;
-        break;
-      }
-    }
-    if (is_sorted) {
-      return;
-    }
-
-    int pivot = arr[high];
-    int i = low - 1;
-
-    for (int j = low; j < high; ++j) {
-      if (arr[j] <= pivot) {
-        ++i;
-        std::swap(arr[i], arr[j]);
-      }
-    }
-    std::swap(arr[i + 1], arr[high]);
-
-    int pi = i + 1;
+#include "core/sort/include/quick_sort.hpp"
+#include "core/util/include/omp_for.hpp"
 
-#pragma omp parallel sections
-    {
-#pragma omp section
-      QuickSort(arr, low, pi - 1);
-#pragma omp section
-      QuickSort(arr, pi + 1, high);
-    }
-  }
-}
+namespace shuravina_o_hoare_simple_merger {
 
 void TestTaskOMP::Merge(std::vector<int>& arr, int low, int mid, int high) {
   std::vector<int> temp(high - low + 1);
@@ -116,7 +83,8 @@ bool TestTaskOMP::RunImpl() {
   }
 
   auto size = input_.size();
-  QuickSort(input_, 0, static_cast<int>(size) - 1);
+  const auto num_threads = static_cast<size_t>(omp_get_max_threads());
+  ppc::core::sort::QuickSort(std::span<int>(input_), 4 * num_threads, ppc::util::OmpFor{});
   Merge(input_, 0, static_cast<int>(size / 2) - 1, static_cast<int>(size) - 1);
   output_ = input_;
   return true;
@@ -17,7 +17,7 @@ class SortTask : public ppc::core::Task {
   bool PostProcessingImpl() override;
 
  private:
-  std::vector<double> input_, output_;
+  std::vector<double> input_, output_, buffer_;
 };
 
 }  // namespace sorochkin_d_radix_double_sort_simple_merge_omp
\ No newline at end of file
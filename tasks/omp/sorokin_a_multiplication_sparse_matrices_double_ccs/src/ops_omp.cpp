@@ -1,12 +1,17 @@
 #include "omp/sorokin_a_multiplication_sparse_matrices_double_ccs/include/ops_omp.hpp"
 
 #include <algorithm>
-#include <cmath>
 #include <cstddef>
 #include <stdexcept>
+#include <utility>
 #include <vector>
 
+#include "core/sparse/include/spgemm.hpp"
+#include "core/util/include/omp_for.hpp"
+#include "core/util/include/util.hpp"
+
 namespace sorokin_a_multiplication_sparse_matrices_double_ccs_omp {
+
 void MultiplyCCS(const std::vector<double> &a_values, const std::vector<int> &a_row_indices, int m,
                  const std::vector<int> &a_col_ptr, const std::vector<double> &b_values,
                  const std::vector<int> &b_row_indices, int k, const std::vector<int> &b_col_ptr,
@@ -14,57 +19,16 @@ void MultiplyCCS(const std::vector<double> &a_values, const std::vector<int> &a_
   if (static_cast<int>(a_values.size()) > m * k || static_cast<int>(b_values.size()) > k * n) {
     throw std::invalid_argument("Invalid val pointer size");
   }
-
-  c_col_ptr.resize(n + 1);
-  std::vector<int> nnz_per_column(n, 0);
-
-#pragma omp parallel for
-  for (int j = 0; j < n; ++j) {
-    std::vector<bool> temp_used(m, false);
-    for (int t = b_col_ptr[j]; t < b_col_ptr[j + 1]; ++t) {
-      int row_b = b_row_indices[t];
-      for (int i = a_col_ptr[row_b]; i < a_col_ptr[row_b + 1]; ++i) {
-        int row_a = a_row_indices[i];
-        if (!temp_used[row_a]) {
-          temp_used[row_a] = true;
-          nnz_per_column[j]++;
-        }
-      }
-    }
-  }
-
-  c_col_ptr[0] = 0;
-  for (int j = 0; j < n; ++j) {
-    c_col_ptr[j + 1] = c_col_ptr[j] + nnz_per_column[j];
-  }
-
-  int total_nnz = c_col_ptr[n];
-  c_values.resize(total_nnz);
-  c_row_indices.resize(total_nnz);
-#pragma omp parallel for
-  for (int j = 0; j < n; ++j) {
-    std::vector<double> temp_values(m, 0.0);
-    std::vector<bool> temp_used(m, false);
-
-    for (int t = b_col_ptr[j]; t < b_col_ptr[j + 1]; ++t) {
-      int row_b = b_row_indices[t];
-      double val_b = b_values[t];
-      for (int i = a_col_ptr[row_b]; i < a_col_ptr[row_b + 1]; ++i) {
-        int row_a = a_row_indices[i];
-        temp_values[row_a] += a_values[i] * val_b;
-        temp_used[row_a] = true;
-      }
-    }
-    int pos = c_col_ptr[j];
-    for (int i = 0; i < m; ++i) {
-      if (temp_used[i]) {
-        c_row_indices[pos] = i;
-        c_values[pos] = temp_values[i];
-        pos++;
-      }
-    }
-  }
+  // CCS arrays of a matrix are the CSR arrays of its transpose, and (A * B)^T = B^T * A^T
+  const ppc::core::sparse::CsrView<int, double> b{b_col_ptr, b_row_indices, b_values, static_cast<size_t>(k)};
+  const ppc::core::sparse::CsrView<int, double> a{a_col_ptr, a_row_indices, a_values, static_cast<size_t>(m)};
+  ppc::core::sparse::CsrArrays<int, double> c;
+  ppc::core::sparse::Multiply(b, a, c, ppc::core::sparse::KeepAll{}, ppc::util::GetPPCNumChunks(), ppc::util::OmpFor{});
+  c_values = std::move(c.values);
+  c_row_indices = std::move(c.indices);
+  c_col_ptr = std::move(c.offsets);
 }
+
 }  // namespace sorokin_a_multiplication_sparse_matrices_double_ccs_omp
 
 bool sorokin_a_multiplication_sparse_matrices_double_ccs_omp::TestTaskOpenMP::PreProcessingImpl() {
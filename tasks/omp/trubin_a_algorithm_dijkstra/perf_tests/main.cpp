@@ -8,6 +8,7 @@
 #include <unordered_set>
 #include <vector>
 
+#include "core/graph/include/graph_generators.hpp"
 #include "core/perf/include/perf.hpp"
 #include "core/task/include/task.hpp"
 #include "omp/trubin_a_algorithm_dijkstra/include/ops_omp.hpp"
@@ -111,4 +112,41 @@ TEST(trubin_a_algorithm_dijkstra_omp, test_task_run) {
   for (size_t i = 0; i < kNumVertices; ++i) {
     EXPECT_TRUE(distances[i] >= -1);
   }
-}
\ No newline at end of file
+}
+TEST(trubin_a_algorithm_dijkstra_omp, test_pipeline_run_grid_graph) {
+  constexpr size_t kSide = 700;
+  constexpr size_t kNumVertices = kSide * kSide;
+
+  // large-diameter road-like graph: many delta-stepping buckets with few vertices each
+  auto graph_data = ppc::core::graph::ToAdjacencyStream(ppc::core::graph::MakeGridGraph(kSide, kSide, 100, 42));
+  int start_vertex = 0;
+  std::vector<int> distances(kNumVertices, -42);
+
+  auto task_data_omp = std::make_shared<ppc::core::TaskData>();
+  task_data_omp->inputs.push_back(reinterpret_cast<uint8_t*>(graph_data.data()));
+  task_data_omp->inputs_count.push_back(static_cast<uint32_t>(graph_data.size()));
+  task_data_omp->inputs.push_back(reinterpret_cast<uint8_t*>(&start_vertex));
+  task_data_omp->outputs.push_back(reinterpret_cast<uint8_t*>(distances.data()));
+  task_data_omp->outputs_count.push_back(static_cast<uint32_t>(kNumVertices));
+
+  auto test_task_omp = std::make_shared<trubin_a_algorithm_dijkstra_omp::TestTaskOpenMP>(task_data_omp);
+
+  auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
+  perf_attr->num_running = 5;
+  const auto t0 = std::chrono::high_resolution_clock::now();
+  perf_attr->current_timer = [&] {
+    auto current_time_point = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(current_time_point - t0).count();
+    return static_cast<double>(duration) * 1e-9;
+  };
+
+  auto perf_results = std::make_shared<ppc::core::PerfResults>();
+  auto perf_analyzer = std::make_shared<ppc::core::Perf>(test_task_omp);
+  perf_analyzer->PipelineRun(perf_attr, perf_results);
+  ppc::core::Perf::PrintPerfStatistic(perf_results);
+
+  ASSERT_EQ(distances[start_vertex], 0);
+  for (size_t i = 0; i < kNumVertices; ++i) {
+    EXPECT_GE(distances[i], 0);
+  }
+}
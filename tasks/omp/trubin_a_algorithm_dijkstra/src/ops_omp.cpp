@@ -1,17 +1,14 @@
 #include "omp/trubin_a_algorithm_dijkstra/include/ops_omp.hpp"
 
-#include <omp.h>
-
 #include <algorithm>
-#include <atomic>
-#include <cmath>
 #include <cstddef>
-#include <iterator>
 #include <limits>
-#include <unordered_map>
-#include <utility>
-#include <vector>
+#include <span>
 
+#include "core/graph/include/adjacency_stream.hpp"
+#include "core/graph/include/delta_stepping.hpp"
+#include "core/graph/include/multi_source.hpp"
+#include "core/util/include/omp_for.hpp"
 #include "core/util/include/util.hpp"
 
 bool trubin_a_algorithm_dijkstra_omp::TestTaskOpenMP::PreProcessingImpl() {
@@ -19,20 +16,26 @@ bool trubin_a_algorithm_dijkstra_omp::TestTaskOpenMP::PreProcessingImpl() {
     return false;
   }
 
-  unsigned int input_size = task_data->inputs_count[0];
-  auto* in_ptr = reinterpret_cast<int*>(task_data->inputs[0]);
-  std::vector<int> graph_data(in_ptr, in_ptr + input_size);
+  const std::span<const int> graph_data(reinterpret_cast<int*>(task_data->inputs[0]), task_data->inputs_count[0]);
+  batch_ = ppc::core::graph::GetBatchedQuery(*task_data);
+  if (batch_) {
+    // the run writes row k of the K x V output for source k
+    num_vertices_ = batch_->num_vertices;
+    return ppc::core::graph::BuildFromAdjacencyStream(graph_data, num_vertices_, ppc::core::graph::StreamCheck::kStrict,
+                                                      graph_, ppc::util::GetPPCNumChunks(), ppc::util::OmpFor{});
+  }
 
   num_vertices_ = task_data->outputs_count[0];
 
-  if (num_vertices_ == 0 || input_size == 0) {
+  if (num_vertices_ == 0 || graph_data.empty()) {
     return true;
   }
 
-  adjacency_list_.assign(num_vertices_, {});
   distances_.assign(num_vertices_, std::numeric_limits<int>::max());
 
-  if (!BuildAdjacencyList(graph_data)) {
+  // the graph is parsed once here, so the run only computes distances
+  if (!ppc::core::graph::BuildFromAdjacencyStream(graph_data, num_vertices_, ppc::core::graph::StreamCheck::kStrict,
+                                                  graph_, ppc::util::GetPPCNumChunks(), ppc::util::OmpFor{})) {
     return false;
   }
 
@@ -73,45 +76,30 @@ bool trubin_a_algorithm_dijkstra_omp::TestTaskOpenMP::ValidationImpl() {
 }
 
 bool trubin_a_algorithm_dijkstra_omp::TestTaskOpenMP::RunImpl() {
-  if (num_vertices_ == 0) {
+  if (batch_) {
+    ppc::core::graph::MultiSourceShortestPaths(graph_, batch_->sources, batch_->distances, ppc::util::OmpFor{});
     return true;
   }
 
+  if (num_vertices_ == 0) {
+    return true;
+  }
   if (start_vertex_ >= num_vertices_) {
     return false;
   }
 
-  const int delta = 5;
-
-  std::vector<std::atomic<int>> distances_atomic(num_vertices_);
-  for (size_t i = 0; i < num_vertices_; ++i) {
-    distances_atomic[i].store(std::numeric_limits<int>::max(), std::memory_order_relaxed);
-  }
-  distances_atomic[start_vertex_].store(0, std::memory_order_relaxed);
-
-  std::vector<std::vector<int>> buckets(1);
-  buckets[0].push_back(static_cast<int>(start_vertex_));
-
-  while (true) {
-    auto it = std::ranges::find_if(buckets, [](const auto& bucket) { return !bucket.empty(); });
-    if (it == buckets.end()) {
-      break;
-    }
-
-    std::vector<int> current;
-    std::swap(current, *it);
-
-    ProcessCurrentBucket(current, buckets, delta, distances_atomic);
-  }
-
-  for (size_t i = 0; i < num_vertices_; ++i) {
-    distances_[i] = distances_atomic[i].load(std::memory_order_relaxed);
-  }
-
+  // delta-stepping: every round relaxes the edges of a whole bucket of vertices in one parallel loop
+  ppc::core::graph::DeltaStepping(graph_, start_vertex_, ppc::core::graph::ChooseDelta(graph_), distances_,
+                                  ppc::util::GetPPCNumChunks(), ppc::util::OmpFor{});
   return true;
 }
 
 bool trubin_a_algorithm_dijkstra_omp::TestTaskOpenMP::PostProcessingImpl() {
+  if (batch_) {
+    std::ranges::replace(batch_->distances, ppc::core::graph::kInfiniteDistance, -1);
+    return true;
+  }
+
   if (num_vertices_ == 0) {
     return true;
   }
@@ -127,98 +115,3 @@ bool trubin_a_algorithm_dijkstra_omp::TestTaskOpenMP::PostProcessingImpl() {
 
   return true;
 }
-
-bool trubin_a_algorithm_dijkstra_omp::TestTaskOpenMP::BuildAdjacencyList(const std::vector<int>& graph_data) {
-  size_t current_vertex = 0;
-  size_t i = 0;
-
-  while (i < graph_data.size()) {
-    if (graph_data[i] == kEndOfVertexList) {
-      if (current_vertex >= num_vertices_) {
-        return false;
-      }
-      current_vertex++;
-      i++;
-      continue;
-    }
-
-    if (i + 1 >= graph_data.size()) {
-      return false;
-    }
-
-    auto to = static_cast<size_t>(graph_data[i]);
-    int weight = graph_data[i + 1];
-
-    if (to >= num_vertices_ || weight < 0) {
-      return false;
-    }
-
-    adjacency_list_[current_vertex].emplace_back(to, weight);
-    i += 2;
-  }
-
-  return true;
-}
-void trubin_a_algorithm_dijkstra_omp::TestTaskOpenMP::ProcessCurrentBucket(
-    std::vector<int>& current, std::vector<std::vector<int>>& buckets, const int delta,
-    std::vector<std::atomic<int>>& distances_atomic) {
-  auto num_threads = static_cast<size_t>(ppc::util::GetPPCNumThreads());
-  std::vector<std::vector<int>> local_next(num_threads);
-  std::vector<std::unordered_map<size_t, std::vector<int>>> local_heavy(num_threads);
-
-  while (!current.empty()) {
-#pragma omp parallel
-    {
-      int tid = omp_get_thread_num();
-      auto& next_bucket = local_next[tid];
-      auto& heavy_buckets = local_heavy[tid];
-
-#pragma omp for schedule(dynamic)
-      for (int i = 0; i < static_cast<int>(current.size()); ++i) {
-        ProcessSingleVertex(current[i], delta, next_bucket, heavy_buckets, distances_atomic);
-      }
-    }
-
-    current.clear();
-    for (auto& next : local_next) {
-      current.insert(current.end(), std::make_move_iterator(next.begin()), std::make_move_iterator(next.end()));
-      next.clear();
-    }
-
-    for (auto& heavy_map : local_heavy) {
-      for (auto& [bucket_idx, verts] : heavy_map) {
-        if (bucket_idx >= buckets.size()) {
-          buckets.resize(bucket_idx + 1);
-        }
-        buckets[bucket_idx].insert(buckets[bucket_idx].end(), std::make_move_iterator(verts.begin()),
-                                   std::make_move_iterator(verts.end()));
-        verts.clear();
-      }
-    }
-  }
-}
-
-void trubin_a_algorithm_dijkstra_omp::TestTaskOpenMP::ProcessSingleVertex(
-    int u, int delta, std::vector<int>& next_bucket, std::unordered_map<size_t, std::vector<int>>& heavy_buckets,
-    std::vector<std::atomic<int>>& distances_atomic) {
-  int dist_u = distances_atomic[u].load(std::memory_order_relaxed);
-
-  for (const auto& edge : adjacency_list_[u]) {
-    int v = static_cast<int>(edge.to);
-    int weight = edge.weight;
-    int new_dist = dist_u + weight;
-
-    int old_dist = distances_atomic[v].load(std::memory_order_relaxed);
-    while (new_dist < old_dist) {
-      if (distances_atomic[v].compare_exchange_weak(old_dist, new_dist, std::memory_order_relaxed)) {
-        if (weight <= delta) {
-          next_bucket.push_back(v);
-        } else {
-          size_t bucket_idx = new_dist / delta;
-          heavy_buckets[bucket_idx].push_back(v);
-        }
-        break;
-      }
-    }
-  }
-}
@@ -2,8 +2,11 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstddef>
 #include <vector>
 
+#include "core/gemm/include/gemm.hpp"
+
 bool vavilov_v_cannon_omp::CannonOMP::PreProcessingImpl() {
   N_ = static_cast<int>(std::sqrt(task_data->inputs_count[0]));
   num_blocks_ = static_cast<int>(task_data->inputs_count[2]);
@@ -50,22 +53,13 @@ void vavilov_v_cannon_omp::CannonOMP::InitialShift() {
   }
 }
 void vavilov_v_cannon_omp::CannonOMP::BlockMultiply() {
+  // after the shifts block (bi, bj) of C accumulates the product of blocks (bi, bj) of A and B
 #pragma omp parallel for
   for (int bi = 0; bi < num_blocks_; ++bi) {
     for (int bj = 0; bj < num_blocks_; ++bj) {
-      for (int i = 0; i < block_size_; ++i) {
-        for (int j = 0; j < block_size_; ++j) {
-          double temp = 0.0;
-          for (int k = 0; k < block_size_; ++k) {
-            int row = (bi * block_size_) + i;
-            int col = (bj * block_size_) + j;
-            int k_idx = (bj * block_size_) + k;
-            int k_row = (bi * block_size_) + k;
-            temp += A_[(row * N_) + k_idx] * B_[(k_row * N_) + col];
-          }
-          C_[(((bi * block_size_) + i) * N_) + ((bj * block_size_) + j)] += temp;
-        }
-      }
+      const size_t offset = (static_cast<size_t>(bi * block_size_) * N_) + (bj * block_size_);
+      ppc::core::gemm::Gemm(block_size_, block_size_, block_size_, A_.data() + offset, N_, B_.data() + offset, N_,
+                            C_.data() + offset, N_);
     }
   }
 }
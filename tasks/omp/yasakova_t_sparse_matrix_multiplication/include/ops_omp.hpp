@@ -120,7 +120,7 @@ class SparseMatrixMultiplier : public ppc::core::Task {
 
  private:
   SparseMatrixFormat left_matrix_;
-  SparseMatrixFormat transposed_right_matrix_;
+  SparseMatrixFormat right_matrix_;
   SparseMatrixFormat result_matrix_;
 };
 
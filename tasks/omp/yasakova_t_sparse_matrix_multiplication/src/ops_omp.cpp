@@ -1,40 +1,13 @@
 #include "omp/yasakova_t_sparse_matrix_multiplication/include/ops_omp.hpp"
 
-#include <cmath>
 #include <complex>
+#include <cstddef>
 #include <cstdint>
-#include <cstdio>
-#include <tuple>
-#include <vector>
+#include <utility>
 
-namespace {
-SparseMatrixFormat TransposeMatrixCRS(const SparseMatrixFormat &input_matrix) {
-  const auto new_cols = input_matrix.RowCount();
-
-  SparseMatrixFormat transposed_matrix;
-  transposed_matrix.columns = new_cols;
-  transposed_matrix.row_pointers.resize(input_matrix.ColumnCount() + 2);
-  transposed_matrix.column_indices.resize(input_matrix.column_indices.size(), 0);
-  transposed_matrix.task_data.resize(input_matrix.task_data.size(), 0);
-
-  for (uint32_t i = 0; i < input_matrix.task_data.size(); ++i) {
-    ++transposed_matrix.row_pointers[input_matrix.column_indices[i] + 2];
-  }
-  for (uint32_t i = 2; i < transposed_matrix.row_pointers.size(); ++i) {
-    transposed_matrix.row_pointers[i] += transposed_matrix.row_pointers[i - 1];
-  }
-  for (uint32_t i = 0; i < new_cols; ++i) {
-    for (uint32_t j = input_matrix.row_pointers[i]; j < input_matrix.row_pointers[i + 1]; ++j) {
-      const auto new_index = transposed_matrix.row_pointers[input_matrix.column_indices[j] + 1]++;
-      transposed_matrix.task_data[new_index] = input_matrix.task_data[j];
-      transposed_matrix.column_indices[new_index] = i;
-    }
-  }
-  transposed_matrix.row_pointers.pop_back();
-
-  return transposed_matrix;
-}
-}  // namespace
+#include "core/sparse/include/spgemm.hpp"
+#include "core/util/include/omp_for.hpp"
+#include "core/util/include/util.hpp"
 
 bool yasakova_t_sparse_matrix_multiplication_omp::SparseMatrixMultiplier::ValidationImpl() {
   const bool left_cols_equal_right_rows = task_data->inputs_count[1] == task_data->inputs_count[2];
@@ -45,53 +18,26 @@ bool yasakova_t_sparse_matrix_multiplication_omp::SparseMatrixMultiplier::Valida
 
 bool yasakova_t_sparse_matrix_multiplication_omp::SparseMatrixMultiplier::PreProcessingImpl() {
   left_matrix_ = *reinterpret_cast<SparseMatrixFormat *>(task_data->inputs[0]);
-  transposed_right_matrix_ = TransposeMatrixCRS(*reinterpret_cast<SparseMatrixFormat *>(task_data->inputs[1]));
+  right_matrix_ = *reinterpret_cast<SparseMatrixFormat *>(task_data->inputs[1]);
   result_matrix_ = {};
   result_matrix_.row_pointers.resize(left_matrix_.RowCount() + 1);
-  result_matrix_.columns = transposed_right_matrix_.RowCount();
+  result_matrix_.columns = right_matrix_.ColumnCount();
   return true;
 }
 
 bool yasakova_t_sparse_matrix_multiplication_omp::SparseMatrixMultiplier::RunImpl() {
-  const auto num_rows = left_matrix_.RowCount();
-  const auto num_cols = transposed_right_matrix_.RowCount();
-
-  std::vector<std::vector<std::tuple<std::complex<double>, uint32_t>>> non_zero_elements(num_rows);
-
-#pragma omp parallel for
-  for (int i = 0; i < static_cast<int>(num_rows); ++i) {
-    for (uint32_t j = 0; j < num_cols; ++j) {
-      auto left_element_ptr = left_matrix_.row_pointers[i];
-      auto right_element_ptr = transposed_right_matrix_.row_pointers[j];
-      std::complex<double> product_sum = 0.0;
-      while (left_element_ptr < left_matrix_.row_pointers[i + 1] &&
-             right_element_ptr < transposed_right_matrix_.row_pointers[j + 1]) {
-        if (left_matrix_.column_indices[left_element_ptr] <
-            transposed_right_matrix_.column_indices[right_element_ptr]) {
-          ++left_element_ptr;
-        } else if (left_matrix_.column_indices[left_element_ptr] >
-                   transposed_right_matrix_.column_indices[right_element_ptr]) {
-          ++right_element_ptr;
-        } else {
-          product_sum +=
-              left_matrix_.task_data[left_element_ptr++] * transposed_right_matrix_.task_data[right_element_ptr++];
-        }
-      }
-      if (product_sum != 0.0) {
-        non_zero_elements[i].emplace_back(product_sum, j);
-      }
-    }
-  }
-
-  for (uint32_t i = 0; i < num_rows; i++) {
-    result_matrix_.row_pointers[i + 1] = result_matrix_.row_pointers[i];
-    for (const auto &[product_sum, j] : non_zero_elements[i]) {
-      result_matrix_.task_data.push_back(product_sum);
-      result_matrix_.column_indices.push_back(j);
-      ++result_matrix_.row_pointers[i + 1];
-    }
-  }
-
+  // Gustavson product by rows: only products of matching entries are computed, rows are split by their work
+  const ppc::core::sparse::CsrView<uint32_t, std::complex<double>> left{
+      left_matrix_.row_pointers, left_matrix_.column_indices, left_matrix_.task_data, left_matrix_.ColumnCount()};
+  const ppc::core::sparse::CsrView<uint32_t, std::complex<double>> right{
+      right_matrix_.row_pointers, right_matrix_.column_indices, right_matrix_.task_data, right_matrix_.ColumnCount()};
+  ppc::core::sparse::CsrArrays<uint32_t, std::complex<double>> product;
+  ppc::core::sparse::Multiply(left, right, product, ppc::core::sparse::KeepNonZero{}, ppc::util::GetPPCNumChunks(),
+                              ppc::util::OmpFor{});
+
+  result_matrix_.row_pointers = std::move(product.offsets);
+  result_matrix_.column_indices = std::move(product.indices);
+  result_matrix_.task_data = std::move(product.values);
   return true;
 }
 
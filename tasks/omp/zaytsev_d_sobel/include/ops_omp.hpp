@@ -1,5 +1,6 @@
 #pragma once
 
+#include <span>
 #include <utility>
 #include <vector>
 
@@ -16,7 +17,9 @@ class TestTaskOpenMP : public ppc::core::Task {
   bool PostProcessingImpl() override;
 
  private:
-  std::vector<int> input_, output_, size_;
+  std::span<const int> input_;
+  std::span<int> output_;
+  std::vector<int> size_;
   int width_, height_;
 };
 
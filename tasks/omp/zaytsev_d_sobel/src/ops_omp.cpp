@@ -2,18 +2,18 @@
 
 #include <algorithm>
 #include <cmath>
-#include <vector>
 
 bool zaytsev_d_sobel_omp::TestTaskOpenMP::PreProcessingImpl() {
-  auto *in_ptr = reinterpret_cast<int *>(task_data->inputs[0]);
-  input_ = std::vector<int>(in_ptr, in_ptr + task_data->inputs_count[0]);
+  input_ = task_data->GetInput<const int>(0);
 
   auto *size_ptr = reinterpret_cast<int *>(task_data->inputs[1]);
   size_ = {size_ptr[0], size_ptr[1]};
   width_ = size_[0];
   height_ = size_[1];
 
-  output_ = std::vector<int>(task_data->outputs_count[0], 0);
+  // the border is not computed, so the output is cleared once instead of copying a private result
+  output_ = task_data->GetOutput<int>(0);
+  std::ranges::fill(output_, 0);
   return true;
 }
 
@@ -58,7 +58,4 @@ bool zaytsev_d_sobel_omp::TestTaskOpenMP::RunImpl() {
   return true;
 }
 
-bool zaytsev_d_sobel_omp::TestTaskOpenMP::PostProcessingImpl() {
-  std::ranges::copy(output_, reinterpret_cast<int *>(task_data->outputs[0]));
-  return true;
-}
+bool zaytsev_d_sobel_omp::TestTaskOpenMP::PostProcessingImpl() { return true; }
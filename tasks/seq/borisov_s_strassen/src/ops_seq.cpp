@@ -4,21 +4,15 @@
 #include <cstddef>
 #include <vector>
 
+#include "core/gemm/include/gemm.hpp"
+
 namespace borisov_s_strassen_seq {
 
 namespace {
 
-std::vector<double> MultiplyNaive(const std::vector<double> &a, const std::vector<double> &b, int n) {
-  std::vector<double> c(n * n, 0.0);
-  for (int i = 0; i < n; ++i) {
-    for (int j = 0; j < n; ++j) {
-      double sum = 0.0;
-      for (int k = 0; k < n; ++k) {
-        sum += a[(i * n) + k] * b[(k * n) + j];
-      }
-      c[(i * n) + j] = sum;
-    }
-  }
+std::vector<double> MultiplyBase(const std::vector<double> &a, const std::vector<double> &b, int n) {
+  std::vector<double> c(n * n);
+  ppc::core::gemm::Multiply(a, b, c, n, n, n);
   return c;
 }
 
@@ -57,8 +51,8 @@ void SetSubMatrix(std::vector<double> &m, const std::vector<double> &sub, int n,
 }
 
 std::vector<double> StrassenRecursive(const std::vector<double> &a, const std::vector<double> &b, int n) {
-  if (n <= 16) {
-    return MultiplyNaive(a, b, n);
+  if (n <= 64) {
+    return MultiplyBase(a, b, n);
   }
   int k = n / 2;
   auto a11 = SubMatrix(a, n, 0, 0, k);
@@ -128,3 +128,33 @@ TEST(burykin_m_radix_seq, EmptyVector) {
 
   EXPECT_EQ(output, expected);
 }
+
+TEST(burykin_m_radix_seq, Batch) {
+  constexpr size_t kSize = 1000;
+  constexpr size_t kItems = 5;
+  std::vector<std::vector<int>> input(kItems);
+  std::vector<std::vector<int>> output(kItems, std::vector<int>(kSize, 0));
+  std::vector<ppc::core::BatchItem> items(kItems);
+  for (size_t i = 0; i < kItems; i++) {
+    input[i] = GenerateRandomVector(kSize);
+    items[i].inputs = {reinterpret_cast<uint8_t*>(input[i].data())};
+    items[i].outputs = {reinterpret_cast<uint8_t*>(output[i].data())};
+  }
+
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.push_back(reinterpret_cast<uint8_t*>(input[0].data()));
+  task_data->inputs_count.push_back(static_cast<std::uint32_t>(kSize));
+  task_data->outputs.push_back(reinterpret_cast<uint8_t*>(output[0].data()));
+  task_data->outputs_count.push_back(static_cast<std::uint32_t>(kSize));
+
+  burykin_m_radix_seq::RadixSequential task(task_data);
+  for (bool overlap_copy_in : {false, true}) {
+    ASSERT_TRUE(task.RunBatch(items, overlap_copy_in));
+    for (size_t i = 0; i < kItems; i++) {
+      std::vector<int> expected = input[i];
+      std::ranges::sort(expected);
+      EXPECT_EQ(output[i], expected);
+      std::ranges::fill(output[i], 0);
+    }
+  }
+}
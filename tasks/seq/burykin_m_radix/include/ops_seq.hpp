@@ -1,6 +1,8 @@
 #pragma once
 
 #include <array>
+#include <cstddef>
+#include <cstdint>
 #include <utility>
 #include <vector>
 
@@ -16,12 +18,18 @@ class RadixSequential : public ppc::core::Task {
   bool RunImpl() override;
   bool PostProcessingImpl() override;
 
-  static std::array<int, 256> ComputeFrequency(const std::vector<int>& a, int shift);
-  static std::array<int, 256> ComputeIndices(const std::array<int, 256>& count);
-  static void DistributeElements(const std::vector<int>& a, std::vector<int>& b, std::array<int, 256> index, int shift);
+ protected:
+  // items of a batch reuse the keys and the radix buffer of the slot
+  bool LoadBatchItemImpl(const ppc::core::BatchItem& item, size_t slot) override;
+  bool StoreBatchItemImpl(const ppc::core::BatchItem& item, size_t slot) override;
+  [[nodiscard]] size_t BatchSlotsCount() const override { return slots_.size(); }
 
  private:
-  std::vector<int> input_, output_;
+  struct Slot {
+    std::vector<int> keys, buffer;
+  };
+  void LoadKeys(const uint8_t* input, Slot& slot) const;
+  std::array<Slot, 2> slots_;
 };
 
-}  // namespace burykin_m_radix_seq
\ No newline at end of file
+}  // namespace burykin_m_radix_seq
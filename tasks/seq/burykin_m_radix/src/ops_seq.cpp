@@ -1,48 +1,21 @@
 #include "seq/burykin_m_radix/include/ops_seq.hpp"
 
-#include <array>
+#include <algorithm>
 #include <cstddef>
-#include <utility>
-#include <vector>
+#include <cstdint>
+#include <span>
 
-std::array<int, 256> burykin_m_radix_seq::RadixSequential::ComputeFrequency(const std::vector<int>& a,
-                                                                            const int shift) {
-  std::array<int, 256> count = {};
-  for (const int v : a) {
-    unsigned int key = ((static_cast<unsigned int>(v) >> shift) & 0xFFU);
-    if (shift == 24) {
-      key ^= 0x80;
-    }
-    ++count[key];
-  }
-  return count;
-}
-
-std::array<int, 256> burykin_m_radix_seq::RadixSequential::ComputeIndices(const std::array<int, 256>& count) {
-  std::array<int, 256> index = {0};
-  for (int i = 1; i < 256; ++i) {
-    index[i] = index[i - 1] + count[i - 1];
-  }
-  return index;
-}
+#include "core/sort/include/radix_sort.hpp"
 
-void burykin_m_radix_seq::RadixSequential::DistributeElements(const std::vector<int>& a, std::vector<int>& b,
-                                                              std::array<int, 256> index, const int shift) {
-  for (const int v : a) {
-    unsigned int key = ((static_cast<unsigned int>(v) >> shift) & 0xFFU);
-    if (shift == 24) {
-      key ^= 0x80;
-    }
-    b[index[key]++] = v;
-  }
+void burykin_m_radix_seq::RadixSequential::LoadKeys(const uint8_t* input, Slot& slot) const {
+  const unsigned int input_size = task_data->inputs_count[0];
+  const auto* in_ptr = reinterpret_cast<const int*>(input);
+  slot.keys.assign(in_ptr, in_ptr + input_size);
+  slot.buffer.resize(input_size);
 }
 
 bool burykin_m_radix_seq::RadixSequential::PreProcessingImpl() {
-  const unsigned int input_size = task_data->inputs_count[0];
-  auto* in_ptr = reinterpret_cast<int*>(task_data->inputs[0]);
-  input_ = std::vector<int>(in_ptr, in_ptr + input_size);
-
-  output_.resize(input_size);
+  LoadKeys(task_data->inputs[0], slots_[CurrentBatchSlot()]);
   return true;
 }
 
@@ -51,27 +24,23 @@ bool burykin_m_radix_seq::RadixSequential::ValidationImpl() {
 }
 
 bool burykin_m_radix_seq::RadixSequential::RunImpl() {
-  if (input_.empty()) {
-    return true;
-  }
-
-  std::vector<int> a = input_;
-  std::vector<int> b(a.size());
+  auto& slot = slots_[CurrentBatchSlot()];
+  ppc::core::sort::RadixSort(std::span<int>(slot.keys), std::span<int>(slot.buffer), 1,
+                             [](size_t begin, size_t end, const auto& body) { body(begin, end); });
+  return true;
+}
 
-  for (int shift = 0; shift < 32; shift += 8) {
-    auto count = ComputeFrequency(a, shift);
-    const auto index = ComputeIndices(count);
-    DistributeElements(a, b, index, shift);
-    a.swap(b);
-  }
+bool burykin_m_radix_seq::RadixSequential::PostProcessingImpl() {
+  std::ranges::copy(slots_[CurrentBatchSlot()].keys, reinterpret_cast<int*>(task_data->outputs[0]));
+  return true;
+}
 
-  output_ = std::move(a);
+bool burykin_m_radix_seq::RadixSequential::LoadBatchItemImpl(const ppc::core::BatchItem& item, size_t slot) {
+  LoadKeys(item.inputs[0], slots_[slot]);
   return true;
 }
 
-bool burykin_m_radix_seq::RadixSequential::PostProcessingImpl() {
-  for (size_t i = 0; i < output_.size(); ++i) {
-    reinterpret_cast<int*>(task_data->outputs[0])[i] = output_[i];
-  }
+bool burykin_m_radix_seq::RadixSequential::StoreBatchItemImpl(const ppc::core::BatchItem& item, size_t slot) {
+  std::ranges::copy(slots_[slot].keys, reinterpret_cast<int*>(item.outputs[0]));
   return true;
 }
@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 
+#include <array>
 #include <cstddef>
 #include <cstdint>
 #include <fstream>
@@ -71,3 +72,76 @@ TEST(nesterov_a_test_task_seq, test_matmul_100_from_file) {
   test_task_sequential.PostProcessing();
   EXPECT_EQ(in, out);
 }
+
+TEST(nesterov_a_test_task_seq, test_matmul_50_with_shape) {
+  constexpr size_t kCount = 50;
+
+  // Create data
+  std::vector<int> in(kCount * kCount, 0);
+  std::vector<int> out(kCount * kCount, 0);
+
+  for (size_t i = 0; i < kCount; i++) {
+    in[(i * kCount) + i] = 1;
+  }
+
+  // Create task_data with shapes of the matrices
+  auto task_data_seq = std::make_shared<ppc::core::TaskData>();
+  task_data_seq->AddInput(in.data(), std::array<uint64_t, 2>{kCount, kCount});
+  task_data_seq->AddOutput(out.data(), std::array<uint64_t, 2>{kCount, kCount});
+
+  // Create Task
+  nesterov_a_test_task_seq::TestTaskSequential test_task_sequential(task_data_seq);
+  ASSERT_EQ(test_task_sequential.Validation(), true);
+  test_task_sequential.PreProcessing();
+  test_task_sequential.Run();
+  test_task_sequential.PostProcessing();
+  EXPECT_EQ(in, out);
+}
+
+TEST(nesterov_a_test_task_seq, test_non_square_shape) {
+  // Create data
+  std::vector<int> in(50 * 20, 0);
+  std::vector<int> out(50 * 20, 0);
+
+  // Create task_data with shapes of the matrices
+  auto task_data_seq = std::make_shared<ppc::core::TaskData>();
+  task_data_seq->AddInput(in.data(), std::array<uint64_t, 2>{50, 20});
+  task_data_seq->AddOutput(out.data(), std::array<uint64_t, 2>{50, 20});
+
+  // Create Task
+  nesterov_a_test_task_seq::TestTaskSequential test_task_sequential(task_data_seq);
+  ASSERT_EQ(test_task_sequential.Validation(), false);
+}
+
+TEST(nesterov_a_test_task_seq, test_matmul_batch) {
+  constexpr size_t kCount = 10;
+  constexpr size_t kItems = 5;
+
+  // Create data: diagonal matrices with different values
+  std::vector<std::vector<int>> in(kItems, std::vector<int>(kCount * kCount, 0));
+  std::vector<std::vector<int>> out(kItems, std::vector<int>(kCount * kCount, 0));
+  std::vector<ppc::core::BatchItem> items(kItems);
+  for (size_t b = 0; b < kItems; b++) {
+    for (size_t i = 0; i < kCount; i++) {
+      in[b][(i * kCount) + i] = static_cast<int>(b);
+    }
+    items[b].inputs = {reinterpret_cast<uint8_t *>(in[b].data())};
+    items[b].outputs = {reinterpret_cast<uint8_t *>(out[b].data())};
+  }
+
+  // Create task_data for the first item
+  auto task_data_seq = std::make_shared<ppc::core::TaskData>();
+  task_data_seq->inputs.emplace_back(reinterpret_cast<uint8_t *>(in[0].data()));
+  task_data_seq->inputs_count.emplace_back(in[0].size());
+  task_data_seq->outputs.emplace_back(reinterpret_cast<uint8_t *>(out[0].data()));
+  task_data_seq->outputs_count.emplace_back(out[0].size());
+
+  // Create Task
+  nesterov_a_test_task_seq::TestTaskSequential test_task_sequential(task_data_seq);
+  ASSERT_TRUE(test_task_sequential.RunBatch(items));
+  for (size_t b = 0; b < kItems; b++) {
+    for (size_t i = 0; i < kCount; i++) {
+      EXPECT_EQ(out[b][(i * kCount) + i], static_cast<int>(b * b));
+    }
+  }
+}
@@ -2,22 +2,32 @@
 
 #include <cmath>
 #include <cstddef>
-#include <vector>
 
 bool nesterov_a_test_task_seq::TestTaskSequential::PreProcessingImpl() {
-  // Init value for input and output
+  // Init value for input and output (memory of previous runs is reused in batch mode)
   unsigned int input_size = task_data->inputs_count[0];
   auto *in_ptr = reinterpret_cast<int *>(task_data->inputs[0]);
-  input_ = std::vector<int>(in_ptr, in_ptr + input_size);
+  input_.assign(in_ptr, in_ptr + input_size);
 
   unsigned int output_size = task_data->outputs_count[0];
-  output_ = std::vector<int>(output_size, 0);
+  output_.assign(output_size, 0);
 
-  rc_size_ = static_cast<int>(std::sqrt(input_size));
+  // The matrix size is taken from the shape of the input if it is described
+  if (task_data->HasInputInfo(0)) {
+    rc_size_ = static_cast<int>(task_data->GetInputView<const int, 2>(0).Extent(0));
+  } else {
+    rc_size_ = static_cast<int>(std::sqrt(input_size));
+  }
   return true;
 }
 
 bool nesterov_a_test_task_seq::TestTaskSequential::ValidationImpl() {
+  if (task_data->HasInputInfo(0)) {
+    const auto &extents = task_data->inputs_info[0].extents;
+    if (extents.size() != 2 || extents[0] != extents[1]) {
+      return false;
+    }
+  }
   // Check equality of counts elements
   return task_data->inputs_count[0] == task_data->outputs_count[0];
 }
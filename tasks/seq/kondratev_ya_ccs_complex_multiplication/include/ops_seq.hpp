@@ -4,6 +4,7 @@
 #include <utility>
 #include <vector>
 
+#include "core/sparse/include/matrix.hpp"
 #include "core/task/include/task.hpp"
 
 namespace kondratev_ya_ccs_complex_multiplication_seq {
@@ -14,6 +15,7 @@ constexpr double kEpsilonForZero = kEpsilon * kEpsilon;
 bool IsZero(const std::complex<double>& value);
 bool IsEqual(const std::complex<double>& a, const std::complex<double>& b);
 
+// layout of the matrices in task data, the task converts them to the CCS matrices of core sparse
 struct CCSMatrix {
   std::vector<std::complex<double>> values;
   std::vector<int> row_index;
@@ -22,9 +24,10 @@ struct CCSMatrix {
 
   CCSMatrix() : rows(0), cols(0) {}
   CCSMatrix(std::pair<int, int> sizes) : rows(sizes.first), cols(sizes.second) { col_ptrs.resize(cols + 1, 0); }
-  CCSMatrix operator*(const CCSMatrix& other) const;
 };
 
+using Matrix = ppc::core::sparse::CcsMatrix<int, std::complex<double>>;
+
 class TestTaskSequential : public ppc::core::Task {
  public:
   explicit TestTaskSequential(ppc::core::TaskDataPtr task_data) : Task(std::move(task_data)) {}
@@ -34,7 +37,9 @@ class TestTaskSequential : public ppc::core::Task {
   bool PostProcessingImpl() override;
 
  private:
-  CCSMatrix a_, b_, c_;
+  static Matrix Multiply(const Matrix& a, const Matrix& b);
+
+  Matrix a_, b_, c_;
 };
 
 }  // namespace kondratev_ya_ccs_complex_multiplication_seq
\ No newline at end of file
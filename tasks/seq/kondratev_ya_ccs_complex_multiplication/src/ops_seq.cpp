@@ -1,9 +1,10 @@
 #include "seq/kondratev_ya_ccs_complex_multiplication/include/ops_seq.hpp"
 
-#include <algorithm>
 #include <cmath>
 #include <complex>
-#include <vector>
+#include <cstddef>
+
+#include "core/sparse/include/spgemm.hpp"
 
 bool kondratev_ya_ccs_complex_multiplication_seq::IsZero(const std::complex<double> &value) {
   return std::norm(value) < kEpsilonForZero;
@@ -14,18 +15,44 @@ bool kondratev_ya_ccs_complex_multiplication_seq::IsEqual(const std::complex<dou
   return std::norm(a - b) <= kEpsilonForZero;
 }
 
+namespace kondratev_ya_ccs_complex_multiplication_seq {
+namespace {
+
+Matrix ToMatrix(const CCSMatrix &m) {
+  Matrix res;
+  res.num_rows = static_cast<size_t>(m.rows);
+  res.num_cols = static_cast<size_t>(m.cols);
+  res.offsets.assign(m.col_ptrs.begin(), m.col_ptrs.end());
+  res.indices.assign(m.row_index.begin(), m.row_index.end());
+  res.values.assign(m.values.begin(), m.values.end());
+  return res;
+}
+
+CCSMatrix ToCCSMatrix(const Matrix &m) {
+  CCSMatrix res({static_cast<int>(m.num_rows), static_cast<int>(m.num_cols)});
+  res.col_ptrs.assign(m.offsets.begin(), m.offsets.end());
+  res.row_index.assign(m.indices.begin(), m.indices.end());
+  res.values.assign(m.values.begin(), m.values.end());
+  return res;
+}
+
+}  // namespace
+}  // namespace kondratev_ya_ccs_complex_multiplication_seq
+
 bool kondratev_ya_ccs_complex_multiplication_seq::TestTaskSequential::PreProcessingImpl() {
-  a_ = *reinterpret_cast<CCSMatrix *>(task_data->inputs[0]);
-  b_ = *reinterpret_cast<CCSMatrix *>(task_data->inputs[1]);
+  const auto &a = *reinterpret_cast<CCSMatrix *>(task_data->inputs[0]);
+  const auto &b = *reinterpret_cast<CCSMatrix *>(task_data->inputs[1]);
 
-  if (a_.rows == 0 || a_.cols == 0 || b_.rows == 0 || b_.cols == 0) {
+  if (a.rows == 0 || a.cols == 0 || b.rows == 0 || b.cols == 0) {
     return false;
   }
 
-  if (a_.cols != b_.rows) {
+  if (a.cols != b.rows) {
     return false;
   }
 
+  a_ = ToMatrix(a);
+  b_ = ToMatrix(b);
   return true;
 }
 
@@ -35,46 +62,23 @@ bool kondratev_ya_ccs_complex_multiplication_seq::TestTaskSequential::Validation
 }
 
 bool kondratev_ya_ccs_complex_multiplication_seq::TestTaskSequential::RunImpl() {
-  c_ = a_ * b_;
+  c_ = Multiply(a_, b_);
   return true;
 }
 
 bool kondratev_ya_ccs_complex_multiplication_seq::TestTaskSequential::PostProcessingImpl() {
-  *reinterpret_cast<CCSMatrix *>(task_data->outputs[0]) = c_;
+  *reinterpret_cast<CCSMatrix *>(task_data->outputs[0]) = ToCCSMatrix(c_);
   return true;
 }
 
-kondratev_ya_ccs_complex_multiplication_seq::CCSMatrix
-kondratev_ya_ccs_complex_multiplication_seq::CCSMatrix::operator*(const CCSMatrix &other) const {
-  CCSMatrix result({rows, other.cols});
-  result.values.reserve(std::min(rows * other.cols, static_cast<int>(values.size() * other.values.size())));
-  result.row_index.reserve(result.values.capacity());
-
-  std::vector<std::complex<double>> temp_col(rows, std::complex<double>(0.0, 0.0));
-
-  for (int result_col = 0; result_col < other.cols; result_col++) {
-    for (int k = other.col_ptrs[result_col]; k < other.col_ptrs[result_col + 1]; k++) {
-      int row_other = other.row_index[k];
-      std::complex<double> val_other = other.values[k];
-
-      for (int i = col_ptrs[row_other]; i < col_ptrs[row_other + 1]; i++) {
-        int row_this = row_index[i];
-        temp_col[row_this] += values[i] * val_other;
-      }
-    }
-
-    result.col_ptrs[result_col] = static_cast<int>(result.values.size());
-    for (int i = 0; i < rows; i++) {
-      if (!IsZero(temp_col[i])) {
-        result.values.emplace_back(temp_col[i]);
-        result.row_index.emplace_back(i);
-
-        temp_col[i] = std::complex<double>(0.0, 0.0);
-      }
-    }
-  }
-
-  result.col_ptrs[other.cols] = static_cast<int>(result.values.size());
-
-  return result;
-}
\ No newline at end of file
+kondratev_ya_ccs_complex_multiplication_seq::Matrix
+kondratev_ya_ccs_complex_multiplication_seq::TestTaskSequential::Multiply(const Matrix &a, const Matrix &b) {
+  Matrix c;
+  c.num_rows = a.num_rows;
+  c.num_cols = b.num_cols;
+  // the CCS arrays of a * b are the CSR arrays of the product of the transposes in the reverse order
+  ppc::core::sparse::Multiply(
+      b.TransposedView(), a.TransposedView(), c, [](const std::complex<double> &value) { return !IsZero(value); }, 1,
+      [](size_t begin, size_t end, const auto &body) { body(begin, end); });
+  return c;
+}
@@ -1,9 +1,11 @@
 #include "seq/kovalchuk_a_shell_sort/include/ops_seq.hpp"
 
 #include <algorithm>
+#include <span>
 #include <utility>
 #include <vector>
 
+#include "core/sort/include/shell_sort.hpp"
 #include "core/task/include/task.hpp"
 
 namespace kovalchuk_a_shell_sort {
@@ -22,28 +24,10 @@ bool ShellSortSequential::ValidationImpl() {
 }
 
 bool ShellSortSequential::RunImpl() {
-  ShellSort();
+  ppc::core::sort::ShellSort(std::span<int>(input_));
   return true;
 }
 
-void ShellSortSequential::ShellSort() {
-  if (input_.empty()) {
-    return;
-  }
-
-  int n = static_cast<int>(input_.size());
-  for (int gap = n / 2; gap > 0; gap /= 2) {
-    for (int i = gap; i < n; ++i) {
-      int temp = input_[i];
-      int j = i;
-      for (; j >= gap && input_[j - gap] > temp; j -= gap) {
-        input_[j] = input_[j - gap];
-      }
-      input_[j] = temp;
-    }
-  }
-}
-
 bool ShellSortSequential::PostProcessingImpl() {
   auto* output_ptr = reinterpret_cast<int*>(task_data->outputs[0]);
   std::ranges::copy(input_, output_ptr);
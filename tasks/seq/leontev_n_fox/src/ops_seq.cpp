@@ -4,6 +4,8 @@
 #include <cstddef>
 #include <vector>
 
+#include "core/gemm/include/gemm.hpp"
+
 namespace leontev_n_fox_seq {
 
 const int k_ = 4;
@@ -23,14 +25,8 @@ double FoxSeq::AtB(size_t i, size_t j) const {
 }
 
 std::vector<double> MatMul(std::vector<double>& a, std::vector<double>& b, size_t n) {
-  std::vector<double> res(n * n, 0.0);
-  for (size_t j = 0; j < n; j++) {
-    for (size_t i = 0; i < n; i++) {
-      for (size_t l = 0; l < n; l++) {
-        res[(i * n) + j] += a[(i * n) + l] * b[(l * n) + j];
-      }
-    }
-  }
+  std::vector<double> res(n * n);
+  ppc::core::gemm::Multiply(a, b, res, n, n, n);
   return res;
 }
 
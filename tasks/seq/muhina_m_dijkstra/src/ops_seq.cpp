@@ -2,17 +2,27 @@
 
 #include <climits>
 #include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <queue>
+#include <span>
 #include <utility>
 #include <vector>
 
-const int muhina_m_dijkstra_seq::TestTaskSequential::kEndOfVertexList = -1;
+#include "core/graph/include/adjacency_stream.hpp"
+#include "core/graph/include/multi_source.hpp"
 
 bool muhina_m_dijkstra_seq::TestTaskSequential::PreProcessingImpl() {
-  unsigned int input_size = task_data->inputs_count[0];
-  auto *in_ptr = reinterpret_cast<int *>(task_data->inputs[0]);
-  graph_data_.assign(in_ptr, in_ptr + input_size);
+  const std::span<const int> graph_data(reinterpret_cast<int *>(task_data->inputs[0]), task_data->inputs_count[0]);
+  batch_ = ppc::core::graph::GetBatchedQuery(*task_data);
+  if (batch_) {
+    // the run writes row k of the K x V output for source k
+    num_vertices_ = batch_->num_vertices;
+    graph_valid_ = ppc::core::graph::BuildFromAdjacencyStream(graph_data, num_vertices_,
+                                                              ppc::core::graph::StreamCheck::kLenient, graph_, 1,
+                                                              ppc::core::graph::SequentialFor{});
+    return graph_valid_;
+  }
 
   num_vertices_ = task_data->outputs_count[0];
   distances_.resize(num_vertices_);
@@ -26,7 +36,11 @@ bool muhina_m_dijkstra_seq::TestTaskSequential::PreProcessingImpl() {
   }
   distances_[start_vertex_] = 0;
 
-  return true;
+  // the graph is parsed once here, so the run only computes distances
+  graph_valid_ = ppc::core::graph::BuildFromAdjacencyStream(graph_data, num_vertices_,
+                                                            ppc::core::graph::StreamCheck::kLenient, graph_, 1,
+                                                            ppc::core::graph::SequentialFor{});
+  return graph_valid_;
 }
 
 bool muhina_m_dijkstra_seq::TestTaskSequential::ValidationImpl() {
@@ -35,32 +49,14 @@ bool muhina_m_dijkstra_seq::TestTaskSequential::ValidationImpl() {
 }
 
 bool muhina_m_dijkstra_seq::TestTaskSequential::RunImpl() {
-  std::vector<std::vector<std::pair<size_t, int>>> adj_list(num_vertices_);
-  size_t current_vertex = 0;
-  size_t i = 0;
-
-  while (i < graph_data_.size() && current_vertex < num_vertices_) {
-    if (graph_data_[i] == kEndOfVertexList) {
-      current_vertex++;
-      i++;
-      continue;
-    }
-
-    if (i + 1 >= graph_data_.size()) {
-      break;
-    }
-
-    size_t dest = graph_data_[i];
-    int weight = graph_data_[i + 1];
-    if (weight < 0) {
-      return false;
-    }
-
-    if (dest < num_vertices_) {
-      adj_list[current_vertex].emplace_back(dest, weight);
-    }
+  if (!graph_valid_) {
+    return false;
+  }
 
-    i += 2;
+  if (batch_) {
+    ppc::core::graph::MultiSourceShortestPaths(graph_, batch_->sources, batch_->distances,
+                                               ppc::core::graph::SequentialFor{});
+    return true;
   }
 
   std::priority_queue<std::pair<int, size_t>, std::vector<std::pair<int, size_t>>, std::greater<>> pq;
@@ -76,9 +72,9 @@ bool muhina_m_dijkstra_seq::TestTaskSequential::RunImpl() {
       continue;
     }
 
-    for (const auto &edge : adj_list[u]) {
-      size_t v = edge.first;
-      int weight = edge.second;
+    for (uint64_t e = graph_.EdgesBegin(u); e < graph_.EdgesEnd(u); e++) {
+      size_t v = graph_.Target(e);
+      int weight = graph_.Weight(e);
 
       if (distances_[u] != INT_MAX && distances_[u] + weight < distances_[v]) {
         distances_[v] = distances_[u] + weight;
@@ -91,6 +87,9 @@ bool muhina_m_dijkstra_seq::TestTaskSequential::RunImpl() {
 }
 
 bool muhina_m_dijkstra_seq::TestTaskSequential::PostProcessingImpl() {
+  if (batch_) {
+    return true;
+  }
   for (size_t i = 0; i < distances_.size(); ++i) {
     reinterpret_cast<int *>(task_data->outputs[0])[i] = distances_[i];
   }
@@ -21,8 +21,6 @@ class HoareSortSimpleMergeSequential : public ppc::core::Task {
  private:
   std::vector<double> vect_;
   size_t vect_size_{};
-
-  size_t Partition(size_t low, size_t high);
 };
 
 }  // namespace nikolaev_r_hoare_sort_simple_merge_seq
\ No newline at end of file
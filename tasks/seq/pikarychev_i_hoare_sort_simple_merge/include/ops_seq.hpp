@@ -1,10 +1,11 @@
 #pragma once
 
 #include <algorithm>
-#include <functional>
+#include <span>
 #include <utility>
 #include <vector>
 
+#include "core/sort/include/quick_sort.hpp"
 #include "core/task/include/task.hpp"
 
 namespace pikarychev_i_hoare_sort_simple_merge {
@@ -32,8 +33,8 @@ class HoareSeq : public ppc::core::Task {
     const auto size = input_.size();
     std::ranges::copy_n(input_.begin(), size, res_.begin());
 
-    DoSort(res_, 0, size - 1,
-           [reverse = reverse_](const auto& a, const auto& b) { return reverse ? (a < b) : (a > b); });
+    ppc::core::sort::QuickSort(std::span<T>(res_),
+                               [reverse = reverse_](const T& a, const T& b) { return reverse ? (a < b) : (a > b); });
 
     return true;
   }
@@ -44,28 +45,6 @@ class HoareSeq : public ppc::core::Task {
   }
 
  private:
-  static int Partition(std::vector<T>& block, int low, int high, const std::function<bool(const T&, const T&)>& comp) {
-    int e = low - 1;
-    for (int j = low; j <= high - 1; j++) {
-      if (!comp(block[j], block[high])) {
-        continue;
-      }
-
-      e++;
-      std::swap(block[e], block[j]);
-    }
-    std::swap(block[e + 1], block[high]);
-    return ++e;
-  };
-  static void DoSort(std::vector<T>& arr, int low, int high, const std::function<bool(const T&, const T&)>& comp) {
-    if (low >= high) {
-      return;
-    }
-    const auto border = Partition(arr, low, high, comp);
-    DoSort(arr, low, border - 1, comp);
-    DoSort(arr, border + 1, high, comp);
-  }
-
   bool reverse_;
   std::vector<T> input_;
   std::vector<T> res_;
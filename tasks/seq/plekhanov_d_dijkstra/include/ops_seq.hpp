@@ -1,9 +1,12 @@
 #pragma once
 
 #include <cstddef>
+#include <optional>
 #include <utility>
 #include <vector>
 
+#include "core/graph/include/csr_graph.hpp"
+#include "core/graph/include/multi_source.hpp"
 #include "core/task/include/task.hpp"
 
 namespace plekhanov_d_dijkstra_seq {
@@ -17,11 +20,12 @@ class TestTaskSequential : public ppc::core::Task {
   bool PostProcessingImpl() override;
 
  private:
-  std::vector<int> graph_data_;
+  ppc::core::graph::CsrGraph graph_;
+  std::optional<ppc::core::graph::BatchedQuery> batch_;
+  bool graph_valid_ = false;
   std::vector<int> distances_;
   size_t start_vertex_;
   size_t num_vertices_;
-  static const int kEndOfVertexList;
 };
 
 }  // namespace plekhanov_d_dijkstra_seq
\ No newline at end of file
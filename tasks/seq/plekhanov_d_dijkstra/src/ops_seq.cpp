@@ -2,16 +2,26 @@
 
 #include <climits>
 #include <cstddef>
+#include <cstdint>
 #include <set>
+#include <span>
 #include <utility>
-#include <vector>
 
-const int plekhanov_d_dijkstra_seq::TestTaskSequential::kEndOfVertexList = -1;
+#include "core/graph/include/adjacency_stream.hpp"
+#include "core/graph/include/multi_source.hpp"
 
 bool plekhanov_d_dijkstra_seq::TestTaskSequential::PreProcessingImpl() {
-  unsigned int input_size = task_data->inputs_count[0];
-  auto *in_ptr = reinterpret_cast<int *>(task_data->inputs[0]);
-  graph_data_.assign(in_ptr, in_ptr + input_size);
+  const std::span<const int> graph_data(reinterpret_cast<int *>(task_data->inputs[0]), task_data->inputs_count[0]);
+  batch_ = ppc::core::graph::GetBatchedQuery(*task_data);
+  if (batch_) {
+    // the run writes row k of the K x V output for source k
+    num_vertices_ = batch_->num_vertices;
+    graph_valid_ = ppc::core::graph::BuildFromAdjacencyStream(graph_data, num_vertices_,
+                                                              ppc::core::graph::StreamCheck::kLenient, graph_, 1,
+                                                              ppc::core::graph::SequentialFor{});
+    return graph_valid_;
+  }
+
   num_vertices_ = task_data->outputs_count[0];
   distances_.resize(num_vertices_);
   distances_.assign(num_vertices_, INT_MAX);
@@ -21,7 +31,12 @@ bool plekhanov_d_dijkstra_seq::TestTaskSequential::PreProcessingImpl() {
     start_vertex_ = 0;
   }
   distances_[start_vertex_] = 0;
-  return true;
+
+  // the graph is parsed once here, so the run only computes distances
+  graph_valid_ = ppc::core::graph::BuildFromAdjacencyStream(graph_data, num_vertices_,
+                                                            ppc::core::graph::StreamCheck::kLenient, graph_, 1,
+                                                            ppc::core::graph::SequentialFor{});
+  return graph_valid_;
 }
 
 bool plekhanov_d_dijkstra_seq::TestTaskSequential::ValidationImpl() {
@@ -30,31 +45,14 @@ bool plekhanov_d_dijkstra_seq::TestTaskSequential::ValidationImpl() {
 }
 
 bool plekhanov_d_dijkstra_seq::TestTaskSequential::RunImpl() {
-  std::vector<std::vector<std::pair<size_t, int>>> adj_list(num_vertices_);
-  const size_t estimated_edges_per_vertex = 8;
-  for (auto &edges : adj_list) {
-    edges.reserve(estimated_edges_per_vertex);
+  if (!graph_valid_) {
+    return false;
   }
-  size_t current_vertex = 0;
-  size_t i = 0;
-  while (i < graph_data_.size() && current_vertex < num_vertices_) {
-    if (graph_data_[i] == kEndOfVertexList) {
-      current_vertex++;
-      i++;
-      continue;
-    }
-    if (i + 1 >= graph_data_.size()) {
-      break;
-    }
-    size_t dest = graph_data_[i];
-    int weight = graph_data_[i + 1];
-    if (weight < 0) {
-      return false;
-    }
-    if (dest < num_vertices_) {
-      adj_list[current_vertex].emplace_back(dest, weight);
-    }
-    i += 2;
+
+  if (batch_) {
+    ppc::core::graph::MultiSourceShortestPaths(graph_, batch_->sources, batch_->distances,
+                                               ppc::core::graph::SequentialFor{});
+    return true;
   }
   distances_[start_vertex_] = 0;
   std::set<std::pair<int, size_t>> vertex_set;
@@ -62,7 +60,9 @@ bool plekhanov_d_dijkstra_seq::TestTaskSequential::RunImpl() {
   while (!vertex_set.empty()) {
     size_t u = vertex_set.begin()->second;
     vertex_set.erase(vertex_set.begin());
-    for (const auto &[v, weight] : adj_list[u]) {
+    for (uint64_t e = graph_.EdgesBegin(u); e < graph_.EdgesEnd(u); e++) {
+      const size_t v = graph_.Target(e);
+      const int weight = graph_.Weight(e);
       if (distances_[u] != INT_MAX && distances_[u] + weight < distances_[v]) {
         if (distances_[v] != INT_MAX) {
           vertex_set.erase({distances_[v], v});
@@ -76,6 +76,9 @@ bool plekhanov_d_dijkstra_seq::TestTaskSequential::RunImpl() {
 }
 
 bool plekhanov_d_dijkstra_seq::TestTaskSequential::PostProcessingImpl() {
+  if (batch_) {
+    return true;
+  }
   auto *output = reinterpret_cast<int *>(task_data->outputs[0]);
   for (size_t i = 0; i < distances_.size(); ++i) {
     output[i] = distances_[i];
@@ -1,9 +1,11 @@
 #include "seq/shlyakov_m_shell_sort/include/ops_seq.hpp"
 
-#include <cmath>
 #include <cstddef>
+#include <span>
 #include <vector>
 
+#include "core/sort/include/shell_sort.hpp"
+
 bool shlyakov_m_shell_sort_seq::TestTaskSequential::PreProcessingImpl() {
   std::size_t input_size = task_data->inputs_count[0];
   auto* in_ptr = reinterpret_cast<int*>(task_data->inputs[0]);
@@ -19,30 +21,7 @@ bool shlyakov_m_shell_sort_seq::TestTaskSequential::ValidationImpl() {
 }
 
 bool shlyakov_m_shell_sort_seq::TestTaskSequential::RunImpl() {
-  int n = static_cast<int>(input_.size());
-
-  std::vector<int> gaps;
-  for (int i = 1; i <= static_cast<int>(std::sqrt(n)) + 1; ++i) {
-    int gap = static_cast<int>(n / std::pow(2.0, i));
-    if (gap > 0) {
-      gaps.push_back(gap);
-    }
-  }
-
-  for (int k = static_cast<int>(gaps.size()) - 1; k >= 0; --k) {
-    int gap = gaps[k];
-    for (int start = 0; start < gap; ++start) {
-      for (int i = start + gap; i < n; i += gap) {
-        int key = output_[i];
-        int j = i - gap;
-        while (j >= start && output_[j] > key) {
-          output_[j + gap] = output_[j];
-          j -= gap;
-        }
-        output_[j + gap] = key;
-      }
-    }
-  }
+  ppc::core::sort::ShellSort(std::span<int>(output_));
   return true;
 }
 
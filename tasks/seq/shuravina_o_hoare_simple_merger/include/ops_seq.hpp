@@ -21,7 +21,6 @@ class TestTaskSequential : public ppc::core::Task {
   std::vector<int> input_;
   std::vector<int> output_;
 
-  void QuickSort(std::vector<int>& arr, int low, int high);
   static void Merge(std::vector<int>& arr, int low, int mid, int high);
 };
 
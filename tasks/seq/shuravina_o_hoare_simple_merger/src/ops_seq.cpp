@@ -1,30 +1,12 @@
 #include "seq/shuravina_o_hoare_simple_merger/include/ops_seq.hpp"
 
-#include <algorithm>
 #include <cstddef>
+#include <span>
 #include <vector>
 
-namespace shuravina_o_hoare_simple_merger {
-
-void TestTaskSequential::QuickSort(std::vector<int>& arr, int low, int high) {
-  if (low < high) {
-    int pivot = arr[high];
-    int i = low - 1;
-
-    for (int j = low; j < high; ++j) {
-      if (arr[j] <= pivot) {
-        ++i;
-        std::swap(arr[i], arr[j]);
-      }
-    }
-    std::swap(arr[i + 1], arr[high]);
+#include "core/sort/include/quick_sort.hpp"
 
-    int pi = i + 1;
-
-    QuickSort(arr, low, pi - 1);
-    QuickSort(arr, pi + 1, high);
-  }
-}
+namespace shuravina_o_hoare_simple_merger {
 
 void TestTaskSequential::Merge(std::vector<int>& arr, int low, int mid, int high) {
   std::vector<int> temp(high - low + 1);
@@ -68,7 +50,7 @@ bool TestTaskSequential::ValidationImpl() { return task_data->inputs_count[0] ==
 
 bool TestTaskSequential::RunImpl() {
   auto size = input_.size();
-  QuickSort(input_, 0, static_cast<int>(size) - 1);
+  ppc::core::sort::QuickSort(std::span<int>(input_));
   Merge(input_, 0, static_cast<int>(size / 2) - 1, static_cast<int>(size) - 1);
   output_ = input_;
   return true;
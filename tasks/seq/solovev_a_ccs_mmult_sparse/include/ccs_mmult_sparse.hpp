@@ -5,9 +5,11 @@
 #include <utility>
 #include <vector>
 
+#include "core/sparse/include/matrix.hpp"
 #include "core/task/include/task.hpp"
 
 namespace solovev_a_matrix {
+// layout of the matrices in task data, the task converts them to the CCS matrices of core sparse
 struct MatrixInCcsSparse {
   std::vector<std::complex<double>> val;
   std::vector<int> row;
@@ -27,6 +29,8 @@ struct MatrixInCcsSparse {
   }
 };
 
+using Matrix = ppc::core::sparse::CcsMatrix<int, std::complex<double>>;
+
 class SeqMatMultCcs : public ppc::core::Task {
  public:
   explicit SeqMatMultCcs(std::shared_ptr<ppc::core::TaskData> task_data) : Task(std::move(task_data)) {}
@@ -36,6 +40,7 @@ class SeqMatMultCcs : public ppc::core::Task {
   bool PostProcessingImpl() override;
 
  private:
-  MatrixInCcsSparse *M1_, *M2_, *M3_;
+  MatrixInCcsSparse *M3_ = nullptr;
+  Matrix m1_, m2_, m3_;
 };
 }  // namespace solovev_a_matrix
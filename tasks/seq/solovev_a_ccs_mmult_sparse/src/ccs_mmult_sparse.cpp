@@ -1,11 +1,33 @@
 #include "seq/solovev_a_ccs_mmult_sparse/include/ccs_mmult_sparse.hpp"
 
-#include <complex>
-#include <vector>
+#include <cstddef>
+
+#include "core/sparse/include/matrix.hpp"
+#include "core/sparse/include/spgemm.hpp"
+
+namespace solovev_a_matrix {
+namespace {
+
+constexpr auto kSerialFor = [](size_t begin, size_t end, const auto& body) { body(begin, end); };
+
+// col_p may hold more than c_n + 1 offsets, the first ones describe the matrix
+Matrix ToMatrix(const MatrixInCcsSparse& m) {
+  Matrix res;
+  res.num_rows = static_cast<size_t>(m.r_n);
+  res.num_cols = static_cast<size_t>(m.c_n);
+  res.offsets.assign(m.col_p.begin(), m.col_p.begin() + m.c_n + 1);
+  const int n_z = m.col_p[m.c_n];
+  res.indices.assign(m.row.begin(), m.row.begin() + n_z);
+  res.values.assign(m.val.begin(), m.val.begin() + n_z);
+  return res;
+}
+
+}  // namespace
+}  // namespace solovev_a_matrix
 
 bool solovev_a_matrix::SeqMatMultCcs::PreProcessingImpl() {
-  M1_ = reinterpret_cast<MatrixInCcsSparse*>(task_data->inputs[0]);
-  M2_ = reinterpret_cast<MatrixInCcsSparse*>(task_data->inputs[1]);
+  m1_ = ToMatrix(*reinterpret_cast<MatrixInCcsSparse*>(task_data->inputs[0]));
+  m2_ = ToMatrix(*reinterpret_cast<MatrixInCcsSparse*>(task_data->inputs[1]));
   M3_ = reinterpret_cast<MatrixInCcsSparse*>(task_data->outputs[0]);
   return true;
 }
@@ -17,62 +39,20 @@ bool solovev_a_matrix::SeqMatMultCcs::ValidationImpl() {
 }
 
 bool solovev_a_matrix::SeqMatMultCcs::RunImpl() {
-  M3_->r_n = M1_->r_n;
-  M3_->c_n = M2_->c_n;
-  M3_->col_p.resize(M3_->c_n + 1);
-  M3_->col_p[0] = 0;
-  std::vector<int> available_el(M3_->r_n);
-  for (int m2_c = 0; m2_c < M3_->c_n; ++m2_c) {
-    for (int m3_r = 0; m3_r < M3_->r_n; ++m3_r) {
-      available_el[m3_r] = 0;
-    }
-    for (int m2_i = M2_->col_p[m2_c]; m2_i < M2_->col_p[m2_c + 1]; ++m2_i) {
-      int m2_r = M2_->row[m2_i];
-      for (int m1_i = M1_->col_p[m2_r]; m1_i < M1_->col_p[m2_r + 1]; ++m1_i) {
-        available_el[M1_->row[m1_i]] = 1;
-      }
-    }
-    int n_z_c_cnt = 0;
-    for (int m3_r = 0; m3_r < M3_->r_n; ++m3_r) {
-      n_z_c_cnt += available_el[m3_r];
-    }
-    M3_->col_p[m2_c + 1] = n_z_c_cnt + M3_->col_p[m2_c];
-  }
-
-  int n_z_full = M3_->col_p[M3_->c_n];
-  M3_->n_z = n_z_full;
-  M3_->row.resize(n_z_full);
-  M3_->val.resize(n_z_full);
-
-  std::complex<double> nought = {0.0, 0.0};
-  std::complex<double> m2_val = {0.0, 0.0};
-  std::vector<std::complex<double>> cask(M3_->r_n);
-  for (int m2_c = 0; m2_c < M3_->c_n; ++m2_c) {
-    for (int m3_r = 0; m3_r < M3_->r_n; ++m3_r) {
-      cask[m3_r] = nought;
-      available_el[m3_r] = 0;
-    }
-
-    for (int m2_i = M2_->col_p[m2_c]; m2_i < M2_->col_p[m2_c + 1]; ++m2_i) {
-      int m2_r = M2_->row[m2_i];
-      m2_val = M2_->val[m2_i];
-      for (int m1_i = M1_->col_p[m2_r]; m1_i < M1_->col_p[m2_r + 1]; ++m1_i) {
-        int m1_row = M1_->row[m1_i];
-        cask[m1_row] += M1_->val[m1_i] * m2_val;
-        available_el[m1_row] = 1;
-      }
-    }
-
-    int c_pos = M3_->col_p[m2_c];
-    for (int m3_r = 0; m3_r < M3_->r_n; ++m3_r) {
-      if (available_el[m3_r] != 0) {
-        M3_->row[c_pos] = m3_r;
-        M3_->val[c_pos++] = cask[m3_r];
-      }
-    }
-  }
-
+  m3_.num_rows = m1_.num_rows;
+  m3_.num_cols = m2_.num_cols;
+  // every entry with a term is stored, sums which cancel out included
+  ppc::core::sparse::Multiply(m2_.TransposedView(), m1_.TransposedView(), m3_, ppc::core::sparse::KeepAll{}, 1,
+                              kSerialFor);
   return true;
 }
 
-bool solovev_a_matrix::SeqMatMultCcs::PostProcessingImpl() { return true; }
+bool solovev_a_matrix::SeqMatMultCcs::PostProcessingImpl() {
+  M3_->r_n = static_cast<int>(m3_.num_rows);
+  M3_->c_n = static_cast<int>(m3_.num_cols);
+  M3_->col_p.assign(m3_.offsets.begin(), m3_.offsets.end());
+  M3_->n_z = M3_->col_p[M3_->c_n];
+  M3_->row.assign(m3_.indices.begin(), m3_.indices.end());
+  M3_->val.assign(m3_.values.begin(), m3_.values.end());
+  return true;
+}
@@ -1,9 +1,11 @@
 #include "seq/solovyev_d_shell_sort_simple/include/ops_seq.hpp"
 
-#include <cmath>
 #include <cstddef>
+#include <span>
 #include <vector>
 
+#include "core/sort/include/shell_sort.hpp"
+
 bool solovyev_d_shell_sort_simple_seq::TaskSequential::PreProcessingImpl() {
   unsigned int input_size = task_data->inputs_count[0];
   auto *in_ptr = reinterpret_cast<int *>(task_data->inputs[0]);
@@ -19,19 +21,7 @@ bool solovyev_d_shell_sort_simple_seq::TaskSequential::ValidationImpl() {
 }
 
 bool solovyev_d_shell_sort_simple_seq::TaskSequential::RunImpl() {
-  unsigned int gap = input_.size() / 2;
-  while (gap > 0) {
-    for (size_t i = gap; i < input_.size(); i++) {
-      int val = input_[i];
-      size_t j = i;
-      while (j >= gap && input_[j - gap] > val) {
-        input_[j] = input_[j - gap];
-        j -= gap;
-      }
-      input_[j] = val;
-    }
-    gap = gap / 2;
-  }
+  ppc::core::sort::ShellSort(std::span<int>(input_));
   return true;
 }
 
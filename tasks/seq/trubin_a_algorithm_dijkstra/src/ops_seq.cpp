@@ -1,32 +1,44 @@
 #include "seq/trubin_a_algorithm_dijkstra/include/ops_seq.hpp"
 
+#include <algorithm>
 #include <cmath>
 #include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <limits>
 #include <queue>
+#include <span>
 #include <utility>
 #include <vector>
 
+#include "core/graph/include/adjacency_stream.hpp"
+#include "core/graph/include/delta_stepping.hpp"
+#include "core/graph/include/multi_source.hpp"
+
 bool trubin_a_algorithm_dijkstra_seq::TestTaskSequential::PreProcessingImpl() {
   if (!validation_passed_) {
     return false;
   }
 
-  unsigned int input_size = task_data->inputs_count[0];
-  auto* in_ptr = reinterpret_cast<int*>(task_data->inputs[0]);
-  std::vector<int> graph_data(in_ptr, in_ptr + input_size);
+  const std::span<const int> graph_data(reinterpret_cast<int*>(task_data->inputs[0]), task_data->inputs_count[0]);
+  batch_ = ppc::core::graph::GetBatchedQuery(*task_data);
+  if (batch_) {
+    // the run writes row k of the K x V output for source k
+    num_vertices_ = batch_->num_vertices;
+    return ppc::core::graph::BuildFromAdjacencyStream(graph_data, num_vertices_, ppc::core::graph::StreamCheck::kStrict,
+                                                      graph_, 1, ppc::core::graph::SequentialFor{});
+  }
 
   num_vertices_ = task_data->outputs_count[0];
 
-  if (num_vertices_ == 0 || input_size == 0) {
+  if (num_vertices_ == 0 || graph_data.empty()) {
     return true;
   }
 
-  adjacency_list_.assign(num_vertices_, {});
   distances_.assign(num_vertices_, std::numeric_limits<int>::max());
 
-  if (!BuildAdjacencyList(graph_data)) {
+  if (!ppc::core::graph::BuildFromAdjacencyStream(graph_data, num_vertices_, ppc::core::graph::StreamCheck::kStrict,
+                                                  graph_, 1, ppc::core::graph::SequentialFor{})) {
     return false;
   }
 
@@ -67,6 +79,12 @@ bool trubin_a_algorithm_dijkstra_seq::TestTaskSequential::ValidationImpl() {
 }
 
 bool trubin_a_algorithm_dijkstra_seq::TestTaskSequential::RunImpl() {
+  if (batch_) {
+    ppc::core::graph::MultiSourceShortestPaths(graph_, batch_->sources, batch_->distances,
+                                               ppc::core::graph::SequentialFor{});
+    return true;
+  }
+
   if (num_vertices_ == 0) {
     return true;
   }
@@ -90,11 +108,12 @@ bool trubin_a_algorithm_dijkstra_seq::TestTaskSequential::RunImpl() {
       continue;
     }
 
-    for (const auto& edge : adjacency_list_[u]) {
-      int new_dist = distances_[u] + edge.weight;
-      if (new_dist < distances_[edge.to]) {
-        distances_[edge.to] = new_dist;
-        min_heap.emplace(new_dist, edge.to);
+    for (uint64_t e = graph_.EdgesBegin(u); e < graph_.EdgesEnd(u); e++) {
+      const size_t to = graph_.Target(e);
+      int new_dist = distances_[u] + graph_.Weight(e);
+      if (new_dist < distances_[to]) {
+        distances_[to] = new_dist;
+        min_heap.emplace(new_dist, to);
       }
     }
   }
@@ -102,6 +121,11 @@ bool trubin_a_algorithm_dijkstra_seq::TestTaskSequential::RunImpl() {
 }
 
 bool trubin_a_algorithm_dijkstra_seq::TestTaskSequential::PostProcessingImpl() {
+  if (batch_) {
+    std::ranges::replace(batch_->distances, ppc::core::graph::kInfiniteDistance, -1);
+    return true;
+  }
+
   if (num_vertices_ == 0) {
     return true;
   }
@@ -116,35 +140,3 @@ bool trubin_a_algorithm_dijkstra_seq::TestTaskSequential::PostProcessingImpl() {
   }
   return true;
 }
-
-bool trubin_a_algorithm_dijkstra_seq::TestTaskSequential::BuildAdjacencyList(const std::vector<int>& graph_data) {
-  size_t current_vertex = 0;
-  size_t i = 0;
-
-  while (i < graph_data.size()) {
-    if (graph_data[i] == kEndOfVertexList) {
-      if (current_vertex >= num_vertices_) {
-        return false;
-      }
-      current_vertex++;
-      i++;
-      continue;
-    }
-
-    if (i + 1 >= graph_data.size()) {
-      return false;
-    }
-
-    auto to = static_cast<size_t>(graph_data[i]);
-    int weight = graph_data[i + 1];
-
-    if (to >= num_vertices_ || weight < 0) {
-      return false;
-    }
-
-    adjacency_list_[current_vertex].emplace_back(to, weight);
-    i += 2;
-  }
-
-  return true;
-}
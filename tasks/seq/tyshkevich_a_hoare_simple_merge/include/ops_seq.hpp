@@ -1,10 +1,11 @@
 #pragma once
 
 #include <algorithm>
-#include <cstdint>
+#include <span>
 #include <utility>
 #include <vector>
 
+#include "core/sort/include/quick_sort.hpp"
 #include "core/task/include/task.hpp"
 
 namespace tyshkevich_a_hoare_simple_merge_seq {
@@ -24,7 +25,7 @@ class HoareSortTask : public ppc::core::Task {
 
   bool RunImpl() override {
     std::copy(input_.begin(), input_.end(), output_.begin());
-    HoareSort(output_, 0, output_.size() - 1);
+    ppc::core::sort::QuickSort(output_, cmp_);
 
     return true;
   }
@@ -35,26 +36,6 @@ class HoareSortTask : public ppc::core::Task {
   }
 
  private:
-  void HoareSort(std::span<T> arr, int64_t low, int64_t high) {
-    const auto partition = [&cmp = this->cmp_](std::span<T> region, int64_t plo, int64_t phi) -> int64_t {
-      const auto& pivot = region[phi];
-      int64_t e = plo - 1;
-      for (int64_t j = plo; j <= phi - 1; j++) {
-        if (cmp(region[j], pivot)) {
-          std::swap(region[++e], region[j]);
-        }
-      }
-      std::swap(region[e + 1], region[phi]);
-      return e + 1;
-    };
-
-    if (low < high) {
-      int64_t p = partition(arr, low, high);
-      HoareSort(arr, low, p - 1);
-      HoareSort(arr, p + 1, high);
-    }
-  };
-
   Comparator cmp_;
 
   std::span<const T> input_;
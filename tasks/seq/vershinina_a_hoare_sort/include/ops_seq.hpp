@@ -18,9 +18,6 @@ class TestTaskSequential : public ppc::core::Task {
   int *input_{};
   int n_{};
   std::vector<int> output_;
-  int value_;
-  void HoareSort(int *s_vec, int first, int last);
-  int Partition(int *s_vec, int first, int last);
 };
 
 }  // namespace vershinina_a_hoare_sort_seq
\ No newline at end of file
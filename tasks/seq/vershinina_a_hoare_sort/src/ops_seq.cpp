@@ -1,28 +1,10 @@
 #include "seq/vershinina_a_hoare_sort/include/ops_seq.hpp"
 
 #include <algorithm>
+#include <cstddef>
+#include <span>
 
-int vershinina_a_hoare_sort_seq::TestTaskSequential::Partition(int *s_vec, int first, int last) {
-  int i = first - 1;
-  value_ = s_vec[last];
-
-  for (int j = first; j <= last - 1; j++) {
-    if (s_vec[j] <= value_) {
-      i++;
-      std::swap(s_vec[i], s_vec[j]);
-    }
-  }
-  std::swap(s_vec[i + 1], s_vec[last]);
-  return i + 1;
-}
-
-void vershinina_a_hoare_sort_seq::TestTaskSequential::HoareSort(int *s_vec, int first, int last) {
-  if (first < last) {
-    int iter = Partition(s_vec, first, last);
-    HoareSort(s_vec, first, iter - 1);
-    HoareSort(s_vec, iter + 1, last);
-  }
-}
+#include "core/sort/include/quick_sort.hpp"
 
 bool vershinina_a_hoare_sort_seq::TestTaskSequential::PreProcessingImpl() {
   input_ = reinterpret_cast<int *>(task_data->inputs[0]);
@@ -38,7 +20,7 @@ bool vershinina_a_hoare_sort_seq::TestTaskSequential::RunImpl() {
   if (n_ <= 1) {
     return true;
   }
-  HoareSort(input_, 0, n_ - 1);
+  ppc::core::sort::QuickSort(std::span<int>(input_, static_cast<size_t>(n_)));
   return true;
 }
 
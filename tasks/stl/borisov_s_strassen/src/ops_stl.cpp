@@ -5,21 +5,15 @@
 #include <thread>
 #include <vector>
 
+#include "core/gemm/include/gemm.hpp"
+
 namespace borisov_s_strassen_stl {
 
 namespace {
 
-std::vector<double> MultiplyNaive(const std::vector<double> &a, const std::vector<double> &b, int n) {
-  std::vector<double> c(n * n, 0.0);
-  for (int i = 0; i < n; ++i) {
-    for (int j = 0; j < n; ++j) {
-      double sum = 0.0;
-      for (int k = 0; k < n; ++k) {
-        sum += a[(i * n) + k] * b[(k * n) + j];
-      }
-      c[(i * n) + j] = sum;
-    }
-  }
+std::vector<double> MultiplyBase(const std::vector<double> &a, const std::vector<double> &b, int n) {
+  std::vector<double> c(n * n);
+  ppc::core::gemm::Multiply(a, b, c, n, n, n);
   return c;
 }
 
@@ -58,7 +52,7 @@ std::vector<double> StrassenRecursive(const std::vector<double> &a, const std::v
   const int parallel_depth = 2;
 
   if (n <= 64) {
-    return MultiplyNaive(a, b, n);
+    return MultiplyBase(a, b, n);
   }
   int k = n / 2;
   auto a11 = SubMatrix(a, n, 0, 0, k);
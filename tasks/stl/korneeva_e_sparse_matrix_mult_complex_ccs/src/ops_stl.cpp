@@ -3,12 +3,15 @@
 #include <algorithm>
 #include <cmath>
 #include <complex>
+#include <cstddef>
 #include <cstdlib>
 #include <numeric>
+#include <span>
 #include <thread>
 #include <utility>
 #include <vector>
 
+#include "core/sparse/include/complex_kernels.hpp"
 #include "core/util/include/util.hpp"
 
 namespace korneeva_e_sparse_matrix_mult_complex_ccs_stl {
@@ -45,9 +48,11 @@ bool SparseMatrixMultComplexCCS::RunImpl() {
   int cols_per_thread = matrix2_->cols / num_threads;
   int remaining_cols = matrix2_->cols % num_threads;
 
+  const ppc::core::sparse::SplitComplex values1(matrix1_->values);
   auto compute_range = [&](int start, int end) {
+    ppc::core::sparse::ComplexAccumulator column(matrix1_->rows);
     for (int j = start; j < end; ++j) {
-      ComputeColumn(j, column_results[j]);
+      ComputeColumn(j, values1, column, column_results[j]);
     }
   };
 
@@ -85,42 +90,18 @@ bool SparseMatrixMultComplexCCS::RunImpl() {
   return true;
 }
 
-void SparseMatrixMultComplexCCS::ComputeColumn(int col_idx, std::vector<std::pair<Complex, int>>& column_data) {
-  int col_start2 = matrix2_->col_offsets[col_idx];
-  int col_end2 = matrix2_->col_offsets[col_idx + 1];
-
-  column_data.reserve(matrix1_->rows);
-  for (int i = 0; i < matrix1_->rows; i++) {
-    Complex sum = ComputeElement(i, col_start2, col_end2);
-    if (sum != Complex(0.0, 0.0)) {
-      column_data.emplace_back(sum, i);
-    }
-  }
-}
-
-Complex SparseMatrixMultComplexCCS::ComputeElement(int row_idx, int col_start2, int col_end2) {
-  Complex sum(0.0, 0.0);
-  for (int k = 0; k < matrix1_->cols; k++) {
+void SparseMatrixMultComplexCCS::ComputeColumn(int col_idx, const ppc::core::sparse::SplitComplex& values1,
+                                               ppc::core::sparse::ComplexAccumulator& column,
+                                               std::vector<std::pair<Complex, int>>& column_data) {
+  // column col_idx of the product sums the columns k of matrix1 scaled by matrix2(k, col_idx)
+  for (int q = matrix2_->col_offsets[col_idx]; q < matrix2_->col_offsets[col_idx + 1]; q++) {
+    int k = matrix2_->row_indices[q];
     int col_start1 = matrix1_->col_offsets[k];
-    int col_end1 = matrix1_->col_offsets[k + 1];
-    sum += ComputeContribution(row_idx, k, col_start1, col_end1, col_start2, col_end2);
-  }
-  return sum;
-}
-
-Complex SparseMatrixMultComplexCCS::ComputeContribution(int row_idx, int k, int col_start1, int col_end1,
-                                                        int col_start2, int col_end2) {
-  Complex contribution(0.0, 0.0);
-  for (int p = col_start1; p < col_end1; p++) {
-    if (matrix1_->row_indices[p] == row_idx) {
-      for (int q = col_start2; q < col_end2; q++) {
-        if (matrix2_->row_indices[q] == k) {
-          contribution += matrix1_->values[p] * matrix2_->values[q];
-        }
-      }
-    }
+    std::span<const int> rows1(matrix1_->row_indices.data() + col_start1, matrix1_->col_offsets[k + 1] - col_start1);
+    ppc::core::sparse::ScatterMultiplyAdd(rows1, values1, col_start1, matrix2_->values[q], column);
   }
-  return contribution;
+  ppc::core::sparse::DrainNonZero(
+      column, 0.0, [&](size_t i, Complex sum) { column_data.emplace_back(sum, static_cast<int>(i)); });
 }
 
 bool SparseMatrixMultComplexCCS::PostProcessingImpl() {
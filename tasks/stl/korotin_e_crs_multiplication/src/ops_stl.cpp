@@ -3,10 +3,11 @@
 #include <algorithm>
 #include <cmath>
 #include <cstddef>
-#include <functional>
-#include <thread>
+#include <utility>
 #include <vector>
 
+#include "core/sparse/include/spgemm.hpp"
+#include "core/util/include/pool_for.hpp"
 #include "core/util/include/util.hpp"
 
 bool korotin_e_crs_multiplication_stl::CrsMultiplicationSTL::PreProcessingImpl() {
@@ -47,98 +48,17 @@ bool korotin_e_crs_multiplication_stl::CrsMultiplicationSTL::ValidationImpl() {
              task_data->inputs_count[3] - 2;
 }
 
-void korotin_e_crs_multiplication_stl::CrsMultiplicationSTL::MulTask(size_t l, size_t r, std::vector<double> &local_val,
-                                                                     std::vector<unsigned int> &local_col,
-                                                                     std::vector<unsigned int> &temp_r_i,
-                                                                     const std::vector<unsigned int> &tr_i,
-                                                                     const std::vector<unsigned int> &tcol,
-                                                                     const std::vector<double> &tval) {
-  for (size_t k = l; k < r; ++k) {
-    for (size_t s = 0; s < tr_i.size() - 1; ++s) {
-      double sum = 0;
-      unsigned int ai = A_rI_[k];
-      unsigned int bt = tr_i[s];
-      while (ai < A_rI_[k + 1] && bt < tr_i[s + 1]) {
-        if (A_col_[ai] == tcol[bt]) {
-          sum += A_val_[ai] * tval[bt];
-          ai++;
-          bt++;
-        } else if (A_col_[ai] < tcol[bt]) {
-          ai++;
-        } else {
-          bt++;
-        }
-      }
-      if (sum != 0) {
-        local_val.push_back(sum);
-        local_col.push_back(s);
-        temp_r_i[k + 1]++;
-      }
-    }
-  }
-}
-
 bool korotin_e_crs_multiplication_stl::CrsMultiplicationSTL::RunImpl() {
-  std::vector<unsigned int> tr_i(*std::ranges::max_element(B_col_.begin(), B_col_.end()) + 2, 0);
-  unsigned int i = 0;
-  unsigned int j = 0;
-  for (i = 0; i < B_Nz_; i++) {
-    tr_i[B_col_[i] + 1]++;
-  }
-  for (i = 1; i < tr_i.size(); i++) {
-    tr_i[i] += tr_i[i - 1];
-  }
-
-  std::vector<unsigned int> tcol(B_Nz_, 0);
-  std::vector<double> tval(B_Nz_, 0);
-  for (i = 0; i < B_N_ - 1; i++) {
-    for (j = B_rI_[i]; j < B_rI_[i + 1]; j++) {
-      tval[tr_i[B_col_[j]]] = B_val_[j];
-      tcol[tr_i[B_col_[j]]] = i;
-      tr_i[B_col_[j]]++;
-    }
-  }
-  for (i = tr_i.size() - 1; i > 0; i--) {
-    tr_i[i] = tr_i[i - 1];
-  }
-  tr_i[0] = 0;
-
-  std::ranges::fill(output_rI_.begin(), output_rI_.end(), 0);
-  output_col_.clear();
-  output_val_.clear();
-  unsigned int magic_const = ppc::util::GetPPCNumThreads();
-  std::vector<std::vector<double>> local_val(magic_const);
-  std::vector<std::vector<unsigned int>> local_col(magic_const);
-  std::vector<unsigned int> temp_r_i(A_N_, 0);
-  std::vector<std::thread> threads;
-
-  std::vector<size_t> delta(magic_const, (A_N_ - 1) / magic_const);
-  for (i = 0; i < (A_N_ - 1) % magic_const; ++i) {
-    delta[i]++;
-  }
-  for (i = 1; i < magic_const; ++i) {
-    delta[i] += delta[i - 1];
-  }
-
-  threads.emplace_back(&CrsMultiplicationSTL::MulTask, this, 0, delta[0], std::ref(local_val[0]),
-                       std::ref(local_col[0]), std::ref(temp_r_i), std::ref(tr_i), std::ref(tcol), std::ref(tval));
-  for (i = 1; i < magic_const; ++i) {
-    threads.emplace_back(&CrsMultiplicationSTL::MulTask, this, delta[i - 1], delta[i], std::ref(local_val[i]),
-                         std::ref(local_col[i]), std::ref(temp_r_i), std::ref(tr_i), std::ref(tcol), std::ref(tval));
-  }
-
-  for (auto &thread : threads) {
-    thread.join();
-  }
-
-  for (unsigned int t = 0; t < magic_const; ++t) {
-    output_val_.insert(output_val_.end(), local_val[t].begin(), local_val[t].end());
-    output_col_.insert(output_col_.end(), local_col[t].begin(), local_col[t].end());
-  }
-
-  for (i = 1; i < A_N_; ++i) {
-    output_rI_[i] += output_rI_[i - 1] + temp_r_i[i];
-  }
+  // Gustavson product by rows: only products of matching entries are computed, rows are split by their work
+  const size_t b_cols = B_Nz_ == 0 ? 0 : *std::ranges::max_element(B_col_) + 1;
+  const ppc::core::sparse::CsrView<unsigned int, double> a{A_rI_, A_col_, A_val_, B_N_ - 1};
+  const ppc::core::sparse::CsrView<unsigned int, double> b{B_rI_, B_col_, B_val_, b_cols};
+  ppc::core::sparse::CsrArrays<unsigned int, double> c;
+  ppc::core::sparse::Multiply(a, b, c, ppc::core::sparse::KeepNonZero{}, ppc::util::GetPPCNumChunks(),
+                              ppc::util::PoolFor{});
+  std::ranges::copy(c.offsets, output_rI_.begin());
+  output_col_ = std::move(c.indices);
+  output_val_ = std::move(c.values);
   return true;
 }
 
@@ -15,7 +15,6 @@ class ShellSortSTL : public ppc::core::Task {
 
  private:
   std::vector<int> input_;
-  void ShellSort();
 };
 
 }  // namespace kovalchuk_a_shell_sort_stl
\ No newline at end of file
@@ -1,12 +1,15 @@
 #include "stl/kovalchuk_a_shell_sort/include/ops_stl.hpp"
 
 #include <algorithm>
-#include <thread>
+#include <cstddef>
+#include <span>
 #include <utility>
 #include <vector>
 
-#include "../modules/core/util/include/util.hpp"
+#include "core/sort/include/shell_sort.hpp"
 #include "core/task/include/task.hpp"
+#include "core/thread_pool/include/thread_pool.hpp"
+#include "core/util/include/pool_for.hpp"
 
 namespace kovalchuk_a_shell_sort_stl {
 
@@ -24,45 +27,11 @@ bool ShellSortSTL::ValidationImpl() {
 }
 
 bool ShellSortSTL::RunImpl() {
-  ShellSort();
+  const auto num_chunks = static_cast<std::size_t>(ppc::core::ThreadPool::Instance().NumThreads()) * 4;
+  ppc::core::sort::ShellSort(std::span<int>(input_), num_chunks, ppc::util::PoolFor{});
   return true;
 }
 
-void ShellSortSTL::ShellSort() {
-  if (input_.empty()) {
-    return;
-  }
-
-  int n = static_cast<int>(input_.size());
-  for (int gap = n / 2; gap > 0; gap /= 2) {
-    int num_threads = std::min(ppc::util::GetPPCNumThreads(), gap);
-    std::vector<std::thread> threads;
-    threads.reserve(num_threads);
-
-    for (int t = 0; t < num_threads; ++t) {
-      threads.emplace_back([&, t, num_threads, gap]() {
-        for (int k = t; k < gap; k += num_threads) {
-          for (int i = k + gap; i < n; i += gap) {
-            int temp = input_[i];
-            int j = i;
-            while (j >= gap && input_[j - gap] > temp) {
-              input_[j] = input_[j - gap];
-              j -= gap;
-            }
-            input_[j] = temp;
-          }
-        }
-      });
-    }
-
-    for (auto& thread : threads) {
-      if (thread.joinable()) {
-        thread.join();
-      }
-    }
-  }
-}
-
 bool ShellSortSTL::PostProcessingImpl() {
   auto* output_ptr = reinterpret_cast<int*>(task_data->outputs[0]);
   std::ranges::copy(input_, output_ptr);
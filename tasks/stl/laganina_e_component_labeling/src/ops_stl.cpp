@@ -2,12 +2,11 @@
 
 #include <algorithm>
 #include <atomic>
+#include <cstddef>
 #include <functional>
-#include <future>
-#include <thread>
 #include <vector>
 
-#include "core/util/include/util.hpp"
+#include "core/thread_pool/include/thread_pool.hpp"
 
 namespace {
 int CountRootsInChunk(const std::vector<int>& parent, int start, int end) {
@@ -69,52 +68,31 @@ bool laganina_e_component_labeling_stl::TestTaskSTL::PostProcessingImpl() {
 }
 
 void laganina_e_component_labeling_stl::TestTaskSTL::InitializeParents(std::vector<int>& parent) {
-  const int size = m_ * n_;
-  int num_threads = std::min(ppc::util::GetPPCNumThreads(), static_cast<int>(std::thread::hardware_concurrency()));
-  const int chunk_size = (size + num_threads - 1) / num_threads;
-
-  std::vector<std::thread> threads;
-  for (int t = 0; t < num_threads; ++t) {
-    const int start = t * chunk_size;
-    const int end = std::min(start + chunk_size, size);
-
-    threads.emplace_back([&, start, end] {
-      for (int i = start; i < end; ++i) {
-        parent[i] = binary_[i] ? i : -1;
-      }
-    });
-  }
-
-  for (auto& t : threads) {
-    t.join();
-  }
+  ppc::core::ParallelFor(0, static_cast<size_t>(m_ * n_), [&](size_t begin, size_t end) {
+    for (auto i = static_cast<int>(begin); i < static_cast<int>(end); ++i) {
+      parent[i] = binary_[i] ? i : -1;
+    }
+  });
 }
 
 void laganina_e_component_labeling_stl::TestTaskSTL::ProcessSweep(bool reverse, std::vector<int>& parent,
                                                                   bool& changed) const {
-  int num_threads = std::min(ppc::util::GetPPCNumThreads(), static_cast<int>(std::thread::hardware_concurrency()));
-  const int chunk_size = (m_ + num_threads - 1) / num_threads;
+  auto& pool = ppc::core::ThreadPool::Instance();
+  const auto chunk_size = static_cast<size_t>((m_ + pool.NumThreads() - 1) / pool.NumThreads());
   std::atomic<bool> global_changed(false);
 
-  std::vector<std::thread> threads;
-  for (int t = 0; t < num_threads; ++t) {
-    const int start = t * chunk_size;
-    const int end = std::min(start + chunk_size, m_);
-
-    threads.emplace_back([&, start, end] {
-      bool local_changed = false;
-      for (int row_idx = start; row_idx < end; ++row_idx) {
-        local_changed |= ProcessRow(row_idx, reverse, parent);
-      }
-      if (local_changed) {
-        global_changed = true;
-      }
-    });
-  }
-
-  for (auto& t : threads) {
-    t.join();
-  }
+  ppc::core::ParallelFor(
+      0, static_cast<size_t>(m_),
+      [&](size_t start, size_t end) {
+        bool local_changed = false;
+        for (auto row_idx = static_cast<int>(start); row_idx < static_cast<int>(end); ++row_idx) {
+          local_changed |= ProcessRow(row_idx, reverse, parent);
+        }
+        if (local_changed) {
+          global_changed = true;
+        }
+      },
+      chunk_size, pool);
   changed = global_changed.load();
 }
 
@@ -183,81 +161,39 @@ bool laganina_e_component_labeling_stl::TestTaskSTL::UnionNodes(int a, int b, st
 }
 
 void laganina_e_component_labeling_stl::TestTaskSTL::FinalizeRoots(std::vector<int>& parent) const {
-  const int size = m_ * n_;
-  int num_threads = std::min(ppc::util::GetPPCNumThreads(), static_cast<int>(std::thread::hardware_concurrency()));
-  const int chunk_size = (size + num_threads - 1) / num_threads;
-
-  std::vector<std::thread> threads;
-  for (int t = 0; t < num_threads; ++t) {
-    const int start = t * chunk_size;
-    const int end = std::min(start + chunk_size, size);
-
-    threads.emplace_back([&, start, end] {
-      for (int i = start; i < end; ++i) {
-        if (parent[i] != -1) {
-          parent[i] = FindRoot(parent, i);
-        }
+  ppc::core::ParallelFor(0, static_cast<size_t>(m_ * n_), [&](size_t begin, size_t end) {
+    for (auto i = static_cast<int>(begin); i < static_cast<int>(end); ++i) {
+      if (parent[i] != -1) {
+        parent[i] = FindRoot(parent, i);
       }
-    });
-  }
-
-  for (auto& t : threads) {
-    t.join();
-  }
+    }
+  });
 }
 
 void laganina_e_component_labeling_stl::TestTaskSTL::AssignLabels(std::vector<int>& parent) {
   const int size = m_ * n_;
-  int num_threads = std::min(ppc::util::GetPPCNumThreads(), static_cast<int>(std::thread::hardware_concurrency()));
+  const int num_chunks = ppc::core::ThreadPool::Instance().NumThreads();
   std::vector<int> labels(size + 1, 0);
-  const int chunk_size = (size + num_threads - 1) / num_threads;
-
-  std::vector<int> root_counts(num_threads + 1, 0);
-  {
-    std::vector<std::future<int>> count_futures;
-    for (int t = 0; t < num_threads; ++t) {
-      const int start = t * chunk_size;
-      const int end = std::min(start + chunk_size, size);
-      count_futures.push_back(std::async(std::launch::async, CountRootsInChunk, std::cref(parent), start, end));
-    }
-
-    for (int t = 0; t < num_threads; ++t) {
-      root_counts[t + 1] = count_futures[t].get();
-    }
-
-    for (int t = 1; t <= num_threads; ++t) {
-      root_counts[t] += root_counts[t - 1];
-    }
-  }
-
-  {
-    std::vector<std::future<void>> label_futures;
-    for (int t = 0; t < num_threads; ++t) {
-      const int start = t * chunk_size;
-      const int end = std::min(start + chunk_size, size);
-      const int label_start = root_counts[t];
-      label_futures.push_back(std::async(std::launch::async, LabelRootsInChunk, std::ref(labels), std::cref(parent),
-                                         start, end, label_start));
-    }
+  const int chunk_size = (size + num_chunks - 1) / num_chunks;
+
+  // the same chunks are used by all phases, so labels of roots are numbered in order of chunks
+  auto for_each_chunk = [&](const std::function<void(int, int, int)>& func) {
+    ppc::core::ParallelFor(0, static_cast<size_t>(num_chunks), [&](size_t first, size_t last) {
+      for (auto t = static_cast<int>(first); t < static_cast<int>(last); ++t) {
+        const int start = std::min(t * chunk_size, size);
+        func(t, start, std::min(start + chunk_size, size));
+      }
+    });
+  };
 
-    for (auto& f : label_futures) {
-      f.wait();
-    }
+  std::vector<int> root_counts(num_chunks + 1, 0);
+  for_each_chunk([&](int t, int start, int end) { root_counts[t + 1] = CountRootsInChunk(parent, start, end); });
+  for (int t = 1; t <= num_chunks; ++t) {
+    root_counts[t] += root_counts[t - 1];
   }
 
-  {
-    std::vector<std::future<void>> propagate_futures;
-    for (int t = 0; t < num_threads; ++t) {
-      const int start = t * chunk_size;
-      const int end = std::min(start + chunk_size, size);
-      propagate_futures.push_back(std::async(std::launch::async, PropagateLabelsInChunk, std::ref(binary_),
-                                             std::cref(labels), std::cref(parent), start, end));
-    }
-
-    for (auto& f : propagate_futures) {
-      f.wait();
-    }
-  }
+  for_each_chunk([&](int t, int start, int end) { LabelRootsInChunk(labels, parent, start, end, root_counts[t]); });
+  for_each_chunk([&](int, int start, int end) { PropagateLabelsInChunk(binary_, labels, parent, start, end); });
 }
 
 void laganina_e_component_labeling_stl::TestTaskSTL::LabelConnectedComponents() {
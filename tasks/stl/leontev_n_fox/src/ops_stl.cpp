@@ -6,47 +6,29 @@
 #include <thread>
 #include <vector>
 
+#include "core/gemm/include/gemm.hpp"
 #include "core/util/include/util.hpp"
 
 namespace leontev_n_fox_stl {
 
-double FoxSTL::AtA(size_t i, size_t j) const {
-  if (i >= n_ || j >= n_) {
-    return 0.0;
-  }
-  return input_a_[(i * n_) + j];
-}
-
-double FoxSTL::AtB(size_t i, size_t j) const {
-  if (i >= n_ || j >= n_) {
-    return 0.0;
-  }
-  return input_b_[(i * n_) + j];
-}
-
 std::vector<double> MatMul(std::vector<double>& a, std::vector<double>& b, size_t n) {
-  std::vector<double> res(n * n, 0.0);
-  for (size_t j = 0; j < n; j++) {
-    for (size_t i = 0; i < n; i++) {
-      for (size_t l = 0; l < n; l++) {
-        res[(i * n) + j] += a[(i * n) + l] * b[(l * n) + j];
-      }
-    }
-  }
+  std::vector<double> res(n * n);
+  ppc::core::gemm::Multiply(a, b, res, n, n, n);
   return res;
 }
 
 void FoxSTL::MatMulBlocks(size_t a_pos_x, size_t a_pos_y, size_t b_pos_x, size_t b_pos_y, size_t c_pos_x,
                           size_t c_pos_y, size_t size) {
-  size_t row_max = (n_ >= c_pos_y) ? (n_ - c_pos_y) : 0;
-  size_t col_max = (n_ >= c_pos_x) ? (n_ - c_pos_x) : 0;
-  for (size_t j = 0; j < std::min(size, col_max); j++) {
-    for (size_t i = 0; i < std::min(size, row_max); i++) {
-      for (size_t l = 0; l < size; l++) {
-        output_[((i + c_pos_y) * n_) + (j + c_pos_x)] += AtA(i + a_pos_y, l + a_pos_x) * AtB(l + b_pos_y, j + b_pos_x);
-      }
-    }
+  // blocks of the last block row and column are cut at the border of the matrices
+  auto extent = [&](size_t pos) { return pos < n_ ? std::min(size, n_ - pos) : size_t{0}; };
+  const size_t rows = extent(c_pos_y);
+  const size_t cols = extent(c_pos_x);
+  const size_t inner = extent(a_pos_x);
+  if (rows == 0 || cols == 0 || inner == 0) {
+    return;
   }
+  ppc::core::gemm::Gemm(rows, cols, inner, input_a_.data() + (a_pos_y * n_) + a_pos_x, n_,
+                        input_b_.data() + (b_pos_y * n_) + b_pos_x, n_, output_.data() + (c_pos_y * n_) + c_pos_x, n_);
 }
 
 bool FoxSTL::PreProcessingImpl() {
@@ -1,6 +1,10 @@
 #include <gtest/gtest.h>
 
+#include "core/perf/include/thread_sweep.hpp"
+
 int main(int argc, char **argv) {
   ::testing::InitGoogleTest(&argc, argv);
+  // STL tasks read the thread count from ppc::util::GetPPCNumThreads() which is set by the sweep
+  ppc::core::ThreadSweep::Enable({});
   return RUN_ALL_TESTS();
 }
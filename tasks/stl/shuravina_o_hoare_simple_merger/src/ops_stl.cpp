@@ -3,12 +3,17 @@
 #include <algorithm>
 #include <atomic>
 #include <core/util/include/util.hpp>
+#include <cstddef>
 #include <future>
 #include <memory>
+#include <span>
 #include <utility>
 #include <vector>
 
+#include "core/sort/include/quick_sort.hpp"
 #include "core/task/include/task.hpp"
+#include "core/thread_pool/include/thread_pool.hpp"
+#include "core/util/include/pool_for.hpp"
 
 namespace shuravina_o_hoare_simple_merger {
 
@@ -34,33 +39,6 @@ bool TestTaskSTL::PreProcessingImpl() {
   return true;
 }
 
-void TestTaskSTL::QuickSort(std::vector<int>& arr, int left, int right) {
-  if (left >= right) {
-    return;
-  }
-
-  int pivot = arr[(left + right) / 2];
-  int i = left;
-  int j = right;
-
-  while (i <= j) {
-    while (arr[i] < pivot) {
-      i++;
-    }
-    while (arr[j] > pivot) {
-      j--;
-    }
-    if (i <= j) {
-      std::swap(arr[i], arr[j]);
-      i++;
-      j--;
-    }
-  }
-
-  QuickSort(arr, left, j);
-  QuickSort(arr, i, right);
-}
-
 void TestTaskSTL::MergeHelper(std::vector<int>& arr, int left, int mid, int right) {
   std::vector<int> temp(right - left + 1);
   const int parallel_threshold = 10000;
@@ -120,7 +98,8 @@ bool TestTaskSTL::RunImpl() {
   }
 
   const int size = static_cast<int>(input_.size());
-  QuickSort(input_, 0, size - 1);
+  const auto num_threads = static_cast<size_t>(ppc::core::ThreadPool::Instance().NumThreads());
+  ppc::core::sort::QuickSort(std::span<int>(input_), 4 * num_threads, ppc::util::PoolFor{});
   MergeHelper(input_, 0, (size / 2) - 1, size - 1);
   output_ = input_;
   return true;
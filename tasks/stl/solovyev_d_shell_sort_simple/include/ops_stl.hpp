@@ -17,7 +17,6 @@ class TaskSTL : public ppc::core::Task {
 
  private:
   std::vector<int> input_;
-  int num_threads_ = 0;
 };
 
 }  // namespace solovyev_d_shell_sort_simple_stl
\ No newline at end of file
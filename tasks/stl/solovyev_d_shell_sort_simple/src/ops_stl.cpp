@@ -1,13 +1,12 @@
 #include "stl/solovyev_d_shell_sort_simple/include/ops_stl.hpp"
 
-#include <algorithm>
-#include <barrier>
-#include <cmath>
 #include <cstddef>
-#include <thread>
+#include <span>
 #include <vector>
 
-#include "core/util/include/util.hpp"
+#include "core/sort/include/shell_sort.hpp"
+#include "core/thread_pool/include/thread_pool.hpp"
+#include "core/util/include/pool_for.hpp"
 
 bool solovyev_d_shell_sort_simple_stl::TaskSTL::PreProcessingImpl() {
   size_t input_size = task_data->inputs_count[0];
@@ -22,33 +21,8 @@ bool solovyev_d_shell_sort_simple_stl::TaskSTL::ValidationImpl() {
 }
 
 bool solovyev_d_shell_sort_simple_stl::TaskSTL::RunImpl() {
-  num_threads_ = std::max(1, ppc::util::GetPPCNumThreads());
-  std::barrier sync_point(num_threads_);
-
-  std::vector<std::thread> threads(num_threads_);
-  for (int t = 0; t < num_threads_; ++t) {
-    threads[t] = std::thread([&, t] {
-      for (int gap = static_cast<int>(input_.size()) / 2; gap > 0; gap /= 2) {
-        sync_point.arrive_and_wait();
-        for (int i = t; i < gap; i += num_threads_) {
-          for (size_t f = i + gap; f < input_.size(); f += gap) {
-            int val = input_[f];
-            size_t j = f;
-            while (j >= static_cast<size_t>(gap) && input_[j - gap] > val) {
-              input_[j] = input_[j - gap];
-              j -= gap;
-            }
-            input_[j] = val;
-          }
-        }
-      }
-    });
-  }
-  for (auto &th : threads) {
-    if (th.joinable()) {
-      th.join();
-    }
-  }
+  const auto num_chunks = static_cast<std::size_t>(ppc::core::ThreadPool::Instance().NumThreads()) * 4;
+  ppc::core::sort::ShellSort(std::span<int>(input_), num_chunks, ppc::util::PoolFor{});
   return true;
 }
 
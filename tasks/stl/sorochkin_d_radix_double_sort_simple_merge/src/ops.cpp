@@ -1,68 +1,18 @@
 #include "../include/ops.hpp"
 
 #include <algorithm>
-#include <array>
-#include <climits>
 #include <cmath>
 #include <cstddef>
-#include <cstdint>
 #include <numeric>
-#include <ranges>
 #include <span>
 #include <thread>
 #include <vector>
 
+#include "core/sort/include/merge.hpp"
+#include "core/sort/include/msd_radix_sort.hpp"
+#include "core/util/include/pool_for.hpp"
 #include "core/util/include/util.hpp"
 
-namespace {
-template <typename T>
-constexpr size_t Bytes() {
-  return sizeof(T);
-}
-template <typename T>
-constexpr size_t Bits() {
-  return Bytes<T>() * CHAR_BIT;
-}
-class Bitutil {
- private:
-  union du64 {
-    double d;
-    uint64_t u;
-    static constexpr uint64_t kMask = 1ULL << ((sizeof(uint64_t) * CHAR_BIT) - 1);
-  };
-
- public:
-  static constexpr uint64_t AsU64(double x) {
-    const du64 r{.d = x};
-    return ((r.u & du64::kMask) != 0U) ? ~r.u : r.u | du64::kMask;
-  }
-
-  template <typename T>
-    requires std::is_floating_point_v<T> or std::is_integral_v<T>
-  static constexpr uint8_t ByteAt(const T &val, uint8_t idx) {
-    return (val >> (idx * 8)) & 0xFF;
-  }
-};
-
-void RadixSort(std::span<double> v) {
-  constexpr size_t kBase = 1 << CHAR_BIT;
-
-  std::vector<double> aux_buf(v.size());
-  std::span<double> aux{aux_buf};
-
-  std::array<std::size_t, kBase> count;
-
-  for (std::size_t ib = 0; ib < Bytes<double>(); ++ib) {
-    std::ranges::fill(count, 0);
-    std::ranges::for_each(v, [&](auto el) { ++count[Bitutil::ByteAt(Bitutil::AsU64(el), ib)]; });
-    std::partial_sum(count.begin(), count.end(), count.begin());
-    std::ranges::for_each(std::ranges::reverse_view(v),
-                          [&](auto el) { aux[--count[Bitutil::ByteAt(Bitutil::AsU64(el), ib)]] = el; });
-    std::swap(v, aux);
-  }
-}
-}  // namespace
-
 bool sorochkin_d_radix_double_sort_simple_merge_stl::SortTask::ValidationImpl() {
   return task_data->inputs_count[0] == task_data->outputs_count[0];
 }
@@ -71,6 +21,7 @@ bool sorochkin_d_radix_double_sort_simple_merge_stl::SortTask::PreProcessingImpl
   std::span<double> src = {reinterpret_cast<double *>(task_data->inputs[0]), task_data->inputs_count[0]};
   input_.assign(src.begin(), src.end());
   output_.reserve(input_.size());
+  buffer_.resize(input_.size());
   return true;
 }
 
@@ -97,36 +48,15 @@ bool sorochkin_d_radix_double_sort_simple_merge_stl::SortTask::RunImpl() {
   });
 
   std::vector<std::thread> threads(numthreads);
-  std::ranges::generate(threads,
-                        [&, i = 0]() mutable { return std::thread([chunk = chunks[i++]] { RadixSort(chunk); }); });
+  std::ranges::generate(threads, [&, i = 0]() mutable {
+    return std::thread([chunk = chunks[i++]] { ppc::core::sort::MsdRadixSort(chunk); });
+  });
   std::ranges::for_each(threads, [](auto &thread) { thread.join(); });
 
-  for (std::size_t i = 1, j = numthreads; j > 1; i *= 2, j /= 2) {
-    const auto multithreaded = chunks.front().size() > 48;
-    const auto jh = j / 2;
-    const auto merge = [&](std::span<double> &master, std::span<double> &slave) {
-      std::inplace_merge(master.begin(), slave.begin(), slave.end());
-      master = std::span{master.begin(), slave.end()};
-    };
-    const auto run = [&](std::size_t begin, std::size_t end) {
-      for (std::size_t k = begin; k < end; ++k) {
-        const auto idx = 2 * i * k;
-        merge(chunks[idx], chunks[idx + i]);
-      }
-    };
-    if (multithreaded) {
-      threads.resize(jh);
-      std::ranges::generate(threads, [&, i = 0]() mutable { return std::thread([&](int j) { run(j, j + 1); }, i); });
-      std::ranges::for_each(threads, [](auto &thread) { thread.join(); });
-    } else {
-      run(0, jh);
-    }
-    if (jh == 1) {
-      merge(chunks.front(), chunks.back());
-    } else if (jh % 2 != 0) {
-      merge(chunks[2 * i * (jh - 2)], chunks[2 * i * (jh - 1)]);
-    }
-  }
+  // the sorted chunks merged in rounds between output_ and buffer_, every merge split over all threads
+  offsets.push_back(size);
+  ppc::core::sort::MergeRuns(std::span<double>(output_), std::span<const std::size_t>(offsets),
+                             std::span<double>(buffer_), 4 * numthreads, ppc::util::PoolFor{});
 
   return true;
 }
@@ -1,116 +1,29 @@
 #include "stl/sorokin_a_multiplication_sparse_matrices_double_ccs/include/ops_stl.hpp"
 
 #include <algorithm>
-#include <atomic>
-#include <cmath>
 #include <cstddef>
-#include <thread>
+#include <utility>
 #include <vector>
 
+#include "core/sparse/include/spgemm.hpp"
+#include "core/util/include/pool_for.hpp"
 #include "core/util/include/util.hpp"
 
 namespace sorokin_a_multiplication_sparse_matrices_double_ccs_stl {
 
-void ProcessFirstPass(int j, int m, const std::vector<int>& a_col_ptr, const std::vector<int>& a_row_indices,
-                      const std::vector<int>& b_col_ptr, const std::vector<int>& b_row_indices,
-                      std::vector<int>& col_sizes) {
-  std::vector<char> temp_used(m, 0);
-  for (int t = b_col_ptr[j]; t < b_col_ptr[j + 1]; ++t) {
-    const int row_b = b_row_indices[t];
-    for (int i = a_col_ptr[row_b]; i < a_col_ptr[row_b + 1]; ++i) {
-      const int row_a = a_row_indices[i];
-      if (temp_used[row_a] == 0) {
-        temp_used[row_a] = 1;
-        col_sizes[j]++;
-      }
-    }
-  }
-}
-
-void ProcessSecondPass(int j, int m, const std::vector<int>& a_col_ptr, const std::vector<int>& a_row_indices,
-                       const std::vector<double>& a_values, const std::vector<int>& b_col_ptr,
-                       const std::vector<int>& b_row_indices, const std::vector<double>& b_values,
-                       const std::vector<int>& c_col_ptr, std::vector<int>& c_row_indices,
-                       std::vector<double>& c_values) {
-  std::vector<double> temp_values(m, 0.0);
-  std::vector<char> temp_used(m, 0);
-
-  for (int t = b_col_ptr[j]; t < b_col_ptr[j + 1]; ++t) {
-    const int row_b = b_row_indices[t];
-    const double val_b = b_values[t];
-    for (int i = a_col_ptr[row_b]; i < a_col_ptr[row_b + 1]; ++i) {
-      const int row_a = a_row_indices[i];
-      temp_values[row_a] += a_values[i] * val_b;
-      temp_used[row_a] = 1;
-    }
-  }
-
-  int pos = c_col_ptr[j];
-  for (int i = 0; i < m; ++i) {
-    if (temp_used[i] != 0) {
-      c_row_indices[pos] = i;
-      c_values[pos] = temp_values[i];
-      pos++;
-    }
-  }
-}
-
 void MultiplyCCS(const std::vector<double>& a_values, const std::vector<int>& a_row_indices, int m,
                  const std::vector<int>& a_col_ptr, const std::vector<double>& b_values,
                  const std::vector<int>& b_row_indices, int k, const std::vector<int>& b_col_ptr,
                  std::vector<double>& c_values, std::vector<int>& c_row_indices, int n, std::vector<int>& c_col_ptr) {
-  c_col_ptr.resize(n + 1);
-  c_col_ptr[0] = 0;
-  std::vector<int> col_sizes(n, 0);
-
-  int num_threads = ppc::util::GetPPCNumThreads();
-  num_threads = std::min(num_threads, n);
-
-  std::vector<std::thread> threads;
-  std::atomic<int> next_j(0);
-
-  auto first_pass_worker = [&]() {
-    int j = 0;
-    while ((j = next_j.fetch_add(1, std::memory_order_relaxed)) < n) {
-      ProcessFirstPass(j, m, a_col_ptr, a_row_indices, b_col_ptr, b_row_indices, col_sizes);
-    }
-  };
-
-  threads.reserve(num_threads);
-  for (int t = 0; t < num_threads; ++t) {
-    threads.emplace_back(first_pass_worker);
-  }
-
-  for (auto& thread : threads) {
-    thread.join();
-  }
-
-  for (int j = 0; j < n; ++j) {
-    c_col_ptr[j + 1] = c_col_ptr[j] + col_sizes[j];
-  }
-
-  const int total_non_zero = c_col_ptr[n];
-  c_values.resize(total_non_zero);
-  c_row_indices.resize(total_non_zero);
-
-  threads.clear();
-  next_j.store(0);
-
-  auto second_pass_worker = [&]() {
-    int j = 0;
-    while ((j = next_j.fetch_add(1, std::memory_order_relaxed)) < n) {
-      ProcessSecondPass(j, m, a_col_ptr, a_row_indices, a_values, b_col_ptr, b_row_indices, b_values, c_col_ptr,
-                        c_row_indices, c_values);
-    }
-  };
-
-  for (int t = 0; t < num_threads; ++t) {
-    threads.emplace_back(second_pass_worker);
-  }
-
-  for (auto& thread : threads) {
-    thread.join();
-  }
+  // CCS arrays of a matrix are the CSR arrays of its transpose, and (A * B)^T = B^T * A^T
+  const ppc::core::sparse::CsrView<int, double> b{b_col_ptr, b_row_indices, b_values, static_cast<size_t>(k)};
+  const ppc::core::sparse::CsrView<int, double> a{a_col_ptr, a_row_indices, a_values, static_cast<size_t>(m)};
+  ppc::core::sparse::CsrArrays<int, double> c;
+  ppc::core::sparse::Multiply(b, a, c, ppc::core::sparse::KeepAll{}, ppc::util::GetPPCNumChunks(),
+                              ppc::util::PoolFor{});
+  c_values = std::move(c.values);
+  c_row_indices = std::move(c.indices);
+  c_col_ptr = std::move(c.offsets);
 }
 
 }  // namespace sorokin_a_multiplication_sparse_matrices_double_ccs_stl
@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 
 #include <algorithm>
+#include <array>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
@@ -178,3 +179,29 @@ TEST(trubin_a_algorithm_dijkstra_stl, cycle_with_shortcut_graph) {
   std::vector<int> graph = {1, 1, 2, 5, -1, 2, 1, -1, 0, 1, -1};
   RunDijkstraTest(graph, 0, 3, {0, 1, 2});
 }
+
+TEST(trubin_a_algorithm_dijkstra_stl, batched_sources_match_single_source) {
+  const size_t num_vertices = 100;
+  auto graph = GenerateRandomGraph(num_vertices, 4, 20);
+  std::vector<int> sources = {0, 3, 99, 50, 3, 17, 64, 8, 31, 72, 45};
+  std::vector<int> out(sources.size() * num_vertices, -42);
+
+  auto task_data_stl = std::make_shared<ppc::core::TaskData>();
+  task_data_stl->inputs.emplace_back(reinterpret_cast<uint8_t*>(graph.data()));
+  task_data_stl->inputs_count.emplace_back(graph.size());
+  task_data_stl->inputs.emplace_back(reinterpret_cast<uint8_t*>(sources.data()));
+  task_data_stl->inputs_count.emplace_back(sources.size());
+  task_data_stl->AddOutput(out.data(), std::array<uint64_t, 2>{sources.size(), num_vertices});
+
+  trubin_a_algorithm_dijkstra_stl::TestTaskSTL task(task_data_stl);
+  ASSERT_TRUE(task.Validation());
+  ASSERT_TRUE(task.PreProcessing());
+  ASSERT_TRUE(task.Run());
+  ASSERT_TRUE(task.PostProcessing());
+
+  for (size_t k = 0; k < sources.size(); ++k) {
+    std::vector<int> row(out.begin() + static_cast<std::ptrdiff_t>(k * num_vertices),
+                         out.begin() + static_cast<std::ptrdiff_t>((k + 1) * num_vertices));
+    RunDijkstraTest(graph, sources[k], num_vertices, row);
+  }
+}
@@ -3,40 +3,29 @@
 #include <algorithm>
 #include <cmath>
 #include <complex>
+#include <cstddef>
 #include <cstdint>
 #include <cstdio>
+#include <span>
 #include <thread>
 #include <tuple>
 #include <vector>
 
+#include "core/sparse/include/complex_kernels.hpp"
 #include "core/util/include/util.hpp"
 
 namespace {
-MatrixCRS TransposeMatrixCRS(const MatrixCRS &crs) {
-  const auto new_cols = crs.GetRows();
-
-  MatrixCRS res;
-  res.cols_count = new_cols;
-  res.rowptr.resize(crs.GetCols() + 2);
-  res.colind.resize(crs.colind.size(), 0);
-  res.data.resize(crs.data.size(), 0);
-
-  for (uint32_t i = 0; i < crs.data.size(); ++i) {
-    ++res.rowptr[crs.colind[i] + 2];
-  }
-  for (uint32_t i = 2; i < res.rowptr.size(); ++i) {
-    res.rowptr[i] += res.rowptr[i - 1];
+// row i of lhs * rhs: rows k of rhs scaled by lhs(i, k) are summed in acc, its non-zero entries go to out
+void MultiplyRow(const MatrixCRS &lhs, uint32_t i, const MatrixCRS &rhs,
+                 const ppc::core::sparse::SplitComplex &rhs_data, ppc::core::sparse::ComplexAccumulator &acc,
+                 std::vector<std::tuple<std::complex<double>, uint32_t>> &out) {
+  for (uint32_t e = lhs.rowptr[i]; e < lhs.rowptr[i + 1]; ++e) {
+    const auto k = lhs.colind[e];
+    const std::span<const uint32_t> cols(rhs.colind.data() + rhs.rowptr[k], rhs.rowptr[k + 1] - rhs.rowptr[k]);
+    ppc::core::sparse::ScatterMultiplyAdd(cols, rhs_data, rhs.rowptr[k], lhs.data[e], acc);
   }
-  for (uint32_t i = 0; i < new_cols; ++i) {
-    for (uint32_t j = crs.rowptr[i]; j < crs.rowptr[i + 1]; ++j) {
-      const auto new_index = res.rowptr[crs.colind[j] + 1]++;
-      res.data[new_index] = crs.data[j];
-      res.colind[new_index] = i;
-    }
-  }
-  res.rowptr.pop_back();
-
-  return res;
+  ppc::core::sparse::DrainNonZero(
+      acc, 0.0, [&](size_t j, std::complex<double> summul) { out.emplace_back(summul, static_cast<uint32_t>(j)); });
 }
 }  // namespace
 
@@ -49,16 +38,16 @@ bool tyurin_m_matmul_crs_complex_stl::TestTaskStl::ValidationImpl() {
 
 bool tyurin_m_matmul_crs_complex_stl::TestTaskStl::PreProcessingImpl() {
   lhs_ = *reinterpret_cast<MatrixCRS *>(task_data->inputs[0]);
-  rhs_ = TransposeMatrixCRS(*reinterpret_cast<MatrixCRS *>(task_data->inputs[1]));
+  rhs_ = *reinterpret_cast<MatrixCRS *>(task_data->inputs[1]);
   res_ = {};
   res_.rowptr.resize(lhs_.GetRows() + 1);
-  res_.cols_count = rhs_.GetRows();
+  res_.cols_count = rhs_.GetCols();
   return true;
 }
 
-bool tyurin_m_matmul_crs_complex_stl::TestTaskStl::RunImpl() {  // NOLINT(readability-function-cognitive-complexity)
+bool tyurin_m_matmul_crs_complex_stl::TestTaskStl::RunImpl() {
   const auto rows = lhs_.GetRows();
-  const auto cols = rhs_.GetRows();
+  const ppc::core::sparse::SplitComplex rhs_data(rhs_.data);
 
   std::vector<std::vector<std::tuple<std::complex<double>, uint32_t>>> buf(rows);
 
@@ -72,24 +61,9 @@ bool tyurin_m_matmul_crs_complex_stl::TestTaskStl::RunImpl() {  // NOLINT(readab
     uint32_t forthread = avg + ((t < nextra) ? 1 : 0);
     threads[t] = std::thread(
         [&](uint32_t thread_rows_begin, uint32_t thread_rows_end) {
+          ppc::core::sparse::ComplexAccumulator acc(rhs_.GetCols());
           for (uint32_t i = thread_rows_begin; i < thread_rows_end; ++i) {
-            for (uint32_t j = 0; j < cols; ++j) {
-              auto ii = lhs_.rowptr[i];
-              auto ij = rhs_.rowptr[j];
-              std::complex<double> summul = 0.0;
-              while (ii < lhs_.rowptr[i + 1] && ij < rhs_.rowptr[j + 1]) {
-                if (lhs_.colind[ii] < rhs_.colind[ij]) {
-                  ++ii;
-                } else if (lhs_.colind[ii] > rhs_.colind[ij]) {
-                  ++ij;
-                } else {
-                  summul += lhs_.data[ii++] * rhs_.data[ij++];
-                }
-              }
-              if (summul != 0.0) {
-                buf[i].emplace_back(summul, j);
-              }
-            }
+            MultiplyRow(lhs_, i, rhs_, rhs_data, acc, buf[i]);
           }
         },
         cur, cur + forthread);
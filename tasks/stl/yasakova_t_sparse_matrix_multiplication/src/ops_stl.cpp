@@ -2,12 +2,15 @@
 
 #include <cmath>
 #include <complex>
-#include <core/util/include/util.hpp>
 #include <cstddef>
 #include <iostream>
-#include <thread>
+#include <utility>
 #include <vector>
 
+#include "core/sparse/include/spgemm.hpp"
+#include "core/util/include/pool_for.hpp"
+#include "core/util/include/util.hpp"
+
 void yasakova_t_sparse_matrix_multiplication_stl::CompressedRowStorage::InsertElement(int row_idx,
                                                                                       std::complex<double> val,
                                                                                       int col_idx) {
@@ -144,50 +147,22 @@ bool yasakova_t_sparse_matrix_multiplication_stl::SparseMatrixMultiTask::Validat
 }
 
 bool yasakova_t_sparse_matrix_multiplication_stl::SparseMatrixMultiTask::RunImpl() {
-  CompressedRowStorage expected_result(firstMatrix_.rowCount, secondMatrix_.columnCount);
-  const int num_threads = ppc::util::GetPPCNumThreads();
-  std::vector<std::thread> threads(num_threads);
-  std::vector<CompressedRowStorage> thread_results(
-      num_threads, CompressedRowStorage(firstMatrix_.rowCount, secondMatrix_.columnCount));
-
-  auto multiply_task = [&](unsigned int start_row, unsigned int end_row, int thread_index) {
-    CompressedRowStorage local_result(firstMatrix_.rowCount, secondMatrix_.columnCount);
-    for (unsigned int i = start_row; i < end_row; ++i) {
-      for (unsigned int j = firstMatrix_.rowPointers[i]; j < (unsigned int)firstMatrix_.rowPointers[i + 1]; ++j) {
-        unsigned int col_a = firstMatrix_.columnIndices[j];
-        std::complex<double> value_a = firstMatrix_.nonZeroValues[j];
-        for (unsigned int k = secondMatrix_.rowPointers[col_a]; k < (unsigned int)secondMatrix_.rowPointers[col_a + 1];
-             ++k) {
-          unsigned int col_b = secondMatrix_.columnIndices[k];
-          std::complex<double> value_b = secondMatrix_.nonZeroValues[k];
-
-          local_result.InsertElement((int)i, value_a * value_b, (int)col_b);
-        }
-      }
-    }
-    thread_results[thread_index] = local_result;
-  };
-
-  unsigned int rows_per_thread = firstMatrix_.rowCount / num_threads;
-  for (int t = 0; t < num_threads; ++t) {
-    unsigned int start_row = t * rows_per_thread;
-    unsigned int end_row = (t == num_threads - 1) ? firstMatrix_.rowCount : start_row + rows_per_thread;
-    threads[t] = std::thread(multiply_task, start_row, end_row, t);
-  }
-
-  for (auto& thread : threads) {
-    thread.join();
-  }
-
-  for (const auto& local_result : thread_results) {
-    for (unsigned int i = 0; i < (unsigned int)local_result.rowCount; ++i) {
-      for (unsigned int j = local_result.rowPointers[i]; j < (unsigned int)local_result.rowPointers[i + 1]; ++j) {
-        expected_result.InsertElement((int)i, local_result.nonZeroValues[j], local_result.columnIndices[j]);
-      }
-    }
-  }
+  // Gustavson product by rows, entries with terms are kept even if they sum to zero
+  const ppc::core::sparse::CsrView<int, std::complex<double>> a{firstMatrix_.rowPointers, firstMatrix_.columnIndices,
+                                                                firstMatrix_.nonZeroValues,
+                                                                static_cast<size_t>(firstMatrix_.columnCount)};
+  const ppc::core::sparse::CsrView<int, std::complex<double>> b{secondMatrix_.rowPointers, secondMatrix_.columnIndices,
+                                                                secondMatrix_.nonZeroValues,
+                                                                static_cast<size_t>(secondMatrix_.columnCount)};
+  ppc::core::sparse::CsrArrays<int, std::complex<double>> product;
+  ppc::core::sparse::Multiply(a, b, product, ppc::core::sparse::KeepAll{}, ppc::util::GetPPCNumChunks(),
+                              ppc::util::PoolFor{});
 
-  resultData_ = ConvertToDense(expected_result);
+  CompressedRowStorage c(firstMatrix_.rowCount, secondMatrix_.columnCount);
+  c.nonZeroValues = std::move(product.values);
+  c.columnIndices = std::move(product.indices);
+  c.rowPointers = std::move(product.offsets);
+  resultData_ = ConvertToDense(c);
   return true;
 }
 
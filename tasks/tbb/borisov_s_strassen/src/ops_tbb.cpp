@@ -8,26 +8,17 @@
 #include <cstddef>
 #include <vector>
 
+#include "core/gemm/include/gemm.hpp"
+
 namespace borisov_s_strassen_tbb {
 
 namespace {
 
 const int kSeqThreshold = 64;
 
-std::vector<double> MultiplyNaive(const std::vector<double>& a, const std::vector<double>& b, int n) {
-  std::vector<double> c(n * n, 0.0);
-  int grain_size = std::max(1, n / 8);
-  tbb::parallel_for(tbb::blocked_range<int>(0, n, grain_size), [&](const tbb::blocked_range<int>& r) {
-    for (int i = r.begin(); i < r.end(); ++i) {
-      for (int j = 0; j < n; ++j) {
-        double sum = 0.0;
-        for (int k = 0; k < n; ++k) {
-          sum += a[(i * n) + k] * b[(k * n) + j];
-        }
-        c[(i * n) + j] = sum;
-      }
-    }
-  });
+std::vector<double> MultiplyBase(const std::vector<double>& a, const std::vector<double>& b, int n) {
+  std::vector<double> c(n * n);
+  ppc::core::gemm::Multiply(a, b, c, n, n, n);
   return c;
 }
 
@@ -81,7 +72,7 @@ void SetSubMatrix(std::vector<double>& m, const std::vector<double>& sub, int n,
 
 std::vector<double> StrassenRecursive(const std::vector<double>& a, const std::vector<double>& b, int n) {
   if (n <= kSeqThreshold) {
-    return MultiplyNaive(a, b, n);
+    return MultiplyBase(a, b, n);
   }
   int k = n / 2;
   auto a11 = SubMatrix(a, n, 0, 0, k);
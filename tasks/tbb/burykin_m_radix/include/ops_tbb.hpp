@@ -1,6 +1,5 @@
 #pragma once
 
-#include <array>
 #include <utility>
 #include <vector>
 
@@ -16,11 +15,6 @@ class RadixTBB : public ppc::core::Task {
   bool RunImpl() override;
   bool PostProcessingImpl() override;
 
-  static std::array<int, 256> ComputeFrequencyParallel(const std::vector<int>& a, int shift);
-  static std::array<int, 256> ComputeIndices(const std::array<int, 256>& count);
-  static void DistributeElementsParallel(const std::vector<int>& a, std::vector<int>& b,
-                                         const std::array<int, 256>& index, int shift);
-
  private:
   std::vector<int> input_, output_;
 };
@@ -6,36 +6,18 @@
 #include <cmath>
 #include <cstddef>
 #include <numbers>
+#include <span>
 #include <vector>
 
-#include "oneapi/tbb/parallel_for.h"
+#include "core/sort/include/quick_sort.hpp"
+#include "core/util/include/tbb_for.hpp"
+#include "core/util/include/util.hpp"
 
 void deryabin_m_hoare_sort_simple_merge_tbb::HoaraSort(std::vector<double>& a, size_t first, size_t last) {
   if (first >= last) {
     return;
   }
-  size_t i = first;
-  size_t j = last;
-  double tmp = 0;
-  double x =
-      std::max(std::min(a[first], a[(first + last) / 2]),
-               std::min(std::max(a[first], a[(first + last) / 2]),
-                        a[last]));  // выбор опорного элемента как медианы первого, среднего и последнего элементов
-  do {
-    while (a[i] < x) {
-      i++;
-    }
-    while (a[j] > x) {
-      j--;
-    }
-    if (i < j && a[i] > a[j]) {
-      tmp = a[i];
-      a[i] = a[j];
-      a[j] = tmp;
-    }
-  } while (i < j);
-  HoaraSort(a, i + 1, last);
-  HoaraSort(a, first, j);
+  ppc::core::sort::QuickSort(std::span<double>(a).subspan(first, last - first + 1));
 }
 
 void deryabin_m_hoare_sort_simple_merge_tbb::MergeTwoParts(std::vector<double>& a, size_t left, size_t right,
@@ -117,15 +99,8 @@ bool deryabin_m_hoare_sort_simple_merge_tbb::HoareSortTaskTBB::ValidationImpl()
 }
 
 bool deryabin_m_hoare_sort_simple_merge_tbb::HoareSortTaskTBB::RunImpl() {
-  oneapi::tbb::parallel_for(0, (int)chunk_count_, 1, [=, this](int count) {
-    HoaraSort(input_array_A_, count * min_chunk_size_, ((count + 1) * min_chunk_size_) - 1);
-  });
-  for (size_t i = 0; i < (size_t)(log((double)chunk_count_) / std::numbers::ln2); i++) {
-    oneapi::tbb::parallel_for(0, (int)chunk_count_ >> (i + 1), 1, [=, this](int j) {
-      MergeTwoParts(input_array_A_, (size_t)j * min_chunk_size_ << (i + 1),
-                    (((size_t)j + 1) * min_chunk_size_ << (i + 1)) - 1, dimension_);
-    });
-  }
+  ppc::core::sort::QuickSort(std::span<double>(input_array_A_),
+                             4 * static_cast<size_t>(ppc::util::GetPPCNumThreads()), ppc::util::TbbFor{});
   return true;
 }
 
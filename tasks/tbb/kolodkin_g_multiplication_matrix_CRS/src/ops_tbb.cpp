@@ -1,8 +1,5 @@
 #include "tbb/kolodkin_g_multiplication_matrix_CRS/include/ops_tbb.hpp"
 
-#include <oneapi/tbb/parallel_for.h>
-#include <tbb/tbb.h>
-
 #include <cmath>
 #include <complex>
 #include <cstddef>
@@ -10,6 +7,10 @@
 #include <utility>
 #include <vector>
 
+#include "core/sparse/include/spgemm.hpp"
+#include "core/util/include/tbb_for.hpp"
+#include "core/util/include/util.hpp"
+
 void kolodkin_g_multiplication_matrix_tbb::SparseMatrixCRS::AddValue(int row, Complex value, int col) {
   bool found = false;
   for (int j = rowPtr[row]; j < rowPtr[row + 1]; j++) {
@@ -142,33 +143,20 @@ bool kolodkin_g_multiplication_matrix_tbb::TestTaskTBB::ValidationImpl() {
 }
 
 bool kolodkin_g_multiplication_matrix_tbb::TestTaskTBB::RunImpl() {
-  SparseMatrixCRS c(A_.numRows, B_.numCols);
-
-  std::vector<std::vector<std::pair<int, Complex>>> local_results(A_.numRows);
-
-  tbb::parallel_for(tbb::blocked_range<unsigned int>(0, A_.numRows), [&](const tbb::blocked_range<unsigned int>& r) {
-    for (unsigned int i = r.begin(); i < r.end(); ++i) {
-      for (unsigned int j = A_.rowPtr[i]; j < (unsigned int)A_.rowPtr[i + 1]; ++j) {
-        unsigned int col_a = A_.colIndices[j];
-        Complex value_a = A_.values[j];
-
-        for (unsigned int k = B_.rowPtr[col_a]; k < (unsigned int)B_.rowPtr[col_a + 1]; ++k) {
-          unsigned int col_b = B_.colIndices[k];
-          Complex value_b = B_.values[k];
-          local_results[i].emplace_back(col_b, value_a * value_b);
-        }
-      }
-    }
-  });
-
-  for (size_t row_index = 0; row_index < local_results.size(); ++row_index) {
-    for (const auto& [col_index, value] : local_results[row_index]) {
-      c.AddValue(static_cast<int>(row_index), value, col_index);
-    }
-  }
+  // Gustavson product by rows, entries with terms are kept even if they sum to zero
+  const ppc::core::sparse::CsrView<int, Complex> a{A_.rowPtr, A_.colIndices, A_.values,
+                                                   static_cast<size_t>(A_.numCols)};
+  const ppc::core::sparse::CsrView<int, Complex> b{B_.rowPtr, B_.colIndices, B_.values,
+                                                   static_cast<size_t>(B_.numCols)};
+  ppc::core::sparse::CsrArrays<int, Complex> product;
+  ppc::core::sparse::Multiply(a, b, product, ppc::core::sparse::KeepAll{}, ppc::util::GetPPCNumChunks(),
+                              ppc::util::TbbFor{});
 
+  SparseMatrixCRS c(A_.numRows, B_.numCols);
+  c.values = std::move(product.values);
+  c.colIndices = std::move(product.indices);
+  c.rowPtr = std::move(product.offsets);
   output_ = ParseMatrixIntoVec(c);
-
   return true;
 }
 
@@ -1,14 +1,17 @@
 #include "tbb/kondratev_ya_ccs_complex_multiplication/include/ops_tbb.hpp"
 
+#include <oneapi/tbb/blocked_range.h>
 #include <oneapi/tbb/parallel_for.h>
 
-#include <algorithm>
 #include <cmath>
 #include <complex>
-#include <numeric>
+#include <cstddef>
+#include <span>
 #include <utility>
 #include <vector>
 
+#include "core/sparse/include/complex_kernels.hpp"
+
 bool kondratev_ya_ccs_complex_multiplication_tbb::IsZero(const std::complex<double> &value) {
   return std::norm(value) < kEpsilonForZero;
 }
@@ -18,18 +21,83 @@ bool kondratev_ya_ccs_complex_multiplication_tbb::IsEqual(const std::complex<dou
   return std::norm(a - b) <= kEpsilonForZero;
 }
 
+namespace kondratev_ya_ccs_complex_multiplication_tbb {
+namespace {
+
+Matrix ToMatrix(const CCSMatrix &m) {
+  Matrix res;
+  res.num_rows = static_cast<size_t>(m.rows);
+  res.num_cols = static_cast<size_t>(m.cols);
+  res.offsets.assign(m.col_ptrs.begin(), m.col_ptrs.end());
+  res.indices.assign(m.row_index.begin(), m.row_index.end());
+  res.values.assign(m.values.begin(), m.values.end());
+  return res;
+}
+
+CCSMatrix ToCCSMatrix(const Matrix &m) {
+  CCSMatrix res({static_cast<int>(m.num_rows), static_cast<int>(m.num_cols)});
+  res.col_ptrs.assign(m.offsets.begin(), m.offsets.end());
+  res.row_index.assign(m.indices.begin(), m.indices.end());
+  res.values.assign(m.values.begin(), m.values.end());
+  return res;
+}
+
+using Column = std::vector<std::pair<int, std::complex<double>>>;
+
+// column j of a * b sums the columns k of a scaled by b(k, j), entries below the zero threshold are dropped
+void ComputeColumn(const Matrix &a, const ppc::core::sparse::SplitComplex &a_values, const Matrix &b, int j,
+                   ppc::core::sparse::ComplexAccumulator &acc, Column &column) {
+  for (int k = b.offsets[j]; k < b.offsets[j + 1]; k++) {
+    const int row_b = b.indices[k];
+    const int begin = a.offsets[row_b];
+    const std::span<const int> rows_a(a.indices.data() + begin, a.offsets[row_b + 1] - begin);
+    ppc::core::sparse::ScatterMultiplyAdd(rows_a, a_values, begin, b.values[k], acc);
+  }
+  ppc::core::sparse::DrainNonZero(acc, kEpsilonForZero, [&](size_t i, std::complex<double> value) {
+    column.emplace_back(static_cast<int>(i), value);
+  });
+}
+
+// offsets of the matrix with the given columns, its indices and values are sized but not filled
+Matrix AllocateColumns(size_t num_rows, const std::vector<Column> &columns) {
+  Matrix res;
+  res.num_rows = num_rows;
+  res.num_cols = columns.size();
+  res.offsets.resize(columns.size() + 1, 0);
+  for (size_t j = 0; j < columns.size(); j++) {
+    res.offsets[j + 1] = res.offsets[j] + static_cast<int>(columns[j].size());
+  }
+  res.indices.resize(static_cast<size_t>(res.offsets.back()));
+  res.values.resize(static_cast<size_t>(res.offsets.back()));
+  return res;
+}
+
+void FillColumn(Matrix &res, const std::vector<Column> &columns, size_t j) {
+  auto offset = static_cast<size_t>(res.offsets[j]);
+  for (const auto &[row, value] : columns[j]) {
+    res.indices[offset] = row;
+    res.values[offset] = value;
+    offset++;
+  }
+}
+
+}  // namespace
+}  // namespace kondratev_ya_ccs_complex_multiplication_tbb
+
 bool kondratev_ya_ccs_complex_multiplication_tbb::TestTaskTBB::PreProcessingImpl() {
-  a_ = *reinterpret_cast<CCSMatrix *>(task_data->inputs[0]);
-  b_ = *reinterpret_cast<CCSMatrix *>(task_data->inputs[1]);
+  const auto &a = *reinterpret_cast<CCSMatrix *>(task_data->inputs[0]);
+  const auto &b = *reinterpret_cast<CCSMatrix *>(task_data->inputs[1]);
 
-  if (a_.rows == 0 || a_.cols == 0 || b_.rows == 0 || b_.cols == 0) {
+  if (a.rows == 0 || a.cols == 0 || b.rows == 0 || b.cols == 0) {
     return false;
   }
 
-  if (a_.cols != b_.rows) {
+  if (a.cols != b.rows) {
     return false;
   }
 
+  a_ = ToMatrix(a);
+  b_ = ToMatrix(b);
   return true;
 }
 
@@ -39,67 +107,30 @@ bool kondratev_ya_ccs_complex_multiplication_tbb::TestTaskTBB::ValidationImpl()
 }
 
 bool kondratev_ya_ccs_complex_multiplication_tbb::TestTaskTBB::RunImpl() {
-  c_ = a_ * b_;
+  c_ = Multiply(a_, b_);
   return true;
 }
 
 bool kondratev_ya_ccs_complex_multiplication_tbb::TestTaskTBB::PostProcessingImpl() {
-  *reinterpret_cast<CCSMatrix *>(task_data->outputs[0]) = c_;
+  *reinterpret_cast<CCSMatrix *>(task_data->outputs[0]) = ToCCSMatrix(c_);
   return true;
 }
 
-kondratev_ya_ccs_complex_multiplication_tbb::CCSMatrix
-kondratev_ya_ccs_complex_multiplication_tbb::CCSMatrix::operator*(const CCSMatrix &other) const {
-  CCSMatrix result({rows, other.cols});
-  result.values.reserve(std::min(rows * other.cols, static_cast<int>(values.size() * other.values.size())));
-  result.row_index.reserve(result.values.capacity());
-  result.col_ptrs.resize(other.cols + 1, 0);
-
-  std::vector<std::vector<std::pair<int, std::complex<double>>>> temp_cols(other.cols);
-
-  tbb::parallel_for(0, other.cols, [&](int result_col) {
-    std::vector<std::complex<double>> local_temp_col(rows, std::complex<double>(0.0, 0.0));
-
-    for (int k = other.col_ptrs[result_col]; k < other.col_ptrs[result_col + 1]; k++) {
-      int row_other = other.row_index[k];
-      std::complex<double> val_other = other.values[k];
+kondratev_ya_ccs_complex_multiplication_tbb::Matrix
+kondratev_ya_ccs_complex_multiplication_tbb::TestTaskTBB::Multiply(const Matrix &a, const Matrix &b) {
+  const int cols = static_cast<int>(b.num_cols);
+  std::vector<Column> temp_cols(cols);
+  const ppc::core::sparse::SplitComplex split_values(a.values);
 
-      for (int i = col_ptrs[row_other]; i < col_ptrs[row_other + 1]; i++) {
-        int row_this = row_index[i];
-        local_temp_col[row_this] += values[i] * val_other;
-      }
-    }
+  tbb::parallel_for(tbb::blocked_range<int>(0, cols), [&](const tbb::blocked_range<int> &r) {
+    ppc::core::sparse::ComplexAccumulator local_temp_col(a.num_rows);
 
-    for (int i = 0; i < rows; i++) {
-      if (!IsZero(local_temp_col[i])) {
-        temp_cols[result_col].emplace_back(i, local_temp_col[i]);
-      }
-    }
-  });
-
-  std::vector<int> col_sizes(other.cols);
-  std::ranges::transform(temp_cols, col_sizes.begin(), [](const auto &col) { return static_cast<int>(col.size()); });
-
-  std::vector<int> col_offsets(other.cols + 1, 0);
-  std::partial_sum(col_sizes.begin(), col_sizes.end(), col_offsets.begin() + 1);
-
-  int total_nonzero = col_offsets[other.cols];
-  result.values.resize(total_nonzero);
-  result.row_index.resize(total_nonzero);
-
-  for (int i = 0; i <= other.cols; i++) {
-    result.col_ptrs[i] = col_offsets[i];
-  }
-
-  tbb::parallel_for(0, other.cols, [&](int col) {
-    int offset = col_offsets[col];
-
-    for (const auto &[row, value] : temp_cols[col]) {
-      result.row_index[offset] = row;
-      result.values[offset] = value;
-      offset++;
+    for (int result_col = r.begin(); result_col < r.end(); result_col++) {
+      ComputeColumn(a, split_values, b, result_col, local_temp_col, temp_cols[result_col]);
     }
   });
 
+  Matrix result = AllocateColumns(a.num_rows, temp_cols);
+  tbb::parallel_for(0, cols, [&](int col) { FillColumn(result, temp_cols, col); });
   return result;
-}
\ No newline at end of file
+}
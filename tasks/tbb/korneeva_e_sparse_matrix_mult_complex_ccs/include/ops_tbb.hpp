@@ -7,6 +7,7 @@
 #include <utility>
 #include <vector>
 
+#include "core/sparse/include/complex_kernels.hpp"
 #include "core/task/include/task.hpp"
 
 namespace korneeva_e_sparse_matrix_mult_complex_ccs_tbb {
@@ -41,9 +42,8 @@ class SparseMatrixMultComplexCCS : public ppc::core::Task {
   SparseMatrixCCS* matrix2_;
   SparseMatrixCCS result_;
 
-  void ComputeColumn(int col_idx, std::vector<std::pair<Complex, int>>& column_data);
-  Complex ComputeElement(int row_idx, int col_start2, int col_end2);
-  Complex ComputeContribution(int row_idx, int k, int col_start1, int col_end1, int col_start2, int col_end2);
+  void ComputeColumn(int col_idx, const ppc::core::sparse::SplitComplex& values1,
+                     ppc::core::sparse::ComplexAccumulator& column, std::vector<std::pair<Complex, int>>& column_data);
 };
 
 }  // namespace korneeva_e_sparse_matrix_mult_complex_ccs_tbb
\ No newline at end of file
@@ -1,75 +1,31 @@
 #include "../include/ops_tbb.hpp"
 
+#include <oneapi/tbb/blocked_range.h>
 #include <oneapi/tbb/parallel_for.h>
 #include <oneapi/tbb/task_arena.h>
 #include <tbb/tbb.h>
 
 #include <algorithm>
-#include <climits>
 #include <cmath>
 #include <cstddef>
 #include <cstdio>
-#include <numeric>
-#include <ranges>
 #include <span>
 #include <string>
-#include <type_traits>
 #include <utility>
 #include <vector>
 
+#include "core/sort/include/merge.hpp"
+#include "core/sort/include/radix_sort.hpp"
+#include "core/util/include/tbb_for.hpp"
 #include "core/util/include/util.hpp"
 
 namespace {
-void RadixIntegerSortHomogenous(std::span<int> arr) {
-  using TInt = std::decay_t<decltype(arr)>::value_type;
-
-  const auto convert = [](TInt num, std::size_t i) {
-    constexpr TInt kMask = 1 << ((sizeof(TInt) * CHAR_BIT) - 1);
-    num = ((num & kMask) == 0U) ? (num | kMask) : (~num);
-    return (num >> (i * 8)) & 0xFF;
-  };
-
-  std::vector<TInt> bufbuf(arr.size());
-  std::span<TInt> buf{bufbuf};
-  std::size_t counts[1 << 8];
-
-  for (std::size_t pp = 0; pp < sizeof(TInt); ++pp) {
-    std::ranges::fill(counts, 0);
-    for (auto &num : arr) {
-      ++counts[convert(num, pp)];
-    }
-    std::partial_sum(std::begin(counts), std::end(counts), std::begin(counts));
-    for (auto &num : std::views::reverse(arr)) {
-      buf[--counts[convert(num, pp)]] = num;
-    }
-    std::swap(arr, buf);
-  }
-}
-
 std::vector<int> RadixIntegerSort(std::span<int> arr) {
-  std::vector<int> res(arr.size());
-
-  std::size_t left = 0;
-  std::size_t right = arr.size();
-  for (auto num : arr) {
-    if (num < 0) {
-      res[left++] = num;
-    } else {
-      res[--right] = num;
-    }
-  }
-
-  // NOLINTBEGIN(bugprone-narrowing-conversions) :: std::size_t -> std::vector<T>::difference_type
-  std::span<int> neg(res.begin(), res.begin() + left);
-  std::span<int> pos(res.begin() + right, res.end());
-  // NOLINTEND(bugprone-narrowing-conversions)
-
-  RadixIntegerSortHomogenous(neg);
-  RadixIntegerSortHomogenous(pos);
-
-  std::ranges::reverse(neg);
+  std::vector<int> res(arr.begin(), arr.end());
+  ppc::core::sort::RadixSort(std::span<int>(res));
   return res;
 }
+
 }  // namespace
 
 bool koshkin_m_radix_int_simple_merge::TbbT::PreProcessingImpl() {
@@ -116,42 +72,17 @@ bool koshkin_m_radix_int_simple_merge::TbbT::RunImpl() {
                               });
   });
 
-  for (std::size_t blcnt = blocks.size(), dx = 1; blcnt > 1; blcnt /= 2, dx *= 2) {
-    const auto bsize = blocks[0].size();
-    const auto after = blcnt / 2;
-
-    const auto merge_and_subst = [&](std::vector<int> &a, std::vector<int> &b) {
-      std::vector<int> c(a.size() + b.size());
-      std::ranges::merge(a, b, c.begin());
-      a = std::move(c);
-      b.clear();
-    };
-    if (bsize > 64) {
-      arena.execute([&] {
-        oneapi::tbb::parallel_for(
-            oneapi::tbb::blocked_range<std::size_t>(0, after, after / tbb::this_task_arena::max_concurrency()),
-            [&](const auto &r) {
-              for (std::size_t g = r.begin(); g < r.end(); ++g) {
-                merge_and_subst(blocks[2 * dx * g], blocks[(2 * dx * g) + dx]);
-              }
-            });
-      });
-    } else {
-      for (std::size_t g = 0; g < after; ++g) {
-        merge_and_subst(blocks[2 * dx * g], blocks[(2 * dx * g) + dx]);
-      }
-    }
-
-    if (after % 2 != 0) {
-      if (after == 1) {
-        merge_and_subst(blocks.front(), blocks.back());
-      } else {
-        merge_and_subst(blocks[2 * dx * (after - 2)], blocks[2 * dx * (after - 1)]);
-      }
-    }
+  // all sorted blocks merged into out_ in one pass, split evenly over the threads
+  std::vector<std::span<const int>> runs(blocks.begin(), blocks.end());
+  std::size_t size = 0;
+  for (const auto &block : blocks) {
+    size += block.size();
   }
-
-  out_ = std::move(blocks.front());
+  out_.resize(size);
+  arena.execute([&] {
+    ppc::core::sort::KWayMerge(std::span<const std::span<const int>>(runs), std::span<int>(out_), 4 * blocks.size(),
+                               ppc::util::TbbFor{});
+  });
 
   return true;
 }
@@ -15,7 +15,6 @@ class ShellSortTBB : public ppc::core::Task {
 
  private:
   std::vector<int> input_;
-  void ShellSort();
 };
 
 }  // namespace kovalchuk_a_shell_sort_tbb
\ No newline at end of file
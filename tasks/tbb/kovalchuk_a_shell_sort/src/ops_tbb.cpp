@@ -1,13 +1,17 @@
 #include "tbb/kovalchuk_a_shell_sort/include/ops_tbb.hpp"
 
-#include <tbb/parallel_for.h>
+#include <oneapi/tbb/task_arena.h>
 
 #include <algorithm>
+#include <cstddef>
+#include <span>
 #include <utility>
 #include <vector>
 
+#include "core/sort/include/shell_sort.hpp"
 #include "core/task/include/task.hpp"
-#include "oneapi/tbb/parallel_for.h"
+#include "core/util/include/tbb_for.hpp"
+#include "core/util/include/util.hpp"
 
 namespace kovalchuk_a_shell_sort_tbb {
 
@@ -25,31 +29,14 @@ bool ShellSortTBB::ValidationImpl() {
 }
 
 bool ShellSortTBB::RunImpl() {
-  ShellSort();
+  const int num_threads = ppc::util::GetPPCNumThreads();
+  oneapi::tbb::task_arena arena(num_threads);
+  arena.execute([&] {
+    ppc::core::sort::ShellSort(std::span<int>(input_), static_cast<std::size_t>(num_threads) * 4, ppc::util::TbbFor{});
+  });
   return true;
 }
 
-void ShellSortTBB::ShellSort() {
-  if (input_.empty()) {
-    return;
-  }
-
-  int n = static_cast<int>(input_.size());
-  for (int gap = n / 2; gap > 0; gap /= 2) {
-    tbb::parallel_for(0, gap, [&](int k) {
-      for (int i = k + gap; i < n; i += gap) {
-        int temp = input_[i];
-        int j = i;
-        while (j >= gap && input_[j - gap] > temp) {
-          input_[j] = input_[j - gap];
-          j -= gap;
-        }
-        input_[j] = temp;
-      }
-    });
-  }
-}
-
 bool ShellSortTBB::PostProcessingImpl() {
   auto* output_ptr = reinterpret_cast<int*>(task_data->outputs[0]);
   std::ranges::copy(input_, output_ptr);
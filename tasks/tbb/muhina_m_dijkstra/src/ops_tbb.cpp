@@ -1,65 +1,26 @@
 #include "tbb/muhina_m_dijkstra/include/ops_tbb.hpp"
 
-#include <oneapi/tbb/blocked_range.h>
-#include <oneapi/tbb/concurrent_priority_queue.h>
-#include <oneapi/tbb/parallel_for.h>
-#include <oneapi/tbb/spin_mutex.h>
-
 #include <climits>
 #include <cstddef>
-#include <functional>
-#include <utility>
-#include <vector>
-
-const int muhina_m_dijkstra_tbb::TestTaskTBB::kEndOfVertexList = -1;
-
-namespace {
-void RunDijkstraAlgorithm(const std::vector<std::vector<std::pair<size_t, int>>> &adj_list, std::vector<int> &distances,
-                          size_t start_vertex) {
-  oneapi::tbb::concurrent_priority_queue<std::pair<int, size_t>, std::greater<>> pq;
-  pq.push({0, start_vertex});
-  oneapi::tbb::spin_mutex mutex;
-
-  while (true) {
-    std::pair<int, size_t> top;
-    if (!pq.try_pop(top)) {
-      if (pq.empty()) {
-        break;
-      }
-      continue;
-    }
-
-    size_t u = top.second;
-    int dist_u = top.first;
+#include <span>
 
-    if (dist_u > distances[u]) {
-      continue;
-    }
-
-    oneapi::tbb::parallel_for(oneapi::tbb::blocked_range<size_t>(0, adj_list[u].size()),
-                              [&](const oneapi::tbb::blocked_range<size_t> &r) {
-                                for (size_t i = r.begin(); i != r.end(); ++i) {
-                                  size_t v = adj_list[u][i].first;
-                                  int weight = adj_list[u][i].second;
-                                  int new_dist = distances[u] + weight;
-
-                                  if (new_dist < distances[v]) {
-                                    oneapi::tbb::spin_mutex::scoped_lock lock(mutex);
-                                    if (new_dist < distances[v]) {
-                                      distances[v] = new_dist;
-                                      pq.push({new_dist, v});
-                                    }
-                                  }
-                                }
-                              });
-  }
-}
-}  // namespace
+#include "core/graph/include/adjacency_stream.hpp"
+#include "core/graph/include/delta_stepping.hpp"
+#include "core/graph/include/multi_source.hpp"
+#include "core/util/include/tbb_for.hpp"
+#include "core/util/include/util.hpp"
 
 bool muhina_m_dijkstra_tbb::TestTaskTBB::PreProcessingImpl() {
-  unsigned int input_size = task_data->inputs_count[0];
-  auto *in_ptr = reinterpret_cast<int *>(task_data->inputs[0]);
-  graph_data_.assign(in_ptr, in_ptr + input_size);
+  const std::span<const int> graph_data(reinterpret_cast<int *>(task_data->inputs[0]), task_data->inputs_count[0]);
+  batch_ = ppc::core::graph::GetBatchedQuery(*task_data);
+  if (batch_) {
+    // the run writes row k of the K x V output for source k
+    num_vertices_ = batch_->num_vertices;
+    graph_valid_ = ppc::core::graph::BuildFromAdjacencyStream(graph_data, num_vertices_,
+                                                              ppc::core::graph::StreamCheck::kLenient, graph_,
+                                                              ppc::util::GetPPCNumChunks(), ppc::util::TbbFor{});
+    return graph_valid_;
+  }
 
   num_vertices_ = task_data->outputs_count[0];
   distances_.resize(num_vertices_);
@@ -73,7 +34,11 @@ bool muhina_m_dijkstra_tbb::TestTaskTBB::PreProcessingImpl() {
   }
   distances_[start_vertex_] = 0;
 
-  return true;
+  // the graph is parsed once here, so the run only computes distances
+  graph_valid_ = ppc::core::graph::BuildFromAdjacencyStream(
+      graph_data, num_vertices_, ppc::core::graph::StreamCheck::kLenient, graph_, ppc::util::GetPPCNumChunks(),
+      ppc::util::TbbFor{});
+  return graph_valid_;
 }
 
 bool muhina_m_dijkstra_tbb::TestTaskTBB::ValidationImpl() {
@@ -82,39 +47,25 @@ bool muhina_m_dijkstra_tbb::TestTaskTBB::ValidationImpl() {
 }
 
 bool muhina_m_dijkstra_tbb::TestTaskTBB::RunImpl() {
-  std::vector<std::vector<std::pair<size_t, int>>> adj_list(num_vertices_);
-  size_t current_vertex = 0;
-  size_t i = 0;
-
-  while (i < graph_data_.size() && current_vertex < num_vertices_) {
-    if (graph_data_[i] == kEndOfVertexList) {
-      current_vertex++;
-      i++;
-      continue;
-    }
-
-    if (i + 1 >= graph_data_.size()) {
-      break;
-    }
-
-    size_t dest = graph_data_[i];
-    int weight = graph_data_[i + 1];
-    if (weight < 0) {
-      return false;
-    }
-
-    if (dest < num_vertices_) {
-      adj_list[current_vertex].emplace_back(dest, weight);
-    }
+  if (!graph_valid_) {
+    return false;
+  }
 
-    i += 2;
+  if (batch_) {
+    ppc::core::graph::MultiSourceShortestPaths(graph_, batch_->sources, batch_->distances, ppc::util::TbbFor{});
+    return true;
   }
-  RunDijkstraAlgorithm(adj_list, distances_, start_vertex_);
 
+  // delta-stepping: every round relaxes the edges of a whole bucket of vertices in one parallel loop
+  ppc::core::graph::DeltaStepping(graph_, start_vertex_, ppc::core::graph::ChooseDelta(graph_), distances_,
+                                  ppc::util::GetPPCNumChunks(), ppc::util::TbbFor{});
   return true;
 }
 
 bool muhina_m_dijkstra_tbb::TestTaskTBB::PostProcessingImpl() {
+  if (batch_) {
+    return true;
+  }
   for (size_t i = 0; i < distances_.size(); ++i) {
     reinterpret_cast<int *>(task_data->outputs[0])[i] = distances_[i];
   }
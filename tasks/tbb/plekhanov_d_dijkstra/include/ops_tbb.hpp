@@ -1,11 +1,12 @@
 #pragma once
 
-#include <oneapi/tbb/mutex.h>
-
 #include <cstddef>
+#include <optional>
 #include <utility>
 #include <vector>
 
+#include "core/graph/include/csr_graph.hpp"
+#include "core/graph/include/multi_source.hpp"
 #include "core/task/include/task.hpp"
 
 namespace plekhanov_d_dijkstra_tbb {
@@ -19,16 +20,12 @@ class TestTaskTBB : public ppc::core::Task {
   bool PostProcessingImpl() override;
 
  private:
-  std::vector<int> graph_data_;
+  ppc::core::graph::CsrGraph graph_;
+  std::optional<ppc::core::graph::BatchedQuery> batch_;
+  bool graph_valid_ = false;
   std::vector<int> distances_;
-  oneapi::tbb::mutex mutex_;
   size_t start_vertex_;
   size_t num_vertices_;
-  static const int kEndOfVertexList;
-
-  [[nodiscard]] int FindMinDistanceVertexTBB(const std::vector<bool>& visited) const;
-  void RelaxEdgesTBB(int u, const std::vector<std::vector<std::pair<int, int>>>& graph,
-                     const std::vector<bool>& visited);
 };
 
 }  // namespace plekhanov_d_dijkstra_tbb
\ No newline at end of file
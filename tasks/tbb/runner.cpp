@@ -1,13 +1,22 @@
 #include <gtest/gtest.h>
 #include <tbb/global_control.h>
 
+#include <memory>
+
+#include "core/perf/include/thread_sweep.hpp"
 #include "core/util/include/util.hpp"
 #include "oneapi/tbb/global_control.h"
 
 int main(int argc, char** argv) {
   // Limit the number of threads in TBB
-  tbb::global_control control(tbb::global_control::max_allowed_parallelism, ppc::util::GetPPCNumThreads());
+  auto control = std::make_unique<tbb::global_control>(tbb::global_control::max_allowed_parallelism,
+                                                       ppc::util::GetPPCNumThreads());
 
   ::testing::InitGoogleTest(&argc, argv);
+  ppc::core::ThreadSweep::Enable([&control](int num_threads) {
+    // the most restrictive active control wins, so the previous one has to be released first
+    control.reset();
+    control = std::make_unique<tbb::global_control>(tbb::global_control::max_allowed_parallelism, num_threads);
+  });
   return RUN_ALL_TESTS();
 }
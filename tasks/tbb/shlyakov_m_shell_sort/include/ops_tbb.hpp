@@ -7,9 +7,6 @@
 
 namespace shlyakov_m_shell_sort_tbb {
 
-void ShellSort(int left, int right, std::vector<int>& arr);
-void Merge(int left, int mid, int right, std::vector<int>& arr, std::vector<int>& buffer);
-
 class TestTaskTBB : public ppc::core::Task {
  public:
   explicit TestTaskTBB(ppc::core::TaskDataPtr task_data) : Task(std::move(task_data)) {}
@@ -5,11 +5,15 @@
 #include <exception>
 #include <iostream>
 #include <memory>
+#include <span>
 #include <utility>
 #include <vector>
 
+#include "core/sort/include/quick_sort.hpp"
 #include "core/task/include/task.hpp"
-#include "oneapi/tbb/parallel_invoke.h"
+#include "core/util/include/tbb_for.hpp"
+#include "core/util/include/util.hpp"
+#include "oneapi/tbb/task_arena.h"
 
 namespace shuravina_o_hoare_simple_merger_tbb {
 
@@ -66,7 +70,9 @@ bool HoareSortTBB::RunImpl() {
   }
 
   try {
-    ParallelQuickSort(data_.data(), 0, data_.size() - 1);
+    const auto num_threads = static_cast<std::size_t>(ppc::util::GetPPCNumThreads());
+    oneapi::tbb::task_arena arena(static_cast<int>(num_threads));
+    ppc::core::sort::QuickSort(std::span<int>(data_), 4 * num_threads, ppc::util::TbbFor{&arena});
     return true;
   } catch (const std::exception& e) {
     std::cerr << "Run error: " << e.what() << '\n';
@@ -95,75 +101,4 @@ bool HoareSortTBB::PostProcessingImpl() {
   }
 }
 
-std::size_t HoareSortTBB::Partition(int* arr, std::size_t left, std::size_t right) {
-  if (right == 0) {
-    return 0;
-  }
-
-  int pivot = arr[(left + right) / 2];
-  while (left <= right) {
-    while (arr[left] < pivot) {
-      ++left;
-    }
-    while (arr[right] > pivot) {
-      if (right == 0) {
-        break;
-      }
-      --right;
-    }
-    if (left <= right) {
-      std::swap(arr[left], arr[right]);
-      ++left;
-      if (right > 0) {
-        --right;
-      }
-    }
-  }
-  return left;
-}
-
-void HoareSortTBB::SequentialQuickSort(int* arr, std::size_t left, std::size_t right) {
-  if (left >= right) {
-    return;
-  }
-
-  std::size_t p = Partition(arr, left, right);
-
-  if (p > 0 && left < p - 1) {
-    SequentialQuickSort(arr, left, p - 1);
-  }
-  if (p < right) {
-    SequentialQuickSort(arr, p, right);
-  }
-}
-
-void HoareSortTBB::ParallelQuickSort(int* arr, std::size_t left, std::size_t right) {
-  if (left >= right) {
-    return;
-  }
-
-  if (right - left < kThreshold) {
-    SequentialQuickSort(arr, left, right);
-    return;
-  }
-
-  std::size_t p = Partition(arr, left, right);
-
-  try {
-    if (p > 0 && left < p - 1 && p < right) {
-      tbb::parallel_invoke([&] { ParallelQuickSort(arr, left, p - 1); }, [&] { ParallelQuickSort(arr, p, right); });
-    } else if (p > 0 && left < p - 1) {
-      ParallelQuickSort(arr, left, p - 1);
-    } else if (p < right) {
-      ParallelQuickSort(arr, p, right);
-    }
-  } catch (const std::exception& e) {
-    std::cerr << "Exception in ParallelQuickSort: " << e.what() << '\n';
-    throw;
-  } catch (...) {
-    std::cerr << "Unknown exception in ParallelQuickSort\n";
-    throw;
-  }
-}
-
 }  // namespace shuravina_o_hoare_simple_merger_tbb
\ No newline at end of file
@@ -5,10 +5,12 @@
 #include <utility>
 #include <vector>
 
+#include "core/sparse/include/matrix.hpp"
 #include "core/task/include/task.hpp"
 
 namespace solovev_a_matrix_tbb {
 
+// layout of the matrices in task data, the task converts them to the CCS matrices of core sparse
 struct MatrixInCcsSparse {
   std::vector<std::complex<double>> val;
   std::vector<int> row;
@@ -28,6 +30,8 @@ struct MatrixInCcsSparse {
   }
 };
 
+using Matrix = ppc::core::sparse::CcsMatrix<int, std::complex<double>>;
+
 class TBBMatMultCcs : public ppc::core::Task {
  public:
   explicit TBBMatMultCcs(std::shared_ptr<ppc::core::TaskData> task_data) : Task(std::move(task_data)) {}
@@ -37,12 +41,8 @@ class TBBMatMultCcs : public ppc::core::Task {
   bool PostProcessingImpl() override;
 
  private:
-  void ComputeColumnSizes();
-  void FillMatrixValues();
-
-  MatrixInCcsSparse *M1_ = nullptr;
-  MatrixInCcsSparse *M2_ = nullptr;
   MatrixInCcsSparse *M3_ = nullptr;
+  Matrix m1_, m2_, m3_;
 };
 
 }  // namespace solovev_a_matrix_tbb
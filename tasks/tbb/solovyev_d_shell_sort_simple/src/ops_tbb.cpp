@@ -1,11 +1,15 @@
 #include "tbb/solovyev_d_shell_sort_simple/include/ops_tbb.hpp"
 
-#include <oneapi/tbb/parallel_for.h>
+#include <oneapi/tbb/task_arena.h>
 
-#include <cmath>
 #include <cstddef>
+#include <span>
 #include <vector>
 
+#include "core/sort/include/shell_sort.hpp"
+#include "core/util/include/tbb_for.hpp"
+#include "core/util/include/util.hpp"
+
 bool solovyev_d_shell_sort_simple_tbb::TaskTBB::PreProcessingImpl() {
   size_t input_size = task_data->inputs_count[0];
   auto *in_ptr = reinterpret_cast<int *>(task_data->inputs[0]);
@@ -19,19 +23,11 @@ bool solovyev_d_shell_sort_simple_tbb::TaskTBB::ValidationImpl() {
 }
 
 bool solovyev_d_shell_sort_simple_tbb::TaskTBB::RunImpl() {
-  for (int gap = static_cast<int>(input_.size()) / 2; gap > 0; gap /= 2) {
-    tbb::parallel_for(0, gap, [this, gap](int i) {
-      for (size_t f = gap + i; f < input_.size(); f += gap) {
-        int val = input_[f];
-        int j = static_cast<int>(f);
-        while (j >= gap && input_[j - gap] > val) {
-          input_[j] = input_[j - gap];
-          j -= gap;
-        }
-        input_[j] = val;
-      }
-    });
-  }
+  const int num_threads = ppc::util::GetPPCNumThreads();
+  oneapi::tbb::task_arena arena(num_threads);
+  arena.execute([&] {
+    ppc::core::sort::ShellSort(std::span<int>(input_), static_cast<std::size_t>(num_threads) * 4, ppc::util::TbbFor{});
+  });
   return true;
 }
 
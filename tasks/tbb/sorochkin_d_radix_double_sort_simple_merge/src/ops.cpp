@@ -1,71 +1,22 @@
 #include "../include/ops.hpp"
 
+#include <oneapi/tbb/blocked_range.h>
 #include <oneapi/tbb/parallel_for.h>
 #include <oneapi/tbb/task_arena.h>
 #include <tbb/tbb.h>
 
 #include <algorithm>
-#include <array>
-#include <climits>
 #include <cmath>
 #include <cstddef>
-#include <cstdint>
 #include <numeric>
-#include <ranges>
 #include <span>
 #include <vector>
 
+#include "core/sort/include/merge.hpp"
+#include "core/sort/include/msd_radix_sort.hpp"
+#include "core/util/include/tbb_for.hpp"
 #include "core/util/include/util.hpp"
 
-namespace {
-template <typename T>
-constexpr size_t Bytes() {
-  return sizeof(T);
-}
-template <typename T>
-constexpr size_t Bits() {
-  return Bytes<T>() * CHAR_BIT;
-}
-class Bitutil {
- private:
-  union du64 {
-    double d;
-    uint64_t u;
-    static constexpr uint64_t kMask = 1ULL << ((sizeof(uint64_t) * CHAR_BIT) - 1);
-  };
-
- public:
-  static constexpr uint64_t AsU64(double x) {
-    const du64 r{.d = x};
-    return ((r.u & du64::kMask) != 0U) ? ~r.u : r.u | du64::kMask;
-  }
-
-  template <typename T>
-    requires std::is_floating_point_v<T> or std::is_integral_v<T>
-  static constexpr uint8_t ByteAt(const T &val, uint8_t idx) {
-    return (val >> (idx * 8)) & 0xFF;
-  }
-};
-
-void RadixSort(std::span<double> v) {
-  constexpr size_t kBase = 1 << CHAR_BIT;
-
-  std::vector<double> aux_buf(v.size());
-  std::span<double> aux{aux_buf};
-
-  std::array<std::size_t, kBase> count;
-
-  for (std::size_t ib = 0; ib < Bytes<double>(); ++ib) {
-    std::ranges::fill(count, 0);
-    std::ranges::for_each(v, [&](auto el) { ++count[Bitutil::ByteAt(Bitutil::AsU64(el), ib)]; });
-    std::partial_sum(count.begin(), count.end(), count.begin());
-    std::ranges::for_each(std::ranges::reverse_view(v),
-                          [&](auto el) { aux[--count[Bitutil::ByteAt(Bitutil::AsU64(el), ib)]] = el; });
-    std::swap(v, aux);
-  }
-}
-}  // namespace
-
 bool sorochkin_d_radix_double_sort_simple_merge_tbb::SortTask::ValidationImpl() {
   return task_data->inputs_count[0] == task_data->outputs_count[0];
 }
@@ -74,6 +25,7 @@ bool sorochkin_d_radix_double_sort_simple_merge_tbb::SortTask::PreProcessingImpl
   std::span<double> src = {reinterpret_cast<double *>(task_data->inputs[0]), task_data->inputs_count[0]};
   input_.assign(src.begin(), src.end());
   output_.reserve(input_.size());
+  buffer_.resize(input_.size());
   return true;
 }
 
@@ -105,38 +57,17 @@ bool sorochkin_d_radix_double_sort_simple_merge_tbb::SortTask::RunImpl() {
         oneapi::tbb::blocked_range<std::size_t>(0, numthreads, numthreads / tbb::this_task_arena::max_concurrency()),
         [&](const auto &r) {
           for (std::size_t i = r.begin(); i < r.end(); i++) {
-            RadixSort(chunks[i]);
+            ppc::core::sort::MsdRadixSort(chunks[i]);
           }
         });
   });
 
-  for (std::size_t i = 1, j = numthreads; j > 1; i *= 2, j /= 2) {
-    const auto multithreaded = chunks.front().size() > 48;
-    const auto jh = j / 2;
-    const auto merge = [&](std::span<double> &master, std::span<double> &slave) {
-      std::inplace_merge(master.begin(), slave.begin(), slave.end());
-      master = std::span{master.begin(), slave.end()};
-    };
-    const auto run = [&](const tbb::blocked_range<std::size_t> &r) {
-      for (std::size_t k = r.begin(); k < r.end(); ++k) {
-        const auto idx = 2 * i * k;
-        merge(chunks[idx], chunks[idx + i]);
-      }
-    };
-    if (multithreaded) {
-      arena.execute([&] {
-        oneapi::tbb::parallel_for(
-            oneapi::tbb::blocked_range<std::size_t>(0, jh, jh / tbb::this_task_arena::max_concurrency()), run);
-      });
-    } else {
-      run(tbb::blocked_range<std::size_t>(0, jh));
-    }
-    if (jh == 1) {
-      merge(chunks.front(), chunks.back());
-    } else if (jh % 2 != 0) {
-      merge(chunks[2 * i * (jh - 2)], chunks[2 * i * (jh - 1)]);
-    }
-  }
+  // the sorted chunks merged in rounds between output_ and buffer_, every merge split over all threads
+  offsets.push_back(size);
+  arena.execute([&] {
+    ppc::core::sort::MergeRuns(std::span<double>(output_), std::span<const std::size_t>(offsets),
+                               std::span<double>(buffer_), 4 * numthreads, ppc::util::TbbFor{});
+  });
 
   return true;
 }
@@ -1,89 +1,30 @@
 #include "tbb/sorokin_a_multiplication_sparse_matrices_double_ccs/include/ops_tbb.hpp"
 
-#include <tbb/tbb.h>
-
 #include <algorithm>
-#include <cmath>
 #include <cstddef>
+#include <utility>
 #include <vector>
 
-#include "oneapi/tbb/blocked_range.h"
-#include "oneapi/tbb/parallel_for.h"
+#include "core/sparse/include/spgemm.hpp"
+#include "core/util/include/tbb_for.hpp"
+#include "core/util/include/util.hpp"
 
 namespace sorokin_a_multiplication_sparse_matrices_double_ccs_tbb {
-void ProcessFirstPass(int j, int m, const std::vector<int>& a_col_ptr, const std::vector<int>& a_row_indices,
-                      const std::vector<int>& b_col_ptr, const std::vector<int>& b_row_indices,
-                      std::vector<int>& col_sizes) {
-  std::vector<bool> temp_used(m, false);
-  for (int t = b_col_ptr[j]; t < b_col_ptr[j + 1]; ++t) {
-    const int row_b = b_row_indices[t];
-    for (int i = a_col_ptr[row_b]; i < a_col_ptr[row_b + 1]; ++i) {
-      const int row_a = a_row_indices[i];
-      if (!temp_used[row_a]) {
-        temp_used[row_a] = true;
-        col_sizes[j]++;
-      }
-    }
-  }
-}
-
-void ProcessSecondPass(int j, int m, const std::vector<int>& a_col_ptr, const std::vector<int>& a_row_indices,
-                       const std::vector<double>& a_values, const std::vector<int>& b_col_ptr,
-                       const std::vector<int>& b_row_indices, const std::vector<double>& b_values,
-                       const std::vector<int>& c_col_ptr, std::vector<int>& c_row_indices,
-                       std::vector<double>& c_values) {
-  std::vector<double> temp_values(m, 0.0);
-  std::vector<bool> temp_used(m, false);
-
-  for (int t = b_col_ptr[j]; t < b_col_ptr[j + 1]; ++t) {
-    const int row_b = b_row_indices[t];
-    const double val_b = b_values[t];
-    for (int i = a_col_ptr[row_b]; i < a_col_ptr[row_b + 1]; ++i) {
-      const int row_a = a_row_indices[i];
-      temp_values[row_a] += a_values[i] * val_b;
-      temp_used[row_a] = true;
-    }
-  }
-
-  int pos = c_col_ptr[j];
-  for (int i = 0; i < m; ++i) {
-    if (temp_used[i]) {
-      c_row_indices[pos] = i;
-      c_values[pos] = temp_values[i];
-      pos++;
-    }
-  }
-}
 
 void MultiplyCCS(const std::vector<double>& a_values, const std::vector<int>& a_row_indices, int m,
                  const std::vector<int>& a_col_ptr, const std::vector<double>& b_values,
                  const std::vector<int>& b_row_indices, int k, const std::vector<int>& b_col_ptr,
                  std::vector<double>& c_values, std::vector<int>& c_row_indices, int n, std::vector<int>& c_col_ptr) {
-  c_col_ptr.resize(n + 1);
-  c_col_ptr[0] = 0;
-  std::vector<int> col_sizes(n, 0);
-
-  tbb::parallel_for(tbb::blocked_range<int>(0, n), [&](const tbb::blocked_range<int>& range) {
-    for (int j = range.begin(); j < range.end(); ++j) {
-      ProcessFirstPass(j, m, a_col_ptr, a_row_indices, b_col_ptr, b_row_indices, col_sizes);
-    }
-  });
-
-  for (int j = 0; j < n; ++j) {
-    c_col_ptr[j + 1] = c_col_ptr[j] + col_sizes[j];
-  }
-
-  const int total_non_zero = c_col_ptr[n];
-  c_values.resize(total_non_zero);
-  c_row_indices.resize(total_non_zero);
-
-  tbb::parallel_for(tbb::blocked_range<int>(0, n), [&](const tbb::blocked_range<int>& range) {
-    for (int j = range.begin(); j < range.end(); ++j) {
-      ProcessSecondPass(j, m, a_col_ptr, a_row_indices, a_values, b_col_ptr, b_row_indices, b_values, c_col_ptr,
-                        c_row_indices, c_values);
-    }
-  });
+  // CCS arrays of a matrix are the CSR arrays of its transpose, and (A * B)^T = B^T * A^T
+  const ppc::core::sparse::CsrView<int, double> b{b_col_ptr, b_row_indices, b_values, static_cast<size_t>(k)};
+  const ppc::core::sparse::CsrView<int, double> a{a_col_ptr, a_row_indices, a_values, static_cast<size_t>(m)};
+  ppc::core::sparse::CsrArrays<int, double> c;
+  ppc::core::sparse::Multiply(b, a, c, ppc::core::sparse::KeepAll{}, ppc::util::GetPPCNumChunks(), ppc::util::TbbFor{});
+  c_values = std::move(c.values);
+  c_row_indices = std::move(c.indices);
+  c_col_ptr = std::move(c.offsets);
 }
+
 }  // namespace sorokin_a_multiplication_sparse_matrices_double_ccs_tbb
 
 bool sorokin_a_multiplication_sparse_matrices_double_ccs_tbb::TestTaskTBB::PreProcessingImpl() {
@@ -1,8 +1,5 @@
 #include "tbb/yasakova_t_sparse_matrix_multiplication/include/ops_tbb.hpp"
 
-#include <oneapi/tbb/parallel_for.h>
-#include <tbb/tbb.h>
-
 #include <cmath>
 #include <complex>
 #include <cstddef>
@@ -10,6 +7,10 @@
 #include <utility>
 #include <vector>
 
+#include "core/sparse/include/spgemm.hpp"
+#include "core/util/include/tbb_for.hpp"
+#include "core/util/include/util.hpp"
+
 void yasakova_t_sparse_matrix_multiplication::CompressedRowStorageMatrix::InsertElement(int row, ComplexNumber value,
                                                                                         int col) {
   bool found = false;
@@ -150,34 +151,22 @@ bool yasakova_t_sparse_matrix_multiplication::TestTaskTBB::ValidationImpl() {
 }
 
 bool yasakova_t_sparse_matrix_multiplication::TestTaskTBB::RunImpl() {
-  CompressedRowStorageMatrix expected_result(firstMatrix_.rowCount, secondMatrix_.columnCount);
-
-  std::vector<std::vector<std::pair<int, ComplexNumber>>> local_results(firstMatrix_.rowCount);
-
-  tbb::parallel_for(
-      tbb::blocked_range<unsigned int>(0, firstMatrix_.rowCount), [&](const tbb::blocked_range<unsigned int>& r) {
-        for (unsigned int i = r.begin(); i < r.end(); ++i) {
-          for (unsigned int j = firstMatrix_.rowPointers[i]; j < (unsigned int)firstMatrix_.rowPointers[i + 1]; ++j) {
-            unsigned int col_a = firstMatrix_.columnIndices[j];
-            ComplexNumber value_a = firstMatrix_.nonZeroValues[j];
-            for (unsigned int k = secondMatrix_.rowPointers[col_a];
-                 k < (unsigned int)secondMatrix_.rowPointers[col_a + 1]; ++k) {
-              unsigned int col_b = secondMatrix_.columnIndices[k];
-              ComplexNumber value_b = secondMatrix_.nonZeroValues[k];
-              local_results[i].emplace_back(col_b, value_a * value_b);
-            }
-          }
-        }
-      });
-
-  for (size_t row_index = 0; row_index < local_results.size(); ++row_index) {
-    for (const auto& [col_index, value] : local_results[row_index]) {
-      expected_result.InsertElement(static_cast<int>(row_index), value, col_index);
-    }
-  }
-
-  resultData_ = ConvertMatrixToVector(expected_result);
-
+  // Gustavson product by rows, entries with terms are kept even if they sum to zero
+  const ppc::core::sparse::CsrView<int, ComplexNumber> a{firstMatrix_.rowPointers, firstMatrix_.columnIndices,
+                                                         firstMatrix_.nonZeroValues,
+                                                         static_cast<size_t>(firstMatrix_.columnCount)};
+  const ppc::core::sparse::CsrView<int, ComplexNumber> b{secondMatrix_.rowPointers, secondMatrix_.columnIndices,
+                                                         secondMatrix_.nonZeroValues,
+                                                         static_cast<size_t>(secondMatrix_.columnCount)};
+  ppc::core::sparse::CsrArrays<int, ComplexNumber> product;
+  ppc::core::sparse::Multiply(a, b, product, ppc::core::sparse::KeepAll{}, ppc::util::GetPPCNumChunks(),
+                              ppc::util::TbbFor{});
+
+  CompressedRowStorageMatrix c(firstMatrix_.rowCount, secondMatrix_.columnCount);
+  c.nonZeroValues = std::move(product.values);
+  c.columnIndices = std::move(product.indices);
+  c.rowPointers = std::move(product.offsets);
+  resultData_ = ConvertMatrixToVector(c);
   return true;
 }
 